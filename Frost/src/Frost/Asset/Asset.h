@@ -8,7 +8,7 @@ namespace Frost
 
 	using AssetHandle = UUID;
 
-	class Asset
+	class Asset : public RefCounted
 	{
 	public:
 		AssetHandle Handle = 0;
@@ -14,6 +14,32 @@ namespace Frost
 {
 	HashMap<AssetHandle, Ref<Asset>> AssetManager::s_LoadedAssets;
 
+	static nlohmann::ordered_json SerializeMeshImportSettings(const MeshImportSettings& importSettings)
+	{
+		nlohmann::ordered_json out = nlohmann::ordered_json();
+		out["LODCount"] = importSettings.LODCount;
+		for (const MeshImportSettings::LODLevel& lodLevel : importSettings.LODs)
+			out["LODs"].push_back({ { "IndexRatio", lodLevel.IndexRatio }, { "TargetError", lodLevel.TargetError } });
+		return out;
+	}
+
+	static MeshImportSettings DeserializeMeshImportSettings(const nlohmann::ordered_json& in)
+	{
+		// Missing values keep their defaults
+		MeshImportSettings importSettings;
+		importSettings.LODCount = in.value("LODCount", importSettings.LODCount);
+		if (in.contains("LODs"))
+		{
+			for (uint32_t i = 0; i < std::min<size_t>(in["LODs"].size(), MaxMeshLODCount - 1); i++)
+			{
+				const auto& lodLevel = in["LODs"][i];
+				importSettings.LODs[i].IndexRatio = lodLevel.value("IndexRatio", importSettings.LODs[i].IndexRatio);
+				importSettings.LODs[i].TargetError = lodLevel.value("TargetError", importSettings.LODs[i].TargetError);
+			}
+		}
+		return importSettings;
+	}
+
 	void AssetManager::Init()
 	{
 		AssetImporter::Init();
@@ -99,6 +125,9 @@ namespace Frost
 			if(metadata.Type == AssetType::None)
 				continue;
 
+			if (metadata.Type == AssetType::MeshAsset && asset.contains("ImportSettings"))
+				metadata.MeshImport = DeserializeMeshImportSettings(asset["ImportSettings"]);
+
 			if (!FileSystem::Exists(AssetManager::GetFileSystemPath(metadata)))
 			{
 				// Search the whole project
@@ -110,7 +139,7 @@ namespace Frost
 				continue;
 			}
 
-			s_AssetRegistry[metadata.FilePath] = metadata;
+			s_AssetRegistry.Set(metadata.FilePath, metadata);
 		}
 
 		FROST_CORE_INFO("[AssetManager] Loaded {0} asset entries", s_AssetRegistry.Count());
@@ -123,7 +152,10 @@ namespace Frost
 		{
 			std::string FilePath;
 			AssetType Type;
+			const MeshImportSettings* MeshImport = nullptr; // Only set when it differs from the defaults
 		};
+		const uint64_t defaultMeshImportHash = MeshImportSettings().GetHash();
+
 		std::map<UUID, AssetRegistryEntry> sortedMap;
 		for (auto& [filepath, metadata] : s_AssetRegistry)
 		{
@@ -132,7 +164,8 @@ namespace Frost
 
 			std::string pathToSerialize = metadata.FilePath.string();
 			std::replace(pathToSerialize.begin(), pathToSerialize.end(), '\\', '/');
-			sortedMap[metadata.Handle] = { pathToSerialize, metadata.Type };
+			bool hasMeshImportSettings = metadata.Type == AssetType::MeshAsset && metadata.MeshImport.GetHash() != defaultMeshImportHash;
+			sortedMap[metadata.Handle] = { pathToSerialize, metadata.Type, hasMeshImportSettings ? &metadata.MeshImport : nullptr };
 		}
 
 		FROST_CORE_INFO("[AssetManager] Serializing asset registry with {0} entries", sortedMap.size());
@@ -144,6 +177,8 @@ namespace Frost
 			assetJson["Handle"] = handle.Get();
 			assetJson["FilePath"] = entry.FilePath;
 			assetJson["Type"] = Utils::AssetTypeToString(entry.Type);
+			if (entry.MeshImport)
+				assetJson["ImportSettings"] = SerializeMeshImportSettings(*entry.MeshImport);
 
 			out.push_back(assetJson);
 		}
@@ -168,29 +203,28 @@ namespace Frost
 					result /= file.string();
 			}
 
-			s_AssetRegistry[result] = s_AssetRegistry[relativeFilepath];
-			s_AssetRegistry[result].FilePath = result;
+			s_AssetRegistry.Rename(relativeFilepath, result);
+			const AssetMetadata& metadata = s_AssetRegistry.Get(result);
 
 			// This is optional, and mostly required only for the assets that have a `Name` in their class
-			switch (s_AssetRegistry[result].Type)
+			switch (metadata.Type)
 			{
 				case AssetType::Material:
 				{
-					Ref<MaterialAsset> materialAsset = AssetManager::GetAsset<MaterialAsset>(s_AssetRegistry[result].FilePath.string());
+					Ref<MaterialAsset> materialAsset = AssetManager::GetAsset<MaterialAsset>(metadata.FilePath.string());
 					if (materialAsset)
 						materialAsset->m_MaterialName = result.stem().string();
 					break;
 				}
 				case AssetType::PhysicsMat:
 				{
-					Ref<PhysicsMaterial> phyiscsmatAsset = AssetManager::GetAsset<PhysicsMaterial>(s_AssetRegistry[result].FilePath.string());
+					Ref<PhysicsMaterial> phyiscsmatAsset = AssetManager::GetAsset<PhysicsMaterial>(metadata.FilePath.string());
 					if (phyiscsmatAsset)
 						phyiscsmatAsset->m_MaterialName = result.stem().string();
 					break;
 				}
 			}
 
-			s_AssetRegistry.Remove(relativeFilepath);
 			WriteRegistryToFile();
 		}
 	}
@@ -218,10 +252,7 @@ namespace Frost
 
 				deleteFunction.AddFunction([&, assetFilePath, result]()
 				{
-					s_AssetRegistry[result] = s_AssetRegistry[assetFilePath];
-					s_AssetRegistry[result].FilePath = result;
-
-					s_AssetRegistry.Remove(assetFilePath);
+					s_AssetRegistry.Rename(assetFilePath, result);
 				});
 
 			}
@@ -271,10 +302,7 @@ namespace Frost
 				std::filesystem::path assetFilePath = filepath;
 				deleteFunction.AddFunction([&, assetFilePath, result]()
 				{
-					s_AssetRegistry[result] = s_AssetRegistry[assetFilePath];
-					s_AssetRegistry[result].FilePath = result;
-
-					s_AssetRegistry.Remove(assetFilePath);
+					s_AssetRegistry.Rename(assetFilePath, result);
 				});
 
 			}
@@ -288,13 +316,7 @@ namespace Frost
 		std::filesystem::path relativeOldFilepath = GetRelativePathString(oldFilepath);
 		std::filesystem::path relativeNewFlepath = GetRelativePathString(newFilepath);
 
-		if (s_AssetRegistry.Find(relativeOldFilepath))
-		{
-			s_AssetRegistry[relativeNewFlepath] = s_AssetRegistry[relativeOldFilepath];
-			s_AssetRegistry[relativeNewFlepath].FilePath = relativeNewFlepath;
-
-			s_AssetRegistry.Remove(relativeOldFilepath);
-		}
+		s_AssetRegistry.Rename(relativeOldFilepath, relativeNewFlepath);
 	}
 
 	void AssetManager::OnAssetDeleted(AssetHandle assetHandle)
@@ -310,37 +332,37 @@ namespace Frost
 
 	bool AssetManager::ReloadData(AssetHandle assetHandle)
 	{
-		auto& metadata = GetMetadataInternal(assetHandle);
+		const AssetMetadata& metadata = GetMetadataInternal(assetHandle);
 		if (s_LoadedAssets.find(metadata.Handle) == s_LoadedAssets.end())
 		{
 			FROST_CORE_WARN("Trying to reload asset that was never loaded");
 
 			Ref<Asset> asset;
-			metadata.IsDataLoaded = AssetImporter::TryLoadData(metadata, asset, nullptr);
-			return metadata.IsDataLoaded;
+			bool isDataLoaded = AssetImporter::TryLoadData(metadata, asset, nullptr);
+			s_AssetRegistry.SetDataLoaded(assetHandle, isDataLoaded);
+			return isDataLoaded;
 		}
 
 		FROST_ASSERT_INTERNAL(bool(s_LoadedAssets.find(assetHandle) != s_LoadedAssets.end()));
-		metadata.IsDataLoaded = s_LoadedAssets[assetHandle]->ReloadData(metadata.FilePath.string());
+		bool isDataLoaded = s_LoadedAssets[assetHandle]->ReloadData(metadata.FilePath.string());
+		s_AssetRegistry.SetDataLoaded(assetHandle, isDataLoaded);
 
-		return metadata.IsDataLoaded;
+		return isDataLoaded;
 	}
 
 	static AssetMetadata s_NullMetadata;
-	AssetMetadata& AssetManager::GetMetadataInternal(AssetHandle handle)
+	const AssetMetadata& AssetManager::GetMetadataInternal(AssetHandle handle)
 	{
-		for (auto& [filepath, metadata] : s_AssetRegistry)
-		{
-			if (metadata.Handle == handle)
-				return metadata;
-		}
+		const AssetMetadata* metadata = s_AssetRegistry.Get(handle);
+		if (metadata)
+			return *metadata;
 
 		return s_NullMetadata;
 	}
 
 	const AssetMetadata& AssetManager::GetMetadata(AssetHandle handle)
 	{
-		if (handle.Get() == 0) return AssetMetadata();
+		if (handle.Get() == 0) return s_NullMetadata;
 
 		return GetMetadataInternal(handle);
 	}
@@ -348,14 +370,14 @@ namespace Frost
 	const Frost::AssetMetadata& AssetManager::GetMetadata(const std::filesystem::path& filepath)
 	{
 		if (s_AssetRegistry.Contains(filepath))
-			return s_AssetRegistry[filepath];
+			return s_AssetRegistry.Get(filepath);
 
 		return s_NullMetadata;
 	}
 
 	AssetHandle AssetManager::GetAssetHandleFromFilePath(const std::filesystem::path& filepath)
 	{
-		return s_AssetRegistry.Contains(filepath) ? s_AssetRegistry[filepath].Handle : 0;
+		return s_AssetRegistry.Contains(filepath) ? s_AssetRegistry.Get(filepath).Handle : 0;
 	}
 
 	std::filesystem::path AssetManager::GetRelativePath(const std::filesystem::path& filepath)
@@ -33,6 +33,20 @@ namespace Frost
 		static bool IsAssetLoaded(AssetHandle handle) { return s_LoadedAssets.find(handle) != s_LoadedAssets.end(); }
 
 
+		// Fast path, which doesn't go through the file path at all
+		template<typename T>
+		static Ref<T> GetAsset(AssetHandle assetHandle)
+		{
+			if (!std::is_base_of<Asset, T>::value)
+				FROST_ASSERT_INTERNAL("GetAsset only works for types derived from Asset");
+
+			auto it = s_LoadedAssets.find(assetHandle);
+			if (it != s_LoadedAssets.end())
+				return it->second.As<T>();
+
+			return nullptr;
+		}
+
 		template<typename T>
 		static Ref<T> GetAsset(const std::string& filepath)
 		{
@@ -79,7 +93,7 @@ namespace Frost
 
 			asset->Handle = metadata.Handle;
 			s_LoadedAssets[asset->Handle] = asset;
-			s_AssetRegistry[metadata.FilePath.string()] = metadata;
+			s_AssetRegistry.Set(metadata.FilePath, metadata);
 
 
 			if (!s_AssetRegistry.Find(metadata.FilePath))
@@ -138,7 +152,7 @@ namespace Frost
 
 			asset->Handle = metadata.Handle;
 			s_LoadedAssets[asset->Handle] = asset;
-			s_AssetRegistry[metadata.FilePath.string()] = metadata;
+			s_AssetRegistry.Set(metadata.FilePath, metadata);
 
 			//if (!s_AssetRegistry.Find(metadata.FilePath))
 			{
@@ -231,7 +245,7 @@ namespace Frost
 		static void LoadAssetRegistry();
 		static void WriteRegistryToFile();
 
-		static AssetMetadata& GetMetadataInternal(AssetHandle handle);
+		static const AssetMetadata& GetMetadataInternal(AssetHandle handle);
 
 	private:
 		static HashMap<AssetHandle, Ref<Asset>> s_LoadedAssets;
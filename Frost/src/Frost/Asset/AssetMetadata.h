@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Frost/Asset/Asset.h"
+#include "Frost/Renderer/MeshImportSettings.h"
 
 #include <filesystem>
 
@@ -14,6 +15,9 @@ namespace Frost
 		std::filesystem::path FilePath;
 		bool IsDataLoaded = false;
 
+		// Only used by mesh assets (written into the asset registry when they differ from the defaults)
+		MeshImportSettings MeshImport;
+
 		bool IsValid() const { return Handle != 0; }
 	};
 
@@ -22,20 +22,67 @@ namespace Frost
 		return key;
 	}
 
-	AssetMetadata& AssetRegistry::operator[](const std::filesystem::path& path)
+	const AssetMetadata& AssetRegistry::Get(const std::filesystem::path& path) const
 	{
 		auto key = GetKey(path);
+		FROST_ASSERT_INTERNAL(bool(m_AssetRegistry.find(key) != m_AssetRegistry.end()));
 		FROST_ASSERT_INTERNAL(!path.string().empty());
-		return m_AssetRegistry[key];
+		return m_AssetRegistry.at(key);
+
 	}
 
-	const AssetMetadata& AssetRegistry::Get(const std::filesystem::path& path) const
+	const AssetMetadata* AssetRegistry::Get(AssetHandle handle) const
+	{
+		auto it = m_HandleIndex.find(handle);
+		if (it == m_HandleIndex.end())
+			return nullptr;
+
+		return it->second;
+	}
+
+	void AssetRegistry::Set(const std::filesystem::path& path, const AssetMetadata& metadata)
 	{
 		auto key = GetKey(path);
-		FROST_ASSERT_INTERNAL(bool(m_AssetRegistry.find(key) != m_AssetRegistry.end()));
 		FROST_ASSERT_INTERNAL(!path.string().empty());
-		return m_AssetRegistry.at(key);
 
+		AssetMetadata& entry = m_AssetRegistry[key];
+		if (entry.Handle != metadata.Handle)
+			RemoveFromHandleIndex(entry);
+
+		entry = metadata;
+		if (entry.Handle != 0)
+			m_HandleIndex[entry.Handle] = &entry;
+	}
+
+	bool AssetRegistry::Rename(const std::filesystem::path& oldPath, const std::filesystem::path& newPath)
+	{
+		auto it = m_AssetRegistry.find(GetKey(oldPath));
+		if (it == m_AssetRegistry.end())
+			return false;
+
+		AssetMetadata metadata = it->second;
+		metadata.FilePath = newPath;
+
+		RemoveFromHandleIndex(it->second);
+		m_AssetRegistry.erase(it);
+
+		Set(newPath, metadata);
+		return true;
+	}
+
+	void AssetRegistry::SetDataLoaded(AssetHandle handle, bool isDataLoaded)
+	{
+		auto it = m_HandleIndex.find(handle);
+		if (it != m_HandleIndex.end())
+			it->second->IsDataLoaded = isDataLoaded;
+	}
+
+	void AssetRegistry::RemoveFromHandleIndex(const AssetMetadata& metadata)
+	{
+		// Only drop the index entry if it points to this metadata (the same handle could have been copied to another path)
+		auto it = m_HandleIndex.find(metadata.Handle);
+		if (it != m_HandleIndex.end() && it->second == &metadata)
+			m_HandleIndex.erase(it);
 	}
 
 	bool AssetRegistry::Contains(const std::filesystem::path& path) const
@@ -47,12 +94,20 @@ namespace Frost
 	size_t AssetRegistry::Remove(const std::filesystem::path& path)
 	{
 		auto key = GetKey(path);
-		return m_AssetRegistry.erase(key);
+
+		auto it = m_AssetRegistry.find(key);
+		if (it == m_AssetRegistry.end())
+			return 0;
+
+		RemoveFromHandleIndex(it->second);
+		m_AssetRegistry.erase(it);
+		return 1;
 	}
 
 	void AssetRegistry::Clear()
 	{
 		m_AssetRegistry.clear();
+		m_HandleIndex.clear();
 	}
 
 }
\ No newline at end of file
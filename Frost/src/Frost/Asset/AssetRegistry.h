@@ -11,9 +11,19 @@ namespace Frost
 	class AssetRegistry
 	{
 	public:
-		AssetMetadata& operator[](const std::filesystem::path& path);
 		const AssetMetadata& Get(const std::filesystem::path& path) const;
 
+		// O(1) lookup by handle (returns nullptr if the handle is not registered)
+		const AssetMetadata* Get(AssetHandle handle) const;
+
+		// Inserts or overwrites the entry of `path`
+		void Set(const std::filesystem::path& path, const AssetMetadata& metadata);
+
+		// Moves the entry of `oldPath` to `newPath` (also updating its `FilePath`). Returns false if `oldPath` is not registered
+		bool Rename(const std::filesystem::path& oldPath, const std::filesystem::path& newPath);
+
+		void SetDataLoaded(AssetHandle handle, bool isDataLoaded);
+
 		size_t Count() const { return m_AssetRegistry.size(); }
 
 		bool Contains(const std::filesystem::path& path) const;
@@ -23,16 +33,22 @@ namespace Frost
 		// true - found // false - not found
 		bool Find(const std::filesystem::path& path) const { return m_AssetRegistry.find(path) != m_AssetRegistry.end(); }
 
-		// Iterators
-		HashMap<std::filesystem::path, AssetMetadata>::iterator begin() { return m_AssetRegistry.begin(); }
-		HashMap<std::filesystem::path, AssetMetadata>::iterator end() { return m_AssetRegistry.end(); }
+		// Iterators (read only, entries are modified through `Set`/`Rename`, so the handle index stays in sync)
+		HashMap<std::filesystem::path, AssetMetadata>::const_iterator begin() const { return m_AssetRegistry.cbegin(); }
+		HashMap<std::filesystem::path, AssetMetadata>::const_iterator end() const { return m_AssetRegistry.cend(); }
 
 		// Const Iterators
 		HashMap<std::filesystem::path, AssetMetadata>::const_iterator cbegin() const { return m_AssetRegistry.cbegin(); }
 		HashMap<std::filesystem::path, AssetMetadata>::const_iterator cend() const { return m_AssetRegistry.cend(); }
 
+	private:
+		void RemoveFromHandleIndex(const AssetMetadata& metadata);
 	private:
 		HashMap<std::filesystem::path, AssetMetadata> m_AssetRegistry;
+
+		// Secondary index (handle -> metadata), updated by every insertion/removal.
+		// NOTE: Pointers to the elements of the `HashMap` stay valid when it rehashes, only erasing invalidates them.
+		HashMap<AssetHandle, AssetMetadata*> m_HandleIndex;
 	};
 
 }
\ No newline at end of file
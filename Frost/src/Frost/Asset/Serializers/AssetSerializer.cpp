@@ -18,7 +18,7 @@ namespace Frost
 	bool MeshAssetSeralizer::TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset, void* pNext) const
 	{
 		std::string filepath = AssetManager::GetFileSystemPathString(metadata);
-		asset = MeshAsset::Load(filepath).As<Asset>();
+		asset = MeshAsset::Load(filepath, {}, metadata.MeshImport).As<Asset>();
 
 		if (asset.As<MeshAsset>()->IsLoaded())
 		{
@@ -2,6 +2,8 @@
 #include "Application.h"
 
 #include "Frost/Utils/Timer.h"
+#include "Frost/Core/FrameAllocator.h"
+#include "Frost/Core/JobSystem.h"
 
 #include "Frost/Renderer/Renderer.h"
 #include "Frost/Physics/PhysicsEngine.h"
@@ -41,6 +43,8 @@ namespace Frost
 		Project::SetActive(project);
 		Application::Get().GetWindow().SetWindowProjectName(Project::GetProjectName());
 
+		JobSystem::Init();
+		FrameAllocator::Init(Renderer::GetRendererConfig().FramesInFlight, Renderer::GetRendererConfig().FrameAllocatorSize);
 		Renderer::Init();
 		PhysicsEngine::Initialize();
 		ScriptEngine::Init("Resources/Scripts/FrostScriptCore.dll");
@@ -56,12 +60,17 @@ namespace Frost
 		ScriptEngine::ShutDown();
 		PhysicsEngine::ShutDown();
 		Renderer::ShutDown();
+		FrameAllocator::ShutDown();
+		JobSystem::ShutDown();
 	}
 
 	void Application::Run()
 	{
 		while (m_Running)
 		{
+			// Recycle the transient memory of the oldest frame in flight
+			FrameAllocator::BeginFrame();
+
 			// Poll Events
 			m_Window->OnUpdate();
 
@@ -155,4 +164,4 @@ namespace Frost
 		layer->OnAttach();
 	}
 
-}
\ No newline at end of file
+}
\ No newline at end of file
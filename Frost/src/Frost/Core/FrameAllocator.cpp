@@ -0,0 +1,150 @@
+#include "frostpch.h"
+#include "FrameAllocator.h"
+
+#include "Frost/Math/Alignment.h"
+
+namespace Frost
+{
+	////////////////////////////////////////////////////
+	// 	   LINEAR ALLOCATOR
+	////////////////////////////////////////////////////
+
+	LinearAllocator::~LinearAllocator()
+	{
+		ShutDown();
+	}
+
+	void LinearAllocator::Init(uint64_t chunkSize)
+	{
+		m_ChunkSize = chunkSize;
+		AllocateChunk(chunkSize);
+	}
+
+	void LinearAllocator::ShutDown()
+	{
+		for (auto& chunk : m_Chunks)
+			delete[] chunk.Data;
+
+		m_Chunks.clear();
+		m_UsedSize = 0;
+		m_AllocationCount = 0;
+	}
+
+	void LinearAllocator::AllocateChunk(uint64_t size)
+	{
+		Chunk& chunk = m_Chunks.emplace_back();
+		chunk.Data = new Byte[size];
+		chunk.Size = size;
+		chunk.Offset = 0;
+	}
+
+	void* LinearAllocator::Allocate(uint64_t size, uint64_t alignment)
+	{
+		FROST_ASSERT_INTERNAL(bool(alignment != 0 && (alignment & (alignment - 1)) == 0));
+
+		if (m_Chunks.empty())
+			AllocateChunk(std::max(m_ChunkSize, size + alignment));
+
+		Chunk* chunk = &m_Chunks.back();
+
+		// Align the address (not the offset), since `new Byte[]` only guarantees the alignment of `max_align_t`
+		uintptr_t base = reinterpret_cast<uintptr_t>(chunk->Data);
+		uint64_t alignedOffset = Math::AlignUp(base + chunk->Offset, alignment) - base;
+
+		if (alignedOffset + size > chunk->Size)
+		{
+			// The current chunk is full, so request a new one from the heap (it will be merged on the next `Reset`)
+			AllocateChunk(std::max(m_ChunkSize, size + alignment));
+			chunk = &m_Chunks.back();
+
+			base = reinterpret_cast<uintptr_t>(chunk->Data);
+			alignedOffset = Math::AlignUp(base, alignment) - base;
+		}
+
+		m_UsedSize += (alignedOffset - chunk->Offset) + size;
+		m_AllocationCount++;
+
+		chunk->Offset = alignedOffset + size;
+		return chunk->Data + alignedOffset;
+	}
+
+	void LinearAllocator::Reset()
+	{
+		if (m_Chunks.size() > 1)
+		{
+			// Merge all the chunks into a single one, so the same usage fits into one chunk next time
+			uint64_t capacity = GetCapacity();
+			ShutDown();
+
+			m_ChunkSize = capacity;
+			AllocateChunk(capacity);
+		}
+		else if (!m_Chunks.empty())
+		{
+			m_Chunks[0].Offset = 0;
+		}
+
+		m_UsedSize = 0;
+		m_AllocationCount = 0;
+	}
+
+	uint64_t LinearAllocator::GetCapacity() const
+	{
+		uint64_t capacity = 0;
+		for (auto& chunk : m_Chunks)
+			capacity += chunk.Size;
+		return capacity;
+	}
+
+
+
+	////////////////////////////////////////////////////
+	// 	   FRAME ALLOCATOR
+	////////////////////////////////////////////////////
+
+	Vector<LinearAllocator> FrameAllocator::s_Arenas;
+	uint32_t FrameAllocator::s_CurrentArena = 0;
+	FrameAllocator::Stats FrameAllocator::s_Stats;
+
+	void FrameAllocator::Init(uint32_t framesInFlight, uint64_t arenaSize)
+	{
+		s_Arenas = Vector<LinearAllocator>(framesInFlight);
+		for (auto& arena : s_Arenas)
+			arena.Init(arenaSize);
+
+		s_CurrentArena = 0;
+		s_Stats = {};
+	}
+
+	void FrameAllocator::ShutDown()
+	{
+		s_Arenas.clear();
+	}
+
+	void FrameAllocator::BeginFrame()
+	{
+		if (s_Arenas.empty()) return;
+
+		// Collect the statistics of the frame that just finished
+		LinearAllocator& lastArena = s_Arenas[s_CurrentArena];
+		s_Stats.UsedBytes = lastArena.GetUsedSize();
+		s_Stats.AllocationCount = lastArena.GetAllocationCount();
+		s_Stats.Capacity = lastArena.GetCapacity();
+		s_Stats.HighWaterMark = std::max(s_Stats.HighWaterMark, s_Stats.UsedBytes);
+
+		// The arena of the next frame was last used `FramesInFlight` frames ago, so its memory is no longer referenced
+		s_CurrentArena = (s_CurrentArena + 1) % static_cast<uint32_t>(s_Arenas.size());
+
+		LinearAllocator& arena = s_Arenas[s_CurrentArena];
+		if (arena.GetChunkCount() > 1)
+			s_Stats.HeapGrowths++;
+		arena.Reset();
+	}
+
+	void* FrameAllocator::Allocate(uint64_t size, uint64_t alignment)
+	{
+		FROST_ASSERT(bool(!s_Arenas.empty()), "Frame allocator was not initialized!");
+		return s_Arenas[s_CurrentArena].Allocate(size, alignment);
+	}
+
+}
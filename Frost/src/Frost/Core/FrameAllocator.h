@@ -0,0 +1,121 @@
+#pragma once
+
+namespace Frost
+{
+	// Bump allocator which hands out memory from big chunks and frees everything at once on `Reset`
+	class LinearAllocator
+	{
+	public:
+		LinearAllocator() = default;
+		LinearAllocator(const LinearAllocator&) = delete;
+		LinearAllocator& operator=(const LinearAllocator&) = delete;
+		~LinearAllocator();
+
+		void Init(uint64_t chunkSize);
+		void ShutDown();
+
+		void* Allocate(uint64_t size, uint64_t alignment);
+
+		// Rewinds the allocator. If the last usage overflowed into extra chunks,
+		// they are merged into a single chunk big enough for the whole usage, so the next frames won't hit the heap again
+		void Reset();
+
+		uint64_t GetUsedSize() const { return m_UsedSize; }
+		uint64_t GetCapacity() const;
+		uint32_t GetAllocationCount() const { return m_AllocationCount; }
+		uint32_t GetChunkCount() const { return static_cast<uint32_t>(m_Chunks.size()); }
+	private:
+		struct Chunk
+		{
+			Byte* Data = nullptr;
+			uint64_t Size = 0;
+			uint64_t Offset = 0;
+		};
+		void AllocateChunk(uint64_t size);
+	private:
+		Vector<Chunk> m_Chunks;
+		uint64_t m_ChunkSize = 0;
+		uint64_t m_UsedSize = 0;
+		uint32_t m_AllocationCount = 0;
+	};
+
+	// Transient memory for data that only lives for one frame (render queues, grouped mesh lists, etc).
+	// There is one `LinearAllocator` per frame in flight and the current one is rewinded in `BeginFrame` (at the top of `Application::Run`).
+	// NOTE: Memory returned by the frame allocator (and the frame containers below) must not be used after the frame it was allocated in.
+	// NOTE: The frame allocator is not thread safe, jobs running on the `JobSystem` workers must not allocate from it.
+	class FrameAllocator
+	{
+	public:
+		struct Stats
+		{
+			uint64_t UsedBytes = 0;        // Bytes used in the last finished frame
+			uint32_t AllocationCount = 0;  // Allocations done in the last finished frame
+			uint64_t HighWaterMark = 0;    // Biggest usage of a frame since startup
+			uint64_t Capacity = 0;         // Capacity of the arena used in the last finished frame
+			uint32_t HeapGrowths = 0;      // How many times an arena had to request more memory from the heap (should stay constant in steady state)
+		};
+
+		static void Init(uint32_t framesInFlight, uint64_t arenaSize);
+		static void ShutDown();
+
+		static void BeginFrame();
+
+		static void* Allocate(uint64_t size, uint64_t alignment = alignof(std::max_align_t));
+
+		template<typename T>
+		static T* AllocateArray(uint64_t count)
+		{
+			return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+		}
+
+		// Objects created with `New` are never destructed, the memory is simply recycled after the frames in flight have passed.
+		// Use it only for objects whose memory is owned entirely by the frame allocator (for example frame containers)
+		template<typename T, typename... Args>
+		static T* New(Args&&... args)
+		{
+			return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		static const Stats& GetStats() { return s_Stats; }
+		static uint32_t GetCurrentArenaIndex() { return s_CurrentArena; }
+	private:
+		static Vector<LinearAllocator> s_Arenas;
+		static uint32_t s_CurrentArena;
+		static Stats s_Stats;
+	};
+
+	// STL compatible adapter for the `FrameAllocator`
+	template<typename T>
+	class FrameAllocatorAdapter
+	{
+	public:
+		using value_type = T;
+
+		FrameAllocatorAdapter() noexcept = default;
+
+		template<typename U>
+		FrameAllocatorAdapter(const FrameAllocatorAdapter<U>&) noexcept {}
+
+		T* allocate(std::size_t count)
+		{
+			return FrameAllocator::AllocateArray<T>(count);
+		}
+
+		void deallocate(T* pointer, std::size_t count) noexcept
+		{
+			// Memory is released all at once when the frame arena is reset
+		}
+
+		template<typename U>
+		bool operator==(const FrameAllocatorAdapter<U>&) const noexcept { return true; }
+
+		template<typename U>
+		bool operator!=(const FrameAllocatorAdapter<U>&) const noexcept { return false; }
+	};
+
+	template<typename T>
+	using FrameVector = std::vector<T, FrameAllocatorAdapter<T>>;
+
+	template<typename T1, typename T2>
+	using FrameHashMap = std::unordered_map<T1, T2, std::hash<T1>, std::equal_to<T1>, FrameAllocatorAdapter<std::pair<const T1, T2>>>;
+}
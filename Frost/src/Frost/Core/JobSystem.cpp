@@ -0,0 +1,246 @@
+#include "frostpch.h"
+#include "JobSystem.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace Frost
+{
+	struct Job
+	{
+		JobFunction Function;
+		JobCounter* Counter = nullptr;
+		const JobCounter* Dependency = nullptr;
+	};
+
+	// Every thread pushes/pops at the back of its own deque, while the other threads steal from the front
+	struct JobQueue
+	{
+		std::deque<Job> Jobs;
+		std::mutex Mutex;
+	};
+
+	struct JobSystemData
+	{
+		// Index 0 is shared by the main thread (and any other non-worker thread), then one queue per worker
+		Vector<Scope<JobQueue>> Queues;
+		Vector<std::thread> Workers;
+
+		std::atomic<bool> Running = false;
+		std::atomic<uint32_t> PendingJobs = 0;
+
+		// Used to put the workers to sleep when there is nothing to do
+		std::mutex WakeMutex;
+		std::condition_variable WakeCondition;
+	};
+
+	static JobSystemData* s_Data = nullptr;
+	static thread_local uint32_t t_ThreadIndex = 0;
+
+	static void PushJob(uint32_t queueIndex, Job&& job, bool pushFront = false)
+	{
+		JobQueue& queue = *s_Data->Queues[queueIndex];
+		{
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+			if (pushFront)
+				queue.Jobs.push_front(std::move(job));
+			else
+				queue.Jobs.push_back(std::move(job));
+		}
+		s_Data->PendingJobs.fetch_add(1, std::memory_order_release);
+
+		// Taking the lock (even empty) makes sure that a worker can't miss the notification while going to sleep
+		{ std::scoped_lock<std::mutex> lock(s_Data->WakeMutex); }
+		s_Data->WakeCondition.notify_one();
+	}
+
+	static bool PopJob(uint32_t threadIndex, Job& outJob)
+	{
+		uint32_t queueCount = static_cast<uint32_t>(s_Data->Queues.size());
+
+		// Try the own queue first (newest job, its data is most likely still in cache)
+		{
+			JobQueue& queue = *s_Data->Queues[threadIndex];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+			if (!queue.Jobs.empty())
+			{
+				outJob = std::move(queue.Jobs.back());
+				queue.Jobs.pop_back();
+				return true;
+			}
+		}
+
+		// Then steal the oldest job from the other queues
+		for (uint32_t i = 1; i < queueCount; i++)
+		{
+			JobQueue& queue = *s_Data->Queues[(threadIndex + i) % queueCount];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+			if (!queue.Jobs.empty())
+			{
+				outJob = std::move(queue.Jobs.front());
+				queue.Jobs.pop_front();
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool JobSystem::TryExecuteJob(uint32_t threadIndex)
+	{
+		Job job;
+		if (!PopJob(threadIndex, job))
+			return false;
+
+		s_Data->PendingJobs.fetch_sub(1, std::memory_order_relaxed);
+
+		if (job.Dependency && !job.Dependency->IsDone())
+		{
+			// Not ready yet, so put it back at the front of the queue (other jobs will be executed first)
+			PushJob(threadIndex, std::move(job), true);
+			return false;
+		}
+
+		job.Function();
+
+		if (job.Counter)
+			job.Counter->m_Value.fetch_sub(1, std::memory_order_acq_rel);
+
+		return true;
+	}
+
+	void JobSystem::WorkerThread(uint32_t threadIndex)
+	{
+		t_ThreadIndex = threadIndex;
+
+		while (s_Data->Running.load(std::memory_order_acquire))
+		{
+			if (TryExecuteJob(threadIndex))
+				continue;
+
+			// Only sleep if there is no job left at all, otherwise just give the other threads a chance (dependencies might be running)
+			if (s_Data->PendingJobs.load(std::memory_order_acquire) > 0)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(s_Data->WakeMutex);
+			s_Data->WakeCondition.wait(lock, []()
+			{
+				return s_Data->PendingJobs.load(std::memory_order_acquire) > 0 || !s_Data->Running.load(std::memory_order_acquire);
+			});
+		}
+	}
+
+	void JobSystem::Init(uint32_t workerCount)
+	{
+		FROST_ASSERT(bool(!s_Data), "Job system was already initialized!");
+
+		if (workerCount == HardwareWorkerCount)
+		{
+			// Keep one hardware thread for the main thread (which also helps while waiting)
+			uint32_t hardwareThreads = std::thread::hardware_concurrency();
+			workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+		}
+
+		s_Data = new JobSystemData();
+		s_Data->Running = true;
+
+		for (uint32_t i = 0; i < workerCount + 1; i++)
+			s_Data->Queues.push_back(CreateScope<JobQueue>());
+
+		t_ThreadIndex = 0;
+		for (uint32_t i = 1; i <= workerCount; i++)
+			s_Data->Workers.emplace_back(WorkerThread, i);
+
+		FROST_CORE_INFO("Job system initialized with {0} worker threads", workerCount);
+	}
+
+	void JobSystem::ShutDown()
+	{
+		if (!s_Data) return;
+
+		// Finish the jobs which are still pending
+		while (s_Data->PendingJobs.load(std::memory_order_acquire) > 0)
+		{
+			if (!TryExecuteJob(0))
+				std::this_thread::yield();
+		}
+
+		{
+			std::scoped_lock<std::mutex> lock(s_Data->WakeMutex);
+			s_Data->Running = false;
+		}
+		s_Data->WakeCondition.notify_all();
+
+		for (auto& worker : s_Data->Workers)
+			worker.join();
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	void JobSystem::Execute(JobFunction job, JobCounter* counter, const JobCounter* dependency)
+	{
+		// Without worker threads (before `Init` or after `ShutDown`) the jobs are executed right away
+		if (!s_Data)
+		{
+			FROST_ASSERT(bool(!dependency || dependency->IsDone()), "Job dependency can't be satisfied without the job system running!");
+			job();
+			return;
+		}
+
+		if (counter)
+			counter->m_Value.fetch_add(1, std::memory_order_relaxed);
+
+		Job newJob;
+		newJob.Function = std::move(job);
+		newJob.Counter = counter;
+		newJob.Dependency = dependency;
+
+		// Threads which are not workers all share the queue 0
+		uint32_t queueIndex = t_ThreadIndex < s_Data->Queues.size() ? t_ThreadIndex : 0;
+		PushJob(queueIndex, std::move(newJob));
+	}
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		if (!s_Data)
+		{
+			FROST_ASSERT(bool(counter.IsDone()), "Waiting on a job counter which can never finish!");
+			return;
+		}
+
+		// Instead of blocking, help the workers until the counter reaches 0
+		while (!counter.IsDone())
+		{
+			if (!TryExecuteJob(t_ThreadIndex))
+				std::this_thread::yield();
+		}
+	}
+
+	bool JobSystem::IsInitialized()
+	{
+		return s_Data != nullptr;
+	}
+
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		return s_Data ? static_cast<uint32_t>(s_Data->Workers.size()) : 0;
+	}
+
+	uint32_t JobSystem::GetThreadIndex()
+	{
+		return t_ThreadIndex;
+	}
+
+	uint32_t JobSystem::GetDefaultBatchSize(uint32_t count)
+	{
+		// Around 4 batches per thread, so stealing can balance uneven work
+		uint32_t batchCount = (GetWorkerCount() + 1) * 4;
+		return std::max<uint32_t>(1, (count + batchCount - 1) / batchCount);
+	}
+}
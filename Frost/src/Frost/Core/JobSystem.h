@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+
+namespace Frost
+{
+	// Counts the jobs which are still running. Jobs increment it when submitted and decrement it when they finish
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		bool IsDone() const { return m_Value.load(std::memory_order_acquire) == 0; }
+		uint32_t GetValue() const { return m_Value.load(std::memory_order_acquire); }
+	private:
+		std::atomic<uint32_t> m_Value = 0;
+
+		friend class JobSystem;
+	};
+
+	using JobFunction = std::function<void()>;
+
+	// Engine-wide pool of worker threads (one per hardware thread, minus the main thread).
+	// Every thread owns a deque of jobs, it takes work from the back of its own deque and steals from the front of the others.
+	class JobSystem
+	{
+	public:
+		// Sizes the pool to the hardware by default. With `workerCount == 0` the jobs are only executed by the threads waiting on them
+		static constexpr uint32_t HardwareWorkerCount = UINT32_MAX;
+		static void Init(uint32_t workerCount = HardwareWorkerCount);
+		static void ShutDown();
+
+		// Submits a job. `counter` (optional) is incremented now and decremented once the job has finished.
+		// If a `dependency` is given, the job won't start until that counter reaches 0
+		static void Execute(JobFunction job, JobCounter* counter = nullptr, const JobCounter* dependency = nullptr);
+
+		// Calls `func(index)` for every index in [0, count), split into batches of `batchSize` indices (0 = pick a batch size automatically).
+		// The async version signals `counter`, while the other one blocks (and helps) until all the batches are done
+		template<typename Func>
+		static void ParallelFor(uint32_t count, Func&& func, uint32_t batchSize = 0)
+		{
+			JobCounter counter;
+			ParallelForAsync(count, func, counter, batchSize);
+			Wait(counter);
+		}
+
+		template<typename Func>
+		static void ParallelForAsync(uint32_t count, const Func& func, JobCounter& counter, uint32_t batchSize = 0, const JobCounter* dependency = nullptr)
+		{
+			if (count == 0) return;
+
+			if (batchSize == 0)
+				batchSize = GetDefaultBatchSize(count);
+
+			// NOTE: `func` is captured by value, so it must be cheap to copy (capture big data by reference)
+			for (uint32_t start = 0; start < count; start += batchSize)
+			{
+				uint32_t end = std::min(start + batchSize, count);
+				Execute([func, start, end]()
+				{
+					for (uint32_t i = start; i < end; i++)
+						func(i);
+				}, &counter, dependency);
+			}
+		}
+
+		// Waits until the counter reaches 0. The calling thread executes pending jobs in the meantime, instead of sleeping
+		static void Wait(const JobCounter& counter);
+
+		static bool IsInitialized();
+		static uint32_t GetWorkerCount();
+
+		// 0 for the main thread (and every non-worker thread), [1, WorkerCount] for the worker threads
+		static uint32_t GetThreadIndex();
+	private:
+		static uint32_t GetDefaultBatchSize(uint32_t count);
+
+		// Returns false if there was no job ready to be executed
+		static bool TryExecuteJob(uint32_t threadIndex);
+		static void WorkerThread(uint32_t threadIndex);
+	};
+}
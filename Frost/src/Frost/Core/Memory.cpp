@@ -1,31 +1,67 @@
 #include "frostpch.h"
 
+#include <mutex>
+
 namespace Frost
 {
-	static std::unordered_set<void*> s_LiveReferences;
-	static std::mutex s_LiveReferenceMutex;
+#ifdef FROST_TRACK_LIVE_REFERENCES
+	// The registry is split into shards (selected by the instance address), so objects being created/destroyed
+	// on different threads rarely contend on the same mutex
+	static constexpr uint32_t s_LiveReferenceShardCount = 32;
+
+	struct LiveReferenceShard
+	{
+		std::mutex Mutex;
+		std::unordered_set<void*> References;
+	};
+
+	static LiveReferenceShard& GetLiveReferenceShard(void* instance)
+	{
+		// Function-local static, so refs created during static initialization are still tracked correctly
+		static std::array<LiveReferenceShard, s_LiveReferenceShardCount> s_LiveReferenceShards;
+
+		// Discard the lower bits, since heap allocations are at least 16 byte aligned
+		uintptr_t address = reinterpret_cast<uintptr_t>(instance);
+		return s_LiveReferenceShards[(address >> 4) % s_LiveReferenceShardCount];
+	}
+#endif
 
 	namespace RefUtils {
 
 		void AddToLiveReferences(void* instance)
 		{
-			std::scoped_lock<std::mutex> lock(s_LiveReferenceMutex);
+#ifdef FROST_TRACK_LIVE_REFERENCES
 			FROST_ASSERT_INTERNAL(instance);
-			s_LiveReferences.insert(instance);
+			LiveReferenceShard& shard = GetLiveReferenceShard(instance);
+
+			std::scoped_lock<std::mutex> lock(shard.Mutex);
+			shard.References.insert(instance);
+#endif
 		}
 
 		void RemoveFromLiveReferences(void* instance)
 		{
-			std::scoped_lock<std::mutex> lock(s_LiveReferenceMutex);
+#ifdef FROST_TRACK_LIVE_REFERENCES
 			FROST_ASSERT_INTERNAL(instance);
-			FROST_ASSERT_INTERNAL(bool(s_LiveReferences.find(instance) != s_LiveReferences.end()));
-			s_LiveReferences.erase(instance);
+			LiveReferenceShard& shard = GetLiveReferenceShard(instance);
+
+			std::scoped_lock<std::mutex> lock(shard.Mutex);
+			FROST_ASSERT_INTERNAL(bool(shard.References.find(instance) != shard.References.end()));
+			shard.References.erase(instance);
+#endif
 		}
 
 		bool IsLive(void* instance)
 		{
+#ifdef FROST_TRACK_LIVE_REFERENCES
 			FROST_ASSERT_INTERNAL(instance);
-			return s_LiveReferences.find(instance) != s_LiveReferences.end();
+			LiveReferenceShard& shard = GetLiveReferenceShard(instance);
+
+			std::scoped_lock<std::mutex> lock(shard.Mutex);
+			return shard.References.find(instance) != shard.References.end();
+#else
+			return instance != nullptr;
+#endif
 		}
 	}
 }
\ No newline at end of file
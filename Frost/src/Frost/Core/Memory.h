@@ -1,5 +1,16 @@
 #pragma once
 
+#include <atomic>
+#include <thread>
+#include <type_traits>
+
+// The live reference registry is a debug-only diagnostic (it asserts on double deletes and can be queried with `RefUtils::IsLive`).
+// It is only touched when an object is created or destroyed (never on copies), and can also be compiled out of debug builds
+// by defining FROST_DISABLE_LIVE_REFERENCES. `WeakRef` does not depend on it
+#if defined(FROST_DEBUG) && !defined(FROST_DISABLE_LIVE_REFERENCES)
+	#define FROST_TRACK_LIVE_REFERENCES
+#endif
+
 namespace Frost
 {
 	namespace RefUtils
@@ -9,6 +20,79 @@ namespace Frost
 		bool IsLive(void* instance);
 	}
 
+	// Shared by every `WeakRef` of an instance. Created by the first `WeakRef`, so instances which are never weakly referenced don't pay for it.
+	// The instance's `RefCounter` holds one reference to it until the instance is destroyed, so it outlives the instance as long as weak refs exist
+	struct WeakRefControl
+	{
+		std::atomic<uint32_t> Count = 1;
+		std::atomic<bool> Expired = false;
+		std::atomic<uint32_t> Upgrading = 0; // `WeakRef::AsRef` calls which are reading the instance's counter right now
+	};
+
+	// Reference count shared by every `Ref` pointing to the same instance.
+	// Lives inside the object for `RefCounted` types (intrusive), otherwise it is heap allocated next to the instance
+	struct RefCounter
+	{
+		std::atomic<uint32_t> Count = 0;
+		std::atomic<WeakRefControl*> WeakControl = nullptr;
+		bool Intrusive = false;
+	};
+
+	namespace RefUtils
+	{
+		// Only called while a strong `Ref` exists, so it can never race with the instance being destroyed
+		inline WeakRefControl* AcquireWeakControl(RefCounter* refCount)
+		{
+			WeakRefControl* control = refCount->WeakControl.load(std::memory_order_acquire);
+			if (!control)
+			{
+				WeakRefControl* newControl = new WeakRefControl();
+				if (refCount->WeakControl.compare_exchange_strong(control, newControl, std::memory_order_acq_rel))
+					control = newControl;
+				else
+					delete newControl; // Another thread created it first (`control` now points to it)
+			}
+
+			control->Count.fetch_add(1, std::memory_order_relaxed);
+			return control;
+		}
+
+		inline void ReleaseWeakControl(WeakRefControl* control)
+		{
+			if (control && control->Count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				delete control;
+		}
+
+		// Takes a reference only if the count isn't 0 already (a count that reached 0 means the instance is being destroyed, it can't be revived)
+		inline bool TryIncreaseRef(RefCounter* refCount)
+		{
+			uint32_t count = refCount->Count.load(std::memory_order_relaxed);
+			while (count != 0)
+			{
+				if (refCount->Count.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed))
+					return true;
+			}
+			return false;
+		}
+	}
+
+	// Deriving from `RefCounted` opts a class into intrusive reference counting,
+	// which removes the extra allocation for the counter and allows creating a `Ref` from a raw `this` pointer safely
+	class RefCounted
+	{
+	public:
+		RefCounted() { m_RefCounter.Intrusive = true; }
+		RefCounted(const RefCounted&) { m_RefCounter.Intrusive = true; }
+		RefCounted& operator=(const RefCounted&) { return *this; }
+
+		uint32_t GetRefCount() const { return m_RefCounter.Count.load(std::memory_order_relaxed); }
+	private:
+		mutable RefCounter m_RefCounter;
+
+		template<typename T>
+		friend class Ref;
+	};
+
 	template <typename T>
 	class Ref
 	{
@@ -21,8 +105,24 @@ namespace Frost
 			: m_RefCount(nullptr), m_Instance(nullptr) {}
 
 		Ref(T* pointer)
-			: m_RefCount(new uint32_t(1)), m_Instance(pointer) {
-			RefUtils::AddToLiveReferences((void*)m_Instance);
+			: m_RefCount(nullptr), m_Instance(pointer)
+		{
+			if (!m_Instance) return;
+
+			if constexpr (std::is_base_of_v<RefCounted, T>)
+			{
+				m_RefCount = &m_Instance->m_RefCounter;
+
+				// Only the first owner registers the instance, every other `Ref` just shares the intrusive counter
+				if (m_RefCount->Count.fetch_add(1, std::memory_order_relaxed) == 0)
+					RegisterLiveReference();
+			}
+			else
+			{
+				m_RefCount = new RefCounter();
+				m_RefCount->Count.store(1, std::memory_order_relaxed);
+				RegisterLiveReference();
+			}
 		}
 
 		Ref(std::nullptr_t n)
@@ -36,7 +136,7 @@ namespace Frost
 			IncreaseRef();
 		}
 
-		Ref(Ref<T>&& refPointer)
+		Ref(Ref<T>&& refPointer) noexcept
 		{
 			m_RefCount = refPointer.m_RefCount;
 			m_Instance = refPointer.m_Instance;
@@ -55,7 +155,7 @@ namespace Frost
 		}
 
 		template <typename Ts>
-		Ref(Ref<Ts>&& refPointer)
+		Ref(Ref<Ts>&& refPointer) noexcept
 		{
 			m_RefCount = refPointer.m_RefCount;
 			m_Instance = (T*)refPointer.m_Instance;
@@ -71,19 +171,20 @@ namespace Frost
 		////////////////////////////////////////////////////
 		Ref& operator=(const Ref<T>& refPointer)
 		{
+			// Increase first, so self-assignment can never release the instance
+			refPointer.IncreaseRef();
 			DecreaseRef();
 
 			m_RefCount = refPointer.m_RefCount;
 			m_Instance = refPointer.m_Instance;
 
-			if (m_Instance != nullptr)
-				IncreaseRef();
-
 			return *this;
 		}
 
-		Ref& operator=(Ref<T>&& refPointer)
+		Ref& operator=(Ref<T>&& refPointer) noexcept
 		{
+			if (this == &refPointer) return *this;
+
 			DecreaseRef();
 
 			m_RefCount = refPointer.m_RefCount;
@@ -99,19 +200,17 @@ namespace Frost
 		template <typename Ts>
 		Ref& operator=(const Ref<Ts>& refPointer)
 		{
+			refPointer.IncreaseRef();
 			DecreaseRef();
 
 			m_RefCount = refPointer.m_RefCount;
 			m_Instance = (T*)refPointer.m_Instance;
 
-			if (m_Instance != nullptr)
-				IncreaseRef();
-
 			return *this;
 		}
 
 		template <typename Ts>
-		Ref& operator=(Ref<T>&& refPointer)
+		Ref& operator=(Ref<Ts>&& refPointer) noexcept
 		{
 			DecreaseRef();
 
@@ -144,6 +243,8 @@ namespace Frost
 			return Ref<T2>(*this);
 		}
 
+		uint32_t GetRefCount() const { return m_RefCount ? m_RefCount->Count.load(std::memory_order_relaxed) : 0; }
+
 
 
 		////////////////////////////////////////////////////
@@ -162,6 +263,9 @@ namespace Frost
 		void Reset()
 		{
 			DecreaseRef();
+
+			m_Instance = nullptr;
+			m_RefCount = nullptr;
 		}
 
 		operator bool() { return m_Instance != nullptr; }
@@ -172,50 +276,69 @@ namespace Frost
 			DecreaseRef();
 		}
 	private:
+		// Used by `WeakRef` to share an already existing counter. Adopts the reference that `RefUtils::TryIncreaseRef` took
+		Ref(RefCounter* refCount, T* instance)
+			: m_RefCount(refCount), m_Instance(instance)
+		{
+		}
+
+		void RegisterLiveReference()
+		{
+#ifdef FROST_TRACK_LIVE_REFERENCES
+			RefUtils::AddToLiveReferences((void*)m_Instance);
+#endif
+		}
+
 		void IncreaseRef() const
 		{
-			if (m_Instance)
-			{
-				++(*m_RefCount);
-				RefUtils::AddToLiveReferences((void*)m_Instance);
-			}
+			if (m_RefCount)
+				m_RefCount->Count.fetch_add(1, std::memory_order_relaxed);
 		}
 
 		void DecreaseRef()
 		{
-			if (m_RefCount)
-			{
-				//if (*m_RefCount == UINT32_MAX)
-				//{
-				//	return;
-				//}
+			if (!m_RefCount) return;
 
-				if (*m_RefCount == 0)
+			// acq_rel makes every write done through other references visible to the thread that deletes the instance
+			if (m_RefCount->Count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				// The intrusive counter is destroyed together with the instance, so read the flag beforehand
+				bool intrusive = m_RefCount->Intrusive;
+
+				// Expire the weak refs before the instance is gone, then drop the counter's reference to the control block.
+				// `WeakRef::AsRef` calls which started before the flag was set may still read the counter (they see 0 and give up),
+				// so the counter (and the intrusive instance holding it) is only destroyed once they are done
+				WeakRefControl* weakControl = m_RefCount->WeakControl.load(std::memory_order_acquire);
+				if (weakControl)
 				{
-					delete m_RefCount;
-					return;
+					weakControl->Expired.store(true, std::memory_order_seq_cst);
+					while (weakControl->Upgrading.load(std::memory_order_seq_cst) != 0)
+						std::this_thread::yield();
+
+					RefUtils::ReleaseWeakControl(weakControl);
 				}
 
-				--(*m_RefCount);
-				if (*m_RefCount == 0)
+				if (m_Instance != nullptr)
 				{
-					if (m_Instance != nullptr)
-					{
-						RefUtils::RemoveFromLiveReferences((void*)m_Instance);
-						delete m_Instance;
-					}
-					delete m_RefCount;
+#ifdef FROST_TRACK_LIVE_REFERENCES
+					RefUtils::RemoveFromLiveReferences((void*)m_Instance);
+#endif
+					delete m_Instance;
 				}
+
+				if (!intrusive)
+					delete m_RefCount;
 			}
 		}
 
 	private:
-		uint32_t* m_RefCount;
+		RefCounter* m_RefCount;
 		T* m_Instance;
 
+		template<typename>
 		friend class Ref;
 
-		template<typename T>
+		template<typename>
 		friend class WeakRef;
 	};
 
@@ -227,52 +350,120 @@ namespace Frost
 
 		WeakRef(Ref<T> ref)
 		{
-			if (ref.Raw() == nullptr) return;
-
-			m_Instance = ref.Raw();
-			m_RefCount = ref.m_RefCount;
+			Assign(ref);
 		}
 
 		WeakRef(std::nullptr_t ptr)
 		{
 		}
 
-		WeakRef& operator=(Ref<T> ref)
+		WeakRef(const WeakRef<T>& other)
+			: m_RefCount(other.m_RefCount), m_Instance(other.m_Instance), m_Control(other.m_Control)
 		{
-			m_Instance = ref.Raw();
-			m_RefCount = ref.m_RefCount;
+			if (m_Control)
+				m_Control->Count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		WeakRef(WeakRef<T>&& other) noexcept
+			: m_RefCount(other.m_RefCount), m_Instance(other.m_Instance), m_Control(other.m_Control)
+		{
+			other.m_RefCount = nullptr;
+			other.m_Instance = nullptr;
+			other.m_Control = nullptr;
+		}
+
+		~WeakRef()
+		{
+			RefUtils::ReleaseWeakControl(m_Control);
+		}
+
+		WeakRef& operator=(const WeakRef<T>& other)
+		{
+			if (other.m_Control)
+				other.m_Control->Count.fetch_add(1, std::memory_order_relaxed);
+			RefUtils::ReleaseWeakControl(m_Control);
+
+			m_RefCount = other.m_RefCount;
+			m_Instance = other.m_Instance;
+			m_Control = other.m_Control;
 
 			return *this;
 		}
 
+		WeakRef& operator=(WeakRef<T>&& other) noexcept
+		{
+			if (this == &other) return *this;
+
+			RefUtils::ReleaseWeakControl(m_Control);
+
+			m_RefCount = other.m_RefCount;
+			m_Instance = other.m_Instance;
+			m_Control = other.m_Control;
+
+			other.m_RefCount = nullptr;
+			other.m_Instance = nullptr;
+			other.m_Control = nullptr;
+
+			return *this;
+		}
+
+		WeakRef& operator=(Ref<T> ref)
+		{
+			Assign(ref);
+			return *this;
+		}
+
 		WeakRef& operator=(std::nullptr_t ptr)
 		{
+			RefUtils::ReleaseWeakControl(m_Control);
+
+			m_Instance = nullptr;
+			m_RefCount = nullptr;
+			m_Control = nullptr;
+
 			return *this;
 		}
 
 		template<typename T2>
 		[[nodiscard]] Ref<T2> AsRef() const
 		{
-			Ref<T2> ref = Ref<T2>((T2*)m_Instance);
+			if (!m_Control) return nullptr;
 
-			// Delete the old ref count just allocated (from constructor)
-			delete ref.m_RefCount;
+			// Announce the upgrade first, so the last `Ref` can't destroy the counter while it's read here.
+			// Checking `IsValid` and then taking a reference isn't enough, the last `Ref` could be released in between
+			m_Control->Upgrading.fetch_add(1, std::memory_order_seq_cst);
+			bool acquired = !m_Control->Expired.load(std::memory_order_seq_cst) && RefUtils::TryIncreaseRef(m_RefCount);
+			m_Control->Upgrading.fetch_sub(1, std::memory_order_release);
 
-			// Set the ref count that the weak ref previously had
-			ref.m_RefCount = m_RefCount;
-			++(*m_RefCount);
+			if (!acquired) return nullptr;
 
-			return ref;
+			// Share the ref count that the original ref had
+			return Ref<T2>(m_RefCount, (T2*)m_Instance);
 		}
 
-		bool IsValid() const { return m_Instance != nullptr ? RefUtils::IsLive(m_Instance) : false; }
+		bool IsValid() const
+		{
+			return m_Control != nullptr && !m_Control->Expired.load(std::memory_order_acquire);
+		}
 		operator bool() const { return IsValid(); }
 
 		T* Raw() { return m_Instance; }
 		[[nodiscard]] const T* Raw() const { return m_Instance; }
 	private:
-		uint32_t* m_RefCount = nullptr;
+		void Assign(const Ref<T>& ref)
+		{
+			// Acquire first, so reassigning the same instance never frees the control block
+			WeakRefControl* control = ref.m_RefCount ? RefUtils::AcquireWeakControl(ref.m_RefCount) : nullptr;
+			RefUtils::ReleaseWeakControl(m_Control);
+
+			m_Instance = ref.m_Instance;
+			m_RefCount = ref.m_RefCount;
+			m_Control = control;
+		}
+	private:
+		RefCounter* m_RefCount = nullptr;
 		T* m_Instance = nullptr;
+		WeakRefControl* m_Control = nullptr;
 	};
 
 }
\ No newline at end of file
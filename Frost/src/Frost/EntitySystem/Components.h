@@ -63,7 +63,7 @@ namespace Frost
 		{
 		}
 
-		glm::mat4 GetTransform()
+		glm::mat4 GetTransform() const
 		{
 			glm::mat4 rotation =  glm::toMat4(glm::quat(glm::radians(Rotation)));
 			glm::mat4 transform = glm::translate(glm::mat4(1.0f), Translation) * rotation * glm::scale(glm::mat4(1.0f), Scale);
@@ -75,6 +75,28 @@ namespace Frost
 		glm::vec3 Scale       = glm::vec3(1.0f, 1.0f, 1.0f);
 	};
 
+	// Cached local/world matrices of an entity (not serialized, it is rebuilt by the scene).
+	// `Dirty` is set by `Scene::MarkTransformDirty` and pushed down to the children right away, so reading a clean matrix is only a flag check.
+	// The TRS values which were used to build the matrices are kept as well, so writes which were not marked are still caught by the per frame update
+	struct WorldTransformComponent
+	{
+		glm::mat4 LocalTransform = glm::mat4(1.0f);
+		glm::mat4 WorldTransform = glm::mat4(1.0f);
+		bool Dirty = true;
+
+		glm::vec3 Translation = glm::vec3(0.0f, 0.0f, 0.0f);
+		glm::vec3 Rotation    = glm::vec3(0.0f, 0.0f, 0.0f);
+		glm::vec3 Scale       = glm::vec3(1.0f, 1.0f, 1.0f);
+		UUID ParentID = 0;
+		bool IsValid = false;
+
+		bool IsDirty(const TransformComponent& transform, UUID parentID) const
+		{
+			return !IsValid || parentID != ParentID ||
+				transform.Translation != Translation || transform.Rotation != Rotation || transform.Scale != Scale;
+		}
+	};
+
 	struct MeshComponent
 	{
 		MeshComponent() = default;
@@ -13,12 +13,17 @@
 
 #include "Frost/Math/Math.h"
 
+#include <atomic>
+
 namespace Frost
 {
+	static std::atomic<uint32_t> s_EntityGenerationCounter = 0;
 
 	Scene::Scene(const std::string& name, bool construct)
 		: m_Name(name)
 	{
+		InvalidateEntityHandles();
+
 		if (construct)
 		{
 			m_Registry.on_construct<ScriptComponent>().connect<&Scene::OnScriptComponentConstruct>(this);
@@ -58,6 +63,7 @@ namespace Frost
 		entity.AddComponent<ParentChildComponent>();
 		entity.AddComponent<TagComponent>(name);
 		entity.AddComponent<TransformComponent>();
+		entity.AddComponent<WorldTransformComponent>();
 
 		m_EntityIDMap[idComponent.ID] = entity;
 
@@ -75,6 +81,7 @@ namespace Frost
 		entity.AddComponent<ParentChildComponent>();
 		entity.AddComponent<TagComponent>(name);
 		entity.AddComponent<TransformComponent>();
+		entity.AddComponent<WorldTransformComponent>();
 
 		m_EntityIDMap[id] = entity;
 
@@ -113,6 +120,7 @@ namespace Frost
 
 	void Scene::Update(Timestep ts)
 	{
+		UpdateWorldTransforms();
 
 		UpdateSkyLight(ts);
 		UpdateMeshComponents(ts);
@@ -138,6 +146,9 @@ namespace Frost
 		// Physics Part
 		PhysicsEngine::Simulate(ts);
 
+		// Scripts and physics have moved the entities, so update the world transforms before rendering
+		UpdateWorldTransforms();
+
 		// Rendering Part
 		UpdateSkyLight(ts);
 		UpdateMeshComponents(ts);
@@ -210,13 +221,112 @@ namespace Frost
 
 	const glm::mat4& Scene::GetTransformMatFromEntityAndParent(Entity entity)
 	{
-		glm::mat4 transform(1.0f);
+		const WorldTransformComponent* worldTransform = m_Registry.try_get<WorldTransformComponent>(entity);
+		if (worldTransform && !worldTransform->Dirty)
+			return worldTransform->WorldTransform;
+
+		// Dirty flags are pushed down when they are set, so the dirty ancestors are always right above the entity.
+		// Rebuilding a world transform always rebuilds its whole subtree, so only the top-most dirty one has to be rebuilt
+		Entity dirtyEntity = entity;
+		for (Entity parent = FindEntityByUUID(entity.GetParent()); parent; parent = FindEntityByUUID(parent.GetParent()))
+		{
+			const WorldTransformComponent* parentWorldTransform = m_Registry.try_get<WorldTransformComponent>(parent);
+			if (parentWorldTransform && !parentWorldTransform->Dirty)
+				break;
+
+			dirtyEntity = parent;
+		}
+		RebuildWorldTransform(dirtyEntity);
+
+		// Get the component again, because the storage could have grown while rebuilding
+		return m_Registry.get<WorldTransformComponent>(entity).WorldTransform;
+	}
+
+	void Scene::MarkTransformDirty(Entity entity)
+	{
+		// Static actors are only moved to their entity's transform when it was written (dynamic ones are moved by the simulation).
+		// This is done before the dirty check, because the actor could have been synchronized since the entity was marked
+		if (m_IsScenePlaying)
+		{
+			const RigidBodyComponent* rigidBody = m_Registry.try_get<RigidBodyComponent>(entity);
+			if (rigidBody && rigidBody->BodyType == RigidBodyComponent::Type::Static && PhysicsEngine::GetScene())
+				PhysicsEngine::GetScene()->MarkActorTransformDirty(entity);
+		}
+
+		WorldTransformComponent* worldTransform = m_Registry.try_get<WorldTransformComponent>(entity);
+		if (worldTransform)
+		{
+			// The children of a dirty entity are dirty as well, so there is nothing left to push down
+			if (worldTransform->Dirty)
+				return;
+
+			worldTransform->Dirty = true;
+		}
+
+		for (auto childID : entity.GetChildren())
+		{
+			Entity child = FindEntityByUUID(childID);
+			if (child)
+				MarkTransformDirty(child);
+		}
+	}
+
+	void Scene::RebuildWorldTransform(Entity entity)
+	{
+		glm::mat4 parentTransform(1.0f);
 
 		Entity parent = FindEntityByUUID(entity.GetParent());
 		if (parent)
-			transform = GetTransformMatFromEntityAndParent(parent);
+			parentTransform = GetTransformMatFromEntityAndParent(parent);
 
-		return transform * entity.GetComponent<TransformComponent>().GetTransform();
+		UpdateWorldTransform(entity, parentTransform, true);
+	}
+
+	void Scene::UpdateWorldTransforms()
+	{
+		// Start from the root entities and walk down the hierarchy, so every matrix is rebuilt at most once
+		auto view = m_Registry.view<ParentChildComponent, TransformComponent>();
+		for (auto entity : view)
+		{
+			const ParentChildComponent& parentChildComponent = view.get<ParentChildComponent>(entity);
+			if (parentChildComponent.ParentID != 0 && FindEntityByUUID(parentChildComponent.ParentID))
+				continue;
+
+			UpdateWorldTransform(Entity(entity, this), glm::mat4(1.0f), false);
+		}
+	}
+
+	void Scene::UpdateWorldTransform(Entity entity, const glm::mat4& parentTransform, bool parentChanged)
+	{
+		const TransformComponent& transform = entity.GetComponent<TransformComponent>();
+		WorldTransformComponent& worldTransform = m_Registry.get_or_emplace<WorldTransformComponent>(entity);
+		UUID parentID = entity.GetParent();
+
+		bool changed = parentChanged;
+		if (worldTransform.Dirty || worldTransform.IsDirty(transform, parentID))
+		{
+			worldTransform.Translation = transform.Translation;
+			worldTransform.Rotation = transform.Rotation;
+			worldTransform.Scale = transform.Scale;
+			worldTransform.ParentID = parentID;
+			worldTransform.IsValid = true;
+			worldTransform.Dirty = false;
+
+			worldTransform.LocalTransform = transform.GetTransform();
+			changed = true;
+		}
+
+		if (changed)
+			worldTransform.WorldTransform = parentTransform * worldTransform.LocalTransform;
+
+		// Copy the matrix, since the component storage might grow while updating the children
+		glm::mat4 currentTransform = worldTransform.WorldTransform;
+		for (auto childID : entity.GetChildren())
+		{
+			Entity child = FindEntityByUUID(childID);
+			if (child)
+				UpdateWorldTransform(child, currentTransform, changed);
+		}
 	}
 
 	TransformComponent Scene::GetTransformFromEntityAndParent(Entity entity)
@@ -241,6 +351,7 @@ namespace Frost
 		// By doing inverse of the parent's matrix, we make the parent's position be the origin point for the child
 		glm::mat4 localTransform = glm::inverse(parentTransform) * transform.GetTransform();
 		Math::DecomposeTransform(localTransform, transform.Translation, transform.Rotation, transform.Scale);
+		MarkTransformDirty(entity);
 	}
 
 	Entity Scene::FindEntityByUUID(UUID id)
@@ -351,7 +462,10 @@ namespace Frost
 
 		
 		if (translation)
+		{
 			newEntity.Transform().Translation = *translation;
+			MarkTransformDirty(newEntity);
+		}
 
 		// Create children
 		for (auto childId : entity.GetChildren())
@@ -745,15 +859,7 @@ namespace Frost
 
 	void Scene::UpdateCSharpApplication(Timestep ts)
 	{
-		auto view = m_Registry.view<ScriptComponent>();
-		for (auto entity : view)
-		{
-			Entity e = { entity, this };
-			if (ScriptEngine::ModuleExists(e.GetComponent<ScriptComponent>().ModuleName))
-			{
-				ScriptEngine::OnUpdateEntity(e, ts);
-			}
-		}
+		ScriptEngine::OnUpdateEntities(this, ts);
 
 		m_PostUpdateQueue.Execute();
 	}
@@ -802,6 +908,16 @@ namespace Frost
 
 		m_EntityIDMap.erase(entity.GetComponent<IDComponent>().ID);
 		m_Registry.destroy(entity.Raw());
+
+		InvalidateEntityHandles();
+	}
+
+	void Scene::InvalidateEntityHandles()
+	{
+		// 0 is never used, so a default initialized handle is always invalid
+		m_EntityGeneration = ++s_EntityGenerationCounter;
+		if (m_EntityGeneration == 0)
+			m_EntityGeneration = ++s_EntityGenerationCounter;
 	}
 
 	void Scene::UnparentEntity(Entity& child)
@@ -825,6 +941,7 @@ namespace Frost
 
 		// Set the Parent to be 0, because we just unparented the entity
 		child.GetComponent<ParentChildComponent>().ParentID = 0;
+		MarkTransformDirty(child);
 	}
 
 	void Scene::SubmitToDestroyEntity(Entity entity)
@@ -935,6 +1052,8 @@ namespace Frost
 		m_EntityIDMap.clear();
 		m_SelectedEntity = {};
 		m_Registry.clear();
+
+		InvalidateEntityHandles();
 	}
 
 	Ref<Scene> Scene::CreateEmpty()
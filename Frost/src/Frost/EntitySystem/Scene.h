@@ -35,7 +35,13 @@ namespace Frost
 		void DestroyEntity(Entity entity);
 
 		void ConvertEntityToParentTransform(Entity entity);
+
+		// Returns the cached world matrix. If the entity was marked dirty since the last update, it is rebuilt (with its dirty ancestors and children) right away
 		const glm::mat4& GetTransformMatFromEntityAndParent(Entity entity);
+		// Has to be called after writing the `TransformComponent` (or the parent) of an entity, it marks the entity and all of its children as dirty
+		void MarkTransformDirty(Entity entity);
+		// Propagates the transform changes top-down (in hierarchy order) into the `WorldTransformComponent` caches. Called once per frame by `Update`/`UpdateRuntime`
+		void UpdateWorldTransforms();
 		TransformComponent GetTransformFromEntityAndParent(Entity entity);
 
 		Entity FindEntityByUUID(UUID id);
@@ -56,6 +62,10 @@ namespace Frost
 		Entity Instantiate(Ref<Prefab> prefab, const glm::vec3* translation = nullptr);
 
 		const EntityMap& GetEntityMap() const { return m_EntityIDMap; }
+
+		// Changes every time an entity is destroyed (and is unique across all scenes).
+		// Entity handles cached outside of the scene (e.g. by the scripts) are only valid while it matches
+		uint32_t GetEntityGeneration() const { return m_EntityGeneration; }
 		void CopyTo(Ref<Scene>& target);
 
 		void SetSelectedEntity(Entity entity);
@@ -70,6 +80,9 @@ namespace Frost
 	public:
 		static Ref<Scene> CreateEmpty();
 	private:
+		void UpdateWorldTransform(Entity entity, const glm::mat4& parentTransform, bool parentChanged);
+		void RebuildWorldTransform(Entity entity);
+
 		void UpdateSkyLight(Timestep ts);
 		void UpdateMeshComponents(Timestep ts);
 		void UpdateTextComponents(Timestep ts);
@@ -88,6 +101,8 @@ namespace Frost
 		void OnScriptComponentConstruct(entt::registry& registry, entt::entity entity);
 		void OnScriptComponentDestroy(entt::registry& registry, entt::entity entity);
 
+		void InvalidateEntityHandles();
+
 		template<typename Fn>
 		void SubmitPostUpdateFunc(Fn&& func)
 		{
@@ -100,6 +115,7 @@ namespace Frost
 
 		std::string m_Name;
 		EntityMap m_EntityIDMap;
+		uint32_t m_EntityGeneration = 0;
 
 		bool m_IsScenePlaying = false;
 
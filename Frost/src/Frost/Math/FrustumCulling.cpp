@@ -0,0 +1,245 @@
+#include "frostpch.h"
+#include "FrustumCulling.h"
+
+#include "Frost/Math/Alignment.h"
+
+#if defined(__AVX__)
+	#include <immintrin.h>
+	#define FROST_CULLING_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define FROST_CULLING_SSE
+#endif
+
+namespace Frost::Math
+{
+	static constexpr uint32_t s_BatchSize = 8;
+
+	ViewFrustum ViewFrustum::FromViewProjection(const glm::mat4& viewProjection)
+	{
+		// Gribb/Hartmann plane extraction (glm is column major, so rows are read accross the columns)
+		glm::vec4 row0 = { viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0] };
+		glm::vec4 row1 = { viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1] };
+		glm::vec4 row2 = { viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2] };
+		glm::vec4 row3 = { viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3] };
+
+		ViewFrustum frustum;
+		frustum.Planes[0] = row3 + row0; // Left
+		frustum.Planes[1] = row3 - row0; // Right
+		frustum.Planes[2] = row3 + row1; // Bottom
+		frustum.Planes[3] = row3 - row1; // Top
+		frustum.Planes[4] = row2;        // Near (depth is [0, 1])
+		frustum.Planes[5] = row3 - row2; // Far
+
+		for (auto& plane : frustum.Planes)
+		{
+			// Infinite far planes have no normal, so they are left as they are (and will never cull anything)
+			float length = glm::length(glm::vec3(plane));
+			if (length > 0.0f)
+				plane /= length;
+		}
+
+		return frustum;
+	}
+
+	ViewFrustum ViewFrustum::FromBounds(const glm::vec3& min, const glm::vec3& max)
+	{
+		ViewFrustum frustum;
+		frustum.Planes[0] = {  1.0f,  0.0f,  0.0f, -min.x };
+		frustum.Planes[1] = { -1.0f,  0.0f,  0.0f,  max.x };
+		frustum.Planes[2] = {  0.0f,  1.0f,  0.0f, -min.y };
+		frustum.Planes[3] = {  0.0f, -1.0f,  0.0f,  max.y };
+		frustum.Planes[4] = {  0.0f,  0.0f,  1.0f, -min.z };
+		frustum.Planes[5] = {  0.0f,  0.0f, -1.0f,  max.z };
+		return frustum;
+	}
+
+	bool ViewFrustum::IsBoxVisible(const glm::vec3& min, const glm::vec3& max) const
+	{
+		glm::vec3 center = (min + max) * 0.5f;
+		glm::vec3 extents = (max - min) * 0.5f;
+		for (const glm::vec4& plane : Planes)
+		{
+			// Same test as the batched one: the box is outside when even its furthest corner along the normal is behind the plane
+			float distance = glm::dot(glm::vec3(plane), center) + plane.w;
+			float radius = glm::dot(glm::abs(glm::vec3(plane)), extents);
+			if (distance + radius < 0.0f)
+				return false;
+		}
+		return true;
+	}
+
+	void CullingBounds::Clear()
+	{
+		m_CenterX.clear(); m_CenterY.clear(); m_CenterZ.clear();
+		m_ExtentX.clear(); m_ExtentY.clear(); m_ExtentZ.clear();
+		m_Count = 0;
+	}
+
+	void CullingBounds::Reserve(uint32_t count)
+	{
+		uint32_t paddedCount = Math::AlignUp<uint32_t>(count, s_BatchSize);
+		m_CenterX.reserve(paddedCount); m_CenterY.reserve(paddedCount); m_CenterZ.reserve(paddedCount);
+		m_ExtentX.reserve(paddedCount); m_ExtentY.reserve(paddedCount); m_ExtentZ.reserve(paddedCount);
+	}
+
+	void CullingBounds::Add(const glm::vec3& center, const glm::vec3& extents)
+	{
+		// Grow a whole batch at once, so the last batch can always be loaded fully
+		if (m_Count == m_CenterX.size())
+		{
+			uint32_t paddedCount = m_Count + s_BatchSize;
+			m_CenterX.resize(paddedCount, 0.0f); m_CenterY.resize(paddedCount, 0.0f); m_CenterZ.resize(paddedCount, 0.0f);
+			m_ExtentX.resize(paddedCount, 0.0f); m_ExtentY.resize(paddedCount, 0.0f); m_ExtentZ.resize(paddedCount, 0.0f);
+		}
+
+		m_CenterX[m_Count] = center.x; m_CenterY[m_Count] = center.y; m_CenterZ[m_Count] = center.z;
+		m_ExtentX[m_Count] = extents.x; m_ExtentY[m_Count] = extents.y; m_ExtentZ[m_Count] = extents.z;
+		m_Count++;
+	}
+
+	void CullingBounds::AddTransformed(const BoundingBox& boundingBox, const glm::mat4& transform)
+	{
+		glm::vec3 center = (boundingBox.Max + boundingBox.Min) * 0.5f;
+		glm::vec3 extents = (boundingBox.Max - boundingBox.Min) * 0.5f;
+
+		// Arvo's method: the world extents are the local extents projected on the absolute values of the (scaled) rotation axes
+		glm::vec3 worldCenter = glm::vec3(transform * glm::vec4(center, 1.0f));
+		glm::vec3 worldExtents = glm::abs(glm::vec3(transform[0])) * extents.x +
+		                         glm::abs(glm::vec3(transform[1])) * extents.y +
+		                         glm::abs(glm::vec3(transform[2])) * extents.z;
+
+		Add(worldCenter, worldExtents);
+	}
+
+	// Reference path, always compiled so the SIMD paths can be checked against it.
+	// The sums are grouped like in the SIMD paths, so both give bit identical results
+	static uint32_t CullBatchScalar(const ViewFrustum& frustum, const float* cx, const float* cy, const float* cz, const float* ex, const float* ey, const float* ez)
+	{
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < s_BatchSize; i++)
+		{
+			bool visible = true;
+			for (const glm::vec4& plane : frustum.Planes)
+			{
+				// Projection interval radius of the box onto the plane normal
+				float radius = (ex[i] * std::abs(plane.x) + ey[i] * std::abs(plane.y)) + ez[i] * std::abs(plane.z);
+				float distance = (cx[i] * plane.x + cy[i] * plane.y) + (cz[i] * plane.z + plane.w);
+				if (distance + radius < 0.0f)
+				{
+					visible = false;
+					break;
+				}
+			}
+			mask |= uint32_t(visible) << i;
+		}
+		return mask;
+	}
+
+#if defined(FROST_CULLING_AVX)
+	static uint32_t CullBatchSIMD(const ViewFrustum& frustum, const float* cx, const float* cy, const float* cz, const float* ex, const float* ey, const float* ez)
+	{
+		__m256 centerX = _mm256_loadu_ps(cx), centerY = _mm256_loadu_ps(cy), centerZ = _mm256_loadu_ps(cz);
+		__m256 extentX = _mm256_loadu_ps(ex), extentY = _mm256_loadu_ps(ey), extentZ = _mm256_loadu_ps(ez);
+		__m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+		for (const glm::vec4& plane : frustum.Planes)
+		{
+			__m256 distance = _mm256_add_ps(
+				_mm256_add_ps(_mm256_mul_ps(centerX, _mm256_set1_ps(plane.x)), _mm256_mul_ps(centerY, _mm256_set1_ps(plane.y))),
+				_mm256_add_ps(_mm256_mul_ps(centerZ, _mm256_set1_ps(plane.z)), _mm256_set1_ps(plane.w)));
+			__m256 radius = _mm256_add_ps(
+				_mm256_add_ps(_mm256_mul_ps(extentX, _mm256_set1_ps(std::abs(plane.x))), _mm256_mul_ps(extentY, _mm256_set1_ps(std::abs(plane.y)))),
+				_mm256_mul_ps(extentZ, _mm256_set1_ps(std::abs(plane.z))));
+
+			visible = _mm256_and_ps(visible, _mm256_cmp_ps(_mm256_add_ps(distance, radius), _mm256_setzero_ps(), _CMP_GE_OQ));
+		}
+
+		return static_cast<uint32_t>(_mm256_movemask_ps(visible));
+	}
+#elif defined(FROST_CULLING_SSE)
+	static uint32_t CullBatch4(const ViewFrustum& frustum, const float* cx, const float* cy, const float* cz, const float* ex, const float* ey, const float* ez)
+	{
+		__m128 centerX = _mm_loadu_ps(cx), centerY = _mm_loadu_ps(cy), centerZ = _mm_loadu_ps(cz);
+		__m128 extentX = _mm_loadu_ps(ex), extentY = _mm_loadu_ps(ey), extentZ = _mm_loadu_ps(ez);
+		__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+		for (const glm::vec4& plane : frustum.Planes)
+		{
+			__m128 distance = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(centerX, _mm_set1_ps(plane.x)), _mm_mul_ps(centerY, _mm_set1_ps(plane.y))),
+				_mm_add_ps(_mm_mul_ps(centerZ, _mm_set1_ps(plane.z)), _mm_set1_ps(plane.w)));
+			__m128 radius = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(extentX, _mm_set1_ps(std::abs(plane.x))), _mm_mul_ps(extentY, _mm_set1_ps(std::abs(plane.y)))),
+				_mm_mul_ps(extentZ, _mm_set1_ps(std::abs(plane.z))));
+
+			visible = _mm_and_ps(visible, _mm_cmpge_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+		}
+
+		return static_cast<uint32_t>(_mm_movemask_ps(visible));
+	}
+
+	static uint32_t CullBatchSIMD(const ViewFrustum& frustum, const float* cx, const float* cy, const float* cz, const float* ex, const float* ey, const float* ez)
+	{
+		return CullBatch4(frustum, cx, cy, cz, ex, ey, ez) |
+		      (CullBatch4(frustum, cx + 4, cy + 4, cz + 4, ex + 4, ey + 4, ez + 4) << 4);
+	}
+#else
+	static uint32_t CullBatchSIMD(const ViewFrustum& frustum, const float* cx, const float* cy, const float* cz, const float* ex, const float* ey, const float* ez)
+	{
+		return CullBatchScalar(frustum, cx, cy, cz, ex, ey, ez);
+	}
+#endif
+
+	// The pointers are already offset to the start of the range
+	template<typename CullBatchFunction>
+	static void CullRange(CullBatchFunction cullBatch, const ViewFrustum& frustum,
+		const float* cx, const float* cy, const float* cz, const float* ex, const float* ey, const float* ez,
+		uint32_t count, uint64_t* outVisibilityMask)
+	{
+		uint32_t wordCount = (count + 63) / 64;
+		std::memset(outVisibilityMask, 0, wordCount * sizeof(uint64_t));
+
+		// The bounds arrays are padded to the batch size, so the last batch can always be loaded fully
+		for (uint32_t offset = 0; offset < count; offset += s_BatchSize)
+		{
+			uint64_t mask = cullBatch(frustum, cx + offset, cy + offset, cz + offset, ex + offset, ey + offset, ez + offset);
+
+			// Boxes after the range (or padding) inside the last batch must not be reported
+			uint32_t validCount = std::min(s_BatchSize, count - offset);
+			mask &= (1ull << validCount) - 1;
+
+			outVisibilityMask[offset / 64] |= mask << (offset % 64);
+		}
+	}
+
+	void FrustumCull(const ViewFrustum& frustum, const CullingBounds& bounds, uint32_t start, uint32_t count, uint64_t* outVisibilityMask)
+	{
+		FROST_ASSERT(bool(start % 64 == 0), "The culling range must start at a multiple of 64!");
+		FROST_ASSERT(bool(start + count <= bounds.m_Count), "The culling range is out of bounds!");
+
+		CullRange(CullBatchSIMD, frustum,
+			bounds.m_CenterX.data() + start, bounds.m_CenterY.data() + start, bounds.m_CenterZ.data() + start,
+			bounds.m_ExtentX.data() + start, bounds.m_ExtentY.data() + start, bounds.m_ExtentZ.data() + start,
+			count, outVisibilityMask);
+	}
+
+	void FrustumCullScalar(const ViewFrustum& frustum, const CullingBounds& bounds, uint32_t start, uint32_t count, uint64_t* outVisibilityMask)
+	{
+		FROST_ASSERT(bool(start % 64 == 0), "The culling range must start at a multiple of 64!");
+		FROST_ASSERT(bool(start + count <= bounds.m_Count), "The culling range is out of bounds!");
+
+		CullRange(CullBatchScalar, frustum,
+			bounds.m_CenterX.data() + start, bounds.m_CenterY.data() + start, bounds.m_CenterZ.data() + start,
+			bounds.m_ExtentX.data() + start, bounds.m_ExtentY.data() + start, bounds.m_ExtentZ.data() + start,
+			count, outVisibilityMask);
+	}
+
+	void FrustumCull(const ViewFrustum& frustum, const CullingBounds& bounds, Vector<uint64_t>& outVisibilityMask)
+	{
+		outVisibilityMask.resize((bounds.GetCount() + 63) / 64);
+		if (bounds.GetCount() == 0) return;
+
+		FrustumCull(frustum, bounds, 0, bounds.GetCount(), outVisibilityMask.data());
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include "BoundingBox.h"
+
+namespace Frost::Math
+{
+	// Frustum planes of a view, stored as `(normal, distance)` so a point is inside when `dot(normal, point) + distance >= 0`
+	struct ViewFrustum
+	{
+		glm::vec4 Planes[6];
+
+		// Extracts the planes from a (Vulkan style, depth [0, 1]) view projection matrix. It should be done only once per view
+		static ViewFrustum FromViewProjection(const glm::mat4& viewProjection);
+
+		// Six axis aligned planes which enclose the world space box [min, max]
+		static ViewFrustum FromBounds(const glm::vec3& min, const glm::vec3& max);
+
+		// Scalar test of a single world space box (for the few boxes which are not worth a `CullingBounds` batch)
+		bool IsBoxVisible(const glm::vec3& min, const glm::vec3& max) const;
+	};
+
+	// World space bounding boxes stored as structure of arrays, so they can be tested in SIMD batches.
+	// The arrays are padded to a multiple of 8 elements
+	class CullingBounds
+	{
+	public:
+		void Clear();
+		void Reserve(uint32_t count);
+
+		void Add(const glm::vec3& center, const glm::vec3& extents);
+
+		// Adds the world space AABB which encloses `boundingBox` after being transformed by `transform` (no matrix decomposition needed)
+		void AddTransformed(const BoundingBox& boundingBox, const glm::mat4& transform);
+
+		uint32_t GetCount() const { return m_Count; }
+
+		glm::vec3 GetCenter(uint32_t index) const { return { m_CenterX[index], m_CenterY[index], m_CenterZ[index] }; }
+		glm::vec3 GetExtents(uint32_t index) const { return { m_ExtentX[index], m_ExtentY[index], m_ExtentZ[index] }; }
+	private:
+		Vector<float> m_CenterX, m_CenterY, m_CenterZ;
+		Vector<float> m_ExtentX, m_ExtentY, m_ExtentZ;
+		uint32_t m_Count = 0;
+
+		friend void FrustumCull(const ViewFrustum&, const CullingBounds&, uint32_t, uint32_t, uint64_t*);
+		friend void FrustumCullScalar(const ViewFrustum&, const CullingBounds&, uint32_t, uint32_t, uint64_t*);
+	};
+
+	// Tests the bounds in [start, start + count) against the frustum and writes one bit per box into `outVisibilityMask`
+	// (bit `i % 64` of word `i / 64`, relative to `start`). `start` must be a multiple of 64, so ranges can be culled by different threads.
+	// Uses AVX (8 boxes per batch, Release/Dist builds enable AVX2) or SSE (4 boxes per batch) when available, with a scalar fallback.
+	void FrustumCull(const ViewFrustum& frustum, const CullingBounds& bounds, uint32_t start, uint32_t count, uint64_t* outVisibilityMask);
+
+	// Same as `FrustumCull`, but always uses the scalar path (the reference the SIMD paths are tested against)
+	void FrustumCullScalar(const ViewFrustum& frustum, const CullingBounds& bounds, uint32_t start, uint32_t count, uint64_t* outVisibilityMask);
+
+	// Culls all the bounds, `outVisibilityMask` is resized to fit them
+	void FrustumCull(const ViewFrustum& frustum, const CullingBounds& bounds, Vector<uint64_t>& outVisibilityMask);
+
+	inline bool IsVisible(const Vector<uint64_t>& visibilityMask, uint32_t index)
+	{
+		return (visibilityMask[index / 64] >> (index % 64)) & 1;
+	}
+}
@@ -41,20 +41,14 @@ namespace Frost
 	{
 		physx::PxTransform transform = m_RigidActor->getGlobalPose();
 		transform.p = PhysXUtils::ToPhysXVector(translation);
-		m_RigidActor->setGlobalPose(transform, autowake);
-
-		if (m_RigidBodyData.BodyType == RigidBodyComponent::Type::Static)
-			SynchronizeTransform();
+		SetGlobalPose(transform, autowake);
 	}
 
 	void PhysXActor::SetRotation(const glm::vec3& rotation, bool autowake /*= true*/)
 	{
 		physx::PxTransform transform = m_RigidActor->getGlobalPose();
 		transform.q = PhysXUtils::ToPhysXQuat(glm::quat(rotation));
-		m_RigidActor->setGlobalPose(transform, autowake);
-
-		if (m_RigidBodyData.BodyType == RigidBodyComponent::Type::Static)
-			SynchronizeTransform();
+		SetGlobalPose(transform, autowake);
 	}
 
 	void PhysXActor::Rotate(const glm::vec3& rotation, bool autowake /*= true*/)
@@ -63,10 +57,7 @@ namespace Frost
 		transform.q *= (physx::PxQuat(glm::radians(rotation.x), { 1.0f, 0.0f, 0.0f })
 			* physx::PxQuat(glm::radians(rotation.y), { 0.0f, 1.0f, 0.0f })
 			* physx::PxQuat(glm::radians(rotation.z), { 0.0f, 0.0f, 1.0f }));
-		m_RigidActor->setGlobalPose(transform, autowake);
-
-		if (m_RigidBodyData.BodyType == RigidBodyComponent::Type::Static)
-			SynchronizeTransform();
+		SetGlobalPose(transform, autowake);
 	}
 
 	void PhysXActor::WakeUp()
@@ -445,6 +436,26 @@ namespace Frost
 		m_RigidActor->userData = this;
 	}
 
+	void PhysXActor::SetGlobalPose(const physx::PxTransform& pose, bool autowake)
+	{
+		m_RigidActor->setGlobalPose(pose, autowake);
+
+		// Write the pose back into the entity right away, so the actor and its TransformComponent always match
+		// (dynamic actors are otherwise only synchronized when the simulation moves them, and a sleeping actor might not be)
+		TransformComponent& transform = m_Entity.Transform();
+		transform.Translation = PhysXUtils::FromPhysXVector(pose.p);
+		transform.Rotation = glm::degrees(glm::eulerAngles(PhysXUtils::FromPhysXQuat(pose.q)));
+		m_Entity.MarkTransformDirty();
+
+		// Static actors are only moved when the entity differs from the synced transform, so record the new pose as already synced
+		if (!IsDynamic())
+		{
+			m_SyncedTranslation = transform.Translation;
+			m_SyncedRotation = transform.Rotation;
+			m_IsTransformSynced = true;
+		}
+	}
+
 	void PhysXActor::SynchronizeTransform()
 	{
 		if (IsDynamic())
@@ -455,10 +466,18 @@ namespace Frost
 
 			glm::quat q = PhysXUtils::FromPhysXQuat(actorPose.q);
 			transform.Rotation = glm::degrees(glm::eulerAngles(q));
+			m_Entity.MarkTransformDirty();
 		}
 		else
 		{
-			m_RigidActor->setGlobalPose(PhysXUtils::ToPhysXTransform(m_Entity.GetComponent<TransformComponent>()));
+			const TransformComponent& transform = m_Entity.GetComponent<TransformComponent>();
+			if (m_IsTransformSynced && transform.Translation == m_SyncedTranslation && transform.Rotation == m_SyncedRotation)
+				return;
+
+			m_RigidActor->setGlobalPose(PhysXUtils::ToPhysXTransform(transform));
+			m_SyncedTranslation = transform.Translation;
+			m_SyncedRotation = transform.Rotation;
+			m_IsTransformSynced = true;
 		}
 	}
 
@@ -79,6 +79,7 @@ namespace Frost
 
 	private:
 		void CreateRigidActor();
+		void SetGlobalPose(const physx::PxTransform& pose, bool autowake);
 		virtual void SynchronizeTransform() override;
 
 	private:
@@ -89,6 +90,11 @@ namespace Frost
 		physx::PxRigidActor* m_RigidActor;
 		Vector<Ref<ColliderShape>> m_Colliders;
 
+		// Transform last pushed into a static actor (moving a static actor is expensive, so it's only done when the entity was moved)
+		glm::vec3 m_SyncedTranslation = glm::vec3(0.0f);
+		glm::vec3 m_SyncedRotation = glm::vec3(0.0f);
+		bool m_IsTransformSynced = false;
+
 		friend class PhysXScene;
 	};
 
@@ -2,11 +2,11 @@
 #include "PhysXInternal.h"
 
 #include <PhysX/extensions/PxDefaultAllocator.h>
-#include <PhysX/extensions/PxDefaultCpuDispatcher.h>
 
 #include "Frost/EntitySystem/Components.h"
 
 #include "PhysXDebugger.h"
+#include "PhysXJobDispatcher.h"
 #include "CookingFactory.h"
 
 namespace Frost
@@ -14,7 +14,7 @@ namespace Frost
 	struct PhysXData
 	{
 		physx::PxFoundation* PhysXFoundation;
-		physx::PxDefaultCpuDispatcher* PhysXCPUDispatcher;
+		PhysXJobDispatcher* PhysXCPUDispatcher;
 		physx::PxPhysics* PhysXSDK;
 
 		physx::PxDefaultAllocator Allocator;
@@ -53,7 +53,8 @@ namespace Frost
 		bool extentionsLoaded = PxInitExtensions(*s_PhysXData->PhysXSDK, PhysXDebugger::GetDebugger());
 		FROST_ASSERT(extentionsLoaded, "Failed to initialize PhysX Extensions.");
 
-		s_PhysXData->PhysXCPUDispatcher = physx::PxDefaultCpuDispatcherCreate(1);
+		// The simulation tasks run on the engine's worker threads
+		s_PhysXData->PhysXCPUDispatcher = new PhysXJobDispatcher();
 
 
 
@@ -68,11 +69,16 @@ namespace Frost
 	physx::PxCpuDispatcher* PhysXInternal::GetCPUDispatcher() { return s_PhysXData->PhysXCPUDispatcher; }
 	physx::PxDefaultAllocator& PhysXInternal::GetAllocator() { return s_PhysXData->Allocator; }
 
+	void PhysXInternal::SetSimulationThreadCount(uint32_t threadCount)
+	{
+		s_PhysXData->PhysXCPUDispatcher->SetMaxWorkerCount(threadCount);
+	}
+
 	void PhysXInternal::Shutdown()
 	{
 		CookingFactory::Shutdown();
 
-		s_PhysXData->PhysXCPUDispatcher->release();
+		delete s_PhysXData->PhysXCPUDispatcher;
 		s_PhysXData->PhysXCPUDispatcher = nullptr;
 
 		PxCloseExtensions();
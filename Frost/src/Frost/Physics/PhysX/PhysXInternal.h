@@ -27,6 +27,9 @@ namespace Frost
 		static physx::PxCpuDispatcher* GetCPUDispatcher();
 		static physx::PxDefaultAllocator& GetAllocator();
 
+		// Limits how many simulation tasks can run in parallel (0 = every worker thread of the `JobSystem`)
+		static void SetSimulationThreadCount(uint32_t threadCount);
+
 
 		// The custom filter shader to use for collision filtering.
 		static physx::PxFilterFlags FilterShader(physx::PxFilterObjectAttributes attributes0, physx::PxFilterData filterData0, physx::PxFilterObjectAttributes attributes1,
@@ -0,0 +1,74 @@
+#include "frostpch.h"
+#include "PhysXJobDispatcher.h"
+
+#include "Frost/Core/JobSystem.h"
+
+namespace Frost
+{
+
+	void PhysXJobDispatcher::submitTask(physx::PxBaseTask& task)
+	{
+		// Without workers the task is executed right away (the same as the default dispatcher created with 0 threads)
+		if (JobSystem::GetWorkerCount() == 0)
+		{
+			task.run();
+			task.release();
+			return;
+		}
+
+		bool startJob = false;
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			m_PendingTasks.push_back(&task);
+
+			if (m_RunningJobs < getWorkerCount())
+			{
+				m_RunningJobs++;
+				startJob = true;
+			}
+		}
+
+		// Every job keeps executing tasks until the queue is empty, so the amount of jobs is the amount of tasks running in parallel
+		if (startJob)
+			JobSystem::Execute([this]() { RunPendingTasks(); });
+	}
+
+	void PhysXJobDispatcher::RunPendingTasks()
+	{
+		while (true)
+		{
+			physx::PxBaseTask* task = nullptr;
+			{
+				std::scoped_lock<std::mutex> lock(m_Mutex);
+				if (m_PendingTasks.empty())
+				{
+					m_RunningJobs--;
+					return;
+				}
+
+				task = m_PendingTasks.front();
+				m_PendingTasks.pop_front();
+			}
+
+			// Releasing the task may submit its continuation (back into this dispatcher)
+			task->run();
+			task->release();
+		}
+	}
+
+	uint32_t PhysXJobDispatcher::getWorkerCount() const
+	{
+		uint32_t workerCount = std::max<uint32_t>(JobSystem::GetWorkerCount(), 1);
+		uint32_t maxWorkerCount = m_MaxWorkerCount.load(std::memory_order_relaxed);
+		if (maxWorkerCount == 0)
+			return workerCount;
+
+		return std::min(maxWorkerCount, workerCount);
+	}
+
+	void PhysXJobDispatcher::SetMaxWorkerCount(uint32_t maxWorkerCount)
+	{
+		m_MaxWorkerCount.store(maxWorkerCount, std::memory_order_relaxed);
+	}
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <PhysX/PxPhysicsAPI.h>
+
+#include <mutex>
+#include <atomic>
+
+namespace Frost
+{
+
+	// Runs the PhysX simulation tasks (broadphase, narrowphase, solver islands, etc) on the `JobSystem` workers,
+	// instead of on a separate thread pool owned by PhysX.
+	// At most `maxWorkerCount` tasks run at the same time, the remaining ones wait in the dispatcher's own queue.
+	class PhysXJobDispatcher : public physx::PxCpuDispatcher
+	{
+	public:
+		PhysXJobDispatcher() = default;
+		PhysXJobDispatcher(const PhysXJobDispatcher&) = delete;
+		PhysXJobDispatcher& operator=(const PhysXJobDispatcher&) = delete;
+
+		virtual void submitTask(physx::PxBaseTask& task) override;
+		virtual uint32_t getWorkerCount() const override;
+
+		// `maxWorkerCount == 0` uses every worker of the `JobSystem`
+		void SetMaxWorkerCount(uint32_t maxWorkerCount);
+	private:
+		void RunPendingTasks();
+	private:
+		std::mutex m_Mutex;
+		std::deque<physx::PxBaseTask*> m_PendingTasks;
+		uint32_t m_RunningJobs = 0;
+		std::atomic<uint32_t> m_MaxWorkerCount = 0;
+	};
+
+}
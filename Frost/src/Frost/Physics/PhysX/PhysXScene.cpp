@@ -17,9 +17,10 @@ namespace Frost
 		physx::PxSceneDesc sceneDesc(PhysXInternal::GetPhysXHandle().getTolerancesScale());
 		sceneDesc.flags |= physx::PxSceneFlag::eENABLE_CCD | physx::PxSceneFlag::eENABLE_PCM;
 		sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ENHANCED_DETERMINISM;
-		//sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
+		sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
 		sceneDesc.gravity = PhysXUtils::ToPhysXVector(settings.Gravity);
 		sceneDesc.broadPhaseType = PhysXUtils::GetBroadphaseType(settings.BroadphaseAlgorithm);
+		PhysXInternal::SetSimulationThreadCount(settings.WorkerThreadCount);
 		sceneDesc.cpuDispatcher = PhysXInternal::GetCPUDispatcher();
 		sceneDesc.filterShader = (physx::PxSimulationFilterShader)PhysXInternal::FilterShader;
 		sceneDesc.simulationEventCallback = &s_ContactListener;
@@ -49,21 +50,39 @@ namespace Frost
 				actor->OnFixedUpdate(m_SubStepSize);
 		}
 
+		// Move the static actors whose entity was moved (by scripts or the editor) before stepping, so the step already sees them there
+		for (UUID entityID : m_DirtyStaticActors)
+		{
+			auto it = m_StaticActorIndices.find(entityID);
+			if (it != m_StaticActorIndices.end())
+				m_StaticActors[it->second]->SynchronizeTransform();
+		}
+		m_DirtyStaticActors.clear();
+
 		Advance(ts);
 
-		for (auto& actor : m_Actors)
+		// Only the actors which were moved by the simulation are reported (sleeping actors are skipped)
+		physx::PxU32 activeActorCount = 0;
+		physx::PxActor** activeActors = m_PhysXScene->getActiveActors(activeActorCount);
+		for (physx::PxU32 i = 0; i < activeActorCount; i++)
+		{
+			PhysXActor* actor = static_cast<PhysXActor*>(activeActors[i]->userData);
 			actor->SynchronizeTransform();
+		}
+	}
+
+	void PhysXScene::MarkActorTransformDirty(Entity entity)
+	{
+		m_DirtyStaticActors.push_back(entity.GetUUID());
 	}
 
 	Ref<PhysicsActor> PhysXScene::GetActor(Entity entity)
 	{
-		for (auto& actor : m_Actors)
-		{
-			if (actor->GetEntity() == entity)
-				return actor;
-		}
+		auto it = m_ActorIndices.find(entity.GetUUID());
+		if (it == m_ActorIndices.end())
+			return nullptr;
 
-		return nullptr;
+		return m_Actors[it->second];
 	}
 
 	Ref<PhysicsActor> PhysXScene::CreateActor(Entity entity)
@@ -71,8 +90,18 @@ namespace Frost
 		Ref<PhysicsActor> actor = PhysicsActor::Create(entity);
 		actor->SetSimulationData(entity.GetComponent<RigidBodyComponent>().Layer);
 
+		UUID entityID = entity.GetUUID();
+		m_ActorIndices[entityID] = static_cast<uint32_t>(m_Actors.size());
 		m_Actors.push_back(actor);
-		m_PhysXScene->addActor(*actor.As<PhysXActor>()->m_RigidActor);
+
+		Ref<PhysXActor> physxActor = actor.As<PhysXActor>();
+		if (!physxActor->IsDynamic())
+		{
+			m_StaticActorIndices[entityID] = static_cast<uint32_t>(m_StaticActors.size());
+			m_StaticActors.push_back(physxActor.Raw());
+		}
+
+		m_PhysXScene->addActor(*physxActor->m_RigidActor);
 
 		return actor;
 	}
@@ -94,13 +123,34 @@ namespace Frost
 		//physxActor->m_RigidActor->release();
 		//physxActor->m_RigidActor = nullptr;
 
-		for (auto it = m_Actors.begin(); it != m_Actors.end(); it++)
+		UUID entityID = actor->GetEntity().GetUUID();
+
+		auto staticIt = m_StaticActorIndices.find(entityID);
+		if (staticIt != m_StaticActorIndices.end())
 		{
-			if ((*it)->GetEntity() == actor->GetEntity())
+			uint32_t index = staticIt->second;
+			m_StaticActorIndices.erase(staticIt);
+
+			if (index != m_StaticActors.size() - 1)
+			{
+				m_StaticActors[index] = m_StaticActors.back();
+				m_StaticActorIndices[m_StaticActors[index]->GetEntity().GetUUID()] = index;
+			}
+			m_StaticActors.pop_back();
+		}
+
+		auto it = m_ActorIndices.find(entityID);
+		if (it != m_ActorIndices.end())
+		{
+			uint32_t index = it->second;
+			m_ActorIndices.erase(it);
+
+			if (index != m_Actors.size() - 1)
 			{
-				m_Actors.erase(it);
-				break;
+				m_Actors[index] = m_Actors.back();
+				m_ActorIndices[m_Actors[index]->GetEntity().GetUUID()] = index;
 			}
+			m_Actors.pop_back();
 		}
 	}
 
@@ -160,10 +210,12 @@ namespace Frost
 	{
 		FROST_ASSERT_INTERNAL(m_PhysXScene);
 
-		for (auto& actor : m_Actors)
-			RemoveActor(actor);
+		// `RemoveActor` modifies `m_Actors`, so always remove the last one
+		while (!m_Actors.empty())
+			RemoveActor(m_Actors.back());
 
 		m_Actors.clear();
+		m_ActorIndices.clear();
 		m_PhysXScene->release();
 		m_PhysXScene = nullptr;
 
@@ -7,6 +7,8 @@
 
 namespace Frost
 {
+	class PhysXActor;
+
 	class PhysXScene : public PhysicsScene
 	{
 	public:
@@ -20,6 +22,8 @@ namespace Frost
 		virtual Ref<PhysicsActor> CreateActor(Entity entity) override;
 		virtual void RemoveActor(Ref<PhysicsActor> actor) override;
 
+		virtual void MarkActorTransformDirty(Entity entity) override;
+
 		virtual glm::vec3 GetGravity() const override { return PhysXUtils::FromPhysXVector(m_PhysXScene->getGravity()); }
 		virtual void SetGravity(const glm::vec3& gravity) override;
 
@@ -40,7 +44,15 @@ namespace Frost
 	private:
 		physx::PxScene* m_PhysXScene;
 
+		// Actors are stored contiguously and removed by swapping with the last one, the indices are looked up by the entity's UUID
 		Vector<Ref<PhysicsActor>> m_Actors;
+		HashMap<UUID, uint32_t> m_ActorIndices;
+
+		// Static actors follow their entity's transform, but only the ones whose transform was written are synchronized
+		// (dynamic ones are synchronized only when PhysX reports them as active)
+		Vector<PhysXActor*> m_StaticActors;
+		HashMap<UUID, uint32_t> m_StaticActorIndices;
+		Vector<UUID> m_DirtyStaticActors; // Can contain the same entity more than once, or entities whose actor was removed since
 
 		float m_SubStepSize;
 		float m_Accumulator;
@@ -27,6 +27,9 @@ namespace Frost
 		virtual Ref<PhysicsActor> CreateActor(Entity entity) = 0;
 		virtual void RemoveActor(Ref<PhysicsActor> actor) = 0;
 
+		// Called when the entity's TransformComponent was written, so its static actor is moved on the next step
+		virtual void MarkActorTransformDirty(Entity entity) = 0;
+
 		virtual bool Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, RaycastHit* outHit) = 0;
 
 		virtual glm::vec3 GetGravity() const = 0;
@@ -63,6 +63,7 @@ namespace Frost
 		FrictionType FrictionModel = FrictionType::Patch;
 		uint32_t SolverIterations = 8;
 		uint32_t SolverVelocityIterations = 2;
+		uint32_t WorkerThreadCount = 0; // Worker threads used by the simulation (0 = every worker thread of the `JobSystem`)
 
 #ifdef FROST_DEBUG
 		bool DebugOnPlay = true;
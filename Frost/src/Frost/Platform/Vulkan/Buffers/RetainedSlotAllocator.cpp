@@ -0,0 +1,64 @@
+#include "frostpch.h"
+#include "RetainedSlotAllocator.h"
+
+namespace Frost
+{
+	void RetainedSlotAllocator::Init(uint32_t capacity)
+	{
+		m_Capacity = capacity;
+		m_Top = 0;
+		m_FreeRanges.clear();
+	}
+
+	bool RetainedSlotAllocator::Allocate(uint32_t size, uint32_t limit, uint32_t& outOffset)
+	{
+		for (uint32_t i = 0; i < m_FreeRanges.size(); i++)
+		{
+			RetainedSlotRange& freeRange = m_FreeRanges[i];
+			if (freeRange.Offset + size > limit) break;
+			if (freeRange.Size < size) continue;
+
+			outOffset = freeRange.Offset;
+			freeRange.Offset += size;
+			freeRange.Size -= size;
+			if (freeRange.Size == 0)
+				m_FreeRanges.erase(m_FreeRanges.begin() + i);
+			return true;
+		}
+
+		if (m_Top + size > std::min(limit, m_Capacity)) return false;
+
+		outOffset = m_Top;
+		m_Top += size;
+		return true;
+	}
+
+	void RetainedSlotAllocator::Free(uint32_t offset, uint32_t size)
+	{
+		if (size == 0) return;
+
+		auto it = std::lower_bound(m_FreeRanges.begin(), m_FreeRanges.end(), offset,
+			[](const RetainedSlotRange& range, uint32_t value) { return range.Offset < value; });
+		it = m_FreeRanges.insert(it, { offset, size });
+
+		// Merge with the next and the previous free range
+		if (it + 1 != m_FreeRanges.end() && it->Offset + it->Size == (it + 1)->Offset)
+		{
+			it->Size += (it + 1)->Size;
+			m_FreeRanges.erase(it + 1);
+		}
+		if (it != m_FreeRanges.begin() && (it - 1)->Offset + (it - 1)->Size == it->Offset)
+		{
+			(it - 1)->Size += it->Size;
+			it = m_FreeRanges.erase(it) - 1;
+		}
+
+		// Give the last free range back to the top of the buffer
+		const RetainedSlotRange& lastRange = m_FreeRanges.back();
+		if (lastRange.Offset + lastRange.Size == m_Top)
+		{
+			m_Top = lastRange.Offset;
+			m_FreeRanges.pop_back();
+		}
+	}
+}
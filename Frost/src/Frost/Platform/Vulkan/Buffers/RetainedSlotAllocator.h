@@ -0,0 +1,32 @@
+#pragma once
+
+namespace Frost
+{
+	// A range of slots from one of the retained gpu scene buffers
+	struct RetainedSlotRange
+	{
+		uint32_t Offset;
+		uint32_t Size;
+	};
+
+	// Hands out slot ranges of a persistent buffer (no Vulkan objects in here, it only does the offset bookkeeping).
+	// Freed ranges are kept sorted by offset and merged with their neighbours,
+	// and a free range touching the top is given back to it, so the used part of the buffer shrinks when batches are compacted
+	class RetainedSlotAllocator
+	{
+	public:
+		void Init(uint32_t capacity);
+
+		// First fit from the free ranges, then from the top. `limit` is used by compaction, to only accept ranges that end before it
+		bool Allocate(uint32_t size, uint32_t limit, uint32_t& outOffset);
+		void Free(uint32_t offset, uint32_t size);
+
+		const Vector<RetainedSlotRange>& GetFreeRanges() const { return m_FreeRanges; }
+		uint32_t GetTop() const { return m_Top; }
+		uint32_t GetCapacity() const { return m_Capacity; }
+	private:
+		Vector<RetainedSlotRange> m_FreeRanges;
+		uint32_t m_Top = 0;
+		uint32_t m_Capacity = 0;
+	};
+}
@@ -0,0 +1,57 @@
+#include "frostpch.h"
+#include "UploadRingAllocator.h"
+
+#include "Frost/Math/Alignment.h"
+
+namespace Frost
+{
+	void UploadRingAllocator::Init(uint64_t capacity)
+	{
+		m_Capacity = capacity;
+		m_Head = 0;
+		m_Tail = 0;
+		m_Batches.clear();
+	}
+
+	bool UploadRingAllocator::Allocate(uint64_t size, uint64_t alignment, uint64_t& outOffset)
+	{
+		if (size == 0 || size > m_Capacity)
+			return false;
+
+		// Nothing is in use, so start again from the beginning of the ring (it avoids skipping the end of the ring for nothing)
+		if (m_Head == m_Tail && m_Batches.empty())
+		{
+			m_Head = 0;
+			m_Tail = 0;
+		}
+
+		uint64_t offset = Math::AlignUp<uint64_t>(m_Head, alignment);
+
+		// The allocation would cross the end of the ring, so it starts at the beginning of the next lap instead
+		uint64_t ringOffset = offset % m_Capacity;
+		if (ringOffset + size > m_Capacity)
+			offset += m_Capacity - ringOffset;
+
+		if (offset + size - m_Tail > m_Capacity)
+			return false;
+
+		m_Head = offset + size;
+		outOffset = offset % m_Capacity;
+		return true;
+	}
+
+	void UploadRingAllocator::CloseBatch(uint64_t batchID)
+	{
+		FROST_ASSERT_INTERNAL(bool(m_Batches.empty() || m_Batches.back().BatchID < batchID));
+		m_Batches.push_back({ batchID, m_Head });
+	}
+
+	void UploadRingAllocator::RetireBatches(uint64_t completedBatchID)
+	{
+		while (!m_Batches.empty() && m_Batches.front().BatchID <= completedBatchID)
+		{
+			m_Tail = m_Batches.front().Head;
+			m_Batches.pop_front();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <deque>
+
+namespace Frost
+{
+	// Ring allocator for the staging memory (no Vulkan objects in here, it only does the offset bookkeeping).
+	// Offsets grow forever and are wrapped with `% capacity`, which makes it easy to tell the used space from the free space.
+	// Every allocation belongs to the batch which is open when it was made, and the space is given back when that batch is retired.
+	class UploadRingAllocator
+	{
+	public:
+		void Init(uint64_t capacity);
+
+		// Returns false if there is not enough free space right now (older batches have to be retired first).
+		// Allocations never wrap around the end of the ring, the remaining space at the end is skipped instead
+		bool Allocate(uint64_t size, uint64_t alignment, uint64_t& outOffset);
+
+		// Everything allocated since the last closed batch belongs to `batchID` (batch IDs must be increasing)
+		void CloseBatch(uint64_t batchID);
+
+		// Frees the space of every batch up to (and including) `completedBatchID`
+		void RetireBatches(uint64_t completedBatchID);
+
+		uint64_t GetCapacity() const { return m_Capacity; }
+		uint64_t GetUsedSize() const { return m_Head - m_Tail; }
+	private:
+		struct Batch
+		{
+			uint64_t BatchID;
+			uint64_t Head; // `m_Head` when the batch was closed
+		};
+
+		uint64_t m_Capacity = 0;
+		uint64_t m_Head = 0;
+		uint64_t m_Tail = 0;
+		std::deque<Batch> m_Batches;
+	};
+}
\ No newline at end of file
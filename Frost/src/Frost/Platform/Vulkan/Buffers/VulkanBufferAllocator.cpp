@@ -61,37 +61,16 @@ namespace Frost
 		FROST_VKCHECK(vmaCreateBuffer(s_Allocator, &bufferInfo, &allocCreateInfo, &buffer, &bufferMemory.allocation, nullptr));
 	}
 
-	void VulkanAllocator::AllocateBuffer(VkDeviceSize size, std::vector<BufferUsage> usage,
+	UploadToken VulkanAllocator::AllocateBuffer(VkDeviceSize size, std::vector<BufferUsage> usage,
 										 VkBuffer& buffer, VulkanMemoryInfo& bufferMemory, void* data)
 	{
-		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
-
 		usage.push_back(BufferUsage::TransferDst);
 
-
-		// Initializating the staging buffer
-		VkBuffer stagingBuffer;
-		VulkanMemoryInfo stagingBufferMemory;
-		AllocateBuffer(size, { BufferUsage::TransferSrc }, MemoryUsage::CPU_ONLY, stagingBuffer, stagingBufferMemory);
-
-		// Binding the data to the staging buffer
-		void* stageData;
-		vmaMapMemory(s_Allocator, stagingBufferMemory.allocation, &stageData);
-		memcpy(stageData, data, (size_t)size);
-		vmaUnmapMemory(s_Allocator, stagingBufferMemory.allocation);
-
 		// Creating the buffer allocated on the gpu
 		AllocateBuffer(size, usage, MemoryUsage::GPU_ONLY, buffer, bufferMemory);
 
-
-		// Copying the data from the staging buffer to the allocated one on the gpu
-		VkCommandBuffer cmdBuf = VulkanContext::GetCurrentDevice()->AllocateCommandBuffer(RenderQueueType::Graphics, true);
-		VkBufferCopy copyRegion{};
-		copyRegion.size = size;
-		vkCmdCopyBuffer(cmdBuf, stagingBuffer, buffer, 1, &copyRegion);
-		VulkanContext::GetCurrentDevice()->FlushCommandBuffer(cmdBuf);
-
-		vmaDestroyBuffer(s_Allocator, stagingBuffer, stagingBufferMemory.allocation);
+		// The data goes through the staging ring, the copy is submitted together with the other uploads (before the next frame)
+		return VulkanUploadManager::UploadBuffer(buffer, data, size);
 	}
 
 	void VulkanAllocator::AllocateMemoryForImage(VkImage& image, VulkanMemoryInfo& memory)
@@ -131,19 +110,13 @@ namespace Frost
 
 	void VulkanAllocator::DeleteBuffer(VkBuffer& buffer, VulkanMemoryInfo& memory)
 	{
+		VulkanUploadManager::OnBufferDestroyed(buffer);
 		vmaDestroyBuffer(s_Allocator, buffer, memory.allocation);
 	}
 
-	void VulkanAllocator::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size)
+	UploadToken VulkanAllocator::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size)
 	{
-		VkCommandBuffer cmdBuf = VulkanContext::GetCurrentDevice()->AllocateCommandBuffer(RenderQueueType::Graphics, true);
-
-		VkBufferCopy copyRegion{};
-		copyRegion.size = size;
-
-		vkCmdCopyBuffer(cmdBuf, srcBuffer, dstBuffer, 1, &copyRegion);
-
-		VulkanContext::GetCurrentDevice()->FlushCommandBuffer(cmdBuf);
+		return VulkanUploadManager::CopyBuffer(srcBuffer, dstBuffer, size);
 	}
 
 	void VulkanAllocator::BindBuffer(VkBuffer& buffer, VulkanMemoryInfo& memory, void** data)
@@ -156,6 +129,11 @@ namespace Frost
 		vmaUnmapMemory(s_Allocator, memory.allocation);
 	}
 
+	void VulkanAllocator::InvalidateBuffer(VulkanMemoryInfo& memory)
+	{
+		vmaInvalidateAllocation(s_Allocator, memory.allocation, 0, VK_WHOLE_SIZE);
+	}
+
 	GPUMemoryStats VulkanAllocator::GetMemoryStats()
 	{
 		if (s_AllocatorDestroyed) return GPUMemoryStats(UINT64_MAX, UINT64_MAX);
@@ -2,6 +2,7 @@
 
 #include "Frost/Platform/Vulkan/Vulkan.h"
 #include "Frost/Renderer/Buffers/BufferDevice.h"
+#include "Frost/Platform/Vulkan/Buffers/VulkanUploadManager.h"
 
 using VmaAllocation = struct VmaAllocation_T*;
 enum VmaMemoryUsage;
@@ -47,17 +48,20 @@ namespace Frost
 
 	public:
 		static void AllocateBuffer(VkDeviceSize size, std::vector<BufferUsage> usage, MemoryUsage memoryFlags, VkBuffer& buffer, VulkanMemoryInfo& bufferMemory);
-		static void AllocateBuffer(VkDeviceSize size, std::vector<BufferUsage> usage, VkBuffer& buffer, VulkanMemoryInfo& bufferMemory, void* data);
+		// Creates a GPU only buffer and uploads `data` into it through the `VulkanUploadManager` (it doesn't wait for the upload to finish)
+		static UploadToken AllocateBuffer(VkDeviceSize size, std::vector<BufferUsage> usage, VkBuffer& buffer, VulkanMemoryInfo& bufferMemory, void* data);
 
 		static void BindBuffer(VkBuffer& buffer, VulkanMemoryInfo& memory, void** data);
 		static void UnbindBuffer(VulkanMemoryInfo& memory);
+		// Needed before reading a mapped `GPU_TO_CPU` buffer, because its memory might not be host coherent
+		static void InvalidateBuffer(VulkanMemoryInfo& memory);
 
 		static void AllocateMemoryForImage(VkImage& image, VulkanMemoryInfo& memory);
 		static void AllocateImage(VkImageCreateInfo imageCreateInfo, MemoryUsage memoryFlags, VkImage& image, VulkanMemoryInfo& memory);
 		static void DestroyImage(const VkImage& image, const VulkanMemoryInfo& memory);
 
 		static void DeleteBuffer(VkBuffer& buffer, VulkanMemoryInfo& memory);
-		static void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
+		static UploadToken CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
 
 		static GPUMemoryStats GetMemoryStats();
 	private:
@@ -97,6 +97,21 @@ namespace Frost
 		VulkanAllocator::UnbindBuffer(m_BufferMemory);
 	}
 
+	void VulkanBufferDevice::SetData(void* data, const Vector<BufferRegion>& regions)
+	{
+		if (regions.empty()) return;
+
+		// Mapping the buffer only once for all the regions
+		void* copyData;
+		VulkanAllocator::BindBuffer(m_Buffer, m_BufferMemory, &copyData);
+		for (const auto& region : regions)
+		{
+			FROST_ASSERT(!(region.Offset + region.Size > m_BufferData.Size), "Buffer overflow!");
+			memcpy((Byte*)copyData + region.Offset, (Byte*)data + region.Offset, region.Size);
+		}
+		VulkanAllocator::UnbindBuffer(m_BufferMemory);
+	}
+
 	void VulkanBufferDevice::GetBufferAddress()
 	{
 		// Getting the buffer address
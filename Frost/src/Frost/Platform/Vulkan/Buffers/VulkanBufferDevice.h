@@ -20,6 +20,7 @@ namespace Frost
 		virtual BufferData GetBufferData() const override { return m_BufferData; }
 		virtual void SetData(uint64_t size, void* data) override;
 		virtual void SetData(void* data) override;
+		virtual void SetData(void* data, const Vector<BufferRegion>& regions) override;
 
 		VkBuffer GetVulkanBuffer() const { return m_Buffer; }
 		VkDeviceAddress GetVulkanBufferAddress() const { return m_BufferAddress; }
@@ -0,0 +1,365 @@
+#include "frostpch.h"
+#include "VulkanUploadManager.h"
+
+#include <mutex>
+
+#include "Frost/Math/Alignment.h"
+#include "Frost/Platform/Vulkan/VulkanContext.h"
+#include "Frost/Platform/Vulkan/Buffers/VulkanBufferAllocator.h"
+
+namespace Frost
+{
+	////////////////////////////////////////////////////
+	// 	   UPLOAD MANAGER
+	////////////////////////////////////////////////////
+
+	// Staging offsets are aligned to this, which covers `optimalBufferCopyOffsetAlignment` on every desktop GPU
+	static constexpr VkDeviceSize s_StagingAlignment = 256;
+
+	namespace Vulkan
+	{
+		struct UploadBatch
+		{
+			UploadToken Token = 0;
+			VkCommandBuffer CommandBuffer = VK_NULL_HANDLE;
+			VkFence Fence = VK_NULL_HANDLE;
+
+			// Uploads which didn't fit into the ring get their own staging buffer, destroyed once the batch is finished
+			Vector<std::pair<VkBuffer, VulkanMemoryInfo>> DedicatedStagingBuffers;
+		};
+
+		struct UploadManagerData
+		{
+			VkCommandPool CommandPool;
+
+			VkBuffer StagingBuffer;
+			VulkanMemoryInfo StagingBufferMemory;
+			Byte* StagingBufferData = nullptr;
+			UploadRingAllocator StagingRing;
+
+			UploadBatch OpenBatch;
+			bool IsBatchOpen = false;
+			std::deque<UploadBatch> InFlightBatches;
+
+			Vector<VkCommandBuffer> FreeCommandBuffers;
+			Vector<VkFence> FreeFences;
+
+			UploadToken NextToken = 1;
+			UploadToken LastSubmittedToken = 0;
+			UploadToken LastCompletedToken = 0;
+
+			// Last batch which wrote into each buffer (so destroying a buffer can wait for its pending uploads)
+			HashMap<VkBuffer, UploadToken> LastUploadToBuffer;
+
+			// Recursive, because waiting/flushing is also done from inside the other functions
+			std::recursive_mutex Mutex;
+
+			VulkanUploadManager::Stats Stats;
+		};
+	}
+
+	static Vulkan::UploadManagerData* s_Data = nullptr;
+
+	void VulkanUploadManager::Init(uint64_t stagingRingSize)
+	{
+		s_Data = new Vulkan::UploadManagerData();
+
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+		uint32_t graphicsFamilyIndex = VulkanContext::GetCurrentDevice()->GetQueueFamilies().GraphicsFamily.Index;
+
+		VkCommandPoolCreateInfo cmdPoolInfo{ VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+		cmdPoolInfo.queueFamilyIndex = graphicsFamilyIndex;
+		cmdPoolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+		FROST_VKCHECK(vkCreateCommandPool(device, &cmdPoolInfo, nullptr, &s_Data->CommandPool));
+
+		// The staging ring stays mapped for the whole lifetime of the engine
+		stagingRingSize = Math::AlignUp<uint64_t>(stagingRingSize, s_StagingAlignment);
+		VulkanAllocator::AllocateBuffer(stagingRingSize, { BufferUsage::TransferSrc }, MemoryUsage::CPU_ONLY, s_Data->StagingBuffer, s_Data->StagingBufferMemory);
+		VulkanContext::SetStructDebugName("StagingRingBuffer", VK_OBJECT_TYPE_BUFFER, s_Data->StagingBuffer);
+		VulkanAllocator::BindBuffer(s_Data->StagingBuffer, s_Data->StagingBufferMemory, (void**)&s_Data->StagingBufferData);
+
+		s_Data->StagingRing.Init(stagingRingSize);
+	}
+
+	void VulkanUploadManager::ShutDown()
+	{
+		if (!s_Data) return;
+
+		Wait(Flush());
+
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+
+		for (VkFence fence : s_Data->FreeFences)
+			vkDestroyFence(device, fence, nullptr);
+		vkDestroyCommandPool(device, s_Data->CommandPool, nullptr);
+
+		VulkanAllocator::UnbindBuffer(s_Data->StagingBufferMemory);
+		VulkanAllocator::DeleteBuffer(s_Data->StagingBuffer, s_Data->StagingBufferMemory);
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	void VulkanUploadManager::BeginBatch()
+	{
+		if (s_Data->IsBatchOpen) return;
+
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+
+		Vulkan::UploadBatch& batch = s_Data->OpenBatch;
+		batch.Token = s_Data->NextToken++;
+
+		if (!s_Data->FreeCommandBuffers.empty())
+		{
+			batch.CommandBuffer = s_Data->FreeCommandBuffers.back();
+			s_Data->FreeCommandBuffers.pop_back();
+		}
+		else
+		{
+			VkCommandBufferAllocateInfo allocInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+			allocInfo.commandPool = s_Data->CommandPool;
+			allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			allocInfo.commandBufferCount = 1;
+			FROST_VKCHECK(vkAllocateCommandBuffers(device, &allocInfo, &batch.CommandBuffer));
+		}
+
+		VkCommandBufferBeginInfo beginInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		FROST_VKCHECK(vkBeginCommandBuffer(batch.CommandBuffer, &beginInfo));
+
+		// Buffers can be updated while older frames are still reading them, so the copies wait for the previous submissions
+		vkCmdPipelineBarrier(batch.CommandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 0, nullptr);
+
+		s_Data->IsBatchOpen = true;
+	}
+
+	bool VulkanUploadManager::AllocateFromStagingRing(VkDeviceSize size, VkDeviceSize& outOffset)
+	{
+		if (size > s_Data->StagingRing.GetCapacity())
+			return false;
+
+		while (!s_Data->StagingRing.Allocate(size, s_StagingAlignment, outOffset))
+		{
+			// The ring is full, so the space has to come from the batches that are still in use (the open one included)
+			if (s_Data->InFlightBatches.empty())
+				Flush();
+
+			WaitForOldestBatch();
+		}
+		return true;
+	}
+
+	UploadToken VulkanUploadManager::UploadBuffer(VkBuffer dstBuffer, const void* data, VkDeviceSize size, VkDeviceSize dstOffset)
+	{
+		if (size == 0 || !data) return 0;
+
+		std::scoped_lock<std::recursive_mutex> lock(s_Data->Mutex);
+
+		// Allocate the staging memory before opening the batch, since a full ring might have to flush the open batch
+		VkBuffer stagingBuffer = VK_NULL_HANDLE;
+		VkDeviceSize stagingOffset = 0;
+		VulkanMemoryInfo dedicatedStagingMemory{};
+		bool isDedicated = !AllocateFromStagingRing(size, stagingOffset);
+		if (isDedicated)
+		{
+			VulkanAllocator::AllocateBuffer(size, { BufferUsage::TransferSrc }, MemoryUsage::CPU_ONLY, stagingBuffer, dedicatedStagingMemory);
+
+			void* stagingData;
+			VulkanAllocator::BindBuffer(stagingBuffer, dedicatedStagingMemory, &stagingData);
+			memcpy(stagingData, data, (size_t)size);
+			VulkanAllocator::UnbindBuffer(dedicatedStagingMemory);
+
+			s_Data->Stats.DedicatedStagingBuffers++;
+		}
+		else
+		{
+			stagingBuffer = s_Data->StagingBuffer;
+			memcpy(s_Data->StagingBufferData + stagingOffset, data, (size_t)size);
+		}
+
+		BeginBatch();
+		Vulkan::UploadBatch& batch = s_Data->OpenBatch;
+
+		if (isDedicated)
+			batch.DedicatedStagingBuffers.push_back({ stagingBuffer, dedicatedStagingMemory });
+
+		VkBufferCopy copyRegion{};
+		copyRegion.srcOffset = stagingOffset;
+		copyRegion.dstOffset = dstOffset;
+		copyRegion.size = size;
+		vkCmdCopyBuffer(batch.CommandBuffer, stagingBuffer, dstBuffer, 1, &copyRegion);
+
+		s_Data->LastUploadToBuffer[dstBuffer] = batch.Token;
+		s_Data->Stats.UploadedBytes += size;
+		return batch.Token;
+	}
+
+	UploadToken VulkanUploadManager::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size)
+	{
+		if (size == 0) return 0;
+
+		std::scoped_lock<std::recursive_mutex> lock(s_Data->Mutex);
+
+		BeginBatch();
+		Vulkan::UploadBatch& batch = s_Data->OpenBatch;
+
+		VkBufferCopy copyRegion{};
+		copyRegion.size = size;
+		vkCmdCopyBuffer(batch.CommandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+
+		s_Data->LastUploadToBuffer[srcBuffer] = batch.Token;
+		s_Data->LastUploadToBuffer[dstBuffer] = batch.Token;
+		return batch.Token;
+	}
+
+	UploadToken VulkanUploadManager::RecordCommands(const std::function<void(VkCommandBuffer)>& recordFunc)
+	{
+		std::scoped_lock<std::recursive_mutex> lock(s_Data->Mutex);
+
+		BeginBatch();
+		Vulkan::UploadBatch& batch = s_Data->OpenBatch;
+
+		recordFunc(batch.CommandBuffer);
+		return batch.Token;
+	}
+
+	UploadToken VulkanUploadManager::Flush()
+	{
+		// One-time command buffers can be flushed before the manager is initialized (or after it was shut down)
+		if (!s_Data) return 0;
+
+		std::scoped_lock<std::recursive_mutex> lock(s_Data->Mutex);
+		if (!s_Data->IsBatchOpen)
+			return s_Data->LastSubmittedToken;
+
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+		VkQueue graphicsQueue = VulkanContext::GetCurrentDevice()->GetQueueFamilies().GraphicsFamily.Queue;
+
+		Vulkan::UploadBatch& batch = s_Data->OpenBatch;
+
+		// Make the copies visible to everything that is submitted after this batch
+		VkMemoryBarrier memoryBarrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+		memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		memoryBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+		vkCmdPipelineBarrier(batch.CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+		FROST_VKCHECK(vkEndCommandBuffer(batch.CommandBuffer));
+
+		if (!s_Data->FreeFences.empty())
+		{
+			batch.Fence = s_Data->FreeFences.back();
+			s_Data->FreeFences.pop_back();
+		}
+		else
+		{
+			VkFenceCreateInfo fenceCreateInfo{ VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+			FROST_VKCHECK(vkCreateFence(device, &fenceCreateInfo, nullptr, &batch.Fence));
+		}
+
+		VkSubmitInfo submitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO };
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &batch.CommandBuffer;
+		FROST_VKCHECK(vkQueueSubmit(graphicsQueue, 1, &submitInfo, batch.Fence));
+
+		UploadToken token = batch.Token;
+		s_Data->StagingRing.CloseBatch(token);
+		s_Data->InFlightBatches.push_back(std::move(batch));
+		s_Data->OpenBatch = {};
+		s_Data->IsBatchOpen = false;
+
+		s_Data->LastSubmittedToken = token;
+		s_Data->Stats.SubmittedBatches++;
+		return token;
+	}
+
+	void VulkanUploadManager::Update()
+	{
+		if (!s_Data) return;
+
+		std::scoped_lock<std::recursive_mutex> lock(s_Data->Mutex);
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+
+		// Batches are submitted to the same queue, so they also finish in order
+		while (!s_Data->InFlightBatches.empty())
+		{
+			Vulkan::UploadBatch& batch = s_Data->InFlightBatches.front();
+			if (vkGetFenceStatus(device, batch.Fence) != VK_SUCCESS)
+				break;
+
+			for (auto& [stagingBuffer, stagingMemory] : batch.DedicatedStagingBuffers)
+				VulkanAllocator::DeleteBuffer(stagingBuffer, stagingMemory);
+
+			FROST_VKCHECK(vkResetFences(device, 1, &batch.Fence));
+			s_Data->FreeFences.push_back(batch.Fence);
+			s_Data->FreeCommandBuffers.push_back(batch.CommandBuffer);
+
+			s_Data->LastCompletedToken = batch.Token;
+			s_Data->InFlightBatches.pop_front();
+		}
+
+		s_Data->StagingRing.RetireBatches(s_Data->LastCompletedToken);
+		s_Data->Stats.StagingRingUsage = s_Data->StagingRing.GetUsedSize();
+
+		for (auto it = s_Data->LastUploadToBuffer.begin(); it != s_Data->LastUploadToBuffer.end();)
+		{
+			if (it->second <= s_Data->LastCompletedToken)
+				it = s_Data->LastUploadToBuffer.erase(it);
+			else
+				it++;
+		}
+	}
+
+	void VulkanUploadManager::WaitForOldestBatch()
+	{
+		if (s_Data->InFlightBatches.empty()) return;
+
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+		FROST_VKCHECK(vkWaitForFences(device, 1, &s_Data->InFlightBatches.front().Fence, VK_TRUE, UINT64_MAX));
+		Update();
+	}
+
+	bool VulkanUploadManager::IsComplete(UploadToken token)
+	{
+		if (token == 0 || !s_Data) return true;
+
+		std::scoped_lock<std::recursive_mutex> lock(s_Data->Mutex);
+		if (token > s_Data->LastCompletedToken)
+			Update();
+		return token <= s_Data->LastCompletedToken;
+	}
+
+	void VulkanUploadManager::Wait(UploadToken token)
+	{
+		if (token == 0 || !s_Data) return;
+
+		std::scoped_lock<std::recursive_mutex> lock(s_Data->Mutex);
+
+		// The batch of the token might not have been submitted yet
+		if (s_Data->IsBatchOpen && token >= s_Data->OpenBatch.Token)
+			Flush();
+
+		Update();
+		while (token > s_Data->LastCompletedToken && !s_Data->InFlightBatches.empty())
+			WaitForOldestBatch();
+	}
+
+	void VulkanUploadManager::OnBufferDestroyed(VkBuffer buffer)
+	{
+		if (!s_Data) return;
+
+		std::scoped_lock<std::recursive_mutex> lock(s_Data->Mutex);
+
+		auto it = s_Data->LastUploadToBuffer.find(buffer);
+		if (it == s_Data->LastUploadToBuffer.end())
+			return;
+
+		UploadToken token = it->second;
+		s_Data->LastUploadToBuffer.erase(it);
+		Wait(token);
+	}
+
+	const VulkanUploadManager::Stats& VulkanUploadManager::GetStats()
+	{
+		return s_Data->Stats;
+	}
+}
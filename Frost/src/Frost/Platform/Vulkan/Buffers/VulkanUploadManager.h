@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Frost/Platform/Vulkan/Vulkan.h"
+#include "Frost/Platform/Vulkan/Buffers/UploadRingAllocator.h"
+
+namespace Frost
+{
+	// Identifies the batch in which an upload was recorded. An upload is finished once its batch has finished executing on the GPU.
+	// A token of 0 is always complete
+	using UploadToken = uint64_t;
+
+	// Records buffer uploads into batches, instead of submitting (and waiting for) a command buffer for every upload.
+	// The data is copied into a persistently mapped staging ring, the copy commands are recorded into the currently open batch
+	// and the batch is submitted on `Flush` (before the frame is submitted, or before any other one-time command buffer).
+	// Each batch gets a fence, so completion is tracked without stalling, and the staging memory is recycled once the batch is finished.
+	// NOTE: Batches are submitted to the graphics queue, they end with a memory barrier so any later submission on that queue sees the uploaded data.
+	class VulkanUploadManager
+	{
+	public:
+		struct Stats
+		{
+			uint64_t UploadedBytes = 0;       // Bytes uploaded since startup
+			uint32_t SubmittedBatches = 0;    // Batches submitted since startup
+			uint32_t DedicatedStagingBuffers = 0; // Uploads which were too big for the ring
+			uint64_t StagingRingUsage = 0;    // Bytes of the ring used by batches that are still in flight
+		};
+
+		static void Init(uint64_t stagingRingSize);
+		static void ShutDown();
+
+		// Copies `data` into the staging memory and records the copy into `dstBuffer`. `data` can be freed right after the call
+		static UploadToken UploadBuffer(VkBuffer dstBuffer, const void* data, VkDeviceSize size, VkDeviceSize dstOffset = 0);
+		static UploadToken CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
+
+		// Records custom commands into the open batch (e.g. acceleration structure builds), so they don't need their own submission.
+		// The commands are executed after every upload recorded before them. `recordFunc` is called right away
+		static UploadToken RecordCommands(const std::function<void(VkCommandBuffer)>& recordFunc);
+
+		// Submits the open batch (if it has any commands). Returns the token of the submitted batch
+		static UploadToken Flush();
+
+		// Retires the finished batches (and recycles their staging memory). It never blocks
+		static void Update();
+
+		static bool IsComplete(UploadToken token);
+		static void Wait(UploadToken token);
+
+		// Makes sure no pending upload writes into a buffer which is about to be destroyed
+		static void OnBufferDestroyed(VkBuffer buffer);
+
+		static const Stats& GetStats();
+	private:
+		static void BeginBatch();
+		// Returns false if the upload is bigger than the whole ring. Blocks (on the oldest batches) only when the ring is full
+		static bool AllocateFromStagingRing(VkDeviceSize size, VkDeviceSize& outOffset);
+		static void WaitForOldestBatch();
+	};
+}
@@ -1,7 +1,9 @@
 #include "frostpch.h"
 #include "VulkanAccelerationStructure.h"
 
+#include "Frost/Renderer/Renderer.h"
 #include "Frost/Platform/Vulkan/VulkanContext.h"
+#include "Frost/Platform/Vulkan/RayTracing/VulkanAccelerationStructureBuilder.h"
 
 #include "Frost/Platform/Vulkan/Buffers/VulkanVertexBuffer.h"
 #include "Frost/Platform/Vulkan/Buffers/VulkanIndexBuffer.h"
@@ -11,10 +13,13 @@ namespace Frost
 {
 
 	VulkanBottomLevelAccelerationStructure::VulkanBottomLevelAccelerationStructure(const MeshASInfo& meshInfo)
+		: m_VertexBuffer(meshInfo.MeshVertexBuffer), m_IndexBuffer(meshInfo.MeshIndexBuffer)
 	{
 		m_GeometryInfo = MeshToVkGeometry(meshInfo);
-		BuildBLAS(m_GeometryInfo);
+		CreateAccelerationStructure();
 		UpdateInstanceInfo();
+
+		VulkanAccelerationStructureBuilder::EnqueueBuild(this);
 	}
 
 	VulkanBottomLevelAccelerationStructure::~VulkanBottomLevelAccelerationStructure()
@@ -78,182 +83,52 @@ namespace Frost
 		return input;
 	}
 
-	void VulkanBottomLevelAccelerationStructure::BuildBLAS(GeometryInfo geomtryInfo)
+	VkAccelerationStructureBuildGeometryInfoKHR VulkanBottomLevelAccelerationStructure::GetBuildGeometryInfo() const
 	{
-		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
-		VkBuildAccelerationStructureFlagsKHR flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR;
-
 		VkAccelerationStructureBuildGeometryInfoKHR buildInfos{ VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR };
-		buildInfos.flags = flags;
-		buildInfos.geometryCount = (uint32_t)geomtryInfo.Geometry.size();
-		buildInfos.pGeometries = geomtryInfo.Geometry.data();
+		buildInfos.flags = s_BuildFlags;
+		buildInfos.geometryCount = (uint32_t)m_GeometryInfo.Geometry.size();
+		buildInfos.pGeometries = m_GeometryInfo.Geometry.data();
 		buildInfos.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
 		buildInfos.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
-		buildInfos.srcAccelerationStructure = m_AccelerationStructure ? m_AccelerationStructure : VK_NULL_HANDLE;
+		return buildInfos;
+	}
+
+	void VulkanBottomLevelAccelerationStructure::CreateAccelerationStructure()
+	{
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+		VkAccelerationStructureBuildGeometryInfoKHR buildInfos = GetBuildGeometryInfo();
 
 		// Query both the size of the finished acceleration structure and the  amount of scratch memory
 		// needed (both written to sizeInfo). The `vkGetAccelerationStructureBuildSizesKHR` function
 		// computes the worst case memory requirements based on the user-reported max number of
-		// primitives. Later, compaction can fix this potential inefficiency.
-		Vector<uint32_t> maxPrimCount(geomtryInfo.BuildOffsetInfo.size());
-		for (auto i = 0; i < geomtryInfo.BuildOffsetInfo.size(); i++)
-			maxPrimCount[i] = geomtryInfo.BuildOffsetInfo[i].primitiveCount;
+		// primitives. The compaction (done by the builder, after the build) fixes this potential inefficiency.
+		Vector<uint32_t> maxPrimCount(m_GeometryInfo.BuildOffsetInfo.size());
+		for (auto i = 0; i < m_GeometryInfo.BuildOffsetInfo.size(); i++)
+			maxPrimCount[i] = m_GeometryInfo.BuildOffsetInfo[i].primitiveCount;
 
 		VkAccelerationStructureBuildSizesInfoKHR sizeInfo{ VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR };
 		vkGetAccelerationStructureBuildSizesKHR(device, VK_ACCELERATION_STRUCTURE_BUILD_TYPE_DEVICE_KHR, &buildInfos, maxPrimCount.data(), &sizeInfo);
 
-		{
-			// Build the acceleration structure
-			VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
-			m_ASBufferSize = (uint32_t)sizeInfo.accelerationStructureSize;
-
-			Vector<BufferUsage> usages;
-			usages.push_back(BufferUsage::AccelerationStructure);
-			usages.push_back(BufferUsage::ShaderAddress);
-			usages.push_back(BufferUsage::Storage);
-
-			VulkanAllocator::AllocateBuffer(m_ASBufferSize, usages, MemoryUsage::GPU_ONLY, m_ASBuffer, m_ASBufferMemory);
-
-			VkAccelerationStructureCreateInfoKHR asInfo{ VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR };
-			asInfo.size = m_ASBufferSize;
-			asInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
-			asInfo.buffer = m_ASBuffer;
-
-			vkCreateAccelerationStructureKHR(device, &asInfo, nullptr, &m_AccelerationStructure);
-
-			VulkanContext::SetStructDebugName("BottomLevel-AccelerationStructure", VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR, m_AccelerationStructure);
-			VulkanContext::SetStructDebugName("BottomLevel-AccelerationStructure-Buffer", VK_OBJECT_TYPE_BUFFER, m_ASBuffer);
-			buildInfos.dstAccelerationStructure = m_AccelerationStructure;
-		}
+		m_ASBufferSize = sizeInfo.accelerationStructureSize;
+		m_BuildScratchSize = sizeInfo.buildScratchSize;
 
+		Vector<BufferUsage> usages;
+		usages.push_back(BufferUsage::AccelerationStructure);
+		usages.push_back(BufferUsage::ShaderAddress);
+		usages.push_back(BufferUsage::Storage);
 
-		VkDeviceSize scratchBufferSize = sizeInfo.buildScratchSize;
+		VulkanAllocator::AllocateBuffer(m_ASBufferSize, usages, MemoryUsage::GPU_ONLY, m_ASBuffer, m_ASBufferMemory);
 
-		// Allocate the scratch buffers holding the temporary data of the acceleration structure builder
-		VkBuffer scratchBuffer;
-		VulkanMemoryInfo scratchMemoryBuffer;
-		VulkanAllocator::AllocateBuffer(scratchBufferSize,
-			{ BufferUsage::Storage, BufferUsage::ShaderAddress },
-			MemoryUsage::GPU_ONLY,
-			scratchBuffer, scratchMemoryBuffer);
+		VkAccelerationStructureCreateInfoKHR asInfo{ VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR };
+		asInfo.size = m_ASBufferSize;
+		asInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
+		asInfo.buffer = m_ASBuffer;
 
+		vkCreateAccelerationStructureKHR(device, &asInfo, nullptr, &m_AccelerationStructure);
 
-		// Is compaction requested?
-		bool doCompaction = (flags & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR) == VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR;
-
-		// Allocate a query pool for storing the needed size for every BLAS compaction.
-		VkQueryPoolCreateInfo queryPoolCreateInfo{ VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
-		queryPoolCreateInfo.queryCount = 1;
-		queryPoolCreateInfo.queryType = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR;
-		VkQueryPool queryPool;
-		vkCreateQueryPool(device, &queryPoolCreateInfo, nullptr, &queryPool);
-		vkResetQueryPool(device, queryPool, 0, 1);
-
-
-
-		{
-			VkCommandBuffer cmdBuf = VulkanContext::GetCurrentDevice()->AllocateCommandBuffer(RenderQueueType::Graphics, true);
-
-			// Convert user vector of offsets to vector of pointer-to-offset (required by vk).
-			// This defines which (sub)section of the vertex/index arrays will be built into the BLAS.
-			Vector<const VkAccelerationStructureBuildRangeInfoKHR*> pBuildOffset(geomtryInfo.BuildOffsetInfo.size());
-			for (size_t i = 0; i < geomtryInfo.BuildOffsetInfo.size(); i++)
-				pBuildOffset[i] = &geomtryInfo.BuildOffsetInfo[i];
-
-			VkBufferDeviceAddressInfo bufferInfo{ VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO };
-			bufferInfo.buffer = scratchBuffer;
-			VkDeviceAddress scratchAddress = vkGetBufferDeviceAddress(device, &bufferInfo);
-
-			buildInfos.scratchData.deviceAddress = scratchAddress;
-			vkCmdBuildAccelerationStructuresKHR(cmdBuf, 1, &buildInfos, pBuildOffset.data());
-
-
-			VkMemoryBarrier barrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER };
-			barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
-			barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
-			vkCmdPipelineBarrier(cmdBuf,
-				VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
-				VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
-				0, 1, &barrier,
-				0, nullptr,
-				0, nullptr
-			);
-
-			// Write compacted size to query number idx.
-			if (doCompaction)
-			{
-				vkCmdWriteAccelerationStructuresPropertiesKHR(cmdBuf, 1, &m_AccelerationStructure,
-					VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, queryPool, 0);
-			}
-
-			VulkanContext::GetCurrentDevice()->FlushCommandBuffer(cmdBuf);
-		}
-
-
-
-		// Compacting all BLAS
-		if (doCompaction)
-		{
-			VkCommandBuffer cmdBuf = VulkanContext::GetCurrentDevice()->AllocateCommandBuffer(RenderQueueType::Graphics, true);
-
-			// Get the size result back
-			Vector<VkDeviceSize> compactSize(1);
-			vkGetQueryPoolResults(device, queryPool, 0,
-								  static_cast<uint32_t>(compactSize.size()), static_cast<uint32_t>(compactSize.size() * sizeof(VkDeviceSize)), compactSize.data(),
-								  sizeof(VkDeviceSize), VK_QUERY_RESULT_WAIT_BIT);
-
-
-			// Compacting
-			VkAccelerationStructureKHR cleanUpAS;
-			VkBuffer cleanUpASBuffer;
-			VulkanMemoryInfo cleanUpASBufferMemory;
-
-			{
-				// Creating a compact version of the AS
-				VkAccelerationStructureKHR compactedAS;
-				VkBuffer compactedASBuffer;
-				VulkanMemoryInfo compactedASBufferMemory;
-
-				Vector<BufferUsage> usages = { BufferUsage::AccelerationStructure, BufferUsage::ShaderAddress };
-				VulkanAllocator::AllocateBuffer(compactSize[0], usages, MemoryUsage::GPU_ONLY, compactedASBuffer, compactedASBufferMemory);
-
-				VkAccelerationStructureCreateInfoKHR asInfo{ VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR };
-				asInfo.size = compactSize[0];
-				asInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
-				asInfo.buffer = m_ASBuffer;
-				vkCreateAccelerationStructureKHR(device, &asInfo, nullptr, &compactedAS);
-
-
-				// Copy the original BLAS to a compact version
-				VkCopyAccelerationStructureInfoKHR copyInfo{ VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR };
-				copyInfo.src = m_AccelerationStructure;
-				copyInfo.dst = compactedAS;
-				copyInfo.mode = VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR;
-				vkCmdCopyAccelerationStructureKHR(cmdBuf, &copyInfo);
-
-				cleanUpAS = m_AccelerationStructure;
-				cleanUpASBuffer = m_ASBuffer;
-				cleanUpASBufferMemory = m_ASBufferMemory;
-
-				m_AccelerationStructure = compactedAS;
-				m_ASBuffer = compactedASBuffer;
-				m_ASBufferMemory = compactedASBufferMemory;
-			}
-			VulkanContext::GetCurrentDevice()->FlushCommandBuffer(cmdBuf);
-
-
-
-			// Destroying the previous version
-			vkDestroyAccelerationStructureKHR(device, cleanUpAS, nullptr);
-			VulkanAllocator::DeleteBuffer(cleanUpASBuffer, cleanUpASBufferMemory);
-
-			VulkanContext::SetStructDebugName("BottomLevel-AccelerationStructure", VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR, m_AccelerationStructure);
-			VulkanContext::SetStructDebugName("BottomLevel-AccelerationStructure-Buffer", VK_OBJECT_TYPE_BUFFER, m_ASBuffer);
-		}
-
-
-		VulkanAllocator::DeleteBuffer(scratchBuffer, scratchMemoryBuffer);
-		vkDestroyQueryPool(device, queryPool, nullptr);
+		VulkanContext::SetStructDebugName("BottomLevel-AccelerationStructure", VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR, m_AccelerationStructure);
+		VulkanContext::SetStructDebugName("BottomLevel-AccelerationStructure-Buffer", VK_OBJECT_TYPE_BUFFER, m_ASBuffer);
 	}
 
 	void VulkanBottomLevelAccelerationStructure::UpdateInstanceInfo()
@@ -284,6 +159,8 @@ namespace Frost
 	void VulkanBottomLevelAccelerationStructure::Destroy()
 	{
 		if (m_AccelerationStructure == VK_NULL_HANDLE) return;
+		VulkanAccelerationStructureBuilder::OnStructureDestroyed(this);
+
 		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
 		vkDestroyAccelerationStructureKHR(device, m_AccelerationStructure, nullptr);
 		VulkanAllocator::DeleteBuffer(m_ASBuffer, m_ASBufferMemory);
@@ -337,9 +214,13 @@ namespace Frost
 		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
 		vkDestroyAccelerationStructureKHR(device, m_AccelerationStructure, nullptr);
 		VulkanAllocator::DeleteBuffer(m_ASBuffer, m_ASBufferMemory);
+		VulkanAllocator::DeleteBuffer(m_ScratchBuffer, m_ScratchBufferMemory);
 		m_InstanceBuffer->Destroy();
 
 		m_AccelerationStructure = VK_NULL_HANDLE;
+		m_ScratchBuffer = VK_NULL_HANDLE;
+		m_ScratchBufferSize = 0;
+		m_Instances.clear();
 	}
 
 	VkAccelerationStructureInstanceKHR VulkanTopLevelAccelertionStructure::InstanceToVkGeometryInstance (
@@ -370,35 +251,62 @@ namespace Frost
 		return accelerationStructureInstanceInfo;
 	}
 
-	void VulkanTopLevelAccelertionStructure::BuildTLAS(std::vector<VkAccelerationStructureInstanceKHR>& instances)
+	bool VulkanTopLevelAccelertionStructure::CanBeRefitted(const Vector<VkAccelerationStructureInstanceKHR>& instances) const
 	{
-		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
-		uint32_t graphicsQueueIndex = VulkanContext::GetCurrentDevice()->GetQueueFamilies().GraphicsFamily.Index;
-		auto flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_BUILD_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR;
+		if (!m_AccelerationStructure || instances.size() != m_Instances.size())
+			return false;
 
-		
-		VkCommandBuffer cmdBuf = VulkanContext::GetCurrentDevice()->AllocateCommandBuffer(RenderQueueType::Graphics, true);
-		
-		if (!m_AccelerationStructure)
+		// Refitting keeps the hierarchy of the first build, so the TLAS gets slower to trace after many refits
+		if (m_RefitCount >= Renderer::GetRendererConfig().RayTracing.MaxTLASRefits)
+			return false;
+
+		// A refit can only move the instances, anything else needs a new build
+		for (size_t i = 0; i < instances.size(); i++)
 		{
-			m_InstanceBuffer = BufferDevice::Create(1000 * sizeof(VkAccelerationStructureInstanceKHR),
-											 { BufferUsage::ShaderAddress, BufferUsage::AccelerationStructureReadOnly } );
+			const VkAccelerationStructureInstanceKHR& instance = instances[i];
+			const VkAccelerationStructureInstanceKHR& lastInstance = m_Instances[i];
+
+			if (instance.accelerationStructureReference != lastInstance.accelerationStructureReference ||
+				instance.instanceCustomIndex != lastInstance.instanceCustomIndex ||
+				instance.mask != lastInstance.mask ||
+				instance.instanceShaderBindingTableRecordOffset != lastInstance.instanceShaderBindingTableRecordOffset ||
+				instance.flags != lastInstance.flags)
+			{
+				return false;
+			}
 		}
+		return true;
+	}
 
+	void VulkanTopLevelAccelertionStructure::BuildTLAS(std::vector<VkAccelerationStructureInstanceKHR>& instances)
+	{
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
+		VkCommandBuffer cmdBuf = VulkanContext::GetSwapChain()->GetRenderCommandBuffer(currentFrameIndex);
+		auto flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_BUILD_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR;
 
-		m_InstanceBuffer->SetData((uint32_t)instances.size() * sizeof(VkAccelerationStructureInstanceKHR), instances.data());
-
+		uint32_t count = (uint32_t)instances.size();
 
-		// Make sure the copy of the instance buffer are copied before triggering the acceleration structure build
-		VkMemoryBarrier barrier{};
-		barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-		barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
-		vkCmdPipelineBarrier(cmdBuf, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
-			0, 1, &barrier, 0, nullptr, 0, nullptr);
+		// Nothing changed since the last update, so the TLAS is still valid
+		if (m_AccelerationStructure && count == m_Instances.size() &&
+			memcmp(instances.data(), m_Instances.data(), count * sizeof(VkAccelerationStructureInstanceKHR)) == 0)
+		{
+			VulkanAccelerationStructureBuilder::OnTopLevelUpdated(VulkanAccelerationStructureBuilder::TopLevelUpdate::Skipped);
+			return;
+		}
 
+		bool refitTlas = CanBeRefitted(instances);
 
+		// The instance buffer (and the TLAS) are sized for `m_InstanceCapacity`, so they are only recreated when the scene grows past it
+		if (count > m_InstanceCapacity)
+		{
+			m_InstanceCapacity = std::max({ count, m_InstanceCapacity * 2, Renderer::GetRendererConfig().RayTracing.MaxInstance });
+			m_InstanceBuffer = BufferDevice::Create(m_InstanceCapacity * sizeof(VkAccelerationStructureInstanceKHR),
+											 { BufferUsage::ShaderAddress, BufferUsage::AccelerationStructureReadOnly } );
+		}
 
+		// The instance buffer is host visible and it is used only by this frame index, so it can be written right away
+		m_InstanceBuffer->SetData((uint64_t)count * sizeof(VkAccelerationStructureInstanceKHR), instances.data());
 
 
 		// Getting the device address of the created buffer (m_InstanceBuffer) with the mesh instances wrapped in VkAccelerationStructureInstanceKHR
@@ -422,30 +330,33 @@ namespace Frost
 		topASGeometry.geometryType = VK_GEOMETRY_TYPE_INSTANCES_KHR;
 		topASGeometry.geometry.instances = instancesVk;
 
-		// Find sizes
+		// Find sizes (for the whole capacity)
 		VkAccelerationStructureBuildGeometryInfoKHR buildInfo{};
 		buildInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
 		buildInfo.flags = flags;
 		buildInfo.geometryCount = 1;
 		buildInfo.pGeometries = &topASGeometry;
-		buildInfo.mode = m_AccelerationStructure ? VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR : VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
+		buildInfo.mode = refitTlas ? VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR : VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
 		buildInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR;
 		buildInfo.srcAccelerationStructure = VK_NULL_HANDLE;
 
-		uint32_t count = (uint32_t)instances.size();
 		VkAccelerationStructureBuildSizesInfoKHR sizeInfo{ VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR };
-		vkGetAccelerationStructureBuildSizesKHR(device, VK_ACCELERATION_STRUCTURE_BUILD_TYPE_DEVICE_KHR, &buildInfo, &count, &sizeInfo);
+		vkGetAccelerationStructureBuildSizesKHR(device, VK_ACCELERATION_STRUCTURE_BUILD_TYPE_DEVICE_KHR, &buildInfo, &m_InstanceCapacity, &sizeInfo);
 
 
 		// Create TLAS
-		bool updateTlas = true;
-		if (!m_AccelerationStructure)
+		if (sizeInfo.accelerationStructureSize > m_ASBufferSize)
 		{
-			// Build the acceleration structure
-			
-			VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
-			updateTlas = false;
-			m_ASBufferSize = (uint32_t)sizeInfo.accelerationStructureSize;
+			// The old TLAS was used only by this frame index, which has already finished on the GPU
+			if (m_AccelerationStructure)
+			{
+				vkDestroyAccelerationStructureKHR(device, m_AccelerationStructure, nullptr);
+				VulkanAllocator::DeleteBuffer(m_ASBuffer, m_ASBufferMemory);
+			}
+
+			refitTlas = false;
+			buildInfo.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
+			m_ASBufferSize = sizeInfo.accelerationStructureSize;
 
 			Vector<BufferUsage> usages;
 			usages.push_back(BufferUsage::AccelerationStructure);
@@ -464,32 +375,44 @@ namespace Frost
 			VulkanContext::SetStructDebugName("TopLevel-AccelerationStructure-Buffer", VK_OBJECT_TYPE_BUFFER, m_ASBuffer);
 		}
 
-		// Allocate the scratch memory
-		VkBuffer scratchBuffer;
-		VulkanMemoryInfo scratchMemoryBuffer;
-		VulkanAllocator::AllocateBuffer(sizeInfo.buildScratchSize,
-											{ BufferUsage::ShaderAddress, BufferUsage::AccelerationStructure, BufferUsage::Storage },
-											MemoryUsage::GPU_ONLY,
-											scratchBuffer, scratchMemoryBuffer);
+		// The scratch memory is kept, big enough for both the builds and the refits
+		VkDeviceSize scratchBufferSize = std::max(sizeInfo.buildScratchSize, sizeInfo.updateScratchSize);
+		if (scratchBufferSize > m_ScratchBufferSize)
+		{
+			if (m_ScratchBuffer)
+				VulkanAllocator::DeleteBuffer(m_ScratchBuffer, m_ScratchBufferMemory);
+
+			m_ScratchBufferSize = scratchBufferSize;
+			VulkanAllocator::AllocateBuffer(m_ScratchBufferSize,
+												{ BufferUsage::ShaderAddress, BufferUsage::AccelerationStructure, BufferUsage::Storage },
+												MemoryUsage::GPU_ONLY,
+												m_ScratchBuffer, m_ScratchBufferMemory);
+			VulkanContext::SetStructDebugName("TopLevel-AccelerationStructure-Scratch", VK_OBJECT_TYPE_BUFFER, m_ScratchBuffer);
+		}
 		
 		// Getting the device address of the scratch buffer
 		VkBufferDeviceAddressInfo scratchBufferInfo{};
 		scratchBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
-		scratchBufferInfo.buffer = scratchBuffer;
+		scratchBufferInfo.buffer = m_ScratchBuffer;
 		VkDeviceAddress scratchAddress = vkGetBufferDeviceAddress(device, &scratchBufferInfo);
 
 
-
-
 		// Update build information
-		buildInfo.srcAccelerationStructure = updateTlas ? m_AccelerationStructure : VK_NULL_HANDLE;
+		buildInfo.srcAccelerationStructure = refitTlas ? m_AccelerationStructure : VK_NULL_HANDLE;
 		buildInfo.dstAccelerationStructure = m_AccelerationStructure;
 		buildInfo.scratchData.deviceAddress = scratchAddress;
 
 
+		// The previous build (which used the same scratch buffer) must be finished before this one starts
+		VkMemoryBarrier barrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+		barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+		barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+		vkCmdPipelineBarrier(cmdBuf, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+			0, 1, &barrier, 0, nullptr, 0, nullptr);
+
 		// Build the TLAS (with n instances)
 		VkAccelerationStructureBuildRangeInfoKHR buildOffsetInfo{};
-		buildOffsetInfo.primitiveCount = static_cast<uint32_t>(instances.size());
+		buildOffsetInfo.primitiveCount = count;
 		buildOffsetInfo.primitiveOffset = 0;
 		buildOffsetInfo.firstVertex = 0;
 		buildOffsetInfo.transformOffset = 0;
@@ -497,11 +420,18 @@ namespace Frost
 
 		vkCmdBuildAccelerationStructuresKHR(cmdBuf, 1, &buildInfo, &pBuildOffsetInfo);
 
+		// Make sure the TLAS is built before the rays are traced
+		barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+		barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+		vkCmdPipelineBarrier(cmdBuf, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR,
+			0, 1, &barrier, 0, nullptr, 0, nullptr);
 
 
+		m_Instances = instances;
+		m_RefitCount = refitTlas ? m_RefitCount + 1 : 0;
 
-		VulkanContext::GetCurrentDevice()->FlushCommandBuffer(cmdBuf);
-		VulkanAllocator::DeleteBuffer(scratchBuffer, scratchMemoryBuffer);
+		VulkanAccelerationStructureBuilder::OnTopLevelUpdated(refitTlas ? VulkanAccelerationStructureBuilder::TopLevelUpdate::Refit
+		                                                                : VulkanAccelerationStructureBuilder::TopLevelUpdate::Build);
 	}
 
 	void VulkanTopLevelAccelertionStructure::UpdateDescriptor()
@@ -2,6 +2,7 @@
 
 #include "Frost/Platform/Vulkan/Vulkan.h"
 #include "Frost/Platform/Vulkan/Buffers/VulkanBufferAllocator.h"
+#include "Frost/Platform/Vulkan/Buffers/VulkanUploadManager.h"
 #include "Frost/Renderer/RayTracing/AccelerationStructures.h"
 
 #include "Frost/Renderer/Mesh.h"
@@ -10,18 +11,33 @@
 
 namespace Frost
 {
+	// The AS is created right away, but the build itself is queued into `VulkanAccelerationStructureBuilder` (and compacted afterwards),
+	// so it must not be used by a TLAS before `IsReady` returns true
 	class VulkanBottomLevelAccelerationStructure : public BottomLevelAccelerationStructure
 	{
 	public:
 		VulkanBottomLevelAccelerationStructure(const MeshASInfo& meshInfo);
 		virtual ~VulkanBottomLevelAccelerationStructure();
 
+		bool IsReady() const { return m_IsReady; }
+
 		virtual void Destroy() override;
 	private:
+		static constexpr VkBuildAccelerationStructureFlagsKHR s_BuildFlags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR |
+		                                                                     VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR;
+
 		VkAccelerationStructureKHR m_AccelerationStructure = VK_NULL_HANDLE;
 		VkBuffer m_ASBuffer;
 		VulkanMemoryInfo m_ASBufferMemory;
-		uint32_t m_ASBufferSize;
+		VkDeviceSize m_ASBufferSize = 0;
+		VkDeviceSize m_BuildScratchSize = 0;
+
+		bool m_IsReady = false;
+		UploadToken m_LastCommandToken = 0; // Last build/compaction recorded for this AS
+
+		// Kept alive until the build has finished on the GPU
+		Ref<VertexBuffer> m_VertexBuffer;
+		Ref<IndexBuffer> m_IndexBuffer;
 
 		// Data used to build acceleration structure geometry
 		struct GeometryInfo
@@ -38,14 +54,19 @@ namespace Frost
 		
 		friend class VulkanTopLevelAccelertionStructure;
 		friend class VulkanRayTracingPass;
+		friend class VulkanAccelerationStructureBuilder;
 	private:
 		GeometryInfo MeshToVkGeometry(const MeshASInfo& meshInfo);
-		void BuildBLAS(GeometryInfo geometry);
+		VkAccelerationStructureBuildGeometryInfoKHR GetBuildGeometryInfo() const;
+		void CreateAccelerationStructure();
 		void UpdateInstanceInfo();
 	};
 
 
 
+	// Recorded into the render command buffer of the current frame.
+	// When only the transforms of the instances change, the TLAS is refitted (`VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR`),
+	// and it is fully rebuilt only when instances are added/removed/replaced, or after `RendererConfig::RayTracing::MaxTLASRefits` refits
 	class VulkanTopLevelAccelertionStructure : public TopLevelAccelertionStructure
 	{
 	public:
@@ -60,15 +81,26 @@ namespace Frost
 	private:
 		VkAccelerationStructureInstanceKHR InstanceToVkGeometryInstance(Ref<BottomLevelAccelerationStructure> blas, const glm::mat4& transform, uint32_t blasIndexID);
 		void BuildTLAS(std::vector<VkAccelerationStructureInstanceKHR>& instances);
+		bool CanBeRefitted(const Vector<VkAccelerationStructureInstanceKHR>& instances) const;
 		void UpdateDescriptor();
 	private:
 		VkAccelerationStructureKHR m_AccelerationStructure = VK_NULL_HANDLE;
 		VkBuffer m_ASBuffer;
 		VulkanMemoryInfo m_ASBufferMemory;
 		VkWriteDescriptorSetAccelerationStructureKHR m_DescriptorInfo;
-		uint32_t m_ASBufferSize;
+		VkDeviceSize m_ASBufferSize = 0;
+
+		// Kept between the updates, since the TLAS is built every frame
+		VkBuffer m_ScratchBuffer = VK_NULL_HANDLE;
+		VulkanMemoryInfo m_ScratchBufferMemory;
+		VkDeviceSize m_ScratchBufferSize = 0;
 
 		Ref<BufferDevice> m_InstanceBuffer;
+		uint32_t m_InstanceCapacity = 0;
+
+		// Instances of the last build/refit (to find out what changed)
+		Vector<VkAccelerationStructureInstanceKHR> m_Instances;
+		uint32_t m_RefitCount = 0;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,370 @@
+#include "frostpch.h"
+#include "VulkanAccelerationStructureBuilder.h"
+
+#include <mutex>
+
+#include "Frost/Math/Alignment.h"
+#include "Frost/Renderer/Renderer.h"
+#include "Frost/Platform/Vulkan/VulkanContext.h"
+#include "Frost/Platform/Vulkan/Buffers/VulkanUploadManager.h"
+#include "Frost/Platform/Vulkan/RayTracing/VulkanAccelerationStructure.h"
+
+namespace Frost
+{
+	namespace Vulkan
+	{
+		struct BLASBuildBatch
+		{
+			UploadToken Token = 0;
+			VkBuffer ScratchBuffer = VK_NULL_HANDLE;
+			VulkanMemoryInfo ScratchBufferMemory;
+			VkQueryPool QueryPool = VK_NULL_HANDLE;
+
+			// A structure is set to nullptr if it gets destroyed before the batch is compacted
+			Vector<VulkanBottomLevelAccelerationStructure*> Structures;
+		};
+
+		// Acceleration structures replaced by their compacted version, destroyed once no frame in flight can use them
+		struct RetiredAccelerationStructure
+		{
+			VkAccelerationStructureKHR AccelerationStructure;
+			VkBuffer Buffer;
+			VulkanMemoryInfo BufferMemory;
+			UploadToken Token;
+			uint64_t RetiredFrame;
+		};
+
+		struct AccelerationStructureBuilderData
+		{
+			VkDeviceSize ScratchAlignment = 256;
+
+			Vector<VulkanBottomLevelAccelerationStructure*> PendingBuilds;
+			std::deque<BLASBuildBatch> BuildBatches;
+			Vector<RetiredAccelerationStructure> RetiredStructures;
+			uint64_t FrameCounter = 0;
+
+			std::mutex Mutex;
+
+			VulkanAccelerationStructureBuilder::Stats Stats;
+		};
+	}
+
+	static Vulkan::AccelerationStructureBuilderData* s_Data = nullptr;
+
+	void VulkanAccelerationStructureBuilder::Init()
+	{
+		s_Data = new Vulkan::AccelerationStructureBuilderData();
+
+		VkPhysicalDevice physicalDevice = VulkanContext::GetCurrentDevice()->GetPhysicalDevice();
+
+		// Every BLAS of a batch gets a slice of the same scratch buffer, so the slices must respect the alignment of the scratch addresses
+		VkPhysicalDeviceAccelerationStructurePropertiesKHR accelerationStructureProperties{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR };
+		VkPhysicalDeviceProperties2 deviceProperties{ VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2 };
+		deviceProperties.pNext = &accelerationStructureProperties;
+		vkGetPhysicalDeviceProperties2(physicalDevice, &deviceProperties);
+
+		s_Data->ScratchAlignment = std::max<VkDeviceSize>(accelerationStructureProperties.minAccelerationStructureScratchOffsetAlignment, 1);
+	}
+
+	void VulkanAccelerationStructureBuilder::ShutDown()
+	{
+		if (!s_Data) return;
+
+		{
+			std::scoped_lock<std::mutex> lock(s_Data->Mutex);
+			VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+
+			// Nothing can be compacted anymore, so just wait for the recorded builds
+			for (Vulkan::BLASBuildBatch& batch : s_Data->BuildBatches)
+			{
+				VulkanUploadManager::Wait(batch.Token);
+				VulkanAllocator::DeleteBuffer(batch.ScratchBuffer, batch.ScratchBufferMemory);
+				vkDestroyQueryPool(device, batch.QueryPool, nullptr);
+			}
+			s_Data->BuildBatches.clear();
+
+			DestroyRetiredStructures(true);
+		}
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	void VulkanAccelerationStructureBuilder::EnqueueBuild(VulkanBottomLevelAccelerationStructure* blas)
+	{
+		FROST_ASSERT(s_Data, "The acceleration structure builder was not initialized!");
+
+		std::scoped_lock<std::mutex> lock(s_Data->Mutex);
+		s_Data->PendingBuilds.push_back(blas);
+		s_Data->Stats.PendingBLAS = (uint32_t)s_Data->PendingBuilds.size();
+	}
+
+	void VulkanAccelerationStructureBuilder::Update()
+	{
+		if (!s_Data) return;
+
+		std::scoped_lock<std::mutex> lock(s_Data->Mutex);
+		s_Data->FrameCounter++;
+
+		CompactFinishedBuilds();
+		DestroyRetiredStructures(false);
+		RecordBuilds();
+	}
+
+	void VulkanAccelerationStructureBuilder::RecordBuilds()
+	{
+		if (s_Data->PendingBuilds.empty()) return;
+
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+		uint64_t scratchBudget = Renderer::GetRendererConfig().RayTracing.BLASBuildScratchBudget;
+
+		// Take as many BLASes as the scratch budget allows (at least one, even if it is bigger than the budget)
+		Vulkan::BLASBuildBatch batch;
+		Vector<VkDeviceSize> scratchOffsets;
+		VkDeviceSize scratchBufferSize = 0;
+		for (VulkanBottomLevelAccelerationStructure* blas : s_Data->PendingBuilds)
+		{
+			VkDeviceSize scratchOffset = Math::AlignUp<VkDeviceSize>(scratchBufferSize, s_Data->ScratchAlignment);
+			if (!batch.Structures.empty() && scratchOffset + blas->m_BuildScratchSize > scratchBudget)
+				break;
+
+			batch.Structures.push_back(blas);
+			scratchOffsets.push_back(scratchOffset);
+			scratchBufferSize = scratchOffset + blas->m_BuildScratchSize;
+		}
+		s_Data->PendingBuilds.erase(s_Data->PendingBuilds.begin(), s_Data->PendingBuilds.begin() + batch.Structures.size());
+		s_Data->Stats.PendingBLAS = (uint32_t)s_Data->PendingBuilds.size();
+
+		// One scratch buffer for the whole batch (with some extra space, so the first slice can be aligned as well)
+		VulkanAllocator::AllocateBuffer(scratchBufferSize + s_Data->ScratchAlignment,
+			{ BufferUsage::Storage, BufferUsage::ShaderAddress },
+			MemoryUsage::GPU_ONLY,
+			batch.ScratchBuffer, batch.ScratchBufferMemory);
+		VulkanContext::SetStructDebugName("BottomLevel-AccelerationStructure-Scratch", VK_OBJECT_TYPE_BUFFER, batch.ScratchBuffer);
+
+		VkBufferDeviceAddressInfo scratchBufferInfo{ VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO };
+		scratchBufferInfo.buffer = batch.ScratchBuffer;
+		VkDeviceAddress scratchAddress = Math::AlignUp<VkDeviceAddress>(vkGetBufferDeviceAddress(device, &scratchBufferInfo), s_Data->ScratchAlignment);
+
+		// Allocate a query pool for storing the compacted size of every BLAS
+		uint32_t structureCount = (uint32_t)batch.Structures.size();
+		VkQueryPoolCreateInfo queryPoolCreateInfo{ VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+		queryPoolCreateInfo.queryCount = structureCount;
+		queryPoolCreateInfo.queryType = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR;
+		FROST_VKCHECK(vkCreateQueryPool(device, &queryPoolCreateInfo, nullptr, &batch.QueryPool));
+
+		Vector<VkAccelerationStructureBuildGeometryInfoKHR> buildInfos(structureCount);
+		Vector<const VkAccelerationStructureBuildRangeInfoKHR*> buildRangeInfos(structureCount);
+		Vector<VkAccelerationStructureKHR> accelerationStructures(structureCount);
+		for (uint32_t i = 0; i < structureCount; i++)
+		{
+			VulkanBottomLevelAccelerationStructure* blas = batch.Structures[i];
+
+			buildInfos[i] = blas->GetBuildGeometryInfo();
+			buildInfos[i].dstAccelerationStructure = blas->m_AccelerationStructure;
+			buildInfos[i].scratchData.deviceAddress = scratchAddress + scratchOffsets[i];
+			buildRangeInfos[i] = blas->m_GeometryInfo.BuildOffsetInfo.data();
+			accelerationStructures[i] = blas->m_AccelerationStructure;
+		}
+
+		batch.Token = VulkanUploadManager::RecordCommands([&](VkCommandBuffer cmdBuf)
+		{
+			// The vertex/index buffers might have been uploaded in the same batch
+			VkMemoryBarrier barrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_SHADER_READ_BIT;
+			vkCmdPipelineBarrier(cmdBuf, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+				0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+			vkCmdBuildAccelerationStructuresKHR(cmdBuf, structureCount, buildInfos.data(), buildRangeInfos.data());
+
+			// The compacted sizes can only be queried after the builds are finished
+			barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+			barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+			vkCmdPipelineBarrier(cmdBuf, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+				VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR | VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR,
+				0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+			vkCmdResetQueryPool(cmdBuf, batch.QueryPool, 0, structureCount);
+			vkCmdWriteAccelerationStructuresPropertiesKHR(cmdBuf, structureCount, accelerationStructures.data(),
+				VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, batch.QueryPool, 0);
+		});
+
+		for (VulkanBottomLevelAccelerationStructure* blas : batch.Structures)
+		{
+			blas->m_IsReady = true;
+			blas->m_LastCommandToken = batch.Token;
+		}
+
+		s_Data->Stats.BuiltBLAS += structureCount;
+		s_Data->BuildBatches.push_back(std::move(batch));
+	}
+
+	void VulkanAccelerationStructureBuilder::CompactFinishedBuilds()
+	{
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+
+		// Batches are recorded in order, so they also finish in order
+		while (!s_Data->BuildBatches.empty() && VulkanUploadManager::IsComplete(s_Data->BuildBatches.front().Token))
+		{
+			Vulkan::BLASBuildBatch& batch = s_Data->BuildBatches.front();
+			uint32_t structureCount = (uint32_t)batch.Structures.size();
+
+			// The build is finished, so the results are already available (no need for `VK_QUERY_RESULT_WAIT_BIT`)
+			Vector<VkDeviceSize> compactedSizes(structureCount, 0);
+			vkGetQueryPoolResults(device, batch.QueryPool, 0, structureCount,
+				structureCount * sizeof(VkDeviceSize), compactedSizes.data(), sizeof(VkDeviceSize), VK_QUERY_RESULT_64_BIT);
+
+			VulkanAllocator::DeleteBuffer(batch.ScratchBuffer, batch.ScratchBufferMemory);
+			vkDestroyQueryPool(device, batch.QueryPool, nullptr);
+
+			Vector<VkCopyAccelerationStructureInfoKHR> copyInfos;
+			Vector<VulkanBottomLevelAccelerationStructure*> compactedStructures;
+			for (uint32_t i = 0; i < structureCount; i++)
+			{
+				VulkanBottomLevelAccelerationStructure* blas = batch.Structures[i];
+				if (!blas) continue;
+
+				// The build is done, the geometry buffers are not needed to be kept alive anymore
+				blas->m_VertexBuffer = nullptr;
+				blas->m_IndexBuffer = nullptr;
+
+				VkDeviceSize compactedSize = compactedSizes[i];
+				if (compactedSize == 0 || compactedSize >= blas->m_ASBufferSize)
+					continue;
+
+				// Creating a compacted version of the AS
+				VkAccelerationStructureKHR compactedAS;
+				VkBuffer compactedASBuffer;
+				VulkanMemoryInfo compactedASBufferMemory;
+
+				Vector<BufferUsage> usages = { BufferUsage::AccelerationStructure, BufferUsage::ShaderAddress, BufferUsage::Storage };
+				VulkanAllocator::AllocateBuffer(compactedSize, usages, MemoryUsage::GPU_ONLY, compactedASBuffer, compactedASBufferMemory);
+
+				VkAccelerationStructureCreateInfoKHR asInfo{ VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR };
+				asInfo.size = compactedSize;
+				asInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
+				asInfo.buffer = compactedASBuffer;
+				FROST_VKCHECK(vkCreateAccelerationStructureKHR(device, &asInfo, nullptr, &compactedAS));
+
+				VulkanContext::SetStructDebugName("BottomLevel-AccelerationStructure", VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR, compactedAS);
+				VulkanContext::SetStructDebugName("BottomLevel-AccelerationStructure-Buffer", VK_OBJECT_TYPE_BUFFER, compactedASBuffer);
+
+				VkCopyAccelerationStructureInfoKHR& copyInfo = copyInfos.emplace_back();
+				copyInfo = { VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR };
+				copyInfo.src = blas->m_AccelerationStructure;
+				copyInfo.dst = compactedAS;
+				copyInfo.mode = VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR;
+				compactedStructures.push_back(blas);
+
+				// The original AS might still be used by the frames in flight, so it is retired instead of being destroyed
+				s_Data->RetiredStructures.push_back({ blas->m_AccelerationStructure, blas->m_ASBuffer, blas->m_ASBufferMemory, 0, s_Data->FrameCounter });
+
+				s_Data->Stats.CompactedBLAS++;
+				s_Data->Stats.CompactionSavedBytes += blas->m_ASBufferSize - compactedSize;
+
+				// The copy is executed before the next frame (same queue), so the BLAS can switch to the compacted version right away.
+				// The TLASes see a new device address and are fully rebuilt on their next update
+				blas->m_AccelerationStructure = compactedAS;
+				blas->m_ASBuffer = compactedASBuffer;
+				blas->m_ASBufferMemory = compactedASBufferMemory;
+				blas->m_ASBufferSize = compactedSize;
+				blas->UpdateInstanceInfo();
+			}
+
+			if (!copyInfos.empty())
+			{
+				UploadToken copyToken = VulkanUploadManager::RecordCommands([&](VkCommandBuffer cmdBuf)
+				{
+					for (VkCopyAccelerationStructureInfoKHR& copyInfo : copyInfos)
+						vkCmdCopyAccelerationStructureKHR(cmdBuf, &copyInfo);
+
+					VkMemoryBarrier barrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+					barrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+					barrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+					vkCmdPipelineBarrier(cmdBuf, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+						VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR | VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR,
+						0, 1, &barrier, 0, nullptr, 0, nullptr);
+				});
+
+				// The original structures are read by the copies, so they have to outlive them as well
+				for (size_t i = s_Data->RetiredStructures.size() - copyInfos.size(); i < s_Data->RetiredStructures.size(); i++)
+					s_Data->RetiredStructures[i].Token = copyToken;
+
+				for (VulkanBottomLevelAccelerationStructure* blas : compactedStructures)
+					blas->m_LastCommandToken = copyToken;
+			}
+
+			s_Data->BuildBatches.pop_front();
+		}
+	}
+
+	void VulkanAccelerationStructureBuilder::DestroyRetiredStructures(bool force)
+	{
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+
+		for (auto it = s_Data->RetiredStructures.begin(); it != s_Data->RetiredStructures.end();)
+		{
+			bool canBeDestroyed = s_Data->FrameCounter - it->RetiredFrame > FRAMES_IN_FLIGHT && VulkanUploadManager::IsComplete(it->Token);
+			if (!force && !canBeDestroyed)
+			{
+				it++;
+				continue;
+			}
+
+			if (force)
+				VulkanUploadManager::Wait(it->Token);
+
+			vkDestroyAccelerationStructureKHR(device, it->AccelerationStructure, nullptr);
+			VulkanAllocator::DeleteBuffer(it->Buffer, it->BufferMemory);
+			it = s_Data->RetiredStructures.erase(it);
+		}
+	}
+
+	void VulkanAccelerationStructureBuilder::OnStructureDestroyed(VulkanBottomLevelAccelerationStructure* blas)
+	{
+		if (!s_Data) return;
+
+		std::scoped_lock<std::mutex> lock(s_Data->Mutex);
+
+		auto pendingIt = std::find(s_Data->PendingBuilds.begin(), s_Data->PendingBuilds.end(), blas);
+		if (pendingIt != s_Data->PendingBuilds.end())
+		{
+			s_Data->PendingBuilds.erase(pendingIt);
+			s_Data->Stats.PendingBLAS = (uint32_t)s_Data->PendingBuilds.size();
+			return;
+		}
+
+		// The BLAS must not be compacted anymore
+		for (Vulkan::BLASBuildBatch& batch : s_Data->BuildBatches)
+		{
+			auto it = std::find(batch.Structures.begin(), batch.Structures.end(), blas);
+			if (it != batch.Structures.end())
+			{
+				*it = nullptr;
+				break;
+			}
+		}
+
+		// The build (or the compaction copy) was already recorded, so it has to finish before the AS can be destroyed
+		VulkanUploadManager::Wait(blas->m_LastCommandToken);
+	}
+
+	void VulkanAccelerationStructureBuilder::OnTopLevelUpdated(TopLevelUpdate update)
+	{
+		if (!s_Data) return;
+
+		switch (update)
+		{
+			case TopLevelUpdate::Build:   s_Data->Stats.TLASBuilds++; break;
+			case TopLevelUpdate::Refit:   s_Data->Stats.TLASRefits++; break;
+			case TopLevelUpdate::Skipped: s_Data->Stats.TLASSkippedUpdates++; break;
+		}
+	}
+
+	const VulkanAccelerationStructureBuilder::Stats& VulkanAccelerationStructureBuilder::GetStats()
+	{
+		static Stats s_EmptyStats;
+		return s_Data ? s_Data->Stats : s_EmptyStats;
+	}
+}
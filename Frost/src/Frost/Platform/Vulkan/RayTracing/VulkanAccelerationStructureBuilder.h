@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Frost/Platform/Vulkan/Vulkan.h"
+
+namespace Frost
+{
+	class VulkanBottomLevelAccelerationStructure;
+
+	// Builds the bottom level acceleration structures in batches, instead of submitting (and waiting for) a command buffer for every mesh.
+	// The queued BLASes are built with one `vkCmdBuildAccelerationStructuresKHR` call (sharing one scratch buffer) inside the upload batches,
+	// and once the build has finished on the GPU, they are compacted into smaller buffers (also without any stall).
+	// A BLAS can be used by the frame in which its build was recorded, since the upload batches are submitted before the frame on the same queue.
+	class VulkanAccelerationStructureBuilder
+	{
+	public:
+		struct Stats
+		{
+			uint32_t BuiltBLAS = 0;        // BLASes built since startup
+			uint32_t CompactedBLAS = 0;    // BLASes which were copied into a smaller buffer
+			uint32_t PendingBLAS = 0;      // BLASes waiting for their build to be recorded
+			uint64_t CompactionSavedBytes = 0;
+
+			uint32_t TLASBuilds = 0;       // Full TLAS builds since startup
+			uint32_t TLASRefits = 0;       // TLAS updates which only refitted the existing TLAS
+			uint32_t TLASSkippedUpdates = 0; // TLAS updates skipped because nothing changed
+		};
+
+		enum class TopLevelUpdate
+		{
+			Build, Refit, Skipped
+		};
+
+		static void Init();
+		static void ShutDown();
+
+		// The build is recorded on the next `Update`
+		static void EnqueueBuild(VulkanBottomLevelAccelerationStructure* blas);
+
+		// Records the queued builds and compacts the finished ones. Should be called once per frame (it never blocks)
+		static void Update();
+
+		// Makes sure no build or compaction still uses the BLAS, which is about to be destroyed
+		static void OnStructureDestroyed(VulkanBottomLevelAccelerationStructure* blas);
+
+		static void OnTopLevelUpdated(TopLevelUpdate update);
+
+		static const Stats& GetStats();
+	private:
+		static void RecordBuilds();
+		static void CompactFinishedBuilds();
+		static void DestroyRetiredStructures(bool force);
+	};
+}
@@ -3,6 +3,7 @@
 
 #include "Frost/Renderer/Material.h"
 #include "Frost/Platform/Vulkan/VulkanPipeline.h"
+#include "Frost/Platform/Vulkan/VulkanPipelineCache.h"
 #include "Frost/Platform/Vulkan/VulkanContext.h"
 #include "Frost/Platform/Vulkan/VulkanShader.h"
 #include "Frost/Platform/Vulkan/RayTracing/VulkanShaderBindingTable.h"
@@ -39,9 +40,16 @@ namespace Frost
 		raytracingPipelineInfo.layout = m_PipelineLayout;
 
 
+		VulkanPipelineCache::CreationFeedback creationFeedback;
+		raytracingPipelineInfo.pNext = &creationFeedback.CreateInfo;
+
 		// TODO: Add multi-threaded pipeline creation
 		VkDeferredOperationKHR defferedOperation{};
-		vkCreateRayTracingPipelinesKHR(device, defferedOperation, {}, 1, &raytracingPipelineInfo, nullptr, &m_Pipeline);
+		auto creationStartTime = std::chrono::high_resolution_clock::now();
+		vkCreateRayTracingPipelinesKHR(device, defferedOperation, VulkanPipelineCache::GetVulkanPipelineCache(), 1, &raytracingPipelineInfo, nullptr, &m_Pipeline);
+		float creationTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - creationStartTime).count();
+
+		VulkanPipelineCache::OnPipelineCreated(creationFeedback, creationTime);
 
 		Ref<VulkanShaderBindingTable> vkShaderBindingTable = createInfo.ShaderBindingTable.As<VulkanShaderBindingTable>();
 		vkShaderBindingTable->CreateShaderBindingTableBuffer(m_Pipeline);
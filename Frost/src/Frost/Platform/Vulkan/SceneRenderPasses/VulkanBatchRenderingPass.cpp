@@ -14,9 +14,7 @@
 #include "Frost/Platform/Vulkan/VulkanRenderer.h"
 #include "Frost/Platform/Vulkan/SceneRenderPasses/VulkanPostFXPass.h"
 
-#include "Frost/Renderer/UserInterface/MSDFData.h"
-
-#include <codecvt>
+#include <imgui.h>
 
 namespace Frost
 {
@@ -233,25 +231,28 @@ namespace Frost
 		m_Data->GridIndexBuffer = IndexBuffer::Create((void*)&GridIndices[0], sizeof(GridIndices));
 	}
 
+	// The readback buffers are sized for the biggest rectangle pick (smaller picks share the remaining space in the same frame)
+	static constexpr uint32_t s_EntityPickReadbackPixels = 1024 * 1024;
+
 	void VulkanBatchRenderingPass::SelectEntityInitData(uint32_t width, uint32_t height)
 	{
 		uint32_t framesInFlight = Renderer::GetRendererConfig().FramesInFlight;
 
+		// The readback buffers don't depend on the viewport size, so they are only created once
+		if (m_Data->EntityPickReadbackBuffer.empty())
+		{
+			m_Data->EntityPickReadbackBuffer.resize(framesInFlight);
+			m_Data->EntityPickReadbackMemory.resize(framesInFlight);
+			m_Data->EntityPickReadbackData.resize(framesInFlight);
+			m_Data->EntityPickInFlightRequests.resize(framesInFlight);
 
-		ImageSpecification imageSpec{};
-		imageSpec.Width = width;
-		imageSpec.Height = height;
-		imageSpec.Format = ImageFormat::R32I;
-		imageSpec.Usage = ImageUsage::ReadOnly;
-		imageSpec.Tiling = ImageTiling::Linear; // Linear because we need to read it from CPU
-		imageSpec.MemoryProperties = ImageMemoryProperties::GPU_TO_CPU;
-		imageSpec.UseMipChain = false;
-		imageSpec.MutableFormat = true;
+			for (uint32_t i = 0; i < framesInFlight; i++)
+			{
+				VulkanAllocator::AllocateBuffer(s_EntityPickReadbackPixels * sizeof(uint32_t), { BufferUsage::TransferDst }, MemoryUsage::GPU_TO_CPU,
+					m_Data->EntityPickReadbackBuffer[i], m_Data->EntityPickReadbackMemory[i]);
 
-		m_Data->EntityIDTexture_CPU.resize(framesInFlight);
-		for (int i = 0; i < framesInFlight; i++)
-		{
-			m_Data->EntityIDTexture_CPU[i] = Image2D::Create(imageSpec);
+				VulkanAllocator::BindBuffer(m_Data->EntityPickReadbackBuffer[i], m_Data->EntityPickReadbackMemory[i], (void**)&m_Data->EntityPickReadbackData[i]);
+			}
 		}
 
 		m_Data->ViewportSize = { width, height };
@@ -340,6 +341,8 @@ namespace Frost
 		m_Data->TextCount = 0;
 		m_Data->TextVertexBufferPtr = m_Data->TextVertexBufferBase;
 
+		m_Data->TextLayouts.BeginFrame();
+
 
 		for (const auto& object2d : renderQueue.m_BatchRendererData)
 		{
@@ -356,6 +359,7 @@ namespace Frost
 		{
 			SubmitText(textObject2d);
 		}
+		m_Data->TextLayouts.EvictLayouts(Renderer::GetRendererConfig().Renderer2D.MaxCachedTextLayouts);
 
 		m_Data->QuadVertexBuffer[currentFrameIndex]->SetData(m_Data->QuadCount * 4 * sizeof(QuadVertex), m_Data->QuadVertexBufferBase);
 		m_Data->LineVertexBuffer[currentFrameIndex]->SetData(m_Data->LineVertexCount * sizeof(LineVertex), m_Data->LineVertexBufferBase);
@@ -574,30 +578,11 @@ namespace Frost
 		}
 	}
 
-	// From https://stackoverflow.com/questions/31302506/stdu32string-conversion-to-from-stdstring-and-stdu16string
-	static std::u32string To_UTF32(const std::string& s)
-	{
-		std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> conv;
-		return conv.from_bytes(s);
-	}
-
-	static bool NextLine(int index, const std::vector<int>& lines)
-	{
-		for (int line : lines)
-		{
-			if (line == index)
-				return true;
-		}
-		return false;
-	}
-
 	void VulkanBatchRenderingPass::SubmitText(const RenderQueue::TextObject2D& textObject2D)
 	{
 		if (textObject2D.String.empty())
 			return;
 
-		std::u32string utf32string = To_UTF32(textObject2D.String);
-
 		Ref<Texture2D> fontAtlas = textObject2D.Font->GetFontAtlas();
 		FROST_ASSERT_INTERNAL(fontAtlas);
 
@@ -613,150 +598,47 @@ namespace Frost
 			atlasTextureSlot = m_BindlessAllocatedTextures[texture->GetVulkanImage()];
 		}
 
+		const TextLayout& textLayout = m_Data->TextLayouts.GetTextLayout(textObject2D.String, textObject2D.Font,
+			textObject2D.MaxWidth, textObject2D.LineHeightOffset, textObject2D.KerningOffset);
 
-		auto& fontGeometry = textObject2D.Font->GetMSDFData()->FontGeometry;
-		const auto& metrics = fontGeometry.getMetrics();
-
-		
-		// Computing the new lines in the text
-		Vector<int> nextLines;
+		if (m_Data->TextIndexCount + textLayout.Quads.size() * 6 > (Renderer::GetRendererConfig().Renderer2D.MaxQuads * 6))
 		{
-			double xOffset = 0.0;
-			double fsScale = 1 / (metrics.ascenderY - metrics.descenderY);
-			double yOffset = -fsScale * metrics.ascenderY;
-			int lastSpace = -1;
-
-			for (int i = 0; i < utf32string.size(); i++)
-			{
-				char32_t character = utf32string[i];
-				if (character == '\n')
-				{
-					xOffset = 0;
-					yOffset -= fsScale * metrics.lineHeight + textObject2D.LineHeightOffset;
-					continue;
-				}
-
-				auto glyph = fontGeometry.getGlyph(character);
-				if (!glyph)
-				{
-					glyph = fontGeometry.getGlyph('?');
-					if (!glyph)
-					{
-						continue;
-					}
-				}
-
-				if (character != ' ')
-				{
-					// Calculate geometry for the glyph
-					double pl, pb, pr, pt;
-					glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-					glm::vec2 quadMin((float)pl, (float)pb);
-					glm::vec2 quadMax((float)pr, (float)pt);
-
-					quadMin *= fsScale;
-					quadMax *= fsScale;
-					
-					quadMin += glm::vec2(xOffset, yOffset);
-					quadMax += glm::vec2(xOffset, yOffset);
-
-					if (quadMax.x > textObject2D.MaxWidth && lastSpace != -1)
-					{
-						i = lastSpace;
-						nextLines.emplace_back(lastSpace);
-						lastSpace = -1;
-						
-						xOffset = 0;
-						yOffset -= fsScale * metrics.lineHeight + textObject2D.LineHeightOffset;
-					}
-				}
-				else
-				{
-					lastSpace = i;
-				}
-
-				double advance = glyph->getAdvance();
-				fontGeometry.getAdvance(advance, character, utf32string[i + 1]);
-				xOffset += fsScale * advance + textObject2D.KerningOffset;
-			}
+			FROST_CORE_ERROR("The maximum number of indices has been reached! The batch renderer cannot render more objects!");
+			return;
 		}
 
+		// Only the transform and the color are applied here, the glyph quads are already laid out
+		for (const TextGlyphQuad& glyphQuad : textLayout.Quads)
 		{
-			double xOffset = 0.0;
-			double fsScale = 1 / (metrics.ascenderY - metrics.descenderY);
-			double yOffset = 0.0;
-			for (int i = 0; i < utf32string.size(); i++)
-			{
-				char32_t character = utf32string[i];
-				if (character == '\n' || NextLine(i, nextLines))
-				{
-					xOffset = 0;
-					yOffset -= fsScale * metrics.lineHeight + textObject2D.LineHeightOffset;
-					continue;
-				}
-
-				auto glyph = fontGeometry.getGlyph(character);
-				if (!glyph)
-				{
-					glyph = fontGeometry.getGlyph('?');
-					if (!glyph)
-					{
-						continue;
-					}
-				}
-
-				// Atlas Quad Bounds
-				double al, ab, ar, at;
-				glyph->getQuadAtlasBounds(al, ab, ar, at);
-
-				double pl, pb, pr, pt;
-				glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-
-				pl = (pl * fsScale) + xOffset;
-				pb = (pb * fsScale) + yOffset;
-				pr = (pr * fsScale) + xOffset;
-				pt = (pt * fsScale) + yOffset;
-
-				double texelWidth = 1.0 / fontAtlas->GetWidth();
-				double texelHeight = 1.0 / fontAtlas->GetHeight();
-
-				al *= texelWidth;
-				ab *= texelHeight;
-				ar *= texelWidth;
-				at *= texelHeight;
-
-				m_Data->TextVertexBufferPtr->Position = textObject2D.Transform * glm::vec4(pl, pb, 0.0f, 1.0f);
-				m_Data->TextVertexBufferPtr->Color = textObject2D.Color;
-				m_Data->TextVertexBufferPtr->TexCoord = { al, ab };
-				m_Data->TextVertexBufferPtr->TexIndex = atlasTextureSlot;
-				m_Data->TextVertexBufferPtr++;
-				
-				m_Data->TextVertexBufferPtr->Position = textObject2D.Transform * glm::vec4(pl, pt, 0.0f, 1.0f);
-				m_Data->TextVertexBufferPtr->Color = textObject2D.Color;
-				m_Data->TextVertexBufferPtr->TexCoord = { al, at };
-				m_Data->TextVertexBufferPtr->TexIndex = atlasTextureSlot;
-				m_Data->TextVertexBufferPtr++;
-				
-				m_Data->TextVertexBufferPtr->Position = textObject2D.Transform * glm::vec4(pr, pt, 0.0f, 1.0f);
-				m_Data->TextVertexBufferPtr->Color = textObject2D.Color;
-				m_Data->TextVertexBufferPtr->TexCoord = { ar, at };
-				m_Data->TextVertexBufferPtr->TexIndex = atlasTextureSlot;
-				m_Data->TextVertexBufferPtr++;
-				
-				m_Data->TextVertexBufferPtr->Position = textObject2D.Transform * glm::vec4(pr, pb, 0.0f, 1.0f);
-				m_Data->TextVertexBufferPtr->Color = textObject2D.Color;
-				m_Data->TextVertexBufferPtr->TexCoord = { ar, ab };
-				m_Data->TextVertexBufferPtr->TexIndex = atlasTextureSlot;
-				m_Data->TextVertexBufferPtr++;
-
-				m_Data->TextIndexCount += 6;
-				m_Data->TextCount++;
-
-				double advance = glyph->getAdvance();
-				fontGeometry.getAdvance(advance, character, utf32string[i + 1]);
-				xOffset += fsScale * advance + textObject2D.KerningOffset;
-
-			}
+			const glm::vec4& plane = glyphQuad.PlaneBounds;
+			const glm::vec4& atlas = glyphQuad.AtlasBounds;
+
+			m_Data->TextVertexBufferPtr->Position = textObject2D.Transform * glm::vec4(plane.x, plane.y, 0.0f, 1.0f);
+			m_Data->TextVertexBufferPtr->Color = textObject2D.Color;
+			m_Data->TextVertexBufferPtr->TexCoord = { atlas.x, atlas.y };
+			m_Data->TextVertexBufferPtr->TexIndex = atlasTextureSlot;
+			m_Data->TextVertexBufferPtr++;
+
+			m_Data->TextVertexBufferPtr->Position = textObject2D.Transform * glm::vec4(plane.x, plane.w, 0.0f, 1.0f);
+			m_Data->TextVertexBufferPtr->Color = textObject2D.Color;
+			m_Data->TextVertexBufferPtr->TexCoord = { atlas.x, atlas.w };
+			m_Data->TextVertexBufferPtr->TexIndex = atlasTextureSlot;
+			m_Data->TextVertexBufferPtr++;
+
+			m_Data->TextVertexBufferPtr->Position = textObject2D.Transform * glm::vec4(plane.z, plane.w, 0.0f, 1.0f);
+			m_Data->TextVertexBufferPtr->Color = textObject2D.Color;
+			m_Data->TextVertexBufferPtr->TexCoord = { atlas.z, atlas.w };
+			m_Data->TextVertexBufferPtr->TexIndex = atlasTextureSlot;
+			m_Data->TextVertexBufferPtr++;
+
+			m_Data->TextVertexBufferPtr->Position = textObject2D.Transform * glm::vec4(plane.z, plane.y, 0.0f, 1.0f);
+			m_Data->TextVertexBufferPtr->Color = textObject2D.Color;
+			m_Data->TextVertexBufferPtr->TexCoord = { atlas.z, atlas.y };
+			m_Data->TextVertexBufferPtr->TexIndex = atlasTextureSlot;
+			m_Data->TextVertexBufferPtr++;
+
+			m_Data->TextIndexCount += 6;
+			m_Data->TextCount++;
 		}
 	}
 
@@ -850,60 +732,133 @@ namespace Frost
 		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
 		VkCommandBuffer cmdBuf = VulkanContext::GetSwapChain()->GetRenderCommandBuffer(currentFrameIndex);
 
-		Ref<VulkanImage2D> entityIDTexture_GeometryPass = m_RenderPassPipeline->GetRenderPassData<VulkanGeometryPass>()->GeometryRenderPass->GetColorAttachment(3, currentFrameIndex).As<VulkanImage2D>();
-		Ref<VulkanImage2D> entityIDTexture_CPU = m_Data->EntityIDTexture_CPU[currentFrameIndex].As<VulkanImage2D>();
+		// The fence of this frame index was already waited on, so the picks recorded the last time it was used are finished
+		ResolveEntityIDPicks(currentFrameIndex);
 
-		entityIDTexture_CPU->CopyImage(cmdBuf, entityIDTexture_GeometryPass.As<Image2D>());
-	}
+		if (m_Data->EntityPickPendingRequests.empty())
+			return;
 
-	uint32_t VulkanBatchRenderingPass::ReadPixelFromTextureEntityID(uint32_t x, uint32_t y)
-	{
-#if 0
-		// Recording a temporary commandbuffer for transitioning
-		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
-		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
-		VkCommandBuffer cmdBuf = VulkanContext::GetCurrentDevice()->AllocateCommandBuffer(RenderQueueType::Graphics, true);
-		//VkCommandBuffer cmdBuf = VulkanContext::GetSwapChain()->GetRenderCommandBuffer(currentFrameIndex);
+		// Nothing can be read back from an empty viewport (e.g. a minimized window), so the picks are dropped
+		if (m_Data->ViewportSize.x <= 0 || m_Data->ViewportSize.y <= 0)
+		{
+			m_Data->EntityPickPendingRequests.clear();
+			return;
+		}
 
+		Ref<VulkanImage2D> entityIDTexture_GeometryPass = m_RenderPassPipeline->GetRenderPassData<VulkanGeometryPass>()->GeometryRenderPass->GetColorAttachment(3, currentFrameIndex).As<VulkanImage2D>();
+		VkImageLayout entityIDTextureLayout = entityIDTexture_GeometryPass->GetVulkanImageLayout();
 
-		//uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
+		auto& inFlightRequests = m_Data->EntityPickInFlightRequests[currentFrameIndex];
+		Vector<VkBufferImageCopy> copyRegions;
 
-		Ref<VulkanImage2D> entityIDTexture_GeometryPass = m_RenderPassPipeline->GetRenderPassData<VulkanGeometryPass>()->GeometryRenderPass->GetColorAttachment(3, currentFrameIndex).As<VulkanImage2D>();
-		Ref<VulkanImage2D> entityIDTexture_CPU = m_Data->EntityIDTexture_CPU[currentFrameIndex].As<VulkanImage2D>();
+		// Take as many pending picks as fit into this frame's readback buffer, the rest are done in the next frames
+		uint32_t bufferOffset = 0;
+		uint32_t pendingIndex = 0;
+		for (; pendingIndex < m_Data->EntityPickPendingRequests.size(); pendingIndex++)
+		{
+			auto& request = m_Data->EntityPickPendingRequests[pendingIndex];
 
-		//entityIDTexture_GeometryPass->TransitionLayout(cmdBuf, entityIDTexture_GeometryPass->GetVulkanImageLayout(), VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+			// Clamp the region to the current viewport (it might have been resized since the request)
+			glm::uvec2 regionMin = glm::min(glm::uvec2(request.Region.x, request.Region.y), glm::uvec2(m_Data->ViewportSize) - 1u);
+			glm::uvec2 regionMax = glm::min(glm::uvec2(request.Region.x + request.Region.z, request.Region.y + request.Region.w), glm::uvec2(m_Data->ViewportSize));
+			glm::uvec2 regionSize = glm::max(regionMax - regionMin, glm::uvec2(1u));
 
-		entityIDTexture_CPU->CopyImage(cmdBuf, entityIDTexture_GeometryPass.As<Image2D>());
-#endif
+			if (regionSize.x * regionSize.y > s_EntityPickReadbackPixels)
+			{
+				FROST_CORE_WARN("Entity pick region is too big ({0}x{1}), only a part of it is read back!", regionSize.x, regionSize.y);
+				regionSize.y = glm::max(s_EntityPickReadbackPixels / regionSize.x, 1u);
+				regionSize.x = glm::min(regionSize.x, s_EntityPickReadbackPixels);
+			}
 
+			uint32_t regionPixels = regionSize.x * regionSize.y;
+			if (bufferOffset + regionPixels > s_EntityPickReadbackPixels)
+				break;
+
+			request.Region = glm::uvec4(regionMin, regionSize);
+			request.BufferOffset = bufferOffset;
+
+			VkBufferImageCopy& copyRegion = copyRegions.emplace_back();
+			copyRegion.bufferOffset = bufferOffset * sizeof(uint32_t);
+			copyRegion.bufferRowLength = 0;
+			copyRegion.bufferImageHeight = 0;
+			copyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			copyRegion.imageSubresource.mipLevel = 0;
+			copyRegion.imageSubresource.baseArrayLayer = 0;
+			copyRegion.imageSubresource.layerCount = 1;
+			copyRegion.imageOffset = { (int32_t)regionMin.x, (int32_t)regionMin.y, 0 };
+			copyRegion.imageExtent = { regionSize.x, regionSize.y, 1 };
+
+			bufferOffset += regionPixels;
+			inFlightRequests.push_back(std::move(request));
+		}
+		m_Data->EntityPickPendingRequests.erase(m_Data->EntityPickPendingRequests.begin(), m_Data->EntityPickPendingRequests.begin() + pendingIndex);
+
+		VkImageSubresourceRange subresourceRange{};
+		subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		subresourceRange.baseArrayLayer = 0;
+		subresourceRange.layerCount = 1;
+		subresourceRange.baseMipLevel = 0;
+		subresourceRange.levelCount = 1;
+
+		// Transition the entity ID texture to `VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL`, copy the regions and transition it back
+		Utils::InsertImageMemoryBarrier(cmdBuf, entityIDTexture_GeometryPass->GetVulkanImage(),
+			Utils::GetAccessFlagsFromLayout(entityIDTextureLayout),
+			Utils::GetAccessFlagsFromLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL),
+			entityIDTextureLayout,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			Utils::GetPipelineStageFlagsFromLayout(entityIDTextureLayout),
+			Utils::GetPipelineStageFlagsFromLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL),
+			subresourceRange
+		);
 
-		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
-		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
+		vkCmdCopyImageToBuffer(cmdBuf,
+			entityIDTexture_GeometryPass->GetVulkanImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			m_Data->EntityPickReadbackBuffer[currentFrameIndex],
+			(uint32_t)copyRegions.size(), copyRegions.data()
+		);
 
-		Ref<VulkanImage2D> entityIDTexture_GeometryPass = m_RenderPassPipeline->GetRenderPassData<VulkanGeometryPass>()->GeometryRenderPass->GetColorAttachment(3, currentFrameIndex).As<VulkanImage2D>();
-		Ref<VulkanImage2D> entityIDTexture_CPU = m_Data->EntityIDTexture_CPU[currentFrameIndex].As<VulkanImage2D>();
+		Utils::InsertImageMemoryBarrier(cmdBuf, entityIDTexture_GeometryPass->GetVulkanImage(),
+			Utils::GetAccessFlagsFromLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL),
+			Utils::GetAccessFlagsFromLayout(entityIDTextureLayout),
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			entityIDTextureLayout,
+			Utils::GetPipelineStageFlagsFromLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL),
+			Utils::GetPipelineStageFlagsFromLayout(entityIDTextureLayout),
+			subresourceRange
+		);
+	}
 
-		// Get layout of the image (including row pitch)
-		VkImageSubresource subResource{ VK_IMAGE_ASPECT_COLOR_BIT, 0, 0 };
-		VkSubresourceLayout subResourceLayout;
-		vkGetImageSubresourceLayout(device, entityIDTexture_CPU->GetVulkanImage(), &subResource, &subResourceLayout);
+	void VulkanBatchRenderingPass::ResolveEntityIDPicks(uint32_t frameIndex)
+	{
+		auto& inFlightRequests = m_Data->EntityPickInFlightRequests[frameIndex];
+		if (inFlightRequests.empty())
+			return;
 
-		entityIDTexture_CPU->MapMemory((void**)&m_Data->TextureDataCPU);
-		uint32_t* data = (uint32_t*)m_Data->TextureDataCPU;
-		data += subResourceLayout.offset;
+		VulkanAllocator::InvalidateBuffer(m_Data->EntityPickReadbackMemory[frameIndex]);
+		const uint32_t* readbackData = m_Data->EntityPickReadbackData[frameIndex];
 
-		uint32_t result = data[
-			(y * (subResourceLayout.rowPitch / sizeof(uint32_t))) + x
-		];
+		for (auto& request : inFlightRequests)
+		{
+			const uint32_t* regionData = readbackData + request.BufferOffset;
+			uint32_t regionPixels = request.Region.z * request.Region.w;
 
-		entityIDTexture_CPU->UnMapMemory();
+			// Deduplicate the entity IDs and remove the empty pixels
+			Vector<uint32_t> entityIDs(regionData, regionData + regionPixels);
+			std::sort(entityIDs.begin(), entityIDs.end());
+			entityIDs.erase(std::unique(entityIDs.begin(), entityIDs.end()), entityIDs.end());
+			if (!entityIDs.empty() && entityIDs.back() == UINT32_MAX)
+				entityIDs.pop_back();
 
-#if 0
-		// Ending the temporary commandbuffer for transitioning
-		VulkanContext::GetCurrentDevice()->FlushCommandBuffer(cmdBuf);
-#endif
+			request.Callback(entityIDs);
+		}
+		inFlightRequests.clear();
+	}
 
-		return result;
+	void VulkanBatchRenderingPass::RequestEntityIDPick(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::function<void(const Vector<uint32_t>&)>& callback)
+	{
+		auto& request = m_Data->EntityPickPendingRequests.emplace_back();
+		request.Region = { x, y, width, height };
+		request.Callback = callback;
 	}
 
 	void VulkanBatchRenderingPass::GlowSelectedEntityUpdate(const RenderQueue& renderQueue)
@@ -1101,7 +1056,12 @@ namespace Frost
 
 	void VulkanBatchRenderingPass::OnRenderDebug()
 	{
-
+		if (ImGui::CollapsingHeader("Batch Rendering Pass"))
+		{
+			const TextLayoutCacheStats& stats = m_Data->TextLayouts.GetStats();
+			ImGui::Text("Text Layout Cache Hits/Misses: %d/%d", stats.CacheHits, stats.CacheMisses);
+			ImGui::Text("Cached Text Layouts: %d (%d evicted)", stats.CachedLayouts, stats.EvictedLayouts);
+		}
 	}
 
 	void VulkanBatchRenderingPass::OnResize(uint32_t width, uint32_t height)
@@ -1124,6 +1084,12 @@ namespace Frost
 
 	void VulkanBatchRenderingPass::ShutDown()
 	{
+		for (uint32_t i = 0; i < m_Data->EntityPickReadbackBuffer.size(); i++)
+		{
+			VulkanAllocator::UnbindBuffer(m_Data->EntityPickReadbackMemory[i]);
+			VulkanAllocator::DeleteBuffer(m_Data->EntityPickReadbackBuffer[i], m_Data->EntityPickReadbackMemory[i]);
+		}
+
 		delete m_Data;
 	}
 }
\ No newline at end of file
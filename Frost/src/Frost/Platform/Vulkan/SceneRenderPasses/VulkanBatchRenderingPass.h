@@ -3,8 +3,8 @@
 #include "Frost/Renderer/SceneRenderPass.h"
 #include "Frost/Renderer/Pipeline.h"
 #include "Frost/Renderer/Renderer.h"
-
-typedef struct VkImage_T* VkImage;
+#include "Frost/Renderer/UserInterface/TextLayout.h"
+#include "Frost/Platform/Vulkan/Buffers/VulkanBufferAllocator.h"
 
 namespace Frost
 {
@@ -45,7 +45,9 @@ namespace Frost
 		virtual void OnResizeLate(uint32_t width, uint32_t height) override;
 		virtual void ShutDown() override;
 
-		uint32_t ReadPixelFromTextureEntityID(uint32_t x, uint32_t y);
+		// Copies the region of the entity ID texture in this frame's command buffer, and calls the callback (with the deduplicated entity IDs)
+		// once this frame index comes around again, so the CPU never waits for the GPU
+		void RequestEntityIDPick(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::function<void(const Vector<uint32_t>&)>& callback);
 
 		virtual void* GetInternalData() override { return (void*)m_Data; }
 
@@ -74,7 +76,7 @@ namespace Frost
 		// ------------ On Click Select Entity ----------------
 		void SelectEntityInitData(uint32_t width, uint32_t height);
 		void SelectEntityUpdate(const RenderQueue& renderQueue);
-		//void SelectEntityUpdate(const RenderQueue& renderQueue);
+		void ResolveEntityIDPicks(uint32_t frameIndex);
 		// ------------------------------------------------------
 
 		// ------------ Glow Selected Entity ----------------
@@ -121,6 +123,7 @@ namespace Frost
 			TextVertex* TextVertexBufferBase = nullptr;
 			TextVertex* TextVertexBufferPtr = nullptr;
 
+			TextLayoutCache TextLayouts;
 
 
 			// Wireframe Renderer
@@ -133,9 +136,18 @@ namespace Frost
 			Ref<BufferDevice> GridVertexBuffer;
 			Ref<IndexBuffer> GridIndexBuffer;
 
-			// Used for selecting and entity
-			Vector<Ref<Image2D>> EntityIDTexture_CPU;
-			uint32_t* TextureDataCPU;
+			// Used for selecting an entity (only the requested regions of the entity ID texture are read back)
+			struct EntityPickRequest
+			{
+				glm::uvec4 Region; // x, y, width, height
+				std::function<void(const Vector<uint32_t>&)> Callback;
+				uint32_t BufferOffset = 0; // In pixels
+			};
+			Vector<EntityPickRequest> EntityPickPendingRequests;
+			Vector<Vector<EntityPickRequest>> EntityPickInFlightRequests; // Per frame in flight
+			Vector<VkBuffer> EntityPickReadbackBuffer;
+			Vector<VulkanMemoryInfo> EntityPickReadbackMemory;
+			Vector<uint32_t*> EntityPickReadbackData; // Stays mapped for the whole lifetime of the pass
 			glm::ivec2 ViewportSize;
 
 			// Line detection
@@ -51,6 +51,9 @@ namespace Frost
 		m_Data->GeometryShader = Renderer::GetShaderLibrary()->Get("GeometryPassIndirectInstancedBindless");
 		m_Data->LateCullShader = Renderer::GetShaderLibrary()->Get("OcclusionCulling_V3");
 
+		// The instance slots are shared by the instanced vertex buffer and the mesh specs, the material slots by the material specs
+		m_Data->InstanceSlotAllocator.Init(static_cast<uint32_t>(MaxCountMeshes));
+		m_Data->MaterialSlotAllocator.Init(static_cast<uint32_t>(MaxCountMeshes));
 
 		GeometryDataInit(1600, 900);
 
@@ -125,17 +128,9 @@ namespace Frost
 		//m_Data->GeometryRenderPass->GetColorAttachment(0, )
 
 		// Pipeline creations
+		// The only instanced attribute is the retained slot, the instance data itself is fetched from `u_InstanceData` with it
 		BufferLayout bufferLayout = {
-			{ "a_ModelSpaceMatrix",           ShaderDataType::Mat4   },
-			{ "a_WorldSpaceMatrix",           ShaderDataType::Mat4   },
-			{ "a_PreviousWorldSpaceMatrix",   ShaderDataType::Mat4   },
-			{ "a_BoneInformationBDA",         ShaderDataType::UInt64 },
-			{ "a_MaterialIndexGlobalOffset",  ShaderDataType::UInt   },
-			{ "a_EntityID",                   ShaderDataType::UInt   }
-			//{ "IsMeshVisible",                ShaderDataType::UInt   },
-			//{ "a_Padding0",                   ShaderDataType::UInt   },
-			//{ "a_Padding1",                   ShaderDataType::UInt   },
-			//{ "a_Padding2",                   ShaderDataType::UInt   },
+			{ "a_InstanceSlot",               ShaderDataType::UInt   }
 		};
 		bufferLayout.m_InputType = InputType::Instanced;
 
@@ -181,6 +176,10 @@ namespace Frost
 				instanceSpec.DeviceBuffer = BufferDevice::Create(sizeof(MaterialData) * MaxCountMeshes, { BufferUsage::Storage });
 				instanceSpec.HostBuffer.Allocate(sizeof(MaterialData) * MaxCountMeshes);
 
+				// The host buffer mirrors the device buffer (only the changed slots are uploaded), so both of them start zeroed
+				instanceSpec.HostBuffer.Initialize();
+				instanceSpec.DeviceBuffer->SetData(instanceSpec.HostBuffer.Data);
+
 				// Setting the storage buffer into the descriptor
 				m_Data->GeometryDescriptor[i]->Set("u_MaterialUniform", instanceSpec.DeviceBuffer);
 			}
@@ -194,6 +193,18 @@ namespace Frost
 				// Allocating a heap block
 				instancdVertexBuffer.DeviceBuffer = BufferDevice::Create(sizeof(MeshInstancedVertexBuffer) * MaxCountMeshes, { BufferUsage::Vertex, BufferUsage::Storage });
 				instancdVertexBuffer.HostBuffer.Allocate(sizeof(MeshInstancedVertexBuffer) * MaxCountMeshes);
+				instancdVertexBuffer.HostBuffer.Initialize();
+				instancdVertexBuffer.DeviceBuffer->SetData(instancdVertexBuffer.HostBuffer.Data);
+
+				m_Data->GeometryDescriptor[i]->Set("u_InstanceData", instancdVertexBuffer.DeviceBuffer);
+			}
+
+			/// Instance slot indices (rebuilt every frame, like the indirect commands)
+			m_Data->InstanceSlotIndices.resize(framesInFlight);
+			for (auto& instanceSlotIndices : m_Data->InstanceSlotIndices)
+			{
+				instanceSlotIndices.DeviceBuffer = BufferDevice::Create(sizeof(uint32_t) * MaxCountMeshes, { BufferUsage::Vertex });
+				instanceSlotIndices.HostBuffer.Allocate(sizeof(uint32_t) * MaxCountMeshes);
 			}
 		}
 
@@ -226,6 +237,8 @@ namespace Frost
 				{
 					m_Data->MeshSpecs[i].DeviceBuffer = BufferDevice::Create(sizeof(MeshData_OC) * MaxCountMeshes, { BufferUsage::Storage });
 					m_Data->MeshSpecs[i].HostBuffer.Allocate(sizeof(MeshData_OC) * MaxCountMeshes);
+					m_Data->MeshSpecs[i].HostBuffer.Initialize();
+					m_Data->MeshSpecs[i].DeviceBuffer->SetData(m_Data->MeshSpecs[i].HostBuffer.Data);
 				}
 			}
 
@@ -295,17 +308,6 @@ namespace Frost
 		return value >= min && value <= max;
 	}
 
-	struct MeshInstanceListGeometryPass // This is reponsible for grouping all the mesh instances into one array
-	{
-		Mesh* Mesh; // Getting it as a raw pointer to intefere with the reference count
-		glm::mat4 Transform;
-		uint32_t MeshIndex;
-		uint32_t EntityID;
-	};
-
-	// This is reponsible for grouping all the mesh instances into one array
-	// Declaring it here to not allocate a new hashmap every frame
-	static HashMap<AssetHandle, Vector<MeshInstanceListGeometryPass>> s_GroupedMeshesCached;
 	static Vector<NewIndirectMeshData> s_GeometryMeshIndirectData; // Made a static variable, to not allocate new data everyframe
 	static glm::mat4 s_PreviousViewProjectioMatrix = glm::mat4(1.0f);
 	static glm::mat4 s_CurrentViewProjectioMatrix = glm::mat4(1.0f);
@@ -376,141 +378,219 @@ namespace Frost
 #endif
 
 
-	struct Plane
+	namespace Utils
 	{
-		glm::vec3 Normal = { 0.0f, 1.0f, 0.0f };// unit vector
-		float Distance = 0.0f;// distance from origin to the nearest point in the plane
+		// Regions closer than this are merged into one copy (the bytes in between are already up to date in the host mirror)
+		static constexpr uint64_t s_ScatterUploadMergeDistance = 256;
 
-		Plane() = default;
+		// Writes the data into the host mirror only if it differs from what was uploaded before, and records the dirty byte range
+		static bool WriteRetainedSlot(HeapBlock& heapBlock, const void* data, uint32_t size, uint64_t offset, Vector<BufferRegion>& dirtyRegions)
+		{
+			FROST_ASSERT(!(offset + size > heapBlock.HostBuffer.Size), "Buffer overflow!");
+
+			Byte* mirror = (Byte*)heapBlock.HostBuffer.Data + offset;
+			if (memcmp(mirror, data, size) == 0)
+				return false;
 
-		Plane(const glm::vec3& distance, const glm::vec3& normal)
-			: Normal(glm::normalize(normal)), Distance(glm::dot(Normal, distance))
-		{}
+			memcpy(mirror, data, size);
 
-		float GetSignedDistanceToPlane(const glm::vec3& point) const
+			if (!dirtyRegions.empty())
+			{
+				BufferRegion& lastRegion = dirtyRegions.back();
+				uint64_t lastRegionEnd = lastRegion.Offset + lastRegion.Size;
+				if (offset >= lastRegionEnd && offset - lastRegionEnd <= s_ScatterUploadMergeDistance)
+				{
+					lastRegion.Size = (offset + size) - lastRegion.Offset;
+					return true;
+				}
+			}
+			dirtyRegions.push_back({ offset, size });
+			return true;
+		}
+
+		static uint64_t GetBufferRegionsSize(const Vector<BufferRegion>& regions)
 		{
-			return glm::dot(Normal, point) - Distance;
+			uint64_t size = 0;
+			for (const auto& region : regions)
+				size += region.Size;
+			return size;
 		}
-	};
+	}
 
-	struct Frustum
+	bool VulkanGeometryPass::RetainedSceneAllocateBatch(RetainedMeshBatch& batch, uint32_t instanceCapacity)
 	{
-		Plane TopFace;
-		Plane BottomFace;
+		uint32_t instanceOffset, materialOffset;
+		if (!m_Data->InstanceSlotAllocator.Allocate(batch.SubmeshCount * instanceCapacity, UINT32_MAX, instanceOffset))
+			return false;
 
-		Plane RightFace;
-		Plane LeftFace;
+		if (!m_Data->MaterialSlotAllocator.Allocate(batch.MaterialCount * instanceCapacity, UINT32_MAX, materialOffset))
+		{
+			m_Data->InstanceSlotAllocator.Free(instanceOffset, batch.SubmeshCount * instanceCapacity);
+			return false;
+		}
 
-		Plane FarFace;
-		Plane NearFace;
-	};
+		batch.InstanceOffset = instanceOffset;
+		batch.MaterialOffset = materialOffset;
+		batch.InstanceCapacity = instanceCapacity;
+		return true;
+	}
 
-	struct AABB
+	void VulkanGeometryPass::RetainedSceneFreeBatch(RetainedMeshBatch& batch)
 	{
-		glm::vec3 Center{ 0.0f, 0.0f, 0.0f };
-		glm::vec3 Extents{ 0.0f, 0.0f, 0.0f };
+		m_Data->InstanceSlotAllocator.Free(batch.InstanceOffset, batch.SubmeshCount * batch.InstanceCapacity);
+		m_Data->MaterialSlotAllocator.Free(batch.MaterialOffset, batch.MaterialCount * batch.InstanceCapacity);
+		batch.InstanceCapacity = 0;
+	}
 
-		AABB(const glm::vec3& min, const glm::vec3& max)
-			: Center{ (max + min) * 0.5f },
-			Extents{ max.x - Center.x, max.y - Center.y, max.z - Center.z }
-		{}
+	void VulkanGeometryPass::RetainedSceneUpdateSlots(const RenderQueue& renderQueue)
+	{
+		uint64_t currentFrameCount = Renderer::GetFrameCount();
 
-		AABB(const glm::vec3& inCenter, float iI, float iJ, float iK)
-			: Center{ inCenter }, Extents{ iI, iJ, iK }
-		{}
+		// Reset the per frame queue indices, so we know which slots were claimed this frame
+		for (auto& [handle, batch] : m_Data->RetainedBatches)
+			batch.SlotQueueIndices.assign(batch.SlotEntityIDs.size(), UINT32_MAX);
 
-		// https://gdbooks.gitbooks.io/3dcollisions/content/Chapter2/static_aabb_plane.html
-		bool IsOnOrForwardPlane(const Plane& plane)
+		// Every instance claims the slot it had last frame (or a new one at the end of its batch).
+		// The instances are already grouped by mesh asset by the scene visibility stage
+		const SceneVisibility& sceneVisibility = m_RenderPassPipeline->GetSceneVisibility();
+		const Vector<uint32_t>& groupedInstances = sceneVisibility.GetGroupedInstances();
+		for (const SceneMeshGroup& group : sceneVisibility.GetGroups())
 		{
-			// Compute the projection interval radius of b onto L(t) = b.c + t * p.n
-			const float r = Extents.x * std::abs(plane.Normal.x) +
-				            Extents.y * std::abs(plane.Normal.y) +
-				            Extents.z * std::abs(plane.Normal.z);
+			RetainedMeshBatch& batch = m_Data->RetainedBatches[group.MeshAssetHandle];
+			batch.LastUsedFrame = currentFrameCount;
 
-			return -r <= plane.GetSignedDistanceToPlane(Center);
+			uint32_t materialCount = static_cast<uint32_t>(group.Mesh->GetMaterialCount());
+			if (batch.SubmeshCount != group.SubmeshCount || batch.MaterialCount != materialCount)
+			{
+				// The mesh asset has been reloaded (or it is a new batch), so its ranges have to be allocated again
+				RetainedSceneFreeBatch(batch);
+				batch.SubmeshCount = group.SubmeshCount;
+				batch.MaterialCount = materialCount;
+			}
+
+			for (uint32_t i = group.FirstInstance; i < group.FirstInstance + group.InstanceCount; i++)
+			{
+				uint32_t queueIndex = groupedInstances[i];
+				uint32_t entityID = renderQueue.m_Data[queueIndex].EntityID;
+
+				auto slotIt = batch.EntitySlots.find(entityID);
+				uint32_t slot;
+				if (slotIt != batch.EntitySlots.end() && batch.SlotQueueIndices[slotIt->second] == UINT32_MAX)
+				{
+					slot = slotIt->second;
+				}
+				else
+				{
+					// The same entity might submit the same mesh more than once, in that case the other submissions get their own slot
+					slot = static_cast<uint32_t>(batch.SlotEntityIDs.size());
+					batch.SlotEntityIDs.push_back(entityID);
+					batch.SlotQueueIndices.push_back(UINT32_MAX);
+					if (slotIt == batch.EntitySlots.end())
+						batch.EntitySlots[entityID] = slot;
+				}
+				batch.SlotQueueIndices[slot] = queueIndex;
+			}
 		}
 
-		bool IsOnFrustum(const Frustum& camFrustum, const glm::mat4& modelMatrix)
+		for (auto it = m_Data->RetainedBatches.begin(); it != m_Data->RetainedBatches.end();)
 		{
-			//Get global scale thanks to our transform
-			const glm::vec3 globalCenter{ modelMatrix * glm::vec4(Center, 1.0f) };
-			
-			glm::vec3 translation, rotation, scale;
-			Math::DecomposeTransform(modelMatrix, translation, rotation, scale);
-
-			glm::vec3 upVector = glm::quat(rotation) * glm::vec3(0.0f, 1.0f, 0.0f);
-			glm::vec3 rightVector = glm::quat(rotation) * glm::vec3(1.0f, 0.0f, 0.0f);
-			glm::vec3 frontVector = glm::quat(rotation) * glm::vec3(0.0f, 0.0f, -1.0f);
-
-			// Scaled orientation
-			const glm::vec3 right = rightVector * Extents.x * scale;
-			const glm::vec3 up = upVector * Extents.y * scale;
-			const glm::vec3 forward = frontVector * Extents.z * scale;
-
-			const float newIi = std::abs(glm::dot(glm::vec3{ 1.0f, 0.0f, 0.0f }, right)) +
-				                std::abs(glm::dot(glm::vec3{ 1.0f, 0.0f, 0.0f }, up)) +
-				                std::abs(glm::dot(glm::vec3{ 1.0f, 0.0f, 0.0f }, forward));
-
-			const float newIj = std::abs(glm::dot(glm::vec3{ 0.0f, 1.0f, 0.0f }, right)) +
-				                std::abs(glm::dot(glm::vec3{ 0.0f, 1.0f, 0.0f }, up)) +
-				                std::abs(glm::dot(glm::vec3{ 0.0f, 1.0f, 0.0f }, forward));
-
-			const float newIk = std::abs(glm::dot(glm::vec3{ 0.0f, 0.0f, 1.0f }, right)) +
-				                std::abs(glm::dot(glm::vec3{ 0.0f, 0.0f, 1.0f }, up)) +
-				                std::abs(glm::dot(glm::vec3{ 0.0f, 0.0f, 1.0f }, forward));
-
-			AABB globalAABB(globalCenter, newIi, newIj, newIk);
-
-			return (globalAABB.IsOnOrForwardPlane(camFrustum.LeftFace) &&
-				    globalAABB.IsOnOrForwardPlane(camFrustum.RightFace) &&
-				    globalAABB.IsOnOrForwardPlane(camFrustum.TopFace) &&
-				    globalAABB.IsOnOrForwardPlane(camFrustum.BottomFace) &&
-				    globalAABB.IsOnOrForwardPlane(camFrustum.NearFace) &&
-				    globalAABB.IsOnOrForwardPlane(camFrustum.FarFace));
-		};
-	};
-	
-	static Frustum CreateFrustum(const RenderQueue& renderQueue)
-	{
-		Ref<EditorCamera> sceneCamera = renderQueue.m_Camera.As<EditorCamera>();
-
-		float screenAspectRatio = (float)renderQueue.ViewPortWidth / (float)renderQueue.ViewPortHeight;
-		glm::vec3 frontVector = sceneCamera->GetForwardDirection();
-		glm::vec3 rightVector = glm::normalize(glm::cross(frontVector, glm::vec3(0.0f, 1.0f, 0.0f)));
-		glm::vec3 upVector = glm::normalize(glm::cross(rightVector, frontVector));
-		//glm::vec3 rightVector = sceneCamera->GetRightDirection();
-		//glm::vec3 upVector = sceneCamera->GetUpDirection();
-		glm::vec3 cameraPosition = sceneCamera->GetPosition();
-
-		//glm::vec3 CamRight = glm::normalize(glm::cross(mCameraFront, glm::vec3(0.0f, 1.0f, 0.0f)));
-		//glm::vec3 CamUp = glm::normalize(glm::cross(CamRight, mCameraFront));
-
-		Frustum frustum;
-		const float halfHeightSide = sceneCamera->GetFarClip() * tanf(glm::radians(sceneCamera->GetCameraFOV() * 0.5f));
-		const float halfWidthSide = halfHeightSide * screenAspectRatio;
-		const glm::vec3 farPlaneDirection = sceneCamera->GetFarClip() * frontVector;
-
-		frustum.NearFace = { cameraPosition + sceneCamera->GetNearClip() * frontVector, frontVector };
-		frustum.FarFace = { cameraPosition + farPlaneDirection, -frontVector };
-		
-		frustum.RightFace = { cameraPosition, glm::cross(farPlaneDirection - rightVector * halfWidthSide, upVector) };
-		frustum.LeftFace = { cameraPosition,  glm::cross(upVector, farPlaneDirection + rightVector * halfWidthSide) };
+			RetainedMeshBatch& batch = it->second;
+
+			// Batches that weren't submitted this frame give back their ranges
+			if (batch.LastUsedFrame != currentFrameCount)
+			{
+				RetainedSceneFreeBatch(batch);
+				it = m_Data->RetainedBatches.erase(it);
+				continue;
+			}
 
-		frustum.TopFace = { cameraPosition,      glm::cross(rightVector, farPlaneDirection - upVector * halfHeightSide) };
-		frustum.BottomFace = { cameraPosition,   glm::cross(farPlaneDirection + upVector * halfHeightSide, rightVector) };
+			// Remove the slots which weren't claimed by moving the last slot into their place (only that one instance gets dirty)
+			for (uint32_t slot = 0; slot < batch.SlotEntityIDs.size();)
+			{
+				if (batch.SlotQueueIndices[slot] != UINT32_MAX)
+				{
+					slot++;
+					continue;
+				}
+
+				auto removedIt = batch.EntitySlots.find(batch.SlotEntityIDs[slot]);
+				if (removedIt != batch.EntitySlots.end() && removedIt->second == slot)
+					batch.EntitySlots.erase(removedIt);
+
+				uint32_t lastSlot = static_cast<uint32_t>(batch.SlotEntityIDs.size()) - 1;
+				if (slot != lastSlot)
+				{
+					batch.SlotEntityIDs[slot] = batch.SlotEntityIDs[lastSlot];
+					batch.SlotQueueIndices[slot] = batch.SlotQueueIndices[lastSlot];
 
-		return frustum;
+					auto movedIt = batch.EntitySlots.find(batch.SlotEntityIDs[slot]);
+					if (movedIt != batch.EntitySlots.end() && movedIt->second == lastSlot)
+						movedIt->second = slot;
+				}
+				batch.SlotEntityIDs.pop_back();
+				batch.SlotQueueIndices.pop_back();
+			}
+
+			// Grow the batch when it is full, and shrink it when most of it is unused
+			uint32_t instanceCount = static_cast<uint32_t>(batch.SlotEntityIDs.size());
+			bool needsGrow = instanceCount > batch.InstanceCapacity;
+			bool needsShrink = batch.InstanceCapacity > 4 && instanceCount < batch.InstanceCapacity / 4;
+			if (needsGrow || needsShrink)
+			{
+				uint32_t instanceCapacity = 4;
+				while (instanceCapacity < instanceCount)
+					instanceCapacity *= 2;
+
+				RetainedSceneFreeBatch(batch);
+				bool allocated = RetainedSceneAllocateBatch(batch, instanceCapacity);
+				FROST_ASSERT(allocated, "The retained gpu scene is full! (increase `MaxMeshCount_GeometryPass`)");
+			}
+
+			it++;
+		}
 	}
 
-	static bool ComputeFrustumCulling(const RenderQueue& renderQueue, const glm::mat4& modelMatrix, const Math::BoundingBox& boundingBox)
+	void VulkanGeometryPass::RetainedSceneCompact()
 	{
-		Frustum cameraFrustum = CreateFrustum(renderQueue);
+		// Background compaction: every frame at most one batch is moved into a lower free range (for each buffer),
+		// this way the freed slots are reclaimed over a few frames, instead of re-uploading everything at once
+		RetainedMeshBatch* highestInstanceBatch = nullptr;
+		RetainedMeshBatch* highestMaterialBatch = nullptr;
+		for (auto& [handle, batch] : m_Data->RetainedBatches)
+		{
+			if (batch.InstanceCapacity == 0) continue;
+
+			if (!highestInstanceBatch || batch.InstanceOffset > highestInstanceBatch->InstanceOffset)
+				highestInstanceBatch = &batch;
+			if (!highestMaterialBatch || batch.MaterialOffset > highestMaterialBatch->MaterialOffset)
+				highestMaterialBatch = &batch;
+		}
 
-		glm::vec3 translation, rotation, scale;
-		Math::DecomposeTransform(modelMatrix, translation, rotation, scale);
+		if (highestInstanceBatch && !m_Data->InstanceSlotAllocator.GetFreeRanges().empty())
+		{
+			RetainedMeshBatch& batch = *highestInstanceBatch;
+			uint32_t size = batch.SubmeshCount * batch.InstanceCapacity;
+			uint32_t newOffset;
+			if (m_Data->InstanceSlotAllocator.Allocate(size, batch.InstanceOffset, newOffset))
+			{
+				m_Data->InstanceSlotAllocator.Free(batch.InstanceOffset, size);
+				batch.InstanceOffset = newOffset;
+				m_Data->RetainedStats.CompactedBatches++;
+			}
+		}
 
-		AABB meshAABB(boundingBox.Min, boundingBox.Max);
-		return meshAABB.IsOnFrustum(cameraFrustum, modelMatrix);
+		if (highestMaterialBatch && !m_Data->MaterialSlotAllocator.GetFreeRanges().empty())
+		{
+			RetainedMeshBatch& batch = *highestMaterialBatch;
+			uint32_t size = batch.MaterialCount * batch.InstanceCapacity;
+			uint32_t newOffset;
+			if (m_Data->MaterialSlotAllocator.Allocate(size, batch.MaterialOffset, newOffset))
+			{
+				m_Data->MaterialSlotAllocator.Free(batch.MaterialOffset, size);
+				batch.MaterialOffset = newOffset;
+				m_Data->RetainedStats.CompactedBatches++;
+			}
+		}
 	}
 
 	void VulkanGeometryPass::GeometryPrepareIndirectDataWithInstacing(const RenderQueue& renderQueue)
@@ -527,6 +607,10 @@ namespace Frost
 		s_PreviousViewProjectioMatrix = s_CurrentViewProjectioMatrix;
 		s_CurrentViewProjectioMatrix = renderQueue.m_Camera->GetViewProjectionVK();
 
+		// The view projection matrices are not part of the instance data anymore (otherwise moving the camera would make every slot dirty)
+		m_Data->GeometryDescriptor[currentFrameIndex]->Set("CameraData.ViewProjectionMatrix", s_CurrentViewProjectioMatrix);
+		m_Data->GeometryDescriptor[currentFrameIndex]->Set("CameraData.PreviousViewProjectionMatrix", s_PreviousViewProjectioMatrix);
+
 		/*
 			Each mesh might have a set of submeshes which are sent to render individualy.
 			We dont need them when we render them indirectly (because the gpu renders all the submeshes automatically - `multidraw`),
@@ -534,24 +618,16 @@ namespace Frost
 			(TODO: This explanation is outdated, now we are using `instanced indirect multidraw rendering` :D)
 		*/
 		s_GeometryMeshIndirectData.clear();
-		s_GroupedMeshesCached.clear();
 		s_TotalSubmeshSubmitted = 0;
 
-		// Allocate all the neccesary array buffers before, so we won't waste cpus cycles on reallocating memory
-		for (auto& [meshAssetUUID, instanceCount] : renderQueue.m_MeshInstanceCount)
-		{
-			s_GroupedMeshesCached[meshAssetUUID].reserve(instanceCount);
-		}
-		s_GeometryMeshIndirectData.reserve(s_GroupedMeshesCached.size());
-
-
-		for (uint32_t i = 0; i < renderQueue.GetQueueSize(); i++)
-		{
-			// Get the mesh
-			auto mesh = renderQueue.m_Data[i].Mesh;
+		// Every mesh asset has its own persistent batch of slots, so the instances are grouped by the retained scene itself
+		m_Data->RetainedStats = {};
+		RetainedSceneUpdateSlots(renderQueue);
+		RetainedSceneCompact();
+		s_GeometryMeshIndirectData.reserve(m_Data->RetainedBatches.size());
 
-			s_GroupedMeshesCached[mesh->GetMeshAsset()->Handle].push_back({ mesh.Raw(), renderQueue.m_Data[i].Transform, i, renderQueue.m_Data[i].EntityID});
-		}
+		// The submesh transforms and the frustum culling (camera view) come from the scene visibility stage
+		const SceneVisibility& sceneVisibility = m_RenderPassPipeline->GetSceneVisibility();
 
 		//ObjectCullingPrepareData(renderQueue);
 
@@ -559,246 +635,150 @@ namespace Frost
 		// `Indirect draw commands` offset
 		uint64_t indirectCmdsOffset = 0;
 
-		// `Instance data` offset.
-		uint64_t materialDataOffset = 0;
-
-		// `Instance data` offset.
-		uint64_t instanceVertexOffset = 0;
+		// Retained slots listed for the draws
+		uint32_t* instanceSlotIndices = reinterpret_cast<uint32_t*>(m_Data->InstanceSlotIndices[currentFrameIndex].HostBuffer.Data);
+		uint32_t instanceSlotIndexCount = 0;
 
-		for (auto& [handle, groupedMeshes] : s_GroupedMeshesCached)
-		{
-			NewIndirectMeshData* currentIndirectMeshData;
-			NewIndirectMeshData* lastIndirectMeshData = nullptr;
+		HeapBlock& materialSpecs = m_Data->MaterialSpecs[currentFrameIndex];
+		HeapBlock& instancedVertexBuffer = m_Data->GlobalInstancedVertexBuffer[currentFrameIndex];
+		HeapBlock& meshSpecs = m_Data->MeshSpecs[currentFrameIndex];
+		m_Data->MaterialDirtyRegions.clear();
+		m_Data->InstanceDirtyRegions.clear();
+		m_Data->MeshSpecDirtyRegions.clear();
 
-			// If we are submitting the first mesh, we don't need any offset
-			currentIndirectMeshData = &s_GeometryMeshIndirectData.emplace_back();
+		RetainedSceneStats& stats = m_Data->RetainedStats;
+		stats.MeshBatches = static_cast<uint32_t>(m_Data->RetainedBatches.size());
 
-			// We are checking `.size() > 1` and also `.size() - 2` because we've already pushed_back and element before, so we should go 2 elements behind instead of one
-			if (s_GeometryMeshIndirectData.size() > 1)
-				lastIndirectMeshData = &s_GeometryMeshIndirectData[s_GeometryMeshIndirectData.size() - 2];
+		m_Data->MaterialIndexOffsets.resize(renderQueue.GetQueueSize());
 
-			Ref<MeshAsset> meshAsset = groupedMeshes[0].Mesh->GetMeshAsset();
-			const Vector<Submesh>& submeshes = meshAsset->GetSubMeshes();
+		for (auto& [handle, batch] : m_Data->RetainedBatches)
+		{
+			uint32_t instanceCount = static_cast<uint32_t>(batch.SlotQueueIndices.size());
 
-			currentIndirectMeshData->MeshAssetHandle = meshAsset->Handle;
-			currentIndirectMeshData->InstanceCount = groupedMeshes.size();
-			currentIndirectMeshData->SubmeshCount = submeshes.size();
+			NewIndirectMeshData* currentIndirectMeshData = &s_GeometryMeshIndirectData.emplace_back();
+			currentIndirectMeshData->MeshAssetHandle = handle;
+			currentIndirectMeshData->InstanceCount = instanceCount;
+			currentIndirectMeshData->SubmeshCount = batch.SubmeshCount;
 			currentIndirectMeshData->TotalSubmeshCount = currentIndirectMeshData->SubmeshCount * currentIndirectMeshData->InstanceCount;
-			currentIndirectMeshData->MaterialCount = groupedMeshes[0].Mesh->GetMaterialCount();
-
+			currentIndirectMeshData->MaterialCount = batch.MaterialCount;
 			currentIndirectMeshData->CmdOffset = indirectCmdsOffset / sizeof(VkDrawIndexedIndirectCommand);
-
-			currentIndirectMeshData->MaterialOffset = 0;
-			currentIndirectMeshData->TotalMeshOffset = 0;
-			if (s_GeometryMeshIndirectData.size() > 1)
-			{
-				currentIndirectMeshData->MaterialOffset = lastIndirectMeshData->MaterialOffset + (lastIndirectMeshData->MaterialCount * lastIndirectMeshData->InstanceCount);
-				currentIndirectMeshData->TotalMeshOffset = lastIndirectMeshData->TotalMeshOffset + (lastIndirectMeshData->SubmeshCount * lastIndirectMeshData->InstanceCount);
-			}
+			currentIndirectMeshData->MaterialOffset = batch.MaterialOffset;
+			currentIndirectMeshData->TotalMeshOffset = batch.InstanceOffset;
+			currentIndirectMeshData->CmdCount = 0;
 
 			// Set up the materials firstly (per instance, per material)
-			for (auto& meshInstance : groupedMeshes)
+			for (uint32_t slot = 0; slot < instanceCount; slot++)
 			{
-				for (uint32_t k = 0; k < currentIndirectMeshData->MaterialCount; k++)
+				Mesh* mesh = renderQueue.m_Data[batch.SlotQueueIndices[slot]].Mesh.Raw();
+				m_Data->MaterialIndexOffsets[batch.SlotQueueIndices[slot]] = batch.MaterialOffset + (slot * batch.MaterialCount);
+				for (uint32_t k = 0; k < batch.MaterialCount; k++)
 				{
 					// Setting up the material data into a storage buffer
-					Ref<DataStorage> materialData = meshInstance.Mesh->GetMaterialAsset(k)->GetMaterialInternalData();
-
-					m_Data->MaterialSpecs[currentFrameIndex].HostBuffer.Write(materialData->GetBufferData(), sizeof(MaterialData), materialDataOffset);
+					Ref<DataStorage> materialData = mesh->GetMaterialAsset(k)->GetMaterialInternalData();
 
-					materialDataOffset += sizeof(MaterialData);
+					uint64_t materialDataOffset = uint64_t(batch.MaterialOffset + (slot * batch.MaterialCount) + k) * sizeof(MaterialData);
+					Utils::WriteRetainedSlot(materialSpecs, materialData->GetBufferData(), sizeof(MaterialData), materialDataOffset, m_Data->MaterialDirtyRegions);
 				}
 			}
+			stats.FullUploadBytes += uint64_t(instanceCount) * batch.MaterialCount * sizeof(MaterialData);
 
-			// Set up the instanced vertex buffer (per submesh, per instance)
-			for(uint32_t submeshIndex = 0; submeshIndex < submeshes.size(); submeshIndex++)
+			// Set up the instanced vertex buffer (per submesh, per instance). Every instance keeps its retained slot whatever LOD the camera view
+			// selected for it, the draws go through a list of slot indices per LOD instead (the culled instances are not listed)
+			const MeshAsset* meshAsset = renderQueue.m_Data[batch.SlotQueueIndices[0]].Mesh->GetMeshAsset().Raw();
+			const Vector<Submesh>& submeshes = meshAsset->GetSubMeshes();
+			uint32_t lodCount = std::max(meshAsset->GetLODCount(), 1u);
+
+			FrameVector<uint8_t> slotLODs(instanceCount);
+			for(uint32_t submeshIndex = 0; submeshIndex < batch.SubmeshCount; submeshIndex++)
 			{
-				MeshInstancedVertexBuffer meshInstancedVertexBuffer{};
-				uint32_t meshInstanceNr = 0;
-				for (auto& meshInstance : groupedMeshes)
+				// Count the instances of every LOD first (the last bucket is for the culled instances)
+				uint32_t lodPositions[MaxMeshLODCount + 1] = {};
+				for (uint32_t slot = 0; slot < instanceCount; slot++)
 				{
-					//glm::mat4 modelMatrix = meshInstance.Transform * submeshes[submeshIndex].Transform;
+					uint32_t queueIndex = batch.SlotQueueIndices[slot];
+					bool inside = sceneVisibility.IsSubmeshVisible(SceneVisibility::CameraView, queueIndex, submeshIndex);
+					slotLODs[slot] = static_cast<uint8_t>(inside ? sceneVisibility.GetSubmeshLOD(SceneVisibility::CameraView, queueIndex, submeshIndex) : MaxMeshLODCount);
+					lodPositions[slotLODs[slot]]++;
+				}
 
-					 // Using skeletal (dynamic) submesh transforms, instead of the static ones which are found in the mesh asset
-					glm::mat4 modelMatrix = meshInstance.Transform * meshInstance.Mesh->GetSkeletalSubmeshes()[submeshIndex].Transform;
+				// Every LOD gets a tightly packed range in the slot index list
+				for (uint32_t lod = 0; lod < MaxMeshLODCount; lod++)
+				{
+					uint32_t lodInstanceCount = lodPositions[lod];
+					lodPositions[lod] = instanceSlotIndexCount;
+					instanceSlotIndexCount += lodInstanceCount;
+
+					if (lod >= lodCount || lodInstanceCount == 0)
+						continue;
+
+					const SubmeshLOD& submeshLOD = meshAsset->GetSubMeshesLOD(lod)[submeshIndex];
+
+					// Submit the submesh into the cpu buffer
+					VkDrawIndexedIndirectCommand indirectCmdBuf{};
+					indirectCmdBuf.firstIndex = submeshLOD.BaseIndex;
+					indirectCmdBuf.indexCount = submeshLOD.IndexCount;
+
+					// The global index buffer is already offsetted (for every LOD), so we do not need to add any offset to the indices
+					indirectCmdBuf.vertexOffset = 0;
 
+					indirectCmdBuf.instanceCount = lodInstanceCount;
+					indirectCmdBuf.firstInstance = lodPositions[lod];
+
+					m_Data->IndirectCmdBuffer[currentFrameIndex].HostBuffer.Write((void*)&indirectCmdBuf, sizeof(VkDrawIndexedIndirectCommand), indirectCmdsOffset);
+					indirectCmdsOffset += sizeof(VkDrawIndexedIndirectCommand);
+					currentIndirectMeshData->CmdCount++;
+				}
+
+				MeshInstancedVertexBuffer meshInstancedVertexBuffer{};
+				for (uint32_t slot = 0; slot < instanceCount; slot++)
+				{
+					uint32_t queueIndex = batch.SlotQueueIndices[slot];
+					const RenderQueue::RenderData& renderData = renderQueue.m_Data[queueIndex];
+					Mesh* mesh = renderData.Mesh.Raw();
+
+					const glm::mat4& modelMatrix = sceneVisibility.GetSubmeshTransform(queueIndex, submeshIndex);
 
 					// Adding the neccesary Matricies for the shader
 					meshInstancedVertexBuffer.ModelSpaceMatrix = modelMatrix;
-					meshInstancedVertexBuffer.WorldSpaceMatrix = s_CurrentViewProjectioMatrix * modelMatrix;
-					meshInstancedVertexBuffer.PreviousWorldSpaceMatrix = s_PreviousViewProjectioMatrix * modelMatrix;
 					/////////////////////////////////////////////////////
 					
 					// Doing `MaterialOffset` because we are indicating it to the whole material buffer (so the index should be global)
-					meshInstancedVertexBuffer.MaterialIndexOffset = currentIndirectMeshData->MaterialOffset + (meshInstanceNr * currentIndirectMeshData->MaterialCount);
+					meshInstancedVertexBuffer.MaterialIndexOffset = batch.MaterialOffset + (slot * batch.MaterialCount);
 					/////////////////////////////////////////////////////
 
 					// Other stuff
-					meshInstancedVertexBuffer.EntityID = meshInstance.EntityID;
+					meshInstancedVertexBuffer.EntityID = renderData.EntityID;
 
-					if (meshInstance.Mesh->IsAnimated())
-						meshInstancedVertexBuffer.BoneInformationBDA = meshInstance.Mesh->GetBoneUniformBuffer(currentFrameIndex).As<VulkanUniformBuffer>()->GetVulkanBufferAddress();
+					if (mesh->IsAnimated())
+						meshInstancedVertexBuffer.BoneInformationBDA = mesh->GetBoneUniformBuffer(currentFrameIndex).As<VulkanUniformBuffer>()->GetVulkanBufferAddress();
 					else
 						meshInstancedVertexBuffer.BoneInformationBDA = 0;
 					/////////////////////////////////////////////////////
 
-					
-
-#if 1
-					// TEMP!!!!
-					const Submesh& submesh = meshInstance.Mesh->GetMeshAsset()->GetSubMeshes()[submeshIndex];
-					
-					
-
-#if 0
-					// Use our Min Max to define eight corners
-					glm::vec4 corners[8] = {
-						{submesh.BoundingBox.Min.x, submesh.BoundingBox.Min.y, submesh.BoundingBox.Min.z, 1.0},
-						{submesh.BoundingBox.Max.x, submesh.BoundingBox.Min.y, submesh.BoundingBox.Min.z, 1.0},
-						{submesh.BoundingBox.Min.x, submesh.BoundingBox.Max.y, submesh.BoundingBox.Min.z, 1.0},
-						{submesh.BoundingBox.Max.x, submesh.BoundingBox.Max.y, submesh.BoundingBox.Min.z, 1.0},
-
-						{submesh.BoundingBox.Min.x, submesh.BoundingBox.Min.y, submesh.BoundingBox.Max.z, 1.0},
-						{submesh.BoundingBox.Max.x, submesh.BoundingBox.Min.y, submesh.BoundingBox.Max.z, 1.0},
-						{submesh.BoundingBox.Min.x, submesh.BoundingBox.Max.y, submesh.BoundingBox.Max.z, 1.0},
-						{submesh.BoundingBox.Max.x, submesh.BoundingBox.Max.y, submesh.BoundingBox.Max.z, 1.0},
-					};
-
-					bool inside = false;
-					for (size_t cornerIndex = 0; cornerIndex < 8; cornerIndex++) {
-						// Transform vertex
-						glm::vec4 corner = worldSpaceMatrix * corners[cornerIndex];
-						// Check vertex against clip space bounds
-						inside = inside ||
-							(Within(-corner.w, corner.x, corner.w) &&
-							Within(-corner.w, corner.y, corner.w) &&
-							Within(0.0f, corner.z, corner.w));
-					}
-#endif
-					
-					bool inside = ComputeFrustumCulling(renderQueue, modelMatrix, submesh.BoundingBox);
-					meshInstancedVertexBuffer.ModelSpaceMatrix[3][3] = (float)inside;
-
-#if 0
-					// Transform the AABB into 2D screen space
-					glm::vec4 minScreenSpace = meshInstancedVertexBuffer.WorldSpaceMatrix * glm::vec4(submesh.BoundingBox.Min, 1.0f);
-					glm::vec4 maxScreenSpace = meshInstancedVertexBuffer.WorldSpaceMatrix * glm::vec4(submesh.BoundingBox.Max, 1.0f);
-					minScreenSpace /= minScreenSpace.w;
-					maxScreenSpace /= maxScreenSpace.w;
-
-					glm::vec4 minViewPos = renderQueue.m_Camera->GetViewMatrix() * glm::vec4(submesh.BoundingBox.Min, 1.0f);
-					glm::vec4 maxViewPos = renderQueue.m_Camera->GetViewMatrix() * glm::vec4(submesh.BoundingBox.Max, 1.0f);
-
-					// clip objects behind near plane
-#if 0
-					//minScreenSpace.z *= glm::step(minViewPos.z, renderQueue.m_Camera->GetNearClip());
-					//maxScreenSpace.z *= glm::step(maxViewPos.z, renderQueue.m_Camera->GetNearClip());
-
-					//minScreenSpace.z = glm::clamp(minScreenSpace.z, 0.0f, 1.0f);
-					//maxScreenSpace.z = glm::clamp(maxScreenSpace.z, 0.0f, 1.0f);
-#endif
-
-					// Convert to pixel coordinates
-					glm::vec2 uvMin = (glm::clamp(glm::vec2(minScreenSpace), glm::vec2(-1.0), glm::vec2(1.0)) * glm::vec2(0.5) + glm::vec2(0.5));
-					glm::vec2 uvMax = (glm::clamp(glm::vec2(maxScreenSpace), glm::vec2(-1.0), glm::vec2(1.0)) * glm::vec2(0.5) + glm::vec2(0.5));
-
-					glm::vec2 screenPosMin = uvMin * glm::vec2(renderQueue.ViewPortWidth, renderQueue.ViewPortHeight);
-					glm::vec2 screenPosMax = uvMax * glm::vec2(renderQueue.ViewPortWidth, renderQueue.ViewPortHeight);
+					const Submesh& submesh = submeshes[submeshIndex];
 
-#if 0
-					//if (minScreenSpace.z > 1.0 && maxScreenSpace.z > 1.0)
-					//{
-					//	screenPosMin = glm::vec2(0.0f);
-					//	screenPosMax = glm::vec2(0.0f);
-					//}
-#endif
+					// Only the instances that changed since this frame's buffer was last uploaded are written
+					// (LOD and visibility changes only touch the slot index list)
+					uint32_t instanceSlot = batch.InstanceOffset + (submeshIndex * batch.InstanceCapacity) + slot;
+					if (slotLODs[slot] != MaxMeshLODCount)
+						instanceSlotIndices[lodPositions[slotLODs[slot]]++] = instanceSlot;
 
-					// Calculate the number of pixels
-					glm::vec2 screenRect = glm::abs(glm::vec2(screenPosMax - screenPosMin));
-					screenRect.x = glm::clamp(screenRect.x, 0.0f, (float)renderQueue.ViewPortWidth);
-					screenRect.y = glm::clamp(screenRect.y, 0.0f, (float)renderQueue.ViewPortHeight);
-					int32_t pixels = int32_t(abs(screenRect.x) * abs(screenRect.y));
-
-					//FROST_CORE_INFO("{0}, {1}", screenRect.x, screenRect.y);
-#endif
-
-					
-					m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].HostBuffer.Write((void*)&meshInstancedVertexBuffer, sizeof(MeshInstancedVertexBuffer), instanceVertexOffset);
-					instanceVertexOffset += sizeof(MeshInstancedVertexBuffer);
+					bool isDirty = Utils::WriteRetainedSlot(instancedVertexBuffer, &meshInstancedVertexBuffer, sizeof(MeshInstancedVertexBuffer), uint64_t(instanceSlot) * sizeof(MeshInstancedVertexBuffer), m_Data->InstanceDirtyRegions);
 
 					// Setting up `Mesh data` for the occlusion culling compute shader
 					meshdataForOcclusionCulling.Transform = modelMatrix;
 					meshdataForOcclusionCulling.AABB_Min = glm::vec4(submesh.BoundingBox.Min, 1.0f);
 					meshdataForOcclusionCulling.AABB_Max = glm::vec4(submesh.BoundingBox.Max, 1.0f);
-					m_Data->MeshSpecs[currentFrameIndex].HostBuffer.Write(
-						(void*)&meshdataForOcclusionCulling,
-						sizeof(MeshData_OC),
-						s_TotalSubmeshSubmitted * sizeof(MeshData_OC)
-					);
-					s_TotalSubmeshSubmitted++;
-					meshInstanceNr++;
-
-					//glm::vec3 translation, rotation, scale;
-					//Math::DecomposeTransform(modelMatrix, translation, rotation, scale);
-					//
-					// 
-					//glm::vec3 scaleFactor = glm::vec3(
-					//	submesh.BoundingBox.Max.x - submesh.BoundingBox.Min.x,
-					//	submesh.BoundingBox.Max.y - submesh.BoundingBox.Min.y,
-					//	submesh.BoundingBox.Max.z - submesh.BoundingBox.Min.z
-					//);
-					// 
-					//glm::mat4 transform = glm::translate(glm::mat4(1.0f), translation) * glm::scale(glm::mat4(1.0f), scaleFactor * scale);
-					//Renderer::SubmitWireframeMesh(MeshAsset::GetDefaultMeshes().Cube, transform, glm::vec4(0.8f, 0.5f, 0.4f, 1.0f), 2.0f);
-#endif
-				}
-			}
-
-			for (uint32_t submeshIndex = 0; submeshIndex < submeshes.size(); submeshIndex++)
-			{
-				const Submesh& submesh = submeshes[submeshIndex];
-
-				// Submit the submesh into the cpu buffer
-				VkDrawIndexedIndirectCommand indirectCmdBuf{};
-				indirectCmdBuf.firstIndex = submesh.BaseIndex;
-				indirectCmdBuf.indexCount = submesh.IndexCount;
-#if 0
-				indirectCmdBuf.firstIndex = meshAsset->GetSubMeshesLOD(1)[submeshIndex].BaseIndex;
-				indirectCmdBuf.indexCount = meshAsset->GetSubMeshesLOD(1)[submeshIndex].IndexCount;
-#endif
-
-				// Vertexoffset:  basically adds what offset you want to the indices before they are actually rendered.
-				// TODO: Previously, each index was using its own scale, from 0 to n
-				// TODO: Now, the index buffer is global, so we do not need to add any offset to the indices
-				//indirectCmdBuf.vertexOffset = submesh.BaseVertex;
-				indirectCmdBuf.vertexOffset = 0;
+					isDirty |= Utils::WriteRetainedSlot(meshSpecs, &meshdataForOcclusionCulling, sizeof(MeshData_OC), uint64_t(instanceSlot) * sizeof(MeshData_OC), m_Data->MeshSpecDirtyRegions);
 
-				indirectCmdBuf.instanceCount = groupedMeshes.size();
-
-				if (lastIndirectMeshData)
-				{
-					indirectCmdBuf.firstInstance = currentIndirectMeshData->TotalMeshOffset;
-				}
-				else
-				{
-					indirectCmdBuf.firstInstance = 0;
+					stats.DirtySlots += static_cast<uint32_t>(isDirty);
+					s_TotalSubmeshSubmitted++;
 				}
-				indirectCmdBuf.firstInstance += submeshIndex;
-
-				// Frustum Cull
-				//if (!currentIndirectMeshData->SubMeshIndexCulled[submeshIndex])
-				//{
-				//	indirectCmdBuf.indexCount = 0;
-				//	indirectCmdBuf.instanceCount = 1;
-				//	indirectCmdBuf.firstIndex = 0;
-				//	indirectCmdBuf.vertexOffset = 0;
-				//	indirectCmdBuf.firstInstance = 0;
-				//}
-
-				m_Data->IndirectCmdBuffer[currentFrameIndex].HostBuffer.Write((void*)&indirectCmdBuf, sizeof(VkDrawIndexedIndirectCommand), indirectCmdsOffset);
-				indirectCmdsOffset += sizeof(VkDrawIndexedIndirectCommand);
 			}
 		}
+		stats.TotalSlots = static_cast<uint32_t>(s_TotalSubmeshSubmitted);
+		uint64_t instanceSlotIndicesSize = uint64_t(instanceSlotIndexCount) * sizeof(uint32_t);
+		stats.FullUploadBytes += s_TotalSubmeshSubmitted * (sizeof(MeshInstancedVertexBuffer) + sizeof(MeshData_OC)) + indirectCmdsOffset + instanceSlotIndicesSize;
 
 		//FROST_CORE_INFO("FINISH!!");
 
@@ -809,25 +789,25 @@ namespace Frost
 
 
 		// Sending the data into the gpu buffer
-		// Indirect draw commands
+		// Indirect draw commands (these are small and the offsets of the batches might change, so they are always uploaded)
 		auto vulkanIndirectCmdBuffer = m_Data->IndirectCmdBuffer[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
 		void* indirectCmdsPointer = m_Data->IndirectCmdBuffer[currentFrameIndex].HostBuffer.Data;
 		vulkanIndirectCmdBuffer->SetData(indirectCmdsOffset, indirectCmdsPointer);
 
-		// Material Instance data
-		auto vulkanInstanceDataBuffer = m_Data->MaterialSpecs[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
-		void* instanceDataPointer = m_Data->MaterialSpecs[currentFrameIndex].HostBuffer.Data;
-		vulkanInstanceDataBuffer->SetData(materialDataOffset, instanceDataPointer);
-
-		// Global Instanced Vertex Buffer data
-		auto vulkanInstancedVertexBuffer = m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
-		void* instancedVertexBufferPointer = m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].HostBuffer.Data;
-		vulkanInstancedVertexBuffer->SetData(instanceVertexOffset, instancedVertexBufferPointer);
+		// Retained slots of this frame's draws (rebuilt every frame, like the indirect commands)
+		if (instanceSlotIndicesSize > 0)
+			m_Data->InstanceSlotIndices[currentFrameIndex].DeviceBuffer->SetData(instanceSlotIndicesSize, instanceSlotIndices);
 
+		// Material Instance data, Global Instanced Vertex Buffer data and Mesh specs (only the dirty regions)
+		materialSpecs.DeviceBuffer->SetData(materialSpecs.HostBuffer.Data, m_Data->MaterialDirtyRegions);
+		instancedVertexBuffer.DeviceBuffer->SetData(instancedVertexBuffer.HostBuffer.Data, m_Data->InstanceDirtyRegions);
+		meshSpecs.DeviceBuffer->SetData(meshSpecs.HostBuffer.Data, m_Data->MeshSpecDirtyRegions);
 
-		auto meshSpecificationBuffer = m_Data->MeshSpecs[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
-		void* meshSpecificationBufferPointer = m_Data->MeshSpecs[currentFrameIndex].HostBuffer.Data;
-		meshSpecificationBuffer->SetData(s_TotalSubmeshSubmitted * sizeof(MeshData_OC), meshSpecificationBufferPointer);
+		stats.UploadRegions = static_cast<uint32_t>(m_Data->MaterialDirtyRegions.size() + m_Data->InstanceDirtyRegions.size() + m_Data->MeshSpecDirtyRegions.size());
+		stats.UploadedBytes = indirectCmdsOffset + instanceSlotIndicesSize +
+			Utils::GetBufferRegionsSize(m_Data->MaterialDirtyRegions) +
+			Utils::GetBufferRegionsSize(m_Data->InstanceDirtyRegions) +
+			Utils::GetBufferRegionsSize(m_Data->MeshSpecDirtyRegions);
 	}
 
 	void VulkanGeometryPass::GeometryUpdateWithInstancing(const RenderQueue& renderQueue)
@@ -894,8 +874,8 @@ namespace Frost
 
 
 
-		// Binding the global instanced vertex buffer only once
-		auto vulkanVertexBufferInstanced = m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
+		// Binding the instance slot indices only once (the instance data is read from the storage buffer with them)
+		auto vulkanVertexBufferInstanced = m_Data->InstanceSlotIndices[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
 		VkBuffer vertexBufferInstanced = vulkanVertexBufferInstanced->GetVulkanBuffer();
 		VkDeviceSize deviceSize[1] = { 0 };
 		vkCmdBindVertexBuffers(cmdBuf, 0, 1, &vertexBufferInstanced, deviceSize);
@@ -906,13 +886,10 @@ namespace Frost
 			auto& indirectPerMeshData = s_GeometryMeshIndirectData[i];
 
 			// Get the mesh
-			const AssetMetadata& assetMetadata = AssetManager::GetMetadata(indirectPerMeshData.MeshAssetHandle);
-			Ref<MeshAsset> meshAsset = AssetManager::GetAsset<MeshAsset>(assetMetadata.FilePath.string());
+			Ref<MeshAsset> meshAsset = AssetManager::GetAsset<MeshAsset>(indirectPerMeshData.MeshAssetHandle);
 
-			// Bind the index buffer
-			//meshAsset->GetIndexBuffer()->Bind(); // TODO: Also this is changed
-			meshAsset->GetSubmeshIndexBuffer()->Bind(); // TODO: Also this is changed
-			//meshAsset->GetGlobalSubmeshIndexBuffer()->Bind(); // TODO: Also this is changed
+			// Bind the index buffer (it holds all the LODs)
+			meshAsset->GetGlobalSubmeshIndexBuffer()->Bind();
 
 			m_GeometryPushConstant.VertexBufferBDA = meshAsset->GetVertexBuffer().As<VulkanVertexBuffer>()->GetVulkanBufferAddress();
 			m_GeometryPushConstant.IsAnimated = static_cast<uint32_t>(meshAsset->IsAnimated());
@@ -921,7 +898,7 @@ namespace Frost
 
 #if 1
 			uint32_t offset = indirectPerMeshData.CmdOffset * sizeof(VkDrawIndexedIndirectCommand);
-			vkCmdDrawIndexedIndirect(cmdBuf, vulkanIndirectCmdBuffer->GetVulkanBuffer(), offset, indirectPerMeshData.SubmeshCount, sizeof(VkDrawIndexedIndirectCommand));
+			vkCmdDrawIndexedIndirect(cmdBuf, vulkanIndirectCmdBuffer->GetVulkanBuffer(), offset, indirectPerMeshData.CmdCount, sizeof(VkDrawIndexedIndirectCommand));
 
 #else
 			Vector<Submesh> submeshes = meshAsset->GetSubMeshes();
@@ -976,7 +953,7 @@ namespace Frost
 		for (uint32_t i = 0; i < renderQueue.GetQueueSize(); i++)
 		{
 			// Get the mesh
-			auto mesh = renderQueue.m_Data[i].Mesh;
+			const auto& mesh = renderQueue.m_Data[i].Mesh;
 			const Vector<Submesh>& submeshes = mesh->GetMeshAsset()->GetSubMeshes();
 
 			// Count how many meshes were submitted (for calculating offsets)
@@ -1169,6 +1146,26 @@ namespace Frost
 
 	void VulkanGeometryPass::OnRenderDebug()
 	{
+		if (ImGui::CollapsingHeader("Geometry Pass"))
+		{
+			const RetainedSceneStats& stats = m_Data->RetainedStats;
+			ImGui::Text("Retained Mesh Batches: %d (%d compacted)", stats.MeshBatches, stats.CompactedBatches);
+			ImGui::Text("Dirty Instance Slots: %d/%d", stats.DirtySlots, stats.TotalSlots);
+			ImGui::Text("Uploaded: %.2f KB in %d regions (full upload: %.2f KB)", stats.UploadedBytes / 1024.0f, stats.UploadRegions, stats.FullUploadBytes / 1024.0f);
+
+			RendererSettings& rendererSettings = Renderer::GetRendererSettings();
+			ImGui::SliderInt("Mesh LODs", &rendererSettings.MeshLOD.Enabled, 0, 1);
+			ImGui::DragFloat("LOD Screen Error (px)", &rendererSettings.MeshLOD.ScreenErrorThreshold, 0.05f, 0.1f, 16.0f);
+			ImGui::DragFloat("LOD Hysteresis", &rendererSettings.MeshLOD.Hysteresis, 0.01f, 0.0f, 0.9f);
+			ImGui::DragFloat("LOD Bias", &rendererSettings.MeshLOD.LODBias, 0.05f, -2.0f, 4.0f);
+
+			const SceneVisibility& sceneVisibility = m_RenderPassPipeline->GetSceneVisibility();
+			if (sceneVisibility.GetViewCount() != 0)
+			{
+				const uint32_t* lodSubmeshCounts = sceneVisibility.GetView(SceneVisibility::CameraView).LODSubmeshCounts;
+				ImGui::Text("Submeshes per LOD: %d / %d / %d / %d", lodSubmeshCounts[0], lodSubmeshCounts[1], lodSubmeshCounts[2], lodSubmeshCounts[3]);
+			}
+		}
 	}
 
 	struct OcclusionCullingPushConstant
@@ -1246,4 +1243,4 @@ namespace Frost
 	{
 		delete m_Data;
 	}
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -7,6 +7,8 @@
 
 #include "Frost/Core/Buffer.h"
 
+#include "Frost/Platform/Vulkan/Buffers/RetainedSlotAllocator.h"
+
 namespace Frost
 {
 
@@ -43,6 +45,7 @@ namespace Frost
 		uint64_t SubmeshCount;       /// DONE   // Reponsible for Submesh Count (without instances) and for the Indirect Command Numbers
 		uint64_t InstanceCount;      /// DONE
 		uint64_t TotalSubmeshCount;  /// DONE // SubmeshCount * InstanceCount
+		uint64_t CmdCount;           // Indirect commands of the mesh (one per submesh, per LOD that is used by any of its instances)
 
 		uint64_t MaterialCount;	     /// DONE
 		uint64_t MaterialOffset;     /// DONE
@@ -52,6 +55,38 @@ namespace Frost
 		AssetHandle MeshAssetHandle; /// DONE
 	};
 
+	// Every mesh asset owns a persistent range in the instance and material buffers (the retained gpu scene).
+	// Instances keep the same slot between frames (slots are looked up by the entity id),
+	// so only the slots whose transform, material or visibility changed have to be uploaded
+	struct RetainedMeshBatch
+	{
+		uint32_t SubmeshCount = 0;
+		uint32_t MaterialCount = 0;
+
+		// Instance ranges are laid out per submesh: `InstanceOffset + (submeshIndex * InstanceCapacity)`, so every submesh still has its instances
+		// next to each other (needed for instanced indirect drawing). Inside of a range, the instances are ordered by their LOD and then by their slot
+		uint32_t InstanceOffset = 0;
+		uint32_t InstanceCapacity = 0;
+		uint32_t MaterialOffset = 0; // Materials are laid out per instance, per material
+
+		Vector<uint32_t> SlotEntityIDs;           // Entity living in each slot (the slots are always tightly packed)
+		Vector<uint32_t> SlotQueueIndices;        // Render queue index of each slot's instance (rebuilt every frame)
+		HashMap<uint32_t, uint32_t> EntitySlots;  // Entity id -> slot
+
+		uint64_t LastUsedFrame = 0;
+	};
+
+	struct RetainedSceneStats
+	{
+		uint64_t UploadedBytes = 0;   // Bytes copied into the gpu buffers this frame
+		uint64_t FullUploadBytes = 0; // Bytes that rewriting every used slot would have copied
+		uint32_t DirtySlots = 0;
+		uint32_t TotalSlots = 0;
+		uint32_t UploadRegions = 0;
+		uint32_t MeshBatches = 0;
+		uint32_t CompactedBatches = 0;
+	};
+
 	class VulkanGeometryPass : public SceneRenderPass
 	{
 	public:
@@ -84,6 +119,13 @@ namespace Frost
 		void OcclusionCullUpdate(const RenderQueue& renderQueue, uint64_t indirectCmdsOffset);
 		// -----------------------------------------------------------
 
+		// ------------------- Retained GPU Scene --------------------
+		void RetainedSceneUpdateSlots(const RenderQueue& renderQueue);
+		void RetainedSceneCompact();
+		bool RetainedSceneAllocateBatch(RetainedMeshBatch& batch, uint32_t instanceCapacity);
+		void RetainedSceneFreeBatch(RetainedMeshBatch& batch);
+		// -----------------------------------------------------------
+
 		//void ObjectCullingPrepareData(const RenderQueue& renderQueue);
 
 	private:
@@ -127,9 +169,7 @@ namespace Frost
 
 		struct MeshInstancedVertexBuffer // `MeshInstancedVertexBuffer` For Geometry Pass
 		{
-			glm::mat4 ModelSpaceMatrix;
-			glm::mat4 WorldSpaceMatrix;
-			glm::mat4 PreviousWorldSpaceMatrix;
+			glm::mat4 ModelSpaceMatrix; // Camera independent, the view projection matrices are sent through the `CameraData` uniform buffer
 			uint64_t BoneInformationBDA;
 			uint32_t MaterialIndexOffset;
 			uint32_t EntityID;
@@ -163,8 +203,24 @@ namespace Frost
 			Vector<HeapBlock> IndirectCmdBuffer;
 			Vector<HeapBlock> MaterialSpecs;
 
-			// Global Instaced Vertex Buffer
+			// Global Instaced Vertex Buffer (read as a storage buffer, indexed by the retained slot)
 			Vector<HeapBlock> GlobalInstancedVertexBuffer;
+
+			// Retained slots to draw, grouped per submesh and LOD (this is the instanced vertex input, so `firstInstance` points into it)
+			Vector<HeapBlock> InstanceSlotIndices;
+
+			// Retained gpu scene (the host buffers of `MaterialSpecs`, `GlobalInstancedVertexBuffer` and `MeshSpecs` mirror what was last uploaded into each frame's device buffer)
+			HashMap<AssetHandle, RetainedMeshBatch> RetainedBatches;
+			RetainedSlotAllocator InstanceSlotAllocator;
+			RetainedSlotAllocator MaterialSlotAllocator;
+			Vector<BufferRegion> MaterialDirtyRegions;
+			Vector<BufferRegion> InstanceDirtyRegions;
+			Vector<BufferRegion> MeshSpecDirtyRegions;
+			RetainedSceneStats RetainedStats;
+
+			// Global material index of every render queue entry (other passes read the material specs filled by this pass).
+			// Only valid once this pass ran for the frame, so passes reading it (e.g. voxelization) must be executed after the geometry pass
+			Vector<uint32_t> MaterialIndexOffsets;
 		};
 
 		struct PushConstant
@@ -24,7 +24,6 @@ namespace Frost
 	{
 	}
 
-	static bool s_UpdateTLAS[3];
 	void VulkanRayTracingPass::Init(SceneRenderPassPipeline* renderPassPipeline)
 	{
 		m_RenderPassPipeline = renderPassPipeline;
@@ -107,10 +106,6 @@ namespace Frost
 		createInfo.ShaderBindingTable = m_Data->SBT;
 		createInfo.Shader = m_Data->Shader;
 		m_Data->Pipeline = RayTracingPipeline::Create(createInfo);
-
-
-		for (uint32_t i = 0; i < FRAMES_IN_FLIGHT; i++)
-			s_UpdateTLAS[i] = true;
 	}
 
 	void VulkanRayTracingPass::InitLate()
@@ -141,18 +136,20 @@ namespace Frost
 		//=====================================================================
 		uint32_t subMeshCount_offset = 0;
 		uint32_t subMeshOffsets_offset = 0;
+		Ref<VulkanBottomLevelAccelerationStructure> previousBlas;
 		for (uint32_t i = 0; i < renderQueue.GetQueueSize(); i++)
 		{
 			auto mesh = renderQueue.m_Data[i];
-			bool isCulled = false;
+			Ref<VulkanBottomLevelAccelerationStructure> blas = mesh.Mesh->GetMeshAsset()->GetAccelerationStructure().As<VulkanBottomLevelAccelerationStructure>();
+
+			// The BLAS builds are queued, so a mesh is traced only after the build of its BLAS was recorded
+			bool isCulled = !blas->IsReady();
 			if (!isCulled)
 			{
 				meshes.push_back(std::make_pair(mesh.Mesh, mesh.Transform));
 				vertexBufferPointers.push_back(mesh.Mesh->GetMeshAsset()->GetVertexBuffer().As<VulkanVertexBuffer>()->GetVulkanBufferAddress());
 				indexBufferPointers.push_back(mesh.Mesh->GetMeshAsset()->GetSubmeshIndexBuffer().As<VulkanIndexBuffer>()->GetVulkanBufferAddress());
 
-				Ref<VulkanBottomLevelAccelerationStructure> blas = mesh.Mesh->GetMeshAsset()->GetAccelerationStructure().As<VulkanBottomLevelAccelerationStructure>();
-
 				// Write into the scene buffers
 				uint32_t submeshOffsetBufferSize = blas->m_GeometryOffset.size() * sizeof(uint32_t);
 				m_Data->SceneGeometryOffsets[currentFrameIndex].HostBuffer.Write(blas->m_GeometryOffset.data(), submeshOffsetBufferSize, subMeshOffsets_offset);
@@ -170,14 +167,11 @@ namespace Frost
 				}
 				else
 				{
-					auto oldMesh = renderQueue.m_Data[i - 1];
-					Ref<VulkanBottomLevelAccelerationStructure> oldBlas = oldMesh.Mesh->GetMeshAsset()->GetAccelerationStructure().As<VulkanBottomLevelAccelerationStructure>();
-
 					// Getting the last submesh count
 					uint32_t lastSubmeshCount = m_Data->SceneGeometrySubmeshCount[currentFrameIndex].HostBuffer.Read<uint32_t>(subMeshCount_offset - sizeof(uint32_t));
 
-					// Calculating the next offset
-					uint32_t submeshCount = oldBlas->m_GeometryMaxOffset + lastSubmeshCount;
+					// Calculating the next offset (from the previous mesh that was added, skipped meshes don't count)
+					uint32_t submeshCount = previousBlas->m_GeometryMaxOffset + lastSubmeshCount;
 
 					// Setting the buffer with the `submeshCount` data
 					m_Data->SceneGeometrySubmeshCount[currentFrameIndex].HostBuffer.Write(&submeshCount, (uint32_t)sizeof(uint32_t), subMeshCount_offset);
@@ -195,10 +189,12 @@ namespace Frost
 				instanceInfo.RefractionIndex = mesh.Mesh->GetMeshAsset()->GetMaterial().ior;
 
 				transformBufferPointers.push_back(instanceInfo);
+				previousBlas = blas;
 			}
 		}
-		if (meshes.size() != 0)
-			m_Data->TopLevelAS[currentFrameIndex]->UpdateAccelerationStructure(meshes);
+		// Nothing can be traced until the first BLAS builds are recorded
+		if (meshes.size() == 0) return;
+		m_Data->TopLevelAS[currentFrameIndex]->UpdateAccelerationStructure(meshes);
 
 		// Scene data
 		m_Data->SceneVertexData[currentFrameIndex]->SetData(
@@ -234,12 +230,13 @@ namespace Frost
 			PreviousCameraPosition[currentFrameIndex] = renderQueue.CameraPosition;
 		}
 
-		// TODO: This should be made better
-		if (s_UpdateTLAS[currentFrameIndex])
+		// The TLAS is recreated when the scene grows past its capacity, so the descriptor is updated only when the handle changes
+		VkAccelerationStructureKHR topLevelAS = m_Data->TopLevelAS[currentFrameIndex].As<VulkanTopLevelAccelertionStructure>()->GetVulkanAccelerationStructure();
+		if (m_Data->BoundTopLevelAS[currentFrameIndex] != topLevelAS)
 		{
 			m_Data->Descriptor[currentFrameIndex]->Set("u_TopLevelAS", m_Data->TopLevelAS[currentFrameIndex]);
 			m_Data->Descriptor[currentFrameIndex].As<VulkanMaterial>()->UpdateVulkanDescriptorIfNeeded();
-			s_UpdateTLAS[currentFrameIndex] = false;
+			m_Data->BoundTopLevelAS[currentFrameIndex] = topLevelAS;
 		}
 
 		Ref<VulkanRayTracingPipeline> rtPipeline = m_Data->Pipeline.As<VulkanRayTracingPipeline>();
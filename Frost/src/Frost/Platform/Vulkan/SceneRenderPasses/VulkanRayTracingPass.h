@@ -9,6 +9,7 @@
 #include "Frost/Renderer/RayTracing/RayTracingPipeline.h"
 
 #include "Frost/Core/Buffer.h"
+#include "Frost/Platform/Vulkan/Vulkan.h"
 
 namespace Frost
 {
@@ -50,6 +51,7 @@ namespace Frost
 			Ref<Image2D> DisplayTexture[FRAMES_IN_FLIGHT];;
 			
 			Ref<Material> Descriptor[FRAMES_IN_FLIGHT];;
+			VkAccelerationStructureKHR BoundTopLevelAS[FRAMES_IN_FLIGHT] = {};
 			Ref<Shader> Shader;
 		};
 		InternalData* m_Data;
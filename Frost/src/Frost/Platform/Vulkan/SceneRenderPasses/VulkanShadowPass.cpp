@@ -3,6 +3,7 @@
 
 #include "Frost/Core/Application.h"
 #include "Frost/Asset/AssetManager.h"
+#include "Frost/Utils/Hash.h"
 
 #include "Frost/Platform/Vulkan/VulkanContext.h"
 #include "Frost/Platform/Vulkan/VulkanRenderer.h"
@@ -42,7 +43,9 @@ namespace Frost
 		m_Data->ShadowComputeDenoiseShader = Renderer::GetShaderLibrary()->Get("SpatialDenoiser");
 
 		uint32_t framesInFlight = Renderer::GetRendererConfig().FramesInFlight;
-		uint64_t maxCountMeshes = Renderer::GetRendererConfig().MaxMeshCount_GeometryPass;
+
+		// Every cascade has its own draw list (an instance can be in more of them), so there is room for all 4
+		uint64_t maxCountMeshes = Renderer::GetRendererConfig().MaxMeshCount_GeometryPass * 4;
 
 		m_Data->IndirectShadowCmdBuffer.resize(framesInFlight);
 		for (auto& indirectCmdBuffer : m_Data->IndirectShadowCmdBuffer)
@@ -80,6 +83,8 @@ namespace Frost
 		uint32_t framesInFlight = Renderer::GetRendererConfig().FramesInFlight;
 		uint32_t shadowTextureRes = Renderer::GetRendererConfig().ShadowTextureResolution;
 
+		// The atlas is loaded, because the cached cascades are copied into it before the dynamic casters are drawn
+		// (the other cascades are cleared in `ShadowDepthRenderCascade`)
 		RenderPassSpecification renderPassSpecs =
 		{
 			shadowTextureRes * 2, shadowTextureRes * 2, framesInFlight,
@@ -87,17 +92,31 @@ namespace Frost
 				// Depth Attachment
 				{
 					FramebufferTextureFormat::Depth, ImageUsage::DepthStencil,
-					OperationLoad::Clear,    OperationStore::Store,    // Color attachment
+					OperationLoad::Load,     OperationStore::Store,    // Color attachment
 					OperationLoad::DontCare, OperationStore::DontCare, // Depth attachment
 				}
 			}
 		};
 		m_Data->ShadowDepthRenderPass = RenderPass::Create(renderPassSpecs);
 
+		// Only one cache is needed for all the frames in flight, because it is copied into the atlas of the frame
+		RenderPassSpecification staticCacheRenderPassSpecs =
+		{
+			shadowTextureRes * 2, shadowTextureRes * 2, 1,
+			{
+				// Depth Attachment
+				{
+					FramebufferTextureFormat::Depth, ImageUsage::DepthStencil,
+					OperationLoad::Clear,    OperationStore::Store,    // Color attachment
+					OperationLoad::DontCare, OperationStore::DontCare, // Depth attachment
+				}
+			}
+		};
+		m_Data->ShadowStaticCacheRenderPass = RenderPass::Create(staticCacheRenderPassSpecs);
+
 
 		BufferLayout bufferLayout = {
 			{ "a_ModelSpaceMatrix",           ShaderDataType::Mat4   },
-			{ "a_WorldSpaceMatrix",           ShaderDataType::Mat4   },
 			{ "a_BoneInformationBDA",         ShaderDataType::UInt64 }
 		};
 		bufferLayout.m_InputType = InputType::Instanced;
@@ -199,10 +218,32 @@ namespace Frost
 
 	}
 
-	void VulkanShadowPass::OnUpdate(const RenderQueue& renderQueue)
+	void VulkanShadowPass::OnRegisterViews(const RenderQueue& renderQueue, SceneVisibility& sceneVisibility)
 	{
+		static const char* s_CascadeViewNames[4] = { "Shadow Cascade 0", "Shadow Cascade 1", "Shadow Cascade 2", "Shadow Cascade 3" };
+
+		// The cascades are needed before the passes are updated, so they can be culled together with the other views
 		UpdateCascades(renderQueue);
 
+		const RendererSettings& rendererSettings = Renderer::GetRendererSettings();
+		m_Data->CascadeViewCount = std::min<uint32_t>(rendererSettings.ShadowPass.CascadeCount, 4);
+		for (uint32_t i = 0; i < m_Data->CascadeViewCount; i++)
+		{
+			const glm::mat4& cascadeViewProj = m_Data->CascadeViewProjMatrix[i];
+			m_Data->CascadeViews[i] = sceneVisibility.AddView(s_CascadeViewNames[i], cascadeViewProj);
+
+			// The cascades are orthographic, so the LODs only depend on how many texels a world unit covers in the cascade
+			SceneViewLOD cascadeLOD;
+			cascadeLOD.Enabled = true;
+			cascadeLOD.Orthographic = true;
+			cascadeLOD.ProjectionScale = glm::length(glm::vec3(cascadeViewProj[0][1], cascadeViewProj[1][1], cascadeViewProj[2][1])) * m_Data->MaxResCascade[i].y * 0.5f;
+			cascadeLOD.Bias = rendererSettings.MeshLOD.LODBias + rendererSettings.ShadowPass.LODBias;
+			sceneVisibility.SetViewLOD(m_Data->CascadeViews[i], cascadeLOD);
+		}
+	}
+
+	void VulkanShadowPass::OnUpdate(const RenderQueue& renderQueue)
+	{
 		VulkanRenderer::BeginTimeStampPass("Shadow Pass (Cascades)");
 		//ShadowDepthUpdate(renderQueue);
 		ShadowDepthUpdateInstancing(renderQueue);
@@ -247,7 +288,7 @@ namespace Frost
 		for (uint32_t i = 0; i < renderQueue.GetQueueSize(); i++)
 		{
 			// Get the mesh
-			auto mesh = renderQueue.m_Data[i].Mesh;
+			const auto& mesh = renderQueue.m_Data[i].Mesh;
 			const Vector<Submesh>& submeshes = mesh->GetMeshAsset()->GetSubMeshes();
 
 			// Count how many meshes were submitted (for calculating offsets)
@@ -383,29 +424,39 @@ namespace Frost
 	}
 #endif
 
-	struct MeshInstanceListShadowPass // This is reponsible for grouping all the mesh instances into one array
-	{
-		Mesh* Mesh;
-		glm::mat4 Transform;
-	};
-
-	// This is reponsible for grouping all the mesh instances into one array
-	// Declaring it here to not allocate a new hashmap every frame
-	static HashMap<AssetHandle, Vector<MeshInstanceListShadowPass>> s_GroupedMeshesCached;
 	static Vector<NewIndirectMeshData> s_ShadowDepthMeshIndirectData; // Made a static variable, to not allocate new data everyframe
 
+	// Casters which haven't moved for this many frames are considered static (and drawn into the cascade caches)
+	static constexpr uint32_t s_StaticCasterFrames = 30;
+
 	void VulkanShadowPass::ShadowDepthUpdateInstancing(const RenderQueue& renderQueue)
 	{
 		// Getting all the needed information
 		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
 		VkCommandBuffer cmdBuf = VulkanContext::GetSwapChain()->GetRenderCommandBuffer(currentFrameIndex);
-		Ref<VulkanRenderPass> vulkanRenderPass = m_Data->ShadowDepthRenderPass.As<VulkanRenderPass>();
 		Ref<VulkanPipeline> vulkanPipeline = m_Data->ShadowDepthPipeline.As<VulkanPipeline>();
+		bool cacheStaticCascades = Renderer::GetRendererSettings().ShadowPass.CacheStaticCascades;
 
-		// Get the needed matricies from the camera
-		glm::mat4 projectionMatrix = renderQueue.CameraProjectionMatrix;
-		projectionMatrix[1][1] *= -1; // GLM uses opengl style of rendering, where the y coordonate is inverted
-		glm::mat4 viewProjectionMatrix = projectionMatrix * renderQueue.CameraViewMatrix;
+		UpdateShadowCasters(renderQueue);
+
+		const RendererSettings& rendererSettings = Renderer::GetRendererSettings();
+		uint64_t lodSettingsHash = Hash::Combine(Hash::FNVOffsetBasis, rendererSettings.MeshLOD);
+		lodSettingsHash = Hash::Combine(lodSettingsHash, rendererSettings.ShadowPass.LODBias);
+
+		// The static depth of a cascade is rendered again only if it has moved (a new fit), a static caster inside of it has changed or the LOD settings were changed
+		bool renderStaticCascade[4] = {};
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			CascadeCache& cascadeCache = m_Data->CascadeCaches[i];
+			if (!cacheStaticCascades || i >= m_Data->CascadeViewCount)
+			{
+				cascadeCache.Valid = false;
+				continue;
+			}
+
+			renderStaticCascade[i] = !cascadeCache.Valid || cascadeCache.Dirty || cascadeCache.ViewProjMatrix != m_Data->CascadeViewProjMatrix[i] ||
+			                         cascadeCache.LODSettingsHash != lodSettingsHash;
+		}
 
 		/*
 			Each mesh might have a set of submeshes which are sent to render individualy.
@@ -414,167 +465,251 @@ namespace Frost
 			(TODO: This explanation is outdated, now we are using `instanced indirect multidraw rendering` :D)
 		*/
 		s_ShadowDepthMeshIndirectData.clear();
-		s_GroupedMeshesCached.clear();
 
-		// Allocate all the neccesary array buffers before, so we won't waste cpus cycles on reallocating memory
-		for (auto& [meshAssetUUID, instanceCount] : renderQueue.m_MeshInstanceCount)
+		// Every cascade gets its own draw lists, with only the instances which are inside of its frustum
+		ShadowDrawListOffsets drawListOffsets;
+		m_Data->CacheStats.RenderedStaticCascades = 0;
+		for (uint32_t i = 0; i < 4; i++)
 		{
-			s_GroupedMeshesCached[meshAssetUUID].reserve(instanceCount);
-		}
-		s_ShadowDepthMeshIndirectData.reserve(s_GroupedMeshesCached.size());
+			m_Data->StaticDrawLists[i] = {};
+			m_Data->DynamicDrawLists[i] = {};
+			if (i >= m_Data->CascadeViewCount)
+				continue;
 
+			if (renderStaticCascade[i])
+				m_Data->StaticDrawLists[i] = ShadowDepthPrepareDrawList(renderQueue, i, ShadowCasterFilter::Static, drawListOffsets);
 
-		for (uint32_t i = 0; i < renderQueue.GetQueueSize(); i++)
-		{
-			// Get the mesh
-			auto mesh = renderQueue.m_Data[i].Mesh;
-			s_GroupedMeshesCached[mesh->GetMeshAsset()->Handle].push_back({ mesh.Raw(), renderQueue.m_Data[i].Transform });
-		}
+			ShadowCasterFilter dynamicFilter = cacheStaticCascades ? ShadowCasterFilter::Dynamic : ShadowCasterFilter::All;
+			m_Data->DynamicDrawLists[i] = ShadowDepthPrepareDrawList(renderQueue, i, dynamicFilter, drawListOffsets);
 
-		// `Indirect draw commands` offset
-		uint64_t indirectCmdsOffset = 0;
+			m_Data->CacheStats.RenderedStaticCascade[i] = renderStaticCascade[i];
+			m_Data->CacheStats.StaticCasters[i] = m_Data->StaticDrawLists[i].CasterCount;
+			m_Data->CacheStats.DynamicCasters[i] = m_Data->DynamicDrawLists[i].CasterCount;
+		}
 
-		// `Instance data` offset.
-		uint64_t materialDataOffset = 0;
+		// Sending the data into the gpu buffer
+		// Indirect draw commands
+		auto vulkanIndirectCmdBuffer = m_Data->IndirectShadowCmdBuffer[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
+		void* indirectCmdsPointer = m_Data->IndirectShadowCmdBuffer[currentFrameIndex].HostBuffer.Data;
+		vulkanIndirectCmdBuffer->SetData(drawListOffsets.IndirectCmds, indirectCmdsPointer);
 
-		// `Instance data` offset.
-		uint64_t instanceVertexOffset = 0;
-		
-		for (auto& [handle, groupedMeshes] : s_GroupedMeshesCached)
-		{
-			NewIndirectMeshData* currentIndirectMeshData;
-			NewIndirectMeshData* lastIndirectMeshData = nullptr;
+		// Global Instanced Vertex Buffer data
+		auto vulkanInstancedVertexBuffer = m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
+		void* instancedVertexBufferPointer = m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].HostBuffer.Data;
+		vulkanInstancedVertexBuffer->SetData(drawListOffsets.InstanceVertices, instancedVertexBufferPointer);
 
-			// If we are submitting the first mesh, we don't need any offset
-			currentIndirectMeshData = &s_ShadowDepthMeshIndirectData.emplace_back();
-			
-			// We are checking `.size() > 1` and also `.size() - 2` because we've already pushed_back and element before, so we should go 2 elements behind instead of one
-			if (s_ShadowDepthMeshIndirectData.size() > 1)
-				lastIndirectMeshData = &s_ShadowDepthMeshIndirectData[s_ShadowDepthMeshIndirectData.size() - 2];
 
 
-			Ref<MeshAsset> meshAsset = groupedMeshes[0].Mesh->GetMeshAsset();
-			const Vector<Submesh>& submeshes = meshAsset->GetSubMeshes();
+		// Bind the pipeline
+		vulkanPipeline->Bind();
 
-			currentIndirectMeshData->MeshAssetHandle = meshAsset->Handle;
-			currentIndirectMeshData->InstanceCount = groupedMeshes.size();
-			currentIndirectMeshData->SubmeshCount = submeshes.size();
-			currentIndirectMeshData->TotalSubmeshCount = currentIndirectMeshData->SubmeshCount * currentIndirectMeshData->InstanceCount;
-			currentIndirectMeshData->MaterialCount = groupedMeshes[0].Mesh->GetMaterialCount();
+		// Render the static casters of the outdated cascades into the cache
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			if (!renderStaticCascade[i])
+				continue;
+
+			ShadowDepthRenderCascade(m_Data->ShadowStaticCacheRenderPass, 0, i, m_Data->StaticDrawLists[i], false);
+
+			CascadeCache& cascadeCache = m_Data->CascadeCaches[i];
+			cascadeCache.ViewProjMatrix = m_Data->CascadeViewProjMatrix[i];
+			cascadeCache.Frustum = Math::ViewFrustum::FromViewProjection(cascadeCache.ViewProjMatrix);
+			cascadeCache.LODSettingsHash = lodSettingsHash;
+			cascadeCache.Valid = true;
+			cascadeCache.Dirty = false;
+			m_Data->CacheStats.RenderedStaticCascades++;
+		}
 
-			currentIndirectMeshData->CmdOffset = indirectCmdsOffset / sizeof(VkDrawIndexedIndirectCommand);
+		// Copy the cached cascades into the atlas of this frame, the dynamic casters are drawn on top of them
+		VkImageCopy cascadeCopyRegions[4];
+		uint32_t cascadeCopyCount = 0;
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			if (!m_Data->CascadeCaches[i].Valid)
+				continue;
+
+			VkImageCopy& cascadeCopyRegion = cascadeCopyRegions[cascadeCopyCount++];
+			cascadeCopyRegion = {};
+			cascadeCopyRegion.srcOffset = { (int32_t)m_Data->MinResCascade[i].x, (int32_t)m_Data->MinResCascade[i].y, 0 };
+			cascadeCopyRegion.dstOffset = cascadeCopyRegion.srcOffset;
+			cascadeCopyRegion.extent = { (uint32_t)m_Data->MaxResCascade[i].x, (uint32_t)m_Data->MaxResCascade[i].y, 1 };
+		}
 
-			currentIndirectMeshData->MaterialOffset = 0;
-			currentIndirectMeshData->TotalMeshOffset = 0;
-			if (s_ShadowDepthMeshIndirectData.size() > 1)
-			{
-				currentIndirectMeshData->MaterialOffset = lastIndirectMeshData->MaterialOffset + (lastIndirectMeshData->MaterialCount * lastIndirectMeshData->InstanceCount);
-				currentIndirectMeshData->TotalMeshOffset = lastIndirectMeshData->TotalMeshOffset + (lastIndirectMeshData->SubmeshCount * lastIndirectMeshData->InstanceCount);
-			}
+		if (cascadeCopyCount != 0)
+		{
+			Ref<VulkanImage2D> shadowDepthTexture = m_Data->ShadowDepthRenderPass->GetDepthAttachment(currentFrameIndex).As<VulkanImage2D>();
+			Ref<Image2D> staticCacheTexture = m_Data->ShadowStaticCacheRenderPass->GetDepthAttachment(0);
+			shadowDepthTexture->CopyImage(cmdBuf, staticCacheTexture, cascadeCopyRegions, cascadeCopyCount);
+		}
 
+		// Render the dynamic casters (or all of them, if the cache is disabled) into the atlas
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			bool clearCascade = !m_Data->CascadeCaches[i].Valid;
+			ShadowDepthRenderCascade(m_Data->ShadowDepthRenderPass, currentFrameIndex, i, m_Data->DynamicDrawLists[i], clearCascade);
+		}
+	}
 
-			// Set up the instanced vertex buffer (per submesh, per instance)
-			for (uint32_t submeshIndex = 0; submeshIndex < submeshes.size(); submeshIndex++)
-			{
-				MeshInstancedVertexBuffer meshInstancedVertexBuffer{};
-				uint32_t meshInstanceNr = 0;
-				for (auto& meshInstance : groupedMeshes)
-				{
-					glm::mat4 modelMatrix = meshInstance.Transform * submeshes[submeshIndex].Transform;
+	VulkanShadowPass::ShadowDrawList VulkanShadowPass::ShadowDepthPrepareDrawList(const RenderQueue& renderQueue, uint32_t cascadeIndex, ShadowCasterFilter filter, ShadowDrawListOffsets& offsets)
+	{
+		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
 
+		// The instances are grouped (and their submesh transforms computed) by the scene visibility stage,
+		// and the visible ones of every view are already sorted by group
+		const SceneVisibility& sceneVisibility = m_RenderPassPipeline->GetSceneVisibility();
+		const SceneView& cascadeView = sceneVisibility.GetView(m_Data->CascadeViews[cascadeIndex]);
 
-					// Adding the neccesary Matricies for the shader
-					meshInstancedVertexBuffer.ModelSpaceMatrix = modelMatrix;
-					meshInstancedVertexBuffer.WorldSpaceMatrix = viewProjectionMatrix * modelMatrix;
-					/////////////////////////////////////////////////////
+		ShadowDrawList drawList;
+		drawList.FirstMesh = static_cast<uint32_t>(s_ShadowDepthMeshIndirectData.size());
 
-					// Other stuff
-					if (meshInstance.Mesh->IsAnimated())
-						meshInstancedVertexBuffer.BoneInformationBDA = meshInstance.Mesh->GetBoneUniformBuffer(currentFrameIndex).As<VulkanUniformBuffer>()->GetVulkanBufferAddress();
-					else
-						meshInstancedVertexBuffer.BoneInformationBDA = 0;
-					/////////////////////////////////////////////////////
+		FrameVector<uint32_t> shadowCasters;
+		shadowCasters.reserve(cascadeView.VisibleInstances.size());
 
-					m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].HostBuffer.Write((void*)&meshInstancedVertexBuffer, sizeof(MeshInstancedVertexBuffer), instanceVertexOffset);
-					instanceVertexOffset += sizeof(MeshInstancedVertexBuffer);
+		const Vector<SceneMeshGroup>& groups = sceneVisibility.GetGroups();
+		for (uint32_t groupIndex = 0; groupIndex < groups.size(); groupIndex++)
+		{
+			const SceneMeshGroup& group = groups[groupIndex];
+			const SceneViewGroupRange& groupRange = cascadeView.GroupRanges[groupIndex];
 
-					meshInstanceNr++;
-				}
+			shadowCasters.clear();
+			for (uint32_t i = groupRange.FirstVisible; i < groupRange.FirstVisible + groupRange.VisibleCount; i++)
+			{
+				uint32_t queueIndex = cascadeView.VisibleInstances[i];
+				bool isStatic = m_Data->IsStaticCaster[queueIndex];
+				if (filter == ShadowCasterFilter::All || isStatic == (filter == ShadowCasterFilter::Static))
+					shadowCasters.push_back(queueIndex);
 			}
 
-			for (uint32_t submeshIndex = 0; submeshIndex < submeshes.size(); submeshIndex++)
-			{
-				const Submesh& submesh = submeshes[submeshIndex];
+			if (shadowCasters.empty())
+				continue;
 
-				// Submit the submesh into the cpu buffer
-				VkDrawIndexedIndirectCommand indirectCmdBuf{};
-				indirectCmdBuf.firstIndex = submesh.BaseIndex;
-				indirectCmdBuf.indexCount = submesh.IndexCount;
-				indirectCmdBuf.vertexOffset = submesh.BaseVertex;
+			uint32_t instanceCount = static_cast<uint32_t>(shadowCasters.size());
+			const MeshAsset* meshAsset = group.Mesh->GetMeshAsset().Raw();
 
-				indirectCmdBuf.instanceCount = groupedMeshes.size();
+			NewIndirectMeshData* currentIndirectMeshData = &s_ShadowDepthMeshIndirectData.emplace_back();
+			currentIndirectMeshData->MeshAssetHandle = group.MeshAssetHandle;
+			currentIndirectMeshData->InstanceCount = instanceCount;
+			currentIndirectMeshData->SubmeshCount = group.SubmeshCount;
+			currentIndirectMeshData->TotalSubmeshCount = currentIndirectMeshData->SubmeshCount * currentIndirectMeshData->InstanceCount;
+			currentIndirectMeshData->MaterialCount = group.Mesh->GetMaterialCount();
+			currentIndirectMeshData->CmdOffset = offsets.IndirectCmds / sizeof(VkDrawIndexedIndirectCommand);
+			currentIndirectMeshData->MaterialOffset = 0;
+			currentIndirectMeshData->TotalMeshOffset = offsets.Instances;
+			currentIndirectMeshData->CmdCount = 0;
 
-				if (lastIndirectMeshData)
-				{
-					indirectCmdBuf.firstInstance = currentIndirectMeshData->TotalMeshOffset;
-				}
-				else
+			uint32_t cascadeViewIndex = m_Data->CascadeViews[cascadeIndex];
+			for (uint32_t submeshIndex = 0; submeshIndex < group.SubmeshCount; submeshIndex++)
+			{
+				// The casters are bucketed by the LOD that the cascade view has selected for this submesh
+				uint32_t lodInstanceCounts[MaxMeshLODCount] = {};
+				for (uint32_t queueIndex : shadowCasters)
+					lodInstanceCounts[sceneVisibility.GetSubmeshLOD(cascadeViewIndex, queueIndex, submeshIndex)]++;
+
+				for (uint32_t lod = 0; lod < group.LODCount; lod++)
 				{
-					indirectCmdBuf.firstInstance = 0;
+					if (lodInstanceCounts[lod] == 0)
+						continue;
+
+					const SubmeshLOD& submeshLOD = meshAsset->GetSubMeshesLOD(lod)[submeshIndex];
+
+					// Submit the submesh into the cpu buffer (the global index buffer is already offsetted, so no vertex offset is needed)
+					VkDrawIndexedIndirectCommand indirectCmdBuf{};
+					indirectCmdBuf.firstIndex = submeshLOD.BaseIndex;
+					indirectCmdBuf.indexCount = submeshLOD.IndexCount;
+					indirectCmdBuf.vertexOffset = 0;
+
+					// The instances of a submesh's LOD are tightly packed one after the other
+					indirectCmdBuf.instanceCount = lodInstanceCounts[lod];
+					indirectCmdBuf.firstInstance = offsets.Instances;
+					offsets.Instances += lodInstanceCounts[lod];
+
+					m_Data->IndirectShadowCmdBuffer[currentFrameIndex].HostBuffer.Write((void*)&indirectCmdBuf, sizeof(VkDrawIndexedIndirectCommand), offsets.IndirectCmds);
+					offsets.IndirectCmds += sizeof(VkDrawIndexedIndirectCommand);
+					currentIndirectMeshData->CmdCount++;
+
+					// Set up the instanced vertex buffer (per submesh, per LOD, per instance)
+					MeshInstancedVertexBuffer meshInstancedVertexBuffer{};
+					for (uint32_t queueIndex : shadowCasters)
+					{
+						if (sceneVisibility.GetSubmeshLOD(cascadeViewIndex, queueIndex, submeshIndex) != lod)
+							continue;
+
+						Mesh* mesh = renderQueue.m_Data[queueIndex].Mesh.Raw();
+
+						// Adding the neccesary Matricies for the shader
+						meshInstancedVertexBuffer.ModelSpaceMatrix = sceneVisibility.GetSubmeshTransform(queueIndex, submeshIndex);
+						/////////////////////////////////////////////////////
+
+						// Other stuff
+						if (mesh->IsAnimated())
+							meshInstancedVertexBuffer.BoneInformationBDA = mesh->GetBoneUniformBuffer(currentFrameIndex).As<VulkanUniformBuffer>()->GetVulkanBufferAddress();
+						else
+							meshInstancedVertexBuffer.BoneInformationBDA = 0;
+						/////////////////////////////////////////////////////
+
+						m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].HostBuffer.Write((void*)&meshInstancedVertexBuffer, sizeof(MeshInstancedVertexBuffer), offsets.InstanceVertices);
+						offsets.InstanceVertices += sizeof(MeshInstancedVertexBuffer);
+					}
 				}
-				indirectCmdBuf.firstInstance += submeshIndex;
-
-				m_Data->IndirectShadowCmdBuffer[currentFrameIndex].HostBuffer.Write((void*)&indirectCmdBuf, sizeof(VkDrawIndexedIndirectCommand), indirectCmdsOffset);
-				indirectCmdsOffset += sizeof(VkDrawIndexedIndirectCommand);
 			}
+
+			drawList.CasterCount += instanceCount;
 		}
-		// Sending the data into the gpu buffer
-		// Indirect draw commands
-		auto vulkanIndirectCmdBuffer = m_Data->IndirectShadowCmdBuffer[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
-		void* indirectCmdsPointer = m_Data->IndirectShadowCmdBuffer[currentFrameIndex].HostBuffer.Data;
-		vulkanIndirectCmdBuffer->SetData(indirectCmdsOffset, indirectCmdsPointer);
 
-		// Global Instanced Vertex Buffer data
-		auto vulkanInstancedVertexBuffer = m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
-		void* instancedVertexBufferPointer = m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].HostBuffer.Data;
-		vulkanInstancedVertexBuffer->SetData(instanceVertexOffset, instancedVertexBufferPointer);
+		drawList.MeshCount = static_cast<uint32_t>(s_ShadowDepthMeshIndirectData.size()) - drawList.FirstMesh;
+		return drawList;
+	}
 
+	void VulkanShadowPass::ShadowDepthRenderCascade(const Ref<RenderPass>& renderPass, uint32_t framebufferIndex, uint32_t cascadeIndex, const ShadowDrawList& drawList, bool clearCascade)
+	{
+		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
+		VkCommandBuffer cmdBuf = VulkanContext::GetSwapChain()->GetRenderCommandBuffer(currentFrameIndex);
+		Ref<VulkanRenderPass> vulkanRenderPass = renderPass.As<VulkanRenderPass>();
+		Ref<VulkanPipeline> vulkanPipeline = m_Data->ShadowDepthPipeline.As<VulkanPipeline>();
+		auto vulkanIndirectCmdBuffer = m_Data->IndirectShadowCmdBuffer[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
 
+		VkRect2D cascadeRect{};
+		cascadeRect.offset = { (int32_t)m_Data->MinResCascade[cascadeIndex].x, (int32_t)m_Data->MinResCascade[cascadeIndex].y };
+		cascadeRect.extent = { (uint32_t)m_Data->MaxResCascade[cascadeIndex].x, (uint32_t)m_Data->MaxResCascade[cascadeIndex].y };
 
-		// Bind the pipeline
-		vulkanPipeline->Bind();
+		VkClearValue clearValue{};
+		clearValue.depthStencil = { 1.0f, 0 };
 
 		// Bind the renderpass
-		for (uint32_t i = 0; i < 4; i++)
+		VkRenderPassBeginInfo renderPassInfo{ VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
+		renderPassInfo.renderPass = vulkanRenderPass->GetVulkanRenderPass();
+		renderPassInfo.framebuffer = (VkFramebuffer)vulkanRenderPass->GetFramebuffer(framebufferIndex)->GetFramebufferHandle();
+		renderPassInfo.renderArea = cascadeRect;
+		renderPassInfo.clearValueCount = 1;
+		renderPassInfo.pClearValues = &clearValue;
+		vkCmdBeginRenderPass(cmdBuf, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+		// The atlas is loaded (not cleared), so the cascades which don't come from the cache have to be cleared here
+		if (clearCascade)
 		{
+			VkClearAttachment clearAttachment{};
+			clearAttachment.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+			clearAttachment.clearValue = clearValue;
+
+			VkClearRect clearRect{};
+			clearRect.rect = cascadeRect;
+			clearRect.baseArrayLayer = 0;
+			clearRect.layerCount = 1;
+			vkCmdClearAttachments(cmdBuf, 1, &clearAttachment, 1, &clearRect);
+		}
 
-			VkClearValue clearValue{};
-			clearValue.depthStencil = { 1.0f, 0 };
-
-			VkRenderPassBeginInfo renderPassInfo{ VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
-			renderPassInfo.renderPass = vulkanRenderPass->GetVulkanRenderPass();
-			renderPassInfo.framebuffer = (VkFramebuffer)vulkanRenderPass->GetFramebuffer(currentFrameIndex)->GetFramebufferHandle();
-			renderPassInfo.renderArea.offset = { (int32_t)m_Data->MinResCascade[i].x, (int32_t)m_Data->MinResCascade[i].y };
-			renderPassInfo.renderArea.extent = { (uint32_t)m_Data->MaxResCascade[i].x, (uint32_t)m_Data->MaxResCascade[i].y };
-			renderPassInfo.clearValueCount = 1;
-			renderPassInfo.pClearValues = &clearValue;
-			vkCmdBeginRenderPass(cmdBuf, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
-
-
+		if (drawList.MeshCount != 0)
+		{
 			// Set the viewport and scrissors
 			VkViewport viewport{};
-			viewport.x = m_Data->MinResCascade[i].x;
-			viewport.y = m_Data->MinResCascade[i].y;
-			viewport.width = (float)m_Data->MaxResCascade[i].x;
-			viewport.height = (float)m_Data->MaxResCascade[i].y;
+			viewport.x = m_Data->MinResCascade[cascadeIndex].x;
+			viewport.y = m_Data->MinResCascade[cascadeIndex].y;
+			viewport.width = (float)m_Data->MaxResCascade[cascadeIndex].x;
+			viewport.height = (float)m_Data->MaxResCascade[cascadeIndex].y;
 			viewport.minDepth = 0.0f;
 			viewport.maxDepth = 1.0f;
 			vkCmdSetViewport(cmdBuf, 0, 1, &viewport);
-
-			VkRect2D scissor{};
-			scissor.offset = { (int32_t)m_Data->MinResCascade[i].x, (int32_t)m_Data->MinResCascade[i].y };
-			scissor.extent = { (uint32_t)m_Data->MaxResCascade[i].x, (uint32_t)m_Data->MaxResCascade[i].y };
-			vkCmdSetScissor(cmdBuf, 0, 1, &scissor);
+			vkCmdSetScissor(cmdBuf, 0, 1, &cascadeRect);
 
 			// Binding the global instanced vertex buffer only once
 			auto vulkanVertexBufferInstanced = m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
@@ -582,33 +717,108 @@ namespace Frost
 			VkDeviceSize deviceSize[1] = { 0 };
 			vkCmdBindVertexBuffers(cmdBuf, 0, 1, &vertexBufferInstanced, deviceSize);
 
-
 			// Sending the indirect draw commands to the command buffer
-			for (uint32_t j = 0; j < s_ShadowDepthMeshIndirectData.size(); j++)
+			for (uint32_t j = drawList.FirstMesh; j < drawList.FirstMesh + drawList.MeshCount; j++)
 			{
 				auto& indirectPerMeshData = s_ShadowDepthMeshIndirectData[j];
 
 				// Get the mesh
-				const AssetMetadata& assetMetadata = AssetManager::GetMetadata(indirectPerMeshData.MeshAssetHandle);
-				Ref<MeshAsset> meshAsset = AssetManager::GetAsset<MeshAsset>(assetMetadata.FilePath.string());
-
-				// Bind the index buffer
-				meshAsset->GetIndexBuffer()->Bind();
+				Ref<MeshAsset> meshAsset = AssetManager::GetAsset<MeshAsset>(indirectPerMeshData.MeshAssetHandle);
 
+				// Bind the index buffer (it holds all the LODs)
+				meshAsset->GetGlobalSubmeshIndexBuffer()->Bind();
 
 				// Set the transform matrix and model matrix of the submesh into a constant buffer
 				m_PushConstant.VertexBufferBDA = meshAsset->GetVertexBuffer().As<VulkanVertexBuffer>()->GetVulkanBufferAddress();
-				m_PushConstant.ViewProjectionMatrix = m_Data->CascadeViewProjMatrix[i];
+				m_PushConstant.ViewProjectionMatrix = m_Data->CascadeViewProjMatrix[cascadeIndex];
 				m_PushConstant.IsAnimated = static_cast<uint32_t>(meshAsset->IsAnimated());
 
 				vulkanPipeline->BindVulkanPushConstant("u_PushConstant", (void*)&m_PushConstant);
 
-				uint32_t submeshCount = indirectPerMeshData.SubmeshCount;
+				uint32_t cmdCount = indirectPerMeshData.CmdCount;
 				uint32_t offset = indirectPerMeshData.CmdOffset * sizeof(VkDrawIndexedIndirectCommand);
-				vkCmdDrawIndexedIndirect(cmdBuf, vulkanIndirectCmdBuffer->GetVulkanBuffer(), offset, submeshCount, sizeof(VkDrawIndexedIndirectCommand));
+				vkCmdDrawIndexedIndirect(cmdBuf, vulkanIndirectCmdBuffer->GetVulkanBuffer(), offset, cmdCount, sizeof(VkDrawIndexedIndirectCommand));
 			}
+		}
 
-			vulkanRenderPass->Unbind();
+		vulkanRenderPass->Unbind();
+	}
+
+	void VulkanShadowPass::UpdateShadowCasters(const RenderQueue& renderQueue)
+	{
+		const SceneVisibility& sceneVisibility = m_RenderPassPipeline->GetSceneVisibility();
+		uint64_t currentFrameCount = Renderer::GetFrameCount();
+
+		m_Data->IsStaticCaster.assign(renderQueue.GetQueueSize(), 0);
+		if (!Renderer::GetRendererSettings().ShadowPass.CacheStaticCascades)
+		{
+			m_Data->ShadowCasters.clear();
+			return;
+		}
+
+		for (uint32_t queueIndex = 0; queueIndex < renderQueue.GetQueueSize(); queueIndex++)
+		{
+			const RenderQueue::RenderData& renderData = renderQueue.m_Data[queueIndex];
+			const SceneMeshInstance& instance = sceneVisibility.GetInstance(queueIndex);
+
+			// The instance key also holds the occurrence index, so an entity submitting the same mesh twice has two casters
+			auto [casterIt, isNewCaster] = m_Data->ShadowCasters.try_emplace(instance.InstanceKey);
+			ShadowCaster& caster = casterIt->second;
+			if (isNewCaster)
+			{
+				// New casters are static straight away, since most of them are placed once and never moved
+				caster.Transform = renderData.Transform;
+				caster.StillFrames = s_StaticCasterFrames;
+			}
+			else if (caster.Transform != renderData.Transform)
+			{
+				caster.Transform = renderData.Transform;
+				caster.StillFrames = 0;
+			}
+			else if (caster.StillFrames < s_StaticCasterFrames)
+			{
+				caster.StillFrames++;
+			}
+
+			// Animated meshes change their shape without moving, so they are always dynamic
+			bool isStatic = !renderData.Mesh->IsAnimated() && caster.StillFrames >= s_StaticCasterFrames;
+
+			// The cached cascades have to be rendered again where a static caster appears or disappears (from the cache).
+			// A caster which starts moving is removed from where it was cached (its previous bounds)
+			if (caster.IsStatic && !isStatic)
+				MarkCachedCascadesDirty(caster.BoundsMin, caster.BoundsMax);
+			else if (!caster.IsStatic && isStatic)
+				MarkCachedCascadesDirty(instance.BoundsMin, instance.BoundsMax);
+
+			caster.IsStatic = isStatic;
+			caster.BoundsMin = instance.BoundsMin;
+			caster.BoundsMax = instance.BoundsMax;
+			caster.LastSeenFrame = currentFrameCount;
+			m_Data->IsStaticCaster[queueIndex] = isStatic;
+		}
+
+		// Casters which weren't submitted this frame (deleted or hidden) are forgotten
+		for (auto it = m_Data->ShadowCasters.begin(); it != m_Data->ShadowCasters.end();)
+		{
+			if (it->second.LastSeenFrame != currentFrameCount)
+			{
+				if (it->second.IsStatic)
+					MarkCachedCascadesDirty(it->second.BoundsMin, it->second.BoundsMax);
+				it = m_Data->ShadowCasters.erase(it);
+			}
+			else
+			{
+				it++;
+			}
+		}
+	}
+
+	void VulkanShadowPass::MarkCachedCascadesDirty(const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+	{
+		for (CascadeCache& cascadeCache : m_Data->CascadeCaches)
+		{
+			if (cascadeCache.Valid && !cascadeCache.Dirty && cascadeCache.Frustum.IsBoxVisible(boundsMin, boundsMax))
+				cascadeCache.Dirty = true;
 		}
 	}
 
@@ -683,16 +893,40 @@ namespace Frost
 		RendererSettings& rendererSettings = Renderer::GetRendererSettings();
 
 		//const int32_t CASCADE_COUNT = Renderer::GetRendererSettings().ShadowPass.CascadeCount;
-		int32_t CASCADE_COUNT = Renderer::GetRendererSettings().ShadowPass.CascadeCount;
+		int32_t CASCADE_COUNT = std::min(Renderer::GetRendererSettings().ShadowPass.CascadeCount, 4);
 
-		Vector<float> cascadeSplits(CASCADE_COUNT);
 		float shadowTextureRes = Renderer::GetRendererConfig().ShadowTextureResolution;
+		uint64_t currentFrameCount = Renderer::GetFrameCount();
 
 		float nearClip = renderQueue.m_Camera->GetNearClip();
 		float farClip = renderQueue.m_Camera->GetFarClip();
 		//float nearClip = rendererSettings.ShadowPass.CameraNearClip;
 		//float farClip = rendererSettings.ShadowPass.CameraFarClip;
 
+		glm::vec3 lightDir = glm::normalize(-renderQueue.m_LightData.DirLight.Direction);
+
+		// If neither the camera, the light or the settings have changed, the cascades from the last frame are still correct
+		uint64_t cascadeInputsHash = Hash::Combine(Hash::FNVOffsetBasis, renderQueue.m_Camera->GetViewProjection());
+		cascadeInputsHash = Hash::Combine(cascadeInputsHash, glm::vec2(nearClip, farClip));
+		cascadeInputsHash = Hash::Combine(cascadeInputsHash, lightDir);
+		cascadeInputsHash = Hash::Combine(cascadeInputsHash, shadowTextureRes);
+		cascadeInputsHash = Hash::Combine(cascadeInputsHash, rendererSettings.ShadowPass.CascadeSplitLambda);
+		cascadeInputsHash = Hash::Combine(cascadeInputsHash, rendererSettings.ShadowPass.CascadeNearPlaneOffset);
+		cascadeInputsHash = Hash::Combine(cascadeInputsHash, rendererSettings.ShadowPass.CascadeFarPlaneOffset);
+		cascadeInputsHash = Hash::Combine(cascadeInputsHash, CASCADE_COUNT);
+		cascadeInputsHash = Hash::Combine(cascadeInputsHash, rendererSettings.ShadowPass.CascadeUpdateInterval);
+
+		m_Data->CacheStats.RefittedCascades = 0;
+		if (cascadeInputsHash == m_Data->CascadeInputsHash)
+			return;
+		m_Data->CascadeInputsHash = cascadeInputsHash;
+
+		// Changing the light direction changes every cascade
+		bool lightChanged = lightDir != m_Data->CascadeLightDirection;
+		m_Data->CascadeLightDirection = lightDir;
+
+		Vector<float> cascadeSplits(CASCADE_COUNT);
+
 		float clipRange = farClip - nearClip;
 
 		float minZ = nearClip;
@@ -714,6 +948,8 @@ namespace Frost
 
 		//cascadeSplits[3] = 0.3f;
 
+		// The light view is placed at the origin (instead of the cascade center), so the snapping below works in a space which doesn't move with the camera
+		glm::mat4 lightViewMatrix = glm::lookAt(glm::vec3(0.0f), lightDir, glm::vec3(0.0f, 0.0f, 1.0f));
 
 		// Calculate orthographic projection matrix for each cascade
 		float lastSplitDist = 0.0;
@@ -768,51 +1004,45 @@ namespace Frost
 			}
 			radius = std::ceil(radius);
 
-			glm::vec3 maxExtents = glm::vec3(radius);
-			glm::vec3 minExtents = -maxExtents;
+			m_Data->CascadeDepthSplit[i] = (nearClip + splitDist * clipRange) * -1.0f;
+			lastSplitDist = cascadeSplits[i];
 
-			glm::vec3 lightDir = glm::normalize(-renderQueue.m_LightData.DirLight.Direction);
-			glm::mat4 lightViewMatrix = glm::lookAt(frustumCenter - lightDir * -minExtents.z, frustumCenter, glm::vec3(0.0f, 0.0f, 1.0f));
+			// Cascades which aren't refitted every frame get a border, so the camera can move a bit before the slice leaves them
+			uint32_t updateInterval = std::max(rendererSettings.ShadowPass.CascadeUpdateInterval[i], 1);
+			float fitRadius = updateInterval > 1 ? std::ceil(radius * 1.1f) : radius;
+
+			// Keep the previous fit, until it is due (by the update interval) or the slice isn't fully inside of it anymore.
+			// Keeping the matrix the same is also what allows the static depth of the cascade to stay cached
+			CascadeFit& cascadeFit = m_Data->CascadeFits[i];
+			bool sliceInsideFit = glm::length(frustumCenter - cascadeFit.Center) + radius <= cascadeFit.Radius;
+			bool fitIsDue = currentFrameCount - cascadeFit.Frame >= updateInterval;
+			if (cascadeFit.Valid && !lightChanged && cascadeFit.Radius == fitRadius && sliceInsideFit && !fitIsDue)
+				continue;
+
+			cascadeFit.Center = frustumCenter;
+			cascadeFit.Radius = fitRadius;
+			cascadeFit.Frame = currentFrameCount;
+			cascadeFit.Valid = true;
+			m_Data->CacheStats.RefittedCascades++;
+
+			// Snap the center to whole texels in light space (to avoid shimmering), and the depth range to coarse steps,
+			// so small camera movements produce exactly the same matrix
+			glm::vec3 lightSpaceCenter = glm::vec3(lightViewMatrix * glm::vec4(frustumCenter, 1.0f));
+			float texelSize = (2.0f * fitRadius) / shadowTextureRes;
+			lightSpaceCenter.x = glm::floor(lightSpaceCenter.x / texelSize) * texelSize;
+			lightSpaceCenter.y = glm::floor(lightSpaceCenter.y / texelSize) * texelSize;
+
+			// The depth step is added to the far plane, so the snapped range still encloses the whole sphere (the view looks down -z)
+			float depthStep = fitRadius * 0.5f;
+			float centerDepth = glm::floor(-lightSpaceCenter.z / depthStep) * depthStep;
 
 			glm::mat4 lightOrthoMatrix = glm::ortho(
-				minExtents.x, maxExtents.x,
-				minExtents.y, maxExtents.y,
-				0.0f + rendererSettings.ShadowPass.CascadeNearPlaneOffset, (maxExtents.z - minExtents.z) + rendererSettings.ShadowPass.CascadeFarPlaneOffset
+				lightSpaceCenter.x - fitRadius, lightSpaceCenter.x + fitRadius,
+				lightSpaceCenter.y - fitRadius, lightSpaceCenter.y + fitRadius,
+				centerDepth - fitRadius + rendererSettings.ShadowPass.CascadeNearPlaneOffset, centerDepth + fitRadius + depthStep + rendererSettings.ShadowPass.CascadeFarPlaneOffset
 			);
-			//glm::mat4 lightOrthoMatrix = glm::ortho(minExtents.x, maxExtents.x, minExtents.y, maxExtents.y, 0.0f, maxExtents.z - minExtents.z);
-
-			// Offset to texel space to avoid shimmering (from https://stackoverflow.com/questions/33499053/cascaded-shadow-map-shimmering)
-			glm::mat4 shadowMatrix = lightOrthoMatrix * lightViewMatrix;
-			glm::vec4 shadowOrigin = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
-			shadowOrigin = shadowMatrix * shadowOrigin;
-			float storedW = shadowOrigin.w;
-			shadowOrigin = shadowOrigin * static_cast<float>(shadowTextureRes) / 2.0f;
-			glm::vec4 roundedOrigin = glm::round(shadowOrigin);
-			glm::vec4 roundOffset = roundedOrigin - shadowOrigin;
-			roundOffset = roundOffset * 2.0f / static_cast<float>(shadowTextureRes);
-			roundOffset.z = 0.0f;
-			roundOffset.w = 0.0f;
-			glm::mat4 shadowProj = lightOrthoMatrix;
-			shadowProj[3] += roundOffset;
-			lightOrthoMatrix = shadowProj;
-#if 0
-			glm::mat4 shadowMatrix = lightOrthoMatrix * lightViewMatrix;
-			const float ShadowMapResolution = shadowTextureRes;
-			glm::vec4 shadowOrigin = (shadowMatrix * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)) * ShadowMapResolution / 2.0f;
-			glm::vec4 roundedOrigin = glm::round(shadowOrigin);
-			glm::vec4 roundOffset = roundedOrigin - shadowOrigin;
-			roundOffset = roundOffset * 2.0f / ShadowMapResolution;
-			roundOffset.z = 0.0f;
-			roundOffset.w = 0.0f;
-			lightOrthoMatrix[3] += roundOffset;
-#endif
 
-
-
-			m_Data->CascadeDepthSplit[i] = (nearClip + splitDist * clipRange) * -1.0f;
 			m_Data->CascadeViewProjMatrix[i] = lightOrthoMatrix * lightViewMatrix;
-
-			lastSplitDist = cascadeSplits[i];
 		}
 	}
 
@@ -852,6 +1082,26 @@ namespace Frost
 			ImGui::SliderInt("Use PCSS", &rendererSpec.ShadowPass.UsePCSS, 0, 1);
 			ImGui::SliderInt("Fade Cascades", &rendererSpec.ShadowPass.FadeCascades, 0, 1);
 			ImGui::SliderInt("Show Cascades", &rendererSpec.ShadowPass.m_ShowCascadesDebug, 0, 1);
+			ImGui::SliderInt("Cache Static Cascades", &rendererSpec.ShadowPass.CacheStaticCascades, 0, 1);
+			ImGui::DragInt4("Cascade Update Interval", rendererSpec.ShadowPass.CascadeUpdateInterval, 0.1f, 1, 60);
+			ImGui::DragFloat("Cascade LOD Bias", &rendererSpec.ShadowPass.LODBias, 0.05f, -2.0f, 4.0f);
+
+			ImGui::Text("Refitted Cascades: %d", m_Data->CacheStats.RefittedCascades);
+			ImGui::Text("Re-rendered Static Cascades: %d/%d", m_Data->CacheStats.RenderedStaticCascades, m_Data->CascadeViewCount);
+			for (uint32_t i = 0; i < m_Data->CascadeViewCount; i++)
+			{
+				if (m_Data->CacheStats.RenderedStaticCascade[i])
+					ImGui::Text("Cascade %d: re-rendered with %d static casters, %d dynamic casters", i, m_Data->CacheStats.StaticCasters[i], m_Data->CacheStats.DynamicCasters[i]);
+				else
+					ImGui::Text("Cascade %d: cached, %d dynamic casters", i, m_Data->CacheStats.DynamicCasters[i]);
+
+				const SceneVisibility& sceneVisibility = m_RenderPassPipeline->GetSceneVisibility();
+				if (m_Data->CascadeViews[i] < sceneVisibility.GetViewCount())
+				{
+					const uint32_t* lodSubmeshCounts = sceneVisibility.GetView(m_Data->CascadeViews[i]).LODSubmeshCounts;
+					ImGui::Text("    Submeshes per LOD: %d / %d / %d / %d", lodSubmeshCounts[0], lodSubmeshCounts[1], lodSubmeshCounts[2], lodSubmeshCounts[3]);
+				}
+			}
 
 			auto shadowDepthTexture = m_Data->ShadowDepthRenderPass->GetDepthAttachment(currentFrameIndex);
 			imguiLayer->RenderTexture(shadowDepthTexture, 256, 256);
@@ -13,6 +13,7 @@ namespace Frost
 
 		virtual void Init(SceneRenderPassPipeline* renderPassPipeline) override;
 		virtual void InitLate() override;
+		virtual void OnRegisterViews(const RenderQueue& renderQueue, SceneVisibility& sceneVisibility) override;
 		virtual void OnUpdate(const RenderQueue& renderQueue) override;
 		virtual void OnRenderDebug() override;
 		virtual void OnResize(uint32_t width, uint32_t height) override;
@@ -38,21 +39,84 @@ namespace Frost
 		void UpdateCascades(const RenderQueue& renderQueue);
 		void CalculateCascadeOffsets();
 
+		void UpdateShadowCasters(const RenderQueue& renderQueue);
+		void MarkCachedCascadesDirty(const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+
 	private:
 		SceneRenderPassPipeline* m_RenderPassPipeline;
 
 		struct MeshInstancedVertexBuffer // `MeshInstancedVertexBuffer` For Shadow Pass
 		{
 			glm::mat4 ModelSpaceMatrix;
-			glm::mat4 WorldSpaceMatrix;
 			uint64_t BoneInformationBDA;
 		};
 
+		enum class ShadowCasterFilter
+		{
+			All, Static, Dynamic
+		};
+
+		// Range of the shadow indirect mesh data, drawn into one cascade
+		struct ShadowDrawList
+		{
+			uint32_t FirstMesh = 0;
+			uint32_t MeshCount = 0;
+			uint32_t CasterCount = 0;
+		};
+
+		// Running offsets into the indirect commands/instanced vertex buffers, while the draw lists of a frame are prepared
+		struct ShadowDrawListOffsets
+		{
+			uint64_t IndirectCmds = 0;
+			uint64_t InstanceVertices = 0;
+			uint32_t Instances = 0;
+		};
+
+		struct ShadowCaster
+		{
+			glm::mat4 Transform;
+			glm::vec3 BoundsMin, BoundsMax; // World space bounds from the last frame it was seen
+			uint32_t StillFrames = 0;       // Frames since the transform last changed
+			uint64_t LastSeenFrame = 0;
+			bool IsStatic = false;          // Drawn into the cascade caches, instead of every frame
+		};
+
+		// Sphere (and frame) which the cascade was last fitted to. Cascades with an update interval keep it until the camera leaves it
+		struct CascadeFit
+		{
+			glm::vec3 Center{ 0.0f };
+			float Radius = 0.0f;
+			uint64_t Frame = 0;
+			bool Valid = false;
+		};
+
+		struct CascadeCache
+		{
+			glm::mat4 ViewProjMatrix{ 1.0f }; // Matrix which the cached depth was rendered with
+			Math::ViewFrustum Frustum;
+			uint64_t LODSettingsHash = 0; // The casters' LODs are part of the cached depth
+			bool Valid = false;
+			bool Dirty = false; // A static caster inside of it has changed
+		};
+
+		struct ShadowCacheStats
+		{
+			uint32_t RefittedCascades = 0;
+			uint32_t RenderedStaticCascades = 0; // Cascades whose static depth was re-rendered this frame
+			bool RenderedStaticCascade[4] = {};
+			uint32_t StaticCasters[4] = {}; // Drawn into the cache (only when it was re-rendered)
+			uint32_t DynamicCasters[4] = {};
+		};
+
+		ShadowDrawList ShadowDepthPrepareDrawList(const RenderQueue& renderQueue, uint32_t cascadeIndex, ShadowCasterFilter filter, ShadowDrawListOffsets& offsets);
+		void ShadowDepthRenderCascade(const Ref<RenderPass>& renderPass, uint32_t framebufferIndex, uint32_t cascadeIndex, const ShadowDrawList& drawList, bool clearCascade);
+
 		struct InternalData
 		{
 			Ref<Shader> ShadowDepthShader;
 			Ref<Pipeline> ShadowDepthPipeline;
 			Ref<RenderPass> ShadowDepthRenderPass;
+			Ref<RenderPass> ShadowStaticCacheRenderPass; // Depth of the static casters only (same atlas layout), kept between frames
 
 			Ref<Shader> ShadowComputeShader;
 			Ref<ComputePipeline> ShadowComputePipeline;
@@ -72,6 +136,19 @@ namespace Frost
 
 			glm::mat4 CascadeViewProjMatrix[4];
 			glm::vec4 CascadeDepthSplit;
+			uint32_t CascadeViews[4]; // Scene visibility views of the cascades (registered every frame)
+			uint32_t CascadeViewCount = 0;
+			uint64_t CascadeInputsHash = 0; // Camera, light and settings which the cascades were fitted with
+			glm::vec3 CascadeLightDirection{ 0.0f };
+			CascadeFit CascadeFits[4];
+			CascadeCache CascadeCaches[4];
+
+			HashMap<uint64_t, ShadowCaster> ShadowCasters; // By scene visibility instance key
+			Vector<uint8_t> IsStaticCaster; // Per render queue entry, for the current frame
+
+			ShadowDrawList StaticDrawLists[4];
+			ShadowDrawList DynamicDrawLists[4];
+			ShadowCacheStats CacheStats;
 
 			glm::vec2 MinResCascade[4];
 			glm::vec2 MaxResCascade[4];
@@ -17,12 +17,96 @@
 
 #include "Frost/Platform/Vulkan/VulkanImage.h"
 
+#include "Frost/Utils/Hash.h"
+
 #include <GLFW/glfw3.h>
 
 #include <imgui.h>
 
 namespace Frost
 {
+	// Size of a brick (in voxels), which is the unit of the dirty tracking and of the clipmap scrolling
+	static constexpr int32_t s_VoxelBrickSize = 16;
+
+	// When the dirty bricks can't be merged into this many boxes, they are revoxelized as one box (their union)
+	static constexpr uint32_t s_MaxVoxelDirtyRegions = 8;
+
+	namespace Utils
+	{
+		// The voxelization shader writes through an R32UI view of the voxel texture, for the atomic operations
+		static void WriteAtomicVoxelTextureDescriptor(const Ref<Material>& descriptor, VkImageView imageView, VkImageLayout imageLayout)
+		{
+			VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+			VkDescriptorSet descriptorSet = descriptor.As<VulkanMaterial>()->GetVulkanDescriptorSet(0);
+
+			VkDescriptorImageInfo imageInfo{};
+			imageInfo.imageLayout = imageLayout;
+			imageInfo.imageView = imageView;
+			imageInfo.sampler = nullptr;
+
+			VkWriteDescriptorSet writeDescriptorSet{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+			writeDescriptorSet.dstBinding = 2;
+			writeDescriptorSet.dstArrayElement = 0;
+			writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+			writeDescriptorSet.pImageInfo = &imageInfo;
+			writeDescriptorSet.descriptorCount = 1;
+			writeDescriptorSet.dstSet = descriptorSet;
+
+			vkUpdateDescriptorSets(device, 1, &writeDescriptorSet, 0, nullptr);
+		}
+
+		static int32_t FloorDiv(int32_t value, int32_t divisor)
+		{
+			return (value >= 0) ? (value / divisor) : -((-value + divisor - 1) / divisor);
+		}
+
+		static int32_t PositiveModulo(int32_t value, int32_t divisor)
+		{
+			return ((value % divisor) + divisor) % divisor;
+		}
+
+		// Converts a world position into a voxel of the (not wrapped) volume.
+		// It's clamped to one voxel outside of the volume, so positions which are far away don't overflow
+		static glm::ivec3 WorldToVolumeVoxel(const glm::vec3& position, float voxelSize, const glm::ivec3& origin, int32_t voxelDimensions)
+		{
+			glm::vec3 voxel = glm::floor(position / voxelSize) - glm::vec3(origin);
+			return glm::ivec3(glm::clamp(voxel, glm::vec3(-1.0f), glm::vec3(float(voxelDimensions))));
+		}
+
+		// Size of the voxel volume in world units (the same with and without the clipmap)
+		static float CalculateVoxelVolumeSize(int32_t voxelDimensions, float voxelSizeSetting)
+		{
+			float size = glm::round(voxelDimensions * voxelSizeSetting);
+			return size + float(int32_t(size) % 2);
+		}
+
+		// Center of the voxel volume when the clipmap is disabled
+		static glm::vec3 CalculateVoxelVolumeCenter(const glm::vec3& cameraPosition, float voxelSizeSetting)
+		{
+			float camPosX = glm::round(cameraPosition.x);
+			float camPosY = glm::round(cameraPosition.y);
+			float camPosZ = glm::round(cameraPosition.z);
+
+			int32_t offsetFactor = int32_t(8.0f * voxelSizeSetting);
+
+			camPosX = camPosX + abs(int32_t(camPosX) % offsetFactor - offsetFactor);
+			camPosY = camPosY + abs(int32_t(camPosY) % offsetFactor - offsetFactor);
+			camPosZ = camPosZ + abs(int32_t(camPosZ) % offsetFactor - offsetFactor);
+
+			return { camPosX, camPosY, camPosZ };
+		}
+
+		// World voxel coordinate of the clipmap's min corner. It's snapped to whole bricks, so the volume always scrolls by whole bricks
+		static glm::ivec3 CalculateClipmapOrigin(const glm::vec3& cameraPosition, float voxelSize, int32_t bricksPerAxis)
+		{
+			glm::ivec3 cameraVoxel = glm::ivec3(glm::floor(cameraPosition / voxelSize));
+			glm::ivec3 originBrick;
+			for (int32_t axis = 0; axis < 3; axis++)
+				originBrick[axis] = FloorDiv(cameraVoxel[axis], s_VoxelBrickSize) - bricksPerAxis / 2;
+			return originBrick * s_VoxelBrickSize;
+		}
+	}
+
 	VulkanVoxelizationPass::VulkanVoxelizationPass()
 		: m_Name("VoxelizationPass")
 	{
@@ -42,7 +126,7 @@ namespace Frost
 		m_Data->VoxelConeTracingShader = Renderer::GetShaderLibrary()->Get("VoxelConeTracing");
 
 		VoxelizationInit();
-		ClearBufferInit();
+		ClipmapVoxelizationInit();
 
 		VoxelFilterInit();
 		VoxelConeTracingInit(1600, 900);
@@ -77,7 +161,6 @@ namespace Frost
 		// Pipeline
 		BufferLayout bufferLayout = {
 			{ "a_ModelSpaceMatrix",    ShaderDataType::Mat4 },
-			{ "a_WorldSpaceMatrix",    ShaderDataType::Mat4 },
 			{ "a_MaterialIndexOffset", ShaderDataType::UInt },
 		};
 		bufferLayout.m_InputType = InputType::Instanced;
@@ -124,29 +207,14 @@ namespace Frost
 			auto instanceSpec = m_RenderPassPipeline->GetRenderPassData<VulkanGeometryPass>()->MaterialSpecs[i];
 
 			Ref<VulkanMaterial> descriptor = m_Data->VoxelizationDescriptor[i].As<VulkanMaterial>();
-			VkDescriptorSet descriptorSet = descriptor->GetVulkanDescriptorSet(0);
 
 			descriptor->Set("u_VoxelTexture_NonAtomic", m_Data->VoxelizationTexture[i]);
 			descriptor->Set("u_MaterialUniform", instanceSpec.DeviceBuffer);
 			descriptor->UpdateVulkanDescriptorIfNeeded();
 
-
 			// Voxel texture with R32UI format
 			Ref<VulkanTexture3D> vulkanVoxelTexture = m_Data->VoxelizationTexture[i].As<VulkanTexture3D>();
-			VkDescriptorImageInfo imageInfo{};
-			imageInfo.imageLayout = vulkanVoxelTexture->GetVulkanImageLayout();
-			imageInfo.imageView = m_Data->VoxelTexture_R32UI[i];
-			imageInfo.sampler = nullptr;
-
-			VkWriteDescriptorSet writeDescriptorSet{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-			writeDescriptorSet.dstBinding = 2;
-			writeDescriptorSet.dstArrayElement = 0;
-			writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-			writeDescriptorSet.pImageInfo = &imageInfo;
-			writeDescriptorSet.descriptorCount = 1;
-			writeDescriptorSet.dstSet = descriptorSet;
-
-			vkUpdateDescriptorSets(device, 1, &writeDescriptorSet, 0, nullptr);
+			Utils::WriteAtomicVoxelTextureDescriptor(m_Data->VoxelizationDescriptor[i], m_Data->VoxelTexture_R32UI[i], vulkanVoxelTexture->GetVulkanImageLayout());
 		}
 
 		m_Data->IndirectVoxelCmdBuffer.resize(framesInFlight);
@@ -188,6 +256,59 @@ namespace Frost
 		delete cpuBuffer;
 	}
 
+	void VulkanVoxelizationPass::ClipmapVoxelizationInit()
+	{
+		uint32_t framesInFlight = Renderer::GetRendererConfig().FramesInFlight;
+		uint32_t voxelVolumeDimensions = Renderer::GetRendererConfig().VoxelTextureResolution;
+
+		FROST_ASSERT(bool(voxelVolumeDimensions % s_VoxelBrickSize == 0), "The voxel texture resolution must be a multiple of the brick size!");
+
+		m_Data->BricksPerAxis = voxelVolumeDimensions / s_VoxelBrickSize;
+		uint32_t brickCount = m_Data->BricksPerAxis * m_Data->BricksPerAxis * m_Data->BricksPerAxis;
+		m_Data->DirtyBricks.resize(brickCount, 0);
+		m_Data->DirtyBricksScratch.resize(brickCount, 0);
+
+		// The albedo volume doesn't need mips, they are generated by the filter into the lit volume
+		ImageSpecification imageSpec{};
+		imageSpec.Width = voxelVolumeDimensions;
+		imageSpec.Height = voxelVolumeDimensions;
+		imageSpec.Depth = voxelVolumeDimensions;
+		imageSpec.Format = ImageFormat::RGBA8;
+		imageSpec.Usage = ImageUsage::Storage;
+		imageSpec.Sampler.SamplerFilter = ImageFilter::Linear;
+		imageSpec.UseMipChain = false;
+		imageSpec.MutableFormat = true;
+		m_Data->AlbedoVoxelTexture = Texture3D::Create(imageSpec);
+
+		Ref<VulkanTexture3D> vulkanAlbedoTexture = m_Data->AlbedoVoxelTexture.As<VulkanTexture3D>();
+		VkImageUsageFlags usageFlags = Utils::GetImageUsageFlags(imageSpec.Usage);
+		Utils::CreateImageView(m_Data->AlbedoVoxelTexture_R32UI, vulkanAlbedoTexture->GetVulkanImage(), usageFlags, VK_FORMAT_R32_UINT, 1, voxelVolumeDimensions);
+
+		// The albedo volume is shared by all the frames, but the material buffer isn't
+		m_Data->AlbedoVoxelizationDescriptor.resize(framesInFlight);
+		for (uint32_t i = 0; i < framesInFlight; i++)
+		{
+			m_Data->AlbedoVoxelizationDescriptor[i] = Material::Create(m_Data->VoxelizationShader, "AlbedoVoxelization_Material");
+
+			auto instanceSpec = m_RenderPassPipeline->GetRenderPassData<VulkanGeometryPass>()->MaterialSpecs[i];
+
+			Ref<VulkanMaterial> descriptor = m_Data->AlbedoVoxelizationDescriptor[i].As<VulkanMaterial>();
+			descriptor->Set("u_VoxelTexture_NonAtomic", m_Data->AlbedoVoxelTexture);
+			descriptor->Set("u_MaterialUniform", instanceSpec.DeviceBuffer);
+			descriptor->UpdateVulkanDescriptorIfNeeded();
+
+			Utils::WriteAtomicVoxelTextureDescriptor(m_Data->AlbedoVoxelizationDescriptor[i], m_Data->AlbedoVoxelTexture_R32UI, vulkanAlbedoTexture->GetVulkanImageLayout());
+		}
+
+		// One brick of zeros is enough to clear any brick (every copy region reads from the start of the buffer)
+		uint32_t zeroBrickSize = s_VoxelBrickSize * s_VoxelBrickSize * s_VoxelBrickSize * sizeof(uint8_t) * 4;
+		Vector<uint8_t> zeroBrick(zeroBrickSize, 0);
+		m_Data->ZeroBrickBuffer = BufferDevice::Create(zeroBrickSize, { BufferUsage::TransferSrc });
+		m_Data->ZeroBrickBuffer->SetData(zeroBrick.data());
+
+		m_Data->FilterInputHash.resize(framesInFlight, 0);
+	}
+
 	void VulkanVoxelizationPass::UpdateRenderingSettings()
 	{
 		RendererSettings& rendererSettings = Renderer::GetRendererSettings();
@@ -218,19 +339,56 @@ namespace Frost
 	{
 	}
 
+	void VulkanVoxelizationPass::OnRegisterViews(const RenderQueue& renderQueue, SceneVisibility& sceneVisibility)
+	{
+		RendererSettings& rendererSettings = Renderer::GetRendererSettings();
+
+		m_Data->VoxelVolumeView = UINT32_MAX;
+		if (!rendererSettings.VoxelGI.EnableVoxelization) return;
+
+		// The same volume which is voxelized in `OnUpdate`, so only the instances inside of it are drawn
+		int32_t voxelDimensions = m_Data->m_VoxelGrid;
+		float size = Utils::CalculateVoxelVolumeSize(voxelDimensions, rendererSettings.VoxelGI.VoxelSize);
+		float voxelSize = size / float(voxelDimensions);
+
+		glm::vec3 center;
+		if (rendererSettings.VoxelGI.UseClipmapVoxelization)
+		{
+			glm::ivec3 origin = Utils::CalculateClipmapOrigin(renderQueue.CameraPosition, voxelSize, m_Data->BricksPerAxis);
+			center = (glm::vec3(origin) + float(voxelDimensions) * 0.5f) * voxelSize;
+		}
+		else
+		{
+			center = Utils::CalculateVoxelVolumeCenter(renderQueue.CameraPosition, rendererSettings.VoxelGI.VoxelSize);
+		}
+
+		// Padded by one voxel, since the voxelization is conservative
+		glm::vec3 halfExtents = glm::vec3(size * 0.5f + voxelSize);
+		m_Data->VoxelVolumeView = sceneVisibility.AddView("Voxel Volume", center - halfExtents, center + halfExtents);
+	}
+
 	void VulkanVoxelizationPass::OnUpdate(const RenderQueue& renderQueue)
 	{
+		RendererSettings& rendererSettings = Renderer::GetRendererSettings();
+
+		// The instances can't be tracked while the clipmap isn't updated, so it has to be revoxelized fully once it is used again
+		bool useClipmap = rendererSettings.VoxelGI.EnableVoxelization && rendererSettings.VoxelGI.UseClipmapVoxelization;
+		if (!useClipmap || renderQueue.GetQueueSize() == 0)
+			m_Data->ClipmapValid = false;
+
 		// If we have 0 meshes, we shouldnt render this pass
 		if (renderQueue.GetQueueSize() == 0) return;
 
-		RendererSettings& rendererSettings = Renderer::GetRendererSettings();
 		UpdateRenderingSettings();
 
 		if (rendererSettings.VoxelGI.EnableVoxelization)
 		{
 			VulkanRenderer::BeginTimeStampPass("Voxelization Pass");
 			//VoxelizationUpdateRendering(renderQueue);
-			VoxelizationUpdateRenderingWithInstancing(renderQueue);
+			if (useClipmap)
+				ClipmapVoxelizationUpdate(renderQueue);
+			else
+				VoxelizationUpdateRenderingWithInstancing(renderQueue);
 			VulkanRenderer::EndTimeStampPass("Voxelization Pass");
 
 			VulkanRenderer::BeginTimeStampPass("Voxel Filter Pass");
@@ -325,6 +483,10 @@ namespace Frost
 			voxelVolumeDimensions
 		};
 
+		// Only needed when the whole volume is cleared every frame
+		if (!m_Data->ClearBuffer)
+			ClearBufferInit();
+
 		Ref<VulkanTexture3D> voxelTexture = m_Data->VoxelizationTexture[currentFrameIndex].As<VulkanTexture3D>();
 		Ref<VulkanBufferDevice> clearBufferDevice = m_Data->ClearBuffer.As<VulkanBufferDevice>();
 
@@ -335,27 +497,44 @@ namespace Frost
 
 
 
-		float size = glm::round(m_Data->m_VoxelGrid * rendererSettings.VoxelGI.VoxelSize);
-		size = size + float(int32_t(size) % 2);
+		float size = Utils::CalculateVoxelVolumeSize(m_Data->m_VoxelGrid, rendererSettings.VoxelGI.VoxelSize);
 		m_Data->m_VoxelAABB = size;
 
-		glm::vec3 camPos = renderQueue.CameraPosition;
+		m_Data->VoxelCameraPosition = Utils::CalculateVoxelVolumeCenter(renderQueue.CameraPosition, rendererSettings.VoxelGI.VoxelSize);
 
-		float camPosX = glm::round(camPos.x);
-		float camPosY = glm::round(camPos.y);
-		float camPosZ = glm::round(camPos.z);
+		UpdateVoxelProjections(m_Data->VoxelizationDescriptor[currentFrameIndex], m_Data->VoxelCameraPosition, size);
 
+#if 0
+		// https://github.com/turanszkij/WickedEngine/blob/master/WickedEngine/wiRenderer.cpp#L3135
 
-		int32_t offsetFactor = int32_t(8.0f * rendererSettings.VoxelGI.VoxelSize);
-
-		camPosX = camPosX + abs(int32_t(camPosX) % offsetFactor - offsetFactor);
-		camPosY = camPosY + abs(int32_t(camPosY) % offsetFactor - offsetFactor);
-		camPosZ = camPosZ + abs(int32_t(camPosZ) % offsetFactor - offsetFactor);
 
-		//FROST_CORE_INFO("X: {0}  Y: {1}   Z: {2}", camPosX, camPosY, camPosZ);
 
-		m_Data->VoxelCameraPosition = { camPosX, camPosY, camPosZ };
+		// Update Voxelization parameters :
+	https://github.com/turanszkij/WickedEngine/blob/master/WickedEngine/wiRenderer.cpp#L2953
+		if (scene.objects.GetCount() > 0)
+		{
+			// We don't update it if the scene is empty, this even makes it easier to debug
+			const float f = 0.05f / voxelSceneData.voxelsize;
+			XMFLOAT3 center = XMFLOAT3(std::floor(vis.camera->Eye.x * f) / f, std::floor(vis.camera->Eye.y * f) / f, std::floor(vis.camera->Eye.z * f) / f);
+			if (wi::math::DistanceSquared(center, voxelSceneData.center) > 0)
+			{
+				voxelSceneData.centerChangedThisFrame = true;
+			}
+			else
+			{
+				voxelSceneData.centerChangedThisFrame = false;
+			}
+			voxelSceneData.center = center;
+			voxelSceneData.extents = XMFLOAT3(voxelSceneData.res * voxelSceneData.voxelsize, voxelSceneData.res * voxelSceneData.voxelsize, voxelSceneData.res * voxelSceneData.voxelsize);
+		}
+#endif
+	}
 
+	void VulkanVoxelizationPass::UpdateVoxelProjections(const Ref<Material>& descriptor, const glm::vec3& center, float size)
+	{
+		float camPosX = center.x;
+		float camPosY = center.y;
+		float camPosZ = center.z;
 
 		// X
 		glm::mat4 projectionMatrix_X = glm::ortho(
@@ -389,46 +568,13 @@ namespace Frost
 		m_VoxelAABBProjection.Y = projectionMatrix_Y * viewY;
 		m_VoxelAABBProjection.Z = projectionMatrix_Z * viewZ;
 
-		m_Data->VoxelizationDescriptor[currentFrameIndex]->Set("VoxelProjections.AxisX", m_VoxelAABBProjection.X);
-		m_Data->VoxelizationDescriptor[currentFrameIndex]->Set("VoxelProjections.AxisY", m_VoxelAABBProjection.Y);
-		m_Data->VoxelizationDescriptor[currentFrameIndex]->Set("VoxelProjections.AxisZ", m_VoxelAABBProjection.Z);
-
-#if 0
-		// https://github.com/turanszkij/WickedEngine/blob/master/WickedEngine/wiRenderer.cpp#L3135
-
-
-
-		// Update Voxelization parameters :
-	https://github.com/turanszkij/WickedEngine/blob/master/WickedEngine/wiRenderer.cpp#L2953
-		if (scene.objects.GetCount() > 0)
-		{
-			// We don't update it if the scene is empty, this even makes it easier to debug
-			const float f = 0.05f / voxelSceneData.voxelsize;
-			XMFLOAT3 center = XMFLOAT3(std::floor(vis.camera->Eye.x * f) / f, std::floor(vis.camera->Eye.y * f) / f, std::floor(vis.camera->Eye.z * f) / f);
-			if (wi::math::DistanceSquared(center, voxelSceneData.center) > 0)
-			{
-				voxelSceneData.centerChangedThisFrame = true;
-			}
-			else
-			{
-				voxelSceneData.centerChangedThisFrame = false;
-			}
-			voxelSceneData.center = center;
-			voxelSceneData.extents = XMFLOAT3(voxelSceneData.res * voxelSceneData.voxelsize, voxelSceneData.res * voxelSceneData.voxelsize, voxelSceneData.res * voxelSceneData.voxelsize);
-		}
-#endif
+		descriptor->Set("VoxelProjections.AxisX", m_VoxelAABBProjection.X);
+		descriptor->Set("VoxelProjections.AxisY", m_VoxelAABBProjection.Y);
+		descriptor->Set("VoxelProjections.AxisZ", m_VoxelAABBProjection.Z);
 	}
 
 
-	struct MeshInstanceListVoxelizationPass // This is reponsible for grouping all the mesh instances into one array
-	{
-		Mesh* Mesh; // Getting it as a raw pointer to intefere with the reference count
-		glm::mat4 Transform;
-		uint32_t MeshIndex;
-	};
-
 	static Vector<NewIndirectMeshData> s_VoxelizationMeshIndirectData;
-	static HashMap<AssetHandle, Vector<MeshInstanceListVoxelizationPass>> s_GroupedMeshesCached;
 
 #if 0
 	void VulkanVoxelizationPass::VoxelizationUpdateRendering(const RenderQueue& renderQueue)
@@ -460,7 +606,7 @@ namespace Frost
 		for (uint32_t i = 0; i < renderQueue.GetQueueSize(); i++)
 		{
 			// Get the mesh
-			auto mesh = renderQueue.m_Data[i].Mesh;
+			const auto& mesh = renderQueue.m_Data[i].Mesh;
 			const Vector<Submesh>& submeshes = mesh->GetMeshAsset()->GetSubMeshes();
 
 			//if (mesh->IsAnimated()) continue;
@@ -594,19 +740,36 @@ namespace Frost
 
 	void VulkanVoxelizationPass::VoxelizationUpdateRenderingWithInstancing(const RenderQueue& renderQueue)
 	{
-		// Getting all the needed information
 		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
-		VkCommandBuffer cmdBuf = VulkanContext::GetSwapChain()->GetRenderCommandBuffer(currentFrameIndex);
-		Ref<Framebuffer> framebuffer = m_Data->VoxelizationRenderPass->GetFramebuffer(currentFrameIndex);
-		Ref<VulkanPipeline> vulkanPipeline = m_Data->VoxelizationPipeline.As<VulkanPipeline>();
-
-		// Get the needed matricies from the camera
-		glm::mat4 projectionMatrix = renderQueue.CameraProjectionMatrix;
-		projectionMatrix[1][1] *= -1; // GLM uses opengl style of rendering, where the y coordonate is inverted
-		glm::mat4 viewProjectionMatrix = projectionMatrix * renderQueue.CameraViewMatrix;
 
+		// Without the clipmap, the volume is cleared and the whole scene is voxelized again every frame
 		VoxelizationUpdateData(renderQueue);
 
+		// Only the instances inside of the voxel volume
+		const SceneVisibility& sceneVisibility = m_RenderPassPipeline->GetSceneVisibility();
+		m_Data->VoxelizedMeshIndices = sceneVisibility.GetView(m_Data->VoxelVolumeView).VisibleInstances;
+
+		m_Data->DirtyRegions.clear();
+		m_Data->DirtyRegions.push_back({ glm::ivec3(0), glm::ivec3(m_Data->m_VoxelGrid) });
+		m_VoxelizationPushConstant.ToroidalOffset = glm::ivec4(0);
+
+		uint64_t triangleCount = VoxelizationPrepareDraws(renderQueue);
+		VoxelizationRecordDraws(renderQueue, m_Data->VoxelizationDescriptor[currentFrameIndex]);
+
+		VoxelizationStats& stats = m_Data->Stats;
+		stats.DirtyBricks = m_Data->BricksPerAxis * m_Data->BricksPerAxis * m_Data->BricksPerAxis;
+		stats.DirtyRegions = 1;
+		stats.ScrolledBricks = 0;
+		stats.VoxelizedInstances = m_Data->VoxelizedMeshIndices.size();
+		stats.VoxelizedTriangles = triangleCount;
+		stats.FullRevoxelizations++;
+	}
+
+	uint64_t VulkanVoxelizationPass::VoxelizationPrepareDraws(const RenderQueue& renderQueue)
+	{
+		// Getting all the needed information
+		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
+
 		/*
 			Each mesh might have a set of submeshes which are sent to render individualy.
 			We dont need them when we render them indirectly (because the gpu renders all the submeshes automatically - `multidraw`),
@@ -614,118 +777,93 @@ namespace Frost
 			(TODO: This explanation is outdated, now we are using `instanced indirect multidraw rendering` :D)
 		*/
 		s_VoxelizationMeshIndirectData.clear();
-		s_GroupedMeshesCached.clear();
 
-		// Allocate all the neccesary array buffers before, so we won't waste cpus cycles on reallocating memory
-		for (auto& [meshAssetUUID, instanceCount] : renderQueue.m_MeshInstanceCount)
-		{
-			s_GroupedMeshesCached[meshAssetUUID].reserve(instanceCount);
-		}
-		s_VoxelizationMeshIndirectData.reserve(s_GroupedMeshesCached.size());
+		// Only the instances in `VoxelizedMeshIndices` are drawn. The material indices point into the material buffer
+		// which is filled by the geometry pass, so they are taken from its retained scene slots
+		const Vector<uint32_t>& materialIndexOffsets = m_RenderPassPipeline->GetRenderPassData<VulkanGeometryPass>()->MaterialIndexOffsets;
+		FrameVector<uint8_t> isVoxelized(renderQueue.GetQueueSize(), 0);
+		for (uint32_t meshIndex : m_Data->VoxelizedMeshIndices)
+			isVoxelized[meshIndex] = 1;
 
-
-		for (uint32_t i = 0; i < renderQueue.GetQueueSize(); i++)
-		{
-			// Get the mesh
-			auto mesh = renderQueue.m_Data[i].Mesh;
-
-			s_GroupedMeshesCached[mesh->GetMeshAsset()->Handle].push_back({ mesh.Raw(), renderQueue.m_Data[i].Transform, i});
-		}
+		// The instances are grouped (and their submesh transforms computed) by the scene visibility stage
+		const SceneVisibility& sceneVisibility = m_RenderPassPipeline->GetSceneVisibility();
+		const Vector<uint32_t>& groupedInstances = sceneVisibility.GetGroupedInstances();
+		s_VoxelizationMeshIndirectData.reserve(sceneVisibility.GetGroups().size());
 
 		// `Indirect draw commands` offset
 		uint64_t indirectCmdsOffset = 0;
 
-		// `Instance data` offset.
-		//uint64_t materialDataOffset = 0;
-
 		// `Instance data` offset.
 		uint64_t instanceVertexOffset = 0;
 
-		for (auto& [handle, groupedMeshes] : s_GroupedMeshesCached)
-		{
-			NewIndirectMeshData* currentIndirectMeshData;
-			NewIndirectMeshData* lastIndirectMeshData = nullptr;
-			
-			// If we are submitting the first mesh, we don't need any offset
-			currentIndirectMeshData = &s_VoxelizationMeshIndirectData.emplace_back();
-
-			// We are checking `.size() > 1` and also `.size() - 2` because we've already pushed_back and element before, so we should go 2 elements behind instead of one
-			if (s_VoxelizationMeshIndirectData.size() > 1)
-				lastIndirectMeshData = &s_VoxelizationMeshIndirectData[s_VoxelizationMeshIndirectData.size() - 2];
+		// Offset of the group in the instanced vertex buffer
+		uint32_t totalMeshOffset = 0;
 
+		uint64_t triangleCount = 0;
 
-			Ref<MeshAsset> meshAsset = groupedMeshes[0].Mesh->GetMeshAsset();
-			const Vector<Submesh>& submeshes = meshAsset->GetSubMeshes();
-
-			currentIndirectMeshData->MeshAssetHandle = meshAsset->Handle;
-			currentIndirectMeshData->InstanceCount = groupedMeshes.size();
-			currentIndirectMeshData->SubmeshCount = submeshes.size();
-			currentIndirectMeshData->TotalSubmeshCount = currentIndirectMeshData->SubmeshCount * currentIndirectMeshData->InstanceCount;
-			currentIndirectMeshData->MaterialCount = groupedMeshes[0].Mesh->GetMaterialCount();
-
-			currentIndirectMeshData->CmdOffset = indirectCmdsOffset / sizeof(VkDrawIndexedIndirectCommand);
+		for (const SceneMeshGroup& group : sceneVisibility.GetGroups())
+		{
+			const Vector<Submesh>& submeshes = group.Mesh->GetMeshAsset()->GetSubMeshes();
+			uint32_t groupEnd = group.FirstInstance + group.InstanceCount;
 
-			currentIndirectMeshData->MaterialOffset = 0;
-			currentIndirectMeshData->TotalMeshOffset = 0;
-			if (s_VoxelizationMeshIndirectData.size() > 1)
-			{
-				currentIndirectMeshData->MaterialOffset = lastIndirectMeshData->MaterialOffset + (lastIndirectMeshData->MaterialCount * lastIndirectMeshData->InstanceCount);
-				currentIndirectMeshData->TotalMeshOffset = lastIndirectMeshData->TotalMeshOffset + (lastIndirectMeshData->SubmeshCount * lastIndirectMeshData->InstanceCount);
-			}
+			uint32_t voxelizedInstanceCount = 0;
+			for (uint32_t i = group.FirstInstance; i < groupEnd; i++)
+				voxelizedInstanceCount += isVoxelized[groupedInstances[i]];
 
-			// Set up the instanced vertex buffer (per submesh, per instance)
-			for (uint32_t submeshIndex = 0; submeshIndex < submeshes.size(); submeshIndex++)
+			if (voxelizedInstanceCount != 0)
 			{
-				MeshInstancedVertexBuffer meshInstancedVertexBuffer{};
-				uint32_t meshInstanceNr = 0;
-				for (auto& meshInstance : groupedMeshes)
+				NewIndirectMeshData& currentIndirectMeshData = s_VoxelizationMeshIndirectData.emplace_back();
+				currentIndirectMeshData.MeshAssetHandle = group.MeshAssetHandle;
+				currentIndirectMeshData.InstanceCount = voxelizedInstanceCount;
+				currentIndirectMeshData.SubmeshCount = group.SubmeshCount;
+				currentIndirectMeshData.TotalSubmeshCount = currentIndirectMeshData.SubmeshCount * currentIndirectMeshData.InstanceCount;
+				currentIndirectMeshData.MaterialCount = group.Mesh->GetMaterialCount();
+				currentIndirectMeshData.MaterialOffset = materialIndexOffsets[groupedInstances[group.FirstInstance]];
+				currentIndirectMeshData.TotalMeshOffset = totalMeshOffset;
+				currentIndirectMeshData.CmdOffset = indirectCmdsOffset / sizeof(VkDrawIndexedIndirectCommand);
+
+				// Set up the instanced vertex buffer (per submesh, per instance)
+				for (uint32_t submeshIndex = 0; submeshIndex < group.SubmeshCount; submeshIndex++)
 				{
-					glm::mat4 modelMatrix = meshInstance.Transform * submeshes[submeshIndex].Transform;
-
-					 // Using skeletal (dynamic) submesh transforms, instead of the static ones which are found in the mesh asset
-					//glm::mat4 modelMatrix = meshInstance.Transform * meshInstance.Mesh->GetSkeletalSubmeshes()[submeshIndex].Transform;
-
-
-					// Adding the neccesary Matricies for the shader
-					meshInstancedVertexBuffer.ModelSpaceMatrix = modelMatrix;
-					meshInstancedVertexBuffer.WorldSpaceMatrix = viewProjectionMatrix * modelMatrix;
-					/////////////////////////////////////////////////////
-
-					// Doing `MaterialOffset` because we are indicating it to the whole material buffer (so the index should be global)
-					meshInstancedVertexBuffer.MaterialIndexOffset = currentIndirectMeshData->MaterialOffset + (meshInstanceNr * currentIndirectMeshData->MaterialCount);
-					/////////////////////////////////////////////////////
-
-					m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].HostBuffer.Write((void*)&meshInstancedVertexBuffer, sizeof(MeshInstancedVertexBuffer), instanceVertexOffset);
-					instanceVertexOffset += sizeof(MeshInstancedVertexBuffer);
-
-					meshInstanceNr++;
+					MeshInstancedVertexBuffer meshInstancedVertexBuffer{};
+					for (uint32_t i = group.FirstInstance; i < groupEnd; i++)
+					{
+						uint32_t queueIndex = groupedInstances[i];
+						if (isVoxelized[queueIndex])
+						{
+							// Adding the neccesary Matricies for the shader
+							meshInstancedVertexBuffer.ModelSpaceMatrix = sceneVisibility.GetSubmeshTransform(queueIndex, submeshIndex);
+							/////////////////////////////////////////////////////
+
+							// Global index into the whole material buffer of the geometry pass
+							meshInstancedVertexBuffer.MaterialIndexOffset = materialIndexOffsets[queueIndex];
+							/////////////////////////////////////////////////////
+
+							m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].HostBuffer.Write((void*)&meshInstancedVertexBuffer, sizeof(MeshInstancedVertexBuffer), instanceVertexOffset);
+							instanceVertexOffset += sizeof(MeshInstancedVertexBuffer);
+						}
+					}
 				}
-			}
 
-			for (uint32_t submeshIndex = 0; submeshIndex < submeshes.size(); submeshIndex++)
-			{
-				const Submesh& submesh = submeshes[submeshIndex];
+				for (uint32_t submeshIndex = 0; submeshIndex < group.SubmeshCount; submeshIndex++)
+				{
+					const Submesh& submesh = submeshes[submeshIndex];
 
-				// Submit the submesh into the cpu buffer
-				VkDrawIndexedIndirectCommand indirectCmdBuf{};
-				indirectCmdBuf.firstIndex = submesh.BaseIndex;
-				indirectCmdBuf.indexCount = submesh.IndexCount;
-				indirectCmdBuf.vertexOffset = submesh.BaseVertex;
+					// Submit the submesh into the cpu buffer
+					VkDrawIndexedIndirectCommand indirectCmdBuf{};
+					indirectCmdBuf.firstIndex = submesh.BaseIndex;
+					indirectCmdBuf.indexCount = submesh.IndexCount;
+					indirectCmdBuf.vertexOffset = submesh.BaseVertex;
+					indirectCmdBuf.instanceCount = voxelizedInstanceCount;
+					indirectCmdBuf.firstInstance = totalMeshOffset + submeshIndex * voxelizedInstanceCount;
 
-				indirectCmdBuf.instanceCount = groupedMeshes.size();
+					m_Data->IndirectVoxelCmdBuffer[currentFrameIndex].HostBuffer.Write((void*)&indirectCmdBuf, sizeof(VkDrawIndexedIndirectCommand), indirectCmdsOffset);
+					indirectCmdsOffset += sizeof(VkDrawIndexedIndirectCommand);
 
-				if (lastIndirectMeshData)
-				{
-					indirectCmdBuf.firstInstance = currentIndirectMeshData->TotalMeshOffset;
+					triangleCount += uint64_t(submesh.IndexCount / 3) * voxelizedInstanceCount;
 				}
-				else
-				{
-					indirectCmdBuf.firstInstance = 0;
-				}
-				indirectCmdBuf.firstInstance += submeshIndex;
 
-				m_Data->IndirectVoxelCmdBuffer[currentFrameIndex].HostBuffer.Write((void*)&indirectCmdBuf, sizeof(VkDrawIndexedIndirectCommand), indirectCmdsOffset);
-				indirectCmdsOffset += sizeof(VkDrawIndexedIndirectCommand);
+				totalMeshOffset += group.SubmeshCount * voxelizedInstanceCount;
 			}
 		}
 
@@ -740,6 +878,16 @@ namespace Frost
 		void* instancedVertexBufferPointer = m_Data->GlobalInstancedVertexBuffer[currentFrameIndex].HostBuffer.Data;
 		vulkanInstancedVertexBuffer->SetData(instanceVertexOffset, instancedVertexBufferPointer);
 
+		return triangleCount;
+	}
+
+	void VulkanVoxelizationPass::VoxelizationRecordDraws(const RenderQueue& renderQueue, const Ref<Material>& descriptor)
+	{
+		// Getting all the needed information
+		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
+		VkCommandBuffer cmdBuf = VulkanContext::GetSwapChain()->GetRenderCommandBuffer(currentFrameIndex);
+		Ref<VulkanPipeline> vulkanPipeline = m_Data->VoxelizationPipeline.As<VulkanPipeline>();
+		auto vulkanIndirectCmdBuffer = m_Data->IndirectVoxelCmdBuffer[currentFrameIndex].DeviceBuffer.As<VulkanBufferDevice>();
 
 		Ref<VulkanImage2D> shadowDepthTexture = m_RenderPassPipeline->GetRenderPassData<VulkanShadowPass>()->ShadowDepthRenderPass->GetDepthAttachment(currentFrameIndex).As<VulkanImage2D>();
 		shadowDepthTexture->TransitionLayout(cmdBuf, shadowDepthTexture->GetVulkanImageLayout(), VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
@@ -768,7 +916,7 @@ namespace Frost
 		// TODO: This is so bad, pls fix this
 		VkPipelineLayout pipelineLayout = m_Data->VoxelizationPipeline.As<VulkanPipeline>()->GetVulkanPipelineLayout();
 
-		auto vulkanDescriptor = m_Data->VoxelizationDescriptor[currentFrameIndex].As<VulkanMaterial>();
+		auto vulkanDescriptor = descriptor.As<VulkanMaterial>();
 		vulkanDescriptor->UpdateVulkanDescriptorIfNeeded();
 		Vector<VkDescriptorSet> descriptorSets = vulkanDescriptor->GetVulkanDescriptorSets();
 		descriptorSets[1] = VulkanBindlessAllocator::GetVulkanDescriptorSet(currentFrameIndex);
@@ -784,35 +932,368 @@ namespace Frost
 		vkCmdBindVertexBuffers(cmdBuf, 0, 1, &vertexBufferInstanced, deviceSize);
 
 
-		// Sending the indirect draw commands to the command buffer
-		for (uint32_t i = 0; i < s_VoxelizationMeshIndirectData.size(); i++)
+		// Every region is drawn separately, the fragment shader discards the voxels outside of it
+		// (so the voxels which weren't cleared don't get averaged twice)
+		for (const VoxelRegion& region : m_Data->DirtyRegions)
 		{
-			auto& indirectPerMeshData = s_VoxelizationMeshIndirectData[i];
+			m_VoxelizationPushConstant.RegionMin = glm::ivec4(region.Min, 0);
+			m_VoxelizationPushConstant.RegionMax = glm::ivec4(region.Max, 0);
 
-			// Get the mesh
-			const AssetMetadata& assetMetadata = AssetManager::GetMetadata(indirectPerMeshData.MeshAssetHandle);
-			Ref<MeshAsset> meshAsset = AssetManager::GetAsset<MeshAsset>(assetMetadata.FilePath.string());
+			// Sending the indirect draw commands to the command buffer
+			for (uint32_t i = 0; i < s_VoxelizationMeshIndirectData.size(); i++)
+			{
+				auto& indirectPerMeshData = s_VoxelizationMeshIndirectData[i];
 
-			// Bind the index buffer
-			meshAsset->GetIndexBuffer()->Bind();
+				// Get the mesh
+				Ref<MeshAsset> meshAsset = AssetManager::GetAsset<MeshAsset>(indirectPerMeshData.MeshAssetHandle);
 
+				// Bind the index buffer
+				meshAsset->GetIndexBuffer()->Bind();
 
-			// Set the transform matrix and model matrix of the submesh into a constant buffer
-			m_VoxelizationPushConstant.ViewMatrix = renderQueue.CameraViewMatrix;
-			//m_VoxelizationPushConstant.MaterialIndex = s_VoxelizationMeshIndirectData[i].MaterialOffset;
-			m_VoxelizationPushConstant.VertexBufferBDA = meshAsset->GetVertexBuffer().As<VulkanVertexBuffer>()->GetVulkanBufferAddress();
-			vulkanPipeline->BindVulkanPushConstant("u_PushConstant", (void*)&m_VoxelizationPushConstant);
 
-			uint32_t submeshCount = indirectPerMeshData.SubmeshCount;
-			uint32_t offset = indirectPerMeshData.CmdOffset * sizeof(VkDrawIndexedIndirectCommand);
-			vkCmdDrawIndexedIndirect(cmdBuf, vulkanIndirectCmdBuffer->GetVulkanBuffer(), offset, submeshCount, sizeof(VkDrawIndexedIndirectCommand));
+				// Set the transform matrix and model matrix of the submesh into a constant buffer
+				m_VoxelizationPushConstant.ViewMatrix = renderQueue.CameraViewMatrix;
+				m_VoxelizationPushConstant.VertexBufferBDA = meshAsset->GetVertexBuffer().As<VulkanVertexBuffer>()->GetVulkanBufferAddress();
+				vulkanPipeline->BindVulkanPushConstant("u_PushConstant", (void*)&m_VoxelizationPushConstant);
 
+				uint32_t submeshCount = indirectPerMeshData.SubmeshCount;
+				uint32_t offset = indirectPerMeshData.CmdOffset * sizeof(VkDrawIndexedIndirectCommand);
+				vkCmdDrawIndexedIndirect(cmdBuf, vulkanIndirectCmdBuffer->GetVulkanBuffer(), offset, submeshCount, sizeof(VkDrawIndexedIndirectCommand));
+			}
 		}
 
 		// End the renderpass
 		m_Data->VoxelizationRenderPass->Unbind();
 	}
 
+	static Vector<VkBufferImageCopy> s_VoxelBrickClearRegions;
+
+	void VulkanVoxelizationPass::ClipmapVoxelizationUpdate(const RenderQueue& renderQueue)
+	{
+		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
+
+		VoxelizationStats& stats = m_Data->Stats;
+		stats.DirtyBricks = 0;
+		stats.DirtyRegions = 0;
+		stats.ScrolledBricks = 0;
+		stats.VoxelizedInstances = 0;
+		stats.VoxelizedTriangles = 0;
+
+		m_Data->ClipmapFrame++;
+
+		UpdateClipmapOrigin(renderQueue);
+		TrackVoxelizedInstances(renderQueue);
+		BuildDirtyRegions();
+
+		UpdateVoxelProjections(m_Data->AlbedoVoxelizationDescriptor[currentFrameIndex], m_Data->VoxelCameraPosition, m_Data->m_VoxelAABB);
+
+		// Nothing has changed, the albedo volume is still valid
+		if (m_Data->DirtyRegions.empty()) return;
+
+		ClearDirtyBricks();
+
+		// Only the instances inside of the volume which overlap a dirty region are voxelized again
+		const SceneVisibility& sceneVisibility = m_RenderPassPipeline->GetSceneVisibility();
+		m_Data->VoxelizedMeshIndices.clear();
+		for (uint32_t queueIndex : sceneVisibility.GetView(m_Data->VoxelVolumeView).VisibleInstances)
+		{
+			const SceneMeshInstance& instance = sceneVisibility.GetInstance(queueIndex);
+			glm::ivec3 voxelMin = Utils::WorldToVolumeVoxel(instance.BoundsMin, m_Data->ClipmapVoxelSize, m_Data->ClipmapOrigin, m_Data->m_VoxelGrid) - 1;
+			glm::ivec3 voxelMax = Utils::WorldToVolumeVoxel(instance.BoundsMax, m_Data->ClipmapVoxelSize, m_Data->ClipmapOrigin, m_Data->m_VoxelGrid) + 2;
+
+			for (const VoxelRegion& region : m_Data->DirtyRegions)
+			{
+				if (glm::all(glm::lessThan(voxelMin, region.Max)) && glm::all(glm::greaterThan(voxelMax, region.Min)))
+				{
+					m_Data->VoxelizedMeshIndices.push_back(queueIndex);
+					break;
+				}
+			}
+		}
+
+		if (!m_Data->VoxelizedMeshIndices.empty())
+		{
+			m_VoxelizationPushConstant.ToroidalOffset = glm::ivec4(m_Data->ToroidalOffset, 1);
+
+			uint64_t triangleCount = VoxelizationPrepareDraws(renderQueue);
+			VoxelizationRecordDraws(renderQueue, m_Data->AlbedoVoxelizationDescriptor[currentFrameIndex]);
+
+			stats.VoxelizedInstances = m_Data->VoxelizedMeshIndices.size();
+			stats.VoxelizedTriangles = triangleCount * m_Data->DirtyRegions.size();
+		}
+
+		std::fill(m_Data->DirtyBricks.begin(), m_Data->DirtyBricks.end(), 0);
+		m_Data->AlbedoVersion++;
+	}
+
+	void VulkanVoxelizationPass::UpdateClipmapOrigin(const RenderQueue& renderQueue)
+	{
+		RendererSettings& rendererSettings = Renderer::GetRendererSettings();
+		int32_t voxelDimensions = m_Data->m_VoxelGrid;
+		int32_t bricksPerAxis = m_Data->BricksPerAxis;
+
+		// Same volume size as without the clipmap
+		float size = Utils::CalculateVoxelVolumeSize(voxelDimensions, rendererSettings.VoxelGI.VoxelSize);
+		float voxelSize = size / float(voxelDimensions);
+
+		glm::ivec3 origin = Utils::CalculateClipmapOrigin(renderQueue.CameraPosition, voxelSize, bricksPerAxis);
+		glm::ivec3 originBrick = origin / s_VoxelBrickSize;
+
+		if (!m_Data->ClipmapValid || voxelSize != m_Data->ClipmapVoxelSize)
+		{
+			// Everything has to be voxelized again
+			std::fill(m_Data->DirtyBricks.begin(), m_Data->DirtyBricks.end(), 1);
+			m_Data->VoxelizedInstances.clear();
+			m_Data->Stats.FullRevoxelizations++;
+			m_Data->ClipmapValid = true;
+		}
+		else if (origin != m_Data->ClipmapOrigin)
+		{
+			// Only the bricks which weren't inside of the old volume are dirty,
+			// the others are still valid since they are stored at the same (wrapped) place
+			glm::ivec3 oldOriginBrick = m_Data->ClipmapOrigin / s_VoxelBrickSize;
+			glm::ivec3 oldEndBrick = oldOriginBrick + bricksPerAxis;
+
+			for (int32_t z = 0; z < bricksPerAxis; z++)
+			{
+				for (int32_t y = 0; y < bricksPerAxis; y++)
+				{
+					for (int32_t x = 0; x < bricksPerAxis; x++)
+					{
+						glm::ivec3 worldBrick = originBrick + glm::ivec3(x, y, z);
+						bool wasInside = glm::all(glm::greaterThanEqual(worldBrick, oldOriginBrick)) && glm::all(glm::lessThan(worldBrick, oldEndBrick));
+						if (!wasInside)
+						{
+							m_Data->DirtyBricks[x + (y + z * bricksPerAxis) * bricksPerAxis] = 1;
+							m_Data->Stats.ScrolledBricks++;
+						}
+					}
+				}
+			}
+		}
+
+		m_Data->ClipmapOrigin = origin;
+		m_Data->ClipmapVoxelSize = voxelSize;
+		for (int32_t axis = 0; axis < 3; axis++)
+			m_Data->ToroidalOffset[axis] = Utils::PositiveModulo(origin[axis], voxelDimensions);
+
+		// Used by the projections, the filter and the cone tracing (same meaning as without the clipmap)
+		m_Data->m_VoxelAABB = size;
+		m_Data->VoxelCameraPosition = (glm::vec3(origin) + float(voxelDimensions) * 0.5f) * voxelSize;
+	}
+
+	void VulkanVoxelizationPass::TrackVoxelizedInstances(const RenderQueue& renderQueue)
+	{
+		uint64_t currentFrame = m_Data->ClipmapFrame;
+
+		// The world bounds are computed by the scene visibility stage
+		const SceneVisibility& sceneVisibility = m_RenderPassPipeline->GetSceneVisibility();
+		for (uint32_t i = 0; i < renderQueue.GetQueueSize(); i++)
+		{
+			const auto& renderData = renderQueue.m_Data[i];
+			const Ref<MeshAsset>& meshAsset = renderData.Mesh->GetMeshAsset();
+			const SceneMeshInstance& sceneInstance = sceneVisibility.GetInstance(i);
+
+			// Instances are identified by their entity and their mesh asset
+			uint64_t instanceKey = Hash::Combine(Hash::Combine(Hash::FNVOffsetBasis, renderData.EntityID), (uint64_t)meshAsset->Handle);
+
+			auto it = m_Data->VoxelizedInstances.find(instanceKey);
+			if (it == m_Data->VoxelizedInstances.end())
+			{
+				// New instance
+				VoxelizedInstance& instance = m_Data->VoxelizedInstances[instanceKey];
+				instance.Transform = renderData.Transform;
+				instance.Bounds = { sceneInstance.BoundsMin, sceneInstance.BoundsMax };
+				MarkDirtyBricks(instance.Bounds.Min, instance.Bounds.Max);
+
+				it = m_Data->VoxelizedInstances.find(instanceKey);
+			}
+			else if (memcmp(&it->second.Transform, &renderData.Transform, sizeof(glm::mat4)) != 0)
+			{
+				// Moved instance, both the old and the new place have to be voxelized again
+				VoxelizedInstance& instance = it->second;
+				MarkDirtyBricks(instance.Bounds.Min, instance.Bounds.Max);
+
+				instance.Transform = renderData.Transform;
+				instance.Bounds = { sceneInstance.BoundsMin, sceneInstance.BoundsMax };
+				MarkDirtyBricks(instance.Bounds.Min, instance.Bounds.Max);
+			}
+
+			it->second.LastSeenFrame = currentFrame;
+		}
+
+		// Removed instances
+		for (auto it = m_Data->VoxelizedInstances.begin(); it != m_Data->VoxelizedInstances.end();)
+		{
+			if (it->second.LastSeenFrame != currentFrame)
+			{
+				MarkDirtyBricks(it->second.Bounds.Min, it->second.Bounds.Max);
+				it = m_Data->VoxelizedInstances.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	void VulkanVoxelizationPass::MarkDirtyBricks(const glm::vec3& worldMin, const glm::vec3& worldMax)
+	{
+		int32_t voxelDimensions = m_Data->m_VoxelGrid;
+		int32_t bricksPerAxis = m_Data->BricksPerAxis;
+
+		// One voxel of margin, for the triangles which are rasterized into the neighbouring voxel
+		glm::ivec3 voxelMin = Utils::WorldToVolumeVoxel(worldMin, m_Data->ClipmapVoxelSize, m_Data->ClipmapOrigin, voxelDimensions) - 1;
+		glm::ivec3 voxelMax = Utils::WorldToVolumeVoxel(worldMax, m_Data->ClipmapVoxelSize, m_Data->ClipmapOrigin, voxelDimensions) + 1;
+
+		// Completely outside of the volume
+		if (glm::any(glm::greaterThanEqual(voxelMin, glm::ivec3(voxelDimensions))) || glm::any(glm::lessThan(voxelMax, glm::ivec3(0))))
+			return;
+
+		glm::ivec3 brickMin = glm::clamp(voxelMin, glm::ivec3(0), glm::ivec3(voxelDimensions - 1)) / s_VoxelBrickSize;
+		glm::ivec3 brickMax = glm::clamp(voxelMax, glm::ivec3(0), glm::ivec3(voxelDimensions - 1)) / s_VoxelBrickSize;
+
+		for (int32_t z = brickMin.z; z <= brickMax.z; z++)
+			for (int32_t y = brickMin.y; y <= brickMax.y; y++)
+				for (int32_t x = brickMin.x; x <= brickMax.x; x++)
+					m_Data->DirtyBricks[x + (y + z * bricksPerAxis) * bricksPerAxis] = 1;
+	}
+
+	void VulkanVoxelizationPass::BuildDirtyRegions()
+	{
+		int32_t bricksPerAxis = m_Data->BricksPerAxis;
+		auto brickIndex = [bricksPerAxis](int32_t x, int32_t y, int32_t z) { return x + (y + z * bricksPerAxis) * bricksPerAxis; };
+
+		Vector<uint8_t>& remainingBricks = m_Data->DirtyBricksScratch;
+		remainingBricks = m_Data->DirtyBricks;
+
+		auto isBoxDirty = [&](const glm::ivec3& min, const glm::ivec3& max)
+		{
+			for (int32_t z = min.z; z < max.z; z++)
+				for (int32_t y = min.y; y < max.y; y++)
+					for (int32_t x = min.x; x < max.x; x++)
+						if (!remainingBricks[brickIndex(x, y, z)]) return false;
+			return true;
+		};
+
+		m_Data->DirtyRegions.clear();
+		uint32_t dirtyBrickCount = 0;
+		glm::ivec3 unionMin = glm::ivec3(bricksPerAxis);
+		glm::ivec3 unionMax = glm::ivec3(0);
+
+		// Greedy merging: a box is grown from the first remaining dirty brick along X, then Y, then Z, while all of its bricks are dirty
+		for (int32_t z = 0; z < bricksPerAxis; z++)
+		{
+			for (int32_t y = 0; y < bricksPerAxis; y++)
+			{
+				for (int32_t x = 0; x < bricksPerAxis; x++)
+				{
+					if (!remainingBricks[brickIndex(x, y, z)]) continue;
+
+					glm::ivec3 min = { x, y, z };
+					glm::ivec3 max = { x + 1, y + 1, z + 1 };
+					while (max.x < bricksPerAxis && remainingBricks[brickIndex(max.x, y, z)]) max.x++;
+					while (max.y < bricksPerAxis && isBoxDirty({ min.x, max.y, min.z }, { max.x, max.y + 1, max.z })) max.y++;
+					while (max.z < bricksPerAxis && isBoxDirty({ min.x, min.y, max.z }, { max.x, max.y, max.z + 1 })) max.z++;
+
+					for (int32_t bz = min.z; bz < max.z; bz++)
+						for (int32_t by = min.y; by < max.y; by++)
+							for (int32_t bx = min.x; bx < max.x; bx++)
+								remainingBricks[brickIndex(bx, by, bz)] = 0;
+
+					glm::ivec3 brickCount = max - min;
+					dirtyBrickCount += brickCount.x * brickCount.y * brickCount.z;
+					unionMin = glm::min(unionMin, min);
+					unionMax = glm::max(unionMax, max);
+
+					m_Data->DirtyRegions.push_back({ min * s_VoxelBrickSize, max * s_VoxelBrickSize });
+				}
+			}
+		}
+
+		// Too many regions, every region costs a pass over the overlapping instances
+		if (m_Data->DirtyRegions.size() > s_MaxVoxelDirtyRegions)
+		{
+			for (int32_t z = unionMin.z; z < unionMax.z; z++)
+				for (int32_t y = unionMin.y; y < unionMax.y; y++)
+					for (int32_t x = unionMin.x; x < unionMax.x; x++)
+						m_Data->DirtyBricks[brickIndex(x, y, z)] = 1;
+
+			glm::ivec3 brickCount = unionMax - unionMin;
+			dirtyBrickCount = brickCount.x * brickCount.y * brickCount.z;
+
+			m_Data->DirtyRegions.clear();
+			m_Data->DirtyRegions.push_back({ unionMin * s_VoxelBrickSize, unionMax * s_VoxelBrickSize });
+		}
+
+		m_Data->Stats.DirtyBricks = dirtyBrickCount;
+		m_Data->Stats.DirtyRegions = m_Data->DirtyRegions.size();
+	}
+
+	void VulkanVoxelizationPass::ClearDirtyBricks()
+	{
+		uint32_t currentFrameIndex = VulkanContext::GetSwapChain()->GetCurrentFrameIndex();
+		VkCommandBuffer cmdBuf = VulkanContext::GetSwapChain()->GetRenderCommandBuffer(currentFrameIndex);
+		int32_t voxelDimensions = m_Data->m_VoxelGrid;
+		int32_t bricksPerAxis = m_Data->BricksPerAxis;
+
+		// One copy region per brick, since the bricks of a region aren't always next to each other in the (wrapped) texture
+		s_VoxelBrickClearRegions.clear();
+		for (int32_t z = 0; z < bricksPerAxis; z++)
+		{
+			for (int32_t y = 0; y < bricksPerAxis; y++)
+			{
+				for (int32_t x = 0; x < bricksPerAxis; x++)
+				{
+					if (!m_Data->DirtyBricks[x + (y + z * bricksPerAxis) * bricksPerAxis]) continue;
+
+					glm::ivec3 texelOffset = (glm::ivec3(x, y, z) * s_VoxelBrickSize + m_Data->ToroidalOffset) % voxelDimensions;
+
+					VkBufferImageCopy& region = s_VoxelBrickClearRegions.emplace_back();
+					region.bufferOffset = 0;
+					region.bufferRowLength = 0;
+					region.bufferImageHeight = 0;
+
+					region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+					region.imageSubresource.mipLevel = 0;
+					region.imageSubresource.layerCount = 1;
+					region.imageSubresource.baseArrayLayer = 0;
+
+					region.imageOffset = { texelOffset.x, texelOffset.y, texelOffset.z };
+					region.imageExtent = { (uint32_t)s_VoxelBrickSize, (uint32_t)s_VoxelBrickSize, (uint32_t)s_VoxelBrickSize };
+				}
+			}
+		}
+
+		Ref<VulkanTexture3D> albedoTexture = m_Data->AlbedoVoxelTexture.As<VulkanTexture3D>();
+		Ref<VulkanBufferDevice> zeroBrickBuffer = m_Data->ZeroBrickBuffer.As<VulkanBufferDevice>();
+
+		VkImageSubresourceRange imageSubrange{};
+		imageSubrange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		imageSubrange.baseArrayLayer = 0;
+		imageSubrange.baseMipLevel = 0;
+		imageSubrange.layerCount = 1;
+		imageSubrange.levelCount = 1;
+
+		// The albedo volume always stays in the general layout, so only the previous voxelization/filter passes have to be waited for
+		Utils::InsertImageMemoryBarrier(cmdBuf, albedoTexture->GetVulkanImage(),
+			VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+			albedoTexture->GetVulkanImageLayout(), albedoTexture->GetVulkanImageLayout(),
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+			imageSubrange
+		);
+
+		vkCmdCopyBufferToImage(cmdBuf, zeroBrickBuffer->GetVulkanBuffer(), albedoTexture->GetVulkanImage(), albedoTexture->GetVulkanImageLayout(),
+			(uint32_t)s_VoxelBrickClearRegions.size(), s_VoxelBrickClearRegions.data());
+
+		Utils::InsertImageMemoryBarrier(cmdBuf, albedoTexture->GetVulkanImage(),
+			VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+			albedoTexture->GetVulkanImageLayout(), albedoTexture->GetVulkanImageLayout(),
+			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			imageSubrange
+		);
+	}
+
 	void VulkanVoxelizationPass::VoxelFilterUpdate(const RenderQueue& renderQueue)
 	{
 		// Getting all the needed information
@@ -824,9 +1305,41 @@ namespace Frost
 		Ref<VulkanMaterial> vulkanDescriptor = m_Data->VoxelFilterDescriptor[currentFrameIndex].As<VulkanMaterial>();
 		Ref<VulkanComputePipeline> vulkanPipeline = m_Data->VoxelFilterPipeline.As<VulkanComputePipeline>();
 
+		// With the clipmap, mip 0 is lit from the (wrapped) albedo volume instead of being lit in place
+		bool useClipmap = rendererSettings.VoxelGI.UseClipmapVoxelization;
+		Ref<VulkanTexture3D> albedoTexture = m_Data->AlbedoVoxelTexture.As<VulkanTexture3D>();
+
+		// Shadow Cascades data neede for the shader
+		auto shadowPassInternalData = m_RenderPassPipeline->GetRenderPassData<VulkanShadowPass>();
+
+		// The lit volume of this frame only has to be filtered again when something it depends on has changed
+		m_Data->Stats.FilterSkipped = false;
+		if (useClipmap)
+		{
+			uint64_t filterInputHash = Hash::Combine(Hash::FNVOffsetBasis, m_Data->AlbedoVersion);
+			filterInputHash = Hash::Combine(filterInputHash, m_Data->VoxelCameraPosition);
+			filterInputHash = Hash::Combine(filterInputHash, m_Data->ClipmapVoxelSize);
+			filterInputHash = Hash::Combine(filterInputHash, renderQueue.CameraViewMatrix);
+			filterInputHash = Hash::Combine(filterInputHash, shadowPassInternalData->CascadeViewProjMatrix);
+			filterInputHash = Hash::Combine(filterInputHash, shadowPassInternalData->CascadeDepthSplit);
+			filterInputHash = Hash::Combine(filterInputHash, renderQueue.m_LightData.DirLight.Specification.Intensity);
+
+			if (m_Data->FilterInputHash[currentFrameIndex] == filterInputHash)
+			{
+				m_Data->Stats.FilterSkipped = true;
+				return;
+			}
+			m_Data->FilterInputHash[currentFrameIndex] = filterInputHash;
+		}
+		else
+		{
+			m_Data->FilterInputHash[currentFrameIndex] = 0;
+		}
+
 
 		m_VoxelFilterPushConstant.ProjectionExtents = m_Data->m_VoxelAABB / 2.0f;
-		m_VoxelFilterPushConstant.VoxelScale = rendererSettings.VoxelGI.VoxelSize;
+		m_VoxelFilterPushConstant.VoxelScale = useClipmap ? m_Data->ClipmapVoxelSize : rendererSettings.VoxelGI.VoxelSize;
+		m_VoxelFilterPushConstant.ToroidalOffset = useClipmap ? glm::ivec4(m_Data->ToroidalOffset, 1) : glm::ivec4(0);
 
 		m_VoxelFilterPushConstant.CameraPosition_SampleMipLevel = glm::vec4(m_Data->VoxelCameraPosition, 1.0f);
 		m_VoxelFilterPushConstant.CameraViewMatrix = renderQueue.CameraViewMatrix;
@@ -836,13 +1349,27 @@ namespace Frost
 		Ref<VulkanTexture3D> vulkanVoxelTexture = m_Data->VoxelizationTexture[currentFrameIndex].As<VulkanTexture3D>();
 		vulkanVoxelTexture->TransitionLayout(cmdBuf, vulkanVoxelTexture->GetVulkanImageLayout(), VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
 
+		if (useClipmap)
+		{
+			VkImageSubresourceRange imageSubrange{};
+			imageSubrange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			imageSubrange.baseArrayLayer = 0;
+			imageSubrange.baseMipLevel = 0;
+			imageSubrange.layerCount = 1;
+			imageSubrange.levelCount = 1;
+
+			Utils::InsertImageMemoryBarrier(cmdBuf, albedoTexture->GetVulkanImage(),
+				VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+				albedoTexture->GetVulkanImageLayout(), albedoTexture->GetVulkanImageLayout(),
+				VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				imageSubrange
+			);
+		}
+
 		// Making a barrier to be sure that the shadow pass has been finished
 		Ref<VulkanImage2D> shadowDepthTexture = m_RenderPassPipeline->GetRenderPassData<VulkanShadowPass>()->ShadowDepthRenderPass->GetDepthAttachment(currentFrameIndex).As<VulkanImage2D>();
 		shadowDepthTexture->TransitionLayout(cmdBuf, shadowDepthTexture->GetVulkanImageLayout(), VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
 
-		// Shadow Cascades data neede for the shader
-		auto shadowPassInternalData = m_RenderPassPipeline->GetRenderPassData<VulkanShadowPass>();
-
 		glm::vec4 cascadeDepthSplit = {
 			shadowPassInternalData->CascadeDepthSplit[0],
 			shadowPassInternalData->CascadeDepthSplit[1],
@@ -883,6 +1410,13 @@ namespace Frost
 				imageInfo.imageView = vulkanVoxelTexture->GetVulkanImageViewMip(sampleMip);
 				imageInfo.sampler = vulkanVoxelTexture->GetVulkanSampler();
 
+				if (useClipmap && mip == 0)
+				{
+					imageInfo.imageLayout = albedoTexture->GetVulkanImageLayout();
+					imageInfo.imageView = albedoTexture->GetVulkanImageView();
+					imageInfo.sampler = albedoTexture->GetVulkanSampler();
+				}
+
 				VkWriteDescriptorSet writeDescriptorSet{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
 				writeDescriptorSet.dstBinding = 1;
 				writeDescriptorSet.dstArrayElement = 0;
@@ -1023,6 +1557,16 @@ namespace Frost
 			ImGui::Separator();
 			ImGui::SliderInt("Atomic Operation (bool)", &m_VoxelizationPushConstant.AtomicOperation, 0, 1);
 			ImGui::DragFloat("Voxel Size", &rendererSettings.VoxelGI.VoxelSize, 0.25f, 0.5f, 2.0f);
+			ImGui::SliderInt("Clipmap Voxelization (bool)", &rendererSettings.VoxelGI.UseClipmapVoxelization, 0, 1);
+			if (ImGui::Button("Revoxelize"))
+				m_Data->ClipmapValid = false; // Material changes are not tracked
+
+			const VoxelizationStats& stats = m_Data->Stats;
+			ImGui::Text("Dirty Bricks: %d (%d regions, %d scrolled)", stats.DirtyBricks, stats.DirtyRegions, stats.ScrolledBricks);
+			ImGui::Text("Voxelized Instances: %d", stats.VoxelizedInstances);
+			ImGui::Text("Voxelized Triangles: %llu", stats.VoxelizedTriangles);
+			ImGui::Text("Full Revoxelizations: %d", stats.FullRevoxelizations);
+			ImGui::Text("Filter Skipped: %s", stats.FilterSkipped ? "Yes" : "No");
 			//ImGui::SliderInt("Cone Tracing Max Steps", &m_VCTPushConstant.ConeTraceMaxSteps, 0, 200);
 			//ImGui::DragFloat("Cone Tracing Max Distance", &m_VCTPushConstant.ConeTraceMaxDistance, 0.01f, 0, 1000);
 			ImGui::Separator();
@@ -1064,8 +1608,9 @@ namespace Frost
 		{
 			vkDestroyImageView(device, voxelTextureImageView, nullptr);
 		}
+		vkDestroyImageView(device, m_Data->AlbedoVoxelTexture_R32UI, nullptr);
 
 		delete m_Data;
 	}
 
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -8,14 +8,31 @@ typedef struct VkImageView_T* VkImageView;
 namespace Frost
 {
 
+	// The scene is voxelized into a camera centered clipmap (`UseClipmapVoxelization`), which is kept between frames.
+	// The volume is split into bricks and only the dirty ones are cleared and revoxelized: the bricks touched by instances
+	// which were added/moved/removed, and the slabs uncovered when the clipmap scrolls with the camera.
+	// The albedo volume is addressed toroidally (wrapped by the clipmap origin), so scrolling never has to move the old voxels.
+	// The lighting/mip filter then writes the lit (not wrapped) volume of the current frame, which is what cone tracing samples.
 	class VulkanVoxelizationPass : public SceneRenderPass
 	{
 	public:
+		struct VoxelizationStats
+		{
+			uint32_t DirtyBricks = 0;         // Bricks cleared and revoxelized this frame
+			uint32_t DirtyRegions = 0;        // Boxes which the dirty bricks were merged into
+			uint32_t ScrolledBricks = 0;      // Bricks uncovered by the clipmap moving with the camera this frame
+			uint32_t VoxelizedInstances = 0;  // Instances drawn into the voxel volume this frame
+			uint64_t VoxelizedTriangles = 0;  // Triangles rasterized into the voxel volume this frame
+			uint32_t FullRevoxelizations = 0; // Since startup
+			bool FilterSkipped = false;       // The lit volume was still up to date, so the filter didn't run
+		};
+
 		VulkanVoxelizationPass();
 		virtual ~VulkanVoxelizationPass();
 
 		virtual void Init(SceneRenderPassPipeline* renderPassPipeline) override;
 		virtual void InitLate() override;
+		virtual void OnRegisterViews(const RenderQueue& renderQueue, SceneVisibility& sceneVisibility) override;
 		virtual void OnUpdate(const RenderQueue& renderQueue) override;
 		virtual void OnRenderDebug() override;
 		virtual void OnResize(uint32_t width, uint32_t height) override;
@@ -32,6 +49,19 @@ namespace Frost
 		void VoxelizationUpdateData(const RenderQueue& renderQueue);
 		void VoxelizationUpdateRendering(const RenderQueue& renderQueue);
 		void VoxelizationUpdateRenderingWithInstancing(const RenderQueue& renderQueue);
+		void UpdateVoxelProjections(const Ref<Material>& descriptor, const glm::vec3& center, float size);
+		uint64_t VoxelizationPrepareDraws(const RenderQueue& renderQueue); // Returns the triangle count of one pass over `VoxelizedMeshIndices`
+		void VoxelizationRecordDraws(const RenderQueue& renderQueue, const Ref<Material>& descriptor);
+		// -------------------------------------------------------
+
+		// ------------ Clipmap voxelization ---------------------
+		void ClipmapVoxelizationInit();
+		void ClipmapVoxelizationUpdate(const RenderQueue& renderQueue);
+		void UpdateClipmapOrigin(const RenderQueue& renderQueue);
+		void TrackVoxelizedInstances(const RenderQueue& renderQueue);
+		void MarkDirtyBricks(const glm::vec3& worldMin, const glm::vec3& worldMax);
+		void BuildDirtyRegions();
+		void ClearDirtyBricks();
 		// -------------------------------------------------------
 
 		// ------------ Voxel texture filtering ------------------
@@ -54,10 +84,28 @@ namespace Frost
 		struct MeshInstancedVertexBuffer // `MeshInstancedVertexBuffer` For Geometry Pass
 		{
 			glm::mat4 ModelSpaceMatrix;
-			glm::mat4 WorldSpaceMatrix;
 			uint32_t MaterialIndexOffset;
 		};
 
+		struct VoxelRegion // In voxels of the (not wrapped) volume, `Max` is exclusive
+		{
+			glm::ivec3 Min;
+			glm::ivec3 Max;
+		};
+
+		struct VoxelBounds // World space AABB
+		{
+			glm::vec3 Min;
+			glm::vec3 Max;
+		};
+
+		struct VoxelizedInstance
+		{
+			glm::mat4 Transform;
+			VoxelBounds Bounds;
+			uint64_t LastSeenFrame;
+		};
+
 		struct InternalData
 		{
 			Ref<Shader> VoxelizationShader;
@@ -79,7 +127,7 @@ namespace Frost
 			Vector<Ref<Image2D>> VCT_IndirectSpecularTexture;
 
 
-			Ref<BufferDevice> ClearBuffer;
+			Ref<BufferDevice> ClearBuffer; // Only created when the clipmap is disabled (the whole volume is cleared every frame)
 			Vector<HeapBlock> IndirectVoxelCmdBuffer;
 
 			// Global Instaced Vertex Buffer
@@ -89,6 +137,34 @@ namespace Frost
 			int32_t m_VoxelGrid; // Renderer::GetRendererConfig().VoxelTextureResolution
 			glm::vec3 VoxelCameraPosition = { 0.0f, 0.0f, 0.0f }; // Camera position
 			float m_VoxelAABB = 0.0f; // Rounded value of 'm_VoxelGrid' to fixed jittering
+
+			// Indices (into the render queue) of the instances which are voxelized this frame
+			Vector<uint32_t> VoxelizedMeshIndices;
+			uint32_t VoxelVolumeView = UINT32_MAX; // Scene visibility view of the voxel volume (registered every frame)
+
+			// Clipmap voxelization
+			Ref<Texture3D> AlbedoVoxelTexture; // Unlit voxels, kept between frames (addressed toroidally)
+			VkImageView AlbedoVoxelTexture_R32UI = nullptr;
+			Vector<Ref<Material>> AlbedoVoxelizationDescriptor;
+			Ref<BufferDevice> ZeroBrickBuffer; // One brick of zeros, copied into the dirty bricks to clear them
+
+			glm::ivec3 ClipmapOrigin = { 0, 0, 0 }; // World voxel coordinate of the volume's min corner (multiple of the brick size)
+			glm::ivec3 ToroidalOffset = { 0, 0, 0 }; // `ClipmapOrigin` wrapped into the volume
+			float ClipmapVoxelSize = 0.0f;
+			bool ClipmapValid = false; // False when the whole volume has to be revoxelized
+
+			int32_t BricksPerAxis = 0;
+			Vector<uint8_t> DirtyBricks; // One flag per brick of the (not wrapped) volume
+			Vector<uint8_t> DirtyBricksScratch;
+			Vector<VoxelRegion> DirtyRegions;
+
+			HashMap<uint64_t, VoxelizedInstance> VoxelizedInstances;
+			uint64_t ClipmapFrame = 0;
+
+			uint64_t AlbedoVersion = 0; // Incremented every time the albedo volume is modified
+			Vector<uint64_t> FilterInputHash; // Per frame in flight, the lit volume is only filtered again when its inputs changed
+
+			VoxelizationStats Stats;
 		};
 
 		struct VoxelProjections
@@ -106,6 +182,10 @@ namespace Frost
 			uint64_t VertexBufferBDA;
 			int32_t VoxelDimensions;
 			int32_t AtomicOperation = 1;
+
+			glm::ivec4 ToroidalOffset; // .w = whether the volume is addressed toroidally
+			glm::ivec4 RegionMin;
+			glm::ivec4 RegionMax;
 		} m_VoxelizationPushConstant;
 
 		struct VCTPushConstant
@@ -130,6 +210,7 @@ namespace Frost
 			glm::mat4 CameraViewMatrix;
 
 			glm::vec4 CameraPosition_SampleMipLevel;
+			glm::ivec4 ToroidalOffset; // .w = whether mip 0 is read from the (wrapped) albedo volume
 
 			float ProjectionExtents;
 			float VoxelScale;
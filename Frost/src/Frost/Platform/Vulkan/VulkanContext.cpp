@@ -3,6 +3,7 @@
 
 #include "Frost/Platform/Vulkan/Buffers/VulkanBufferAllocator.h"
 #include "Frost/Platform/Vulkan/VulkanBindlessAllocator.h"
+#include "Frost/Platform/Vulkan/RayTracing/VulkanAccelerationStructureBuilder.h"
 #include "Frost/Renderer/Renderer.h"
 
 #include "Frost/Platform/Vulkan/Internal/VulkanExtensions.h"
@@ -45,6 +46,8 @@ namespace Frost
 	VulkanContext::~VulkanContext()
 	{
 		VulkanBindlessAllocator::ShutDown();
+		VulkanAccelerationStructureBuilder::ShutDown();
+		VulkanUploadManager::ShutDown();
 		VulkanAllocator::ShutDown();
 		m_SwapChain->Destroy();
 
@@ -78,6 +81,10 @@ namespace Frost
 
 		m_SwapChain = CreateScope<VulkanSwapChain>(m_Window);
 		VulkanAllocator::Init();
+		VulkanUploadManager::Init(Renderer::GetRendererConfig().StagingRingSize);
+#if FROST_SUPPORT_RAY_TRACING
+		VulkanAccelerationStructureBuilder::Init();
+#endif
 		BindlessAllocator::Init();
 	}
 
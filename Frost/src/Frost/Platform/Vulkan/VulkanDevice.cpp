@@ -3,6 +3,7 @@
 #include "Frost/Core/Engine.h"
 
 #include "VulkanContext.h"
+#include "Buffers/VulkanUploadManager.h"
 
 namespace Frost
 {
@@ -424,6 +425,9 @@ namespace Frost
 		VkQueue graphicsQueue = VulkanContext::GetCurrentDevice()->GetQueueFamilies().GraphicsFamily.Queue;
 		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
 
+		// The command buffer might use buffers whose uploads are still recorded in the open batch, so they have to be submitted first
+		VulkanUploadManager::Flush();
+
 		vkEndCommandBuffer(commandBuffer);
 
 		VkSubmitInfo submitInfo{};
@@ -3,6 +3,7 @@
 
 #include "VulkanContext.h"
 #include "Frost/Platform/Vulkan/VulkanRenderer.h"
+#include "Frost/Core/FrameAllocator.h"
 
 //#include <dds.hpp>
 #include <compressonator.h>
@@ -516,6 +517,15 @@ namespace Frost
 	}
 
 	void VulkanImage2D::CopyImage(VkCommandBuffer cmdBuf, const Ref<Image2D>& srcImage)
+	{
+		VkImageCopy imageCopyRegion{};
+		imageCopyRegion.extent.width = srcImage->GetWidth();
+		imageCopyRegion.extent.height = srcImage->GetHeight();
+		imageCopyRegion.extent.depth = 1;
+		CopyImage(cmdBuf, srcImage, &imageCopyRegion, 1);
+	}
+
+	void VulkanImage2D::CopyImage(VkCommandBuffer cmdBuf, const Ref<Image2D>& srcImage, const VkImageCopy* regions, uint32_t regionCount)
 	{
 		VkImageAspectFlags imageAspectMask{};
 		switch (m_ImageSpecification.Format)
@@ -543,8 +553,6 @@ namespace Frost
 		// #SOURCE
 		// Getting all the information neccesary
 		Ref<VulkanImage2D> vulkanSrcImage = srcImage.As<VulkanImage2D>();
-		int32_t blitImageWidth = vulkanSrcImage->m_ImageSpecification.Width;
-		int32_t blitImageHeight = vulkanSrcImage->m_ImageSpecification.Height;
 		VkImage vulkanSrcRawImage = vulkanSrcImage->GetVulkanImage();
 		VkImageLayout initialSrcImageLayout = vulkanSrcImage->GetVulkanImageLayout();
 
@@ -577,19 +585,20 @@ namespace Frost
 
 
 		// Otherwise use image copy (requires us to manually flip components)
-		VkImageCopy imageCopyRegion{};
-		imageCopyRegion.srcSubresource.aspectMask = imageAspectMask;
-		imageCopyRegion.srcSubresource.layerCount = 1;
-		imageCopyRegion.dstSubresource.aspectMask = imageAspectMask;
-		imageCopyRegion.dstSubresource.layerCount = 1;
-		imageCopyRegion.extent.width = blitImageWidth;
-		imageCopyRegion.extent.height = blitImageHeight;
-		imageCopyRegion.extent.depth = 1;
+		// The subresources are filled in here, so the callers only have to set the offsets and extents
+		FrameVector<VkImageCopy> imageCopyRegions(regions, regions + regionCount);
+		for (VkImageCopy& imageCopyRegion : imageCopyRegions)
+		{
+			imageCopyRegion.srcSubresource.aspectMask = imageAspectMask;
+			imageCopyRegion.srcSubresource.layerCount = 1;
+			imageCopyRegion.dstSubresource.aspectMask = imageAspectMask;
+			imageCopyRegion.dstSubresource.layerCount = 1;
+		}
 
 		vkCmdCopyImage(cmdBuf,
 			vulkanSrcRawImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
 			m_Image,           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-			1, &imageCopyRegion
+			regionCount, imageCopyRegions.data()
 		);
 
 
@@ -953,6 +962,7 @@ namespace Frost
 				case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:             return VK_ACCESS_TRANSFER_WRITE_BIT;
 				case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:             return VK_ACCESS_TRANSFER_READ_BIT;
 				case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:         return VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+				case VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_STENCIL_READ_ONLY_OPTIMAL:
 				case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL: return VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
 				case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:         return VK_ACCESS_SHADER_READ_BIT;
 			}
@@ -977,7 +987,8 @@ namespace Frost
 				case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
 				case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:             return VK_PIPELINE_STAGE_TRANSFER_BIT;
 				case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:         return VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-				case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL: return VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+				case VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_STENCIL_READ_ONLY_OPTIMAL:
+				case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL: return VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
 				case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:         return VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
 				case VK_IMAGE_LAYOUT_PREINITIALIZED:                   return VK_PIPELINE_STAGE_HOST_BIT;
 				case VK_IMAGE_LAYOUT_UNDEFINED:                        return VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
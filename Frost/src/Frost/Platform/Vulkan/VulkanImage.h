@@ -26,6 +26,7 @@ namespace Frost
 		void GenerateMipMaps(VkCommandBuffer cmdBuffer, VkImageLayout newImageLayout);
 		void BlitImage(VkCommandBuffer cmdBuf, const Ref<Image2D>& srcImage, uint32_t mipLevel = 0);
 		void CopyImage(VkCommandBuffer cmdBuf, const Ref<Image2D>& srcImage);
+		void CopyImage(VkCommandBuffer cmdBuf, const Ref<Image2D>& srcImage, const VkImageCopy* regions, uint32_t regionCount); // Only the given (mip 0) regions
 
 		void MapMemory(void** data);
 		void UnMapMemory();
@@ -5,6 +5,7 @@
 #include "Frost/Platform/Vulkan/VulkanMaterial.h"
 #include "Frost/Platform/Vulkan/VulkanRenderPass.h"
 #include "Frost/Platform/Vulkan/VulkanFramebuffer.h"
+#include "Frost/Platform/Vulkan/VulkanPipelineCache.h"
 
 #include "Frost/Platform/Vulkan/VulkanContext.h"
 #include "Frost/Platform/Vulkan/Buffers/VulkanBufferLayout.h"
@@ -226,7 +227,14 @@ namespace Frost
 			rasterizer.pNext = &conservativeRasterStateCI;
 		}
 
-		FROST_VKCHECK(vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_Pipeline));
+		VulkanPipelineCache::CreationFeedback creationFeedback;
+		pipelineInfo.pNext = &creationFeedback.CreateInfo;
+
+		auto creationStartTime = std::chrono::high_resolution_clock::now();
+		FROST_VKCHECK(vkCreateGraphicsPipelines(device, VulkanPipelineCache::GetVulkanPipelineCache(), 1, &pipelineInfo, nullptr, &m_Pipeline));
+		float creationTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - creationStartTime).count();
+
+		VulkanPipelineCache::OnPipelineCreated(creationFeedback, creationTime);
 		VulkanContext::SetStructDebugName("Pipeline", VK_OBJECT_TYPE_PIPELINE, m_Pipeline);
 	}
 
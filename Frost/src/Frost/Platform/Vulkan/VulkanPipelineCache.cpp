@@ -0,0 +1,232 @@
+#include "frostpch.h"
+#include "VulkanPipelineCache.h"
+
+#include "Frost/Platform/Vulkan/VulkanContext.h"
+#include "Frost/Project/Project.h"
+#include "Frost/Utils/FileSystem.h"
+#include "Frost/Utils/Hash.h"
+
+#include <iomanip>
+
+namespace Frost
+{
+	namespace Utils
+	{
+		static std::filesystem::path GetPipelineCacheDirectory()
+		{
+			return Project::GetProjectDirectory() / std::filesystem::path("Resources/Cache/Pipelines");
+		}
+
+		// One file per GPU, so switching between GPUs doesn't throw away the cache of the other one
+		static std::filesystem::path GetPipelineCacheFilepath(const VkPhysicalDeviceProperties& properties)
+		{
+			std::stringstream ss;
+			ss << std::hex << std::setw(4) << std::setfill('0') << properties.vendorID << "_"
+			               << std::setw(8) << std::setfill('0') << properties.deviceID;
+			return GetPipelineCacheDirectory() / (ss.str() + ".fpc"); // fpc - Frost Pipeline Cache
+		}
+	}
+
+	// Bump it when the file layout changes, so old files are ignored
+	static constexpr uint32_t s_PipelineCacheVersion = 1;
+	static constexpr uint32_t s_PipelineCacheMagic = 0x30435046; // "FPC0"
+
+	struct PipelineCacheFileHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t VendorID;
+		uint32_t DeviceID;
+		uint32_t DriverVersion;
+		uint8_t PipelineCacheUUID[VK_UUID_SIZE];
+		uint32_t Padding;
+		uint64_t DataSize;
+		uint64_t DataHash;
+	};
+
+	struct PipelineCacheData
+	{
+		VkPipelineCache PipelineCache = VK_NULL_HANDLE;
+		VkPhysicalDeviceProperties DeviceProperties{};
+		VulkanPipelineCache::Stats Stats;
+	};
+	static PipelineCacheData* s_Data = nullptr;
+
+	VulkanPipelineCache::CreationFeedback::CreationFeedback()
+	{
+		CreateInfo.pPipelineCreationFeedback = &Feedback;
+		CreateInfo.pipelineStageCreationFeedbackCount = 0;
+		CreateInfo.pPipelineStageCreationFeedbacks = nullptr;
+	}
+
+	void VulkanPipelineCache::Init()
+	{
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+		VkPhysicalDevice physicalDevice = VulkanContext::GetCurrentDevice()->GetPhysicalDevice();
+
+		s_Data = new PipelineCacheData();
+		vkGetPhysicalDeviceProperties(physicalDevice, &s_Data->DeviceProperties);
+		const VkPhysicalDeviceProperties& properties = s_Data->DeviceProperties;
+
+		Buffer cacheBuffer;
+		std::filesystem::path cacheFilepath = Utils::GetPipelineCacheFilepath(properties);
+		if (FileSystem::Exists(cacheFilepath))
+		{
+			std::error_code errorCode;
+			if (std::filesystem::file_size(cacheFilepath, errorCode) > sizeof(PipelineCacheFileHeader) && !errorCode)
+				cacheBuffer = FileSystem::ReadBytes(cacheFilepath);
+		}
+
+		// Validate the file against the current GPU/driver, before giving anything to the driver
+		// (drivers should reject incompatible data by themselves, but not all of them are robust against it)
+		bool isValid = false;
+		if (cacheBuffer)
+		{
+			PipelineCacheFileHeader header = cacheBuffer.Read<PipelineCacheFileHeader>(0);
+			const Byte* data = (Byte*)cacheBuffer.Data + sizeof(PipelineCacheFileHeader);
+
+			isValid = header.Magic == s_PipelineCacheMagic &&
+			          header.Version == s_PipelineCacheVersion &&
+			          header.VendorID == properties.vendorID &&
+			          header.DeviceID == properties.deviceID &&
+			          header.DriverVersion == properties.driverVersion &&
+			          memcmp(header.PipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0 &&
+			          header.DataSize == cacheBuffer.Size - sizeof(PipelineCacheFileHeader) &&
+			          header.DataSize >= sizeof(VkPipelineCacheHeaderVersionOne) &&
+			          header.DataHash == Hash::GenerateFNVHash(data, header.DataSize);
+
+			// The data also starts with the header written by the driver, check it as well
+			if (isValid)
+			{
+				VkPipelineCacheHeaderVersionOne driverHeader;
+				memcpy(&driverHeader, data, sizeof(VkPipelineCacheHeaderVersionOne));
+
+				isValid = driverHeader.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+				          driverHeader.vendorID == properties.vendorID &&
+				          driverHeader.deviceID == properties.deviceID &&
+				          memcmp(driverHeader.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+			}
+
+			if (!isValid)
+				FROST_CORE_WARN("[PipelineCache] Pipeline cache '{0}' is corrupted or was made by another GPU/driver, ignoring it", cacheFilepath.string());
+		}
+
+		VkPipelineCacheCreateInfo pipelineCacheCreateInfo{ VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+		if (isValid)
+		{
+			pipelineCacheCreateInfo.initialDataSize = cacheBuffer.Size - sizeof(PipelineCacheFileHeader);
+			pipelineCacheCreateInfo.pInitialData = (Byte*)cacheBuffer.Data + sizeof(PipelineCacheFileHeader);
+		}
+
+		// If the driver still refuses the data, start with an empty cache
+		if (vkCreatePipelineCache(device, &pipelineCacheCreateInfo, nullptr, &s_Data->PipelineCache) != VK_SUCCESS)
+		{
+			FROST_CORE_WARN("[PipelineCache] The driver refused the pipeline cache '{0}', starting with an empty one", cacheFilepath.string());
+			isValid = false;
+			pipelineCacheCreateInfo.initialDataSize = 0;
+			pipelineCacheCreateInfo.pInitialData = nullptr;
+			FROST_VKCHECK(vkCreatePipelineCache(device, &pipelineCacheCreateInfo, nullptr, &s_Data->PipelineCache));
+		}
+		VulkanContext::SetStructDebugName("PipelineCache", VK_OBJECT_TYPE_PIPELINE_CACHE, s_Data->PipelineCache);
+
+		s_Data->Stats.LoadedFromDisk = isValid;
+		s_Data->Stats.LoadedSize = pipelineCacheCreateInfo.initialDataSize;
+		cacheBuffer.Release();
+	}
+
+	void VulkanPipelineCache::ShutDown()
+	{
+		if (!s_Data) return;
+
+		Save();
+
+		const Stats& stats = s_Data->Stats;
+		FROST_CORE_INFO("[PipelineCache] {0} pipelines created in {1} ms ({2} cache hits, {3} misses)",
+			stats.CreatedPipelines, stats.CreationTime, stats.CacheHits, stats.CacheMisses);
+
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+		vkDestroyPipelineCache(device, s_Data->PipelineCache, nullptr);
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	void VulkanPipelineCache::Save()
+	{
+		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
+
+		size_t dataSize = 0;
+		if (vkGetPipelineCacheData(device, s_Data->PipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0)
+			return;
+
+		Vector<Byte> data(sizeof(PipelineCacheFileHeader) + dataSize);
+		if (vkGetPipelineCacheData(device, s_Data->PipelineCache, &dataSize, data.data() + sizeof(PipelineCacheFileHeader)) != VK_SUCCESS)
+		{
+			FROST_CORE_ERROR("[PipelineCache] Failed to get the pipeline cache data from the driver");
+			return;
+		}
+		data.resize(sizeof(PipelineCacheFileHeader) + dataSize);
+
+		const VkPhysicalDeviceProperties& properties = s_Data->DeviceProperties;
+
+		PipelineCacheFileHeader header{};
+		header.Magic = s_PipelineCacheMagic;
+		header.Version = s_PipelineCacheVersion;
+		header.VendorID = properties.vendorID;
+		header.DeviceID = properties.deviceID;
+		header.DriverVersion = properties.driverVersion;
+		memcpy(header.PipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+		header.DataSize = dataSize;
+		header.DataHash = Hash::GenerateFNVHash(data.data() + sizeof(PipelineCacheFileHeader), dataSize);
+		memcpy(data.data(), &header, sizeof(PipelineCacheFileHeader));
+
+		std::filesystem::path cacheDirectory = Utils::GetPipelineCacheDirectory();
+		if (!std::filesystem::exists(cacheDirectory))
+			std::filesystem::create_directories(cacheDirectory);
+
+		// Write into a temporary file first, so a crash while writing can't leave a half written cache behind
+		std::filesystem::path cacheFilepath = Utils::GetPipelineCacheFilepath(properties);
+		std::filesystem::path tempFilepath = cacheFilepath.string() + ".tmp";
+		bool success = FileSystem::WriteBytes(tempFilepath, Buffer(data.data(), static_cast<uint32_t>(data.size())));
+
+		std::error_code errorCode;
+		if (success)
+			std::filesystem::rename(tempFilepath, cacheFilepath, errorCode);
+
+		if (!success || errorCode)
+		{
+			FROST_CORE_ERROR("[PipelineCache] Failed to write the pipeline cache '{0}'", cacheFilepath.string());
+			std::filesystem::remove(tempFilepath, errorCode);
+		}
+	}
+
+	VkPipelineCache VulkanPipelineCache::GetVulkanPipelineCache()
+	{
+		return s_Data ? s_Data->PipelineCache : VK_NULL_HANDLE;
+	}
+
+	void VulkanPipelineCache::OnPipelineCreated(const CreationFeedback& creationFeedback, float creationTime)
+	{
+		if (!s_Data) return;
+
+		Stats& stats = s_Data->Stats;
+		stats.CreatedPipelines++;
+		stats.CreationTime += creationTime;
+
+		// Drivers are allowed to not report anything, in that case the pipeline is counted neither as a hit nor as a miss
+		const VkPipelineCreationFeedback& feedback = creationFeedback.Feedback;
+		if (feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT)
+		{
+			if (feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT)
+				stats.CacheHits++;
+			else
+				stats.CacheMisses++;
+		}
+	}
+
+	const VulkanPipelineCache::Stats& VulkanPipelineCache::GetStats()
+	{
+		static Stats s_EmptyStats;
+		return s_Data ? s_Data->Stats : s_EmptyStats;
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Frost/Platform/Vulkan/Vulkan.h"
+
+namespace Frost
+{
+	// Engine wide `VkPipelineCache`, shared by every graphics/compute/ray tracing pipeline.
+	// It is loaded from `Resources/Cache/Pipelines` of the project when the renderer starts and written back when it shuts down,
+	// so the driver doesn't have to compile the same pipelines again on every launch.
+	// The file stores the vendor/device ID, the driver version and the pipeline cache UUID of the GPU,
+	// and it is ignored if any of them don't match (e.g. after a driver update).
+	class VulkanPipelineCache
+	{
+	public:
+		struct Stats
+		{
+			bool LoadedFromDisk = false;   // Whether a valid cache file was found at startup
+			uint64_t LoadedSize = 0;       // Size of the cache data loaded from the disk
+			uint32_t CreatedPipelines = 0; // Pipelines created since startup
+			uint32_t CacheHits = 0;        // Pipelines which the driver found in the cache
+			uint32_t CacheMisses = 0;      // Pipelines which the driver had to compile
+			float CreationTime = 0.0f;     // Time spent creating pipelines since startup (in ms)
+		};
+
+		// Chained into `pNext` of the pipeline create info, so the driver reports if the pipeline came from the cache
+		struct CreationFeedback
+		{
+			CreationFeedback();
+			CreationFeedback(const CreationFeedback&) = delete;
+			CreationFeedback& operator=(const CreationFeedback&) = delete;
+
+			VkPipelineCreationFeedback Feedback{};
+			VkPipelineCreationFeedbackCreateInfo CreateInfo{ VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO };
+		};
+
+		static void Init();
+		static void ShutDown();
+
+		static VkPipelineCache GetVulkanPipelineCache();
+
+		// Should be called after each pipeline creation (`creationTime` is in ms)
+		static void OnPipelineCreated(const CreationFeedback& creationFeedback, float creationTime);
+
+		static const Stats& GetStats();
+	private:
+		static void Save();
+	};
+}
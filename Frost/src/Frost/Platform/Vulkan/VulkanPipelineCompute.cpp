@@ -4,6 +4,7 @@
 #include "Frost/Platform/Vulkan/VulkanContext.h"
 #include "Frost/Platform/Vulkan/VulkanShader.h"
 #include "Frost/Platform/Vulkan/VulkanPipeline.h"
+#include "Frost/Platform/Vulkan/VulkanPipelineCache.h"
 
 namespace Frost
 {
@@ -42,9 +43,14 @@ namespace Frost
 		computePipelineCreateInfo.flags = 0;
 		computePipelineCreateInfo.stage = shaderStages[0];
 
-		VkPipelineCacheCreateInfo pipelineCacheCreateInfo{ VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
-		FROST_VKCHECK(vkCreatePipelineCache(device, &pipelineCacheCreateInfo, nullptr, &m_PipelineCache));
-		FROST_VKCHECK(vkCreateComputePipelines(device, m_PipelineCache, 1, &computePipelineCreateInfo, nullptr, &m_Pipeline));
+		VulkanPipelineCache::CreationFeedback creationFeedback;
+		computePipelineCreateInfo.pNext = &creationFeedback.CreateInfo;
+
+		auto creationStartTime = std::chrono::high_resolution_clock::now();
+		FROST_VKCHECK(vkCreateComputePipelines(device, VulkanPipelineCache::GetVulkanPipelineCache(), 1, &computePipelineCreateInfo, nullptr, &m_Pipeline));
+		float creationTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - creationStartTime).count();
+
+		VulkanPipelineCache::OnPipelineCreated(creationFeedback, creationTime);
 	}
 
 	VulkanComputePipeline::~VulkanComputePipeline()
@@ -80,7 +86,6 @@ namespace Frost
 
 		VkDevice device = VulkanContext::GetCurrentDevice()->GetVulkanDevice();
 		vkDestroyPipeline(device, m_Pipeline, nullptr);
-		vkDestroyPipelineCache(device, m_PipelineCache, nullptr);
 		vkDestroyPipelineLayout(device, m_PipelineLayout, nullptr);
 
 		m_Pipeline = VK_NULL_HANDLE;
@@ -23,7 +23,6 @@ namespace Frost
 	private:
 		VkPipeline m_Pipeline = VK_NULL_HANDLE;
 		VkPipelineLayout m_PipelineLayout;
-		VkPipelineCache m_PipelineCache;
 		std::unordered_map<std::string, VkPushConstantRange> m_PushConstantRangeCache;
 	};
 
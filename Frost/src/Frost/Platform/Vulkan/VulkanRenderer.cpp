@@ -14,6 +14,7 @@
 #include "Frost/Platform/Vulkan/VulkanImage.h"
 #include "Frost/Platform/Vulkan/VulkanContext.h"
 #include "Frost/Platform/Vulkan/VulkanMaterial.h"
+#include "Frost/Platform/Vulkan/VulkanPipelineCache.h"
 
 // Render Passes
 #include "Frost/Platform/Vulkan/SceneRenderPasses/VulkanPostFXPass.h"
@@ -27,6 +28,8 @@
 #include "Frost/Platform/Vulkan/SceneRenderPasses/VulkanBatchRenderingPass.h"
 
 #include "Frost/Platform/Vulkan/VulkanBindlessAllocator.h"
+#include "Frost/Platform/Vulkan/Buffers/VulkanUploadManager.h"
+#include "Frost/Platform/Vulkan/RayTracing/VulkanAccelerationStructureBuilder.h"
 
 namespace Frost
 {
@@ -77,6 +80,9 @@ namespace Frost
 		vulkanImGuiLayer->OnInit(VulkanContext::GetSwapChain()->GetRenderPass());
 
 		VulkanMaterial::AllocateDescriptorPool();
+
+		// Load the pipeline cache from the disk (before any pipeline gets created)
+		VulkanPipelineCache::Init();
 	
 		// Creating the semaphores and fences
 		for (uint32_t i = 0; i < FRAMES_IN_FLIGHT; i++)
@@ -191,6 +197,11 @@ namespace Frost
 		/// Create the renderer debugger
 		s_Data->s_RendererDebugger = RendererDebugger::Create();
 		s_Data->s_RendererDebugger->Init(s_Data->SceneRenderPasses.Raw());
+
+		const VulkanPipelineCache::Stats& pipelineCacheStats = VulkanPipelineCache::GetStats();
+		FROST_CORE_INFO("[PipelineCache] Startup: {0} pipelines created in {1} ms ({2} cache hits, {3} misses, cache {4})",
+			pipelineCacheStats.CreatedPipelines, pipelineCacheStats.CreationTime, pipelineCacheStats.CacheHits, pipelineCacheStats.CacheMisses,
+			pipelineCacheStats.LoadedFromDisk ? "loaded from disk" : "was empty");
 	}
 
 	void VulkanRenderer::BeginFrame()
@@ -214,6 +225,12 @@ namespace Frost
 			/* When the fence was finished being used by the renderer, we mark the fence as now being in use by this frame */
 			s_Data->FencesInCheck[currentFrameIndex] = s_Data->FencesInFlight[currentFrameIndex];
 
+			/* Recycle the staging memory of the uploads that have finished */
+			VulkanUploadManager::Update();
+
+			/* Record the queued BLAS builds (and compact the finished ones) into the upload batch, submitted before this frame */
+			VulkanAccelerationStructureBuilder::Update();
+
 			/* Reset the descriptor pool */
 			FROST_VKCHECK(vkResetDescriptorPool(device, s_Data->DescriptorPools[currentFrameIndex], 0));
 
@@ -346,6 +363,9 @@ namespace Frost
 			submitInfo.pCommandBuffers = &cmdBuf;
 			vkResetFences(device, 1, &fenceInFlight);
 
+			/* Submit the uploads recorded during this frame, so they are executed before the frame's commands */
+			VulkanUploadManager::Flush();
+
 			VkQueue graphicsQueue = VulkanContext::GetCurrentDevice()->GetQueueFamilies().GraphicsFamily.Queue;
 			FROST_VKCHECK(vkQueueSubmit(graphicsQueue, 1, &submitInfo, fenceInFlight));
 		});
@@ -421,9 +441,20 @@ namespace Frost
 		});
 	}
 
-	uint32_t VulkanRenderer::ReadPixelFromFramebufferEntityID(uint32_t x, uint32_t y)
+	void VulkanRenderer::RequestEntityIDPick(uint32_t x, uint32_t y, const std::function<void(uint32_t)>& callback)
 	{
-		return s_Data->SceneRenderPasses->GetRenderPass<VulkanBatchRenderingPass>()->ReadPixelFromTextureEntityID(x, y);
+		RequestEntityIDPickRect(x, y, 1, 1, [callback](const Vector<uint32_t>& entityIDs)
+		{
+			callback(entityIDs.empty() ? UINT32_MAX : entityIDs[0]);
+		});
+	}
+
+	void VulkanRenderer::RequestEntityIDPickRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::function<void(const Vector<uint32_t>&)>& callback)
+	{
+		Renderer::Submit([&, x, y, width, height, callback]()
+		{
+			s_Data->SceneRenderPasses->GetRenderPass<VulkanBatchRenderingPass>()->RequestEntityIDPick(x, y, width, height, callback);
+		});
 	}
 
 	uint32_t VulkanRenderer::GetCurrentFrameIndex()
@@ -526,6 +557,9 @@ namespace Frost
 			s_RenderQueue[i].Reset();
 		}
 		VulkanMaterial::DeallocateDescriptorPool();
+
+		// Write the pipeline cache back to the disk, so the next launch doesn't have to compile the pipelines again
+		VulkanPipelineCache::ShutDown();
 	}
 
 	uint64_t VulkanRenderer::BeginTimestampQuery()
@@ -35,7 +35,8 @@ namespace Frost
 		virtual void SubmitText(const std::string& string, const Ref<Font>& font, const glm::mat4& transform, float maxWidth, float lineHeightOffset, float kerningOffset, const glm::vec4& color) override;
 		virtual void SubmitWireframeMesh(Ref<Mesh> mesh, const glm::mat4& transform, const glm::vec4& color, float lineWidth) override;
 
-		virtual uint32_t ReadPixelFromFramebufferEntityID(uint32_t x, uint32_t y) override;
+		virtual void RequestEntityIDPick(uint32_t x, uint32_t y, const std::function<void(uint32_t)>& callback) override;
+		virtual void RequestEntityIDPickRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::function<void(const Vector<uint32_t>&)>& callback) override;
 		virtual uint32_t GetCurrentFrameIndex() override;
 		virtual uint64_t GetFrameCount() override;
 		virtual Ref<Scene> GetActiveScene() override;
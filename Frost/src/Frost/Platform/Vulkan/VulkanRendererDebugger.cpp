@@ -1,8 +1,11 @@
 #include "frostpch.h"
 #include "VulkanRendererDebugger.h"
 
+#include "Frost/Core/FrameAllocator.h"
 #include "Frost/Renderer/SceneRenderPass.h"
 #include "Frost/Platform/Vulkan/VulkanRenderer.h"
+#include "Frost/Platform/Vulkan/VulkanPipelineCache.h"
+#include "Frost/Platform/Vulkan/RayTracing/VulkanAccelerationStructureBuilder.h"
 
 #include <imgui.h>
 
@@ -39,6 +42,34 @@ namespace Frost
 		{
 			ImGui::Text("%s: %.2f", timeStampPass.first.c_str(), gpuTimings[timeStampPass.second / 2]);
 		}
+
+		ImGui::Separator();
+		const FrameAllocator::Stats& frameAllocatorStats = FrameAllocator::GetStats();
+		ImGui::Text("Frame Allocator Usage: %.2f KB (%d allocations)", frameAllocatorStats.UsedBytes / 1024.0f, frameAllocatorStats.AllocationCount);
+		ImGui::Text("Frame Allocator High Water Mark: %.2f KB", frameAllocatorStats.HighWaterMark / 1024.0f);
+		ImGui::Text("Frame Allocator Capacity: %.2f KB", frameAllocatorStats.Capacity / 1024.0f);
+		ImGui::Text("Frame Allocator Heap Growths: %d", frameAllocatorStats.HeapGrowths);
+
+		ImGui::Separator();
+		const VulkanPipelineCache::Stats& pipelineCacheStats = VulkanPipelineCache::GetStats();
+		ImGui::Text("Pipeline Cache: %s (%.2f KB loaded)", pipelineCacheStats.LoadedFromDisk ? "Loaded from disk" : "Empty", pipelineCacheStats.LoadedSize / 1024.0f);
+		ImGui::Text("Pipelines Created: %d (%.2f ms)", pipelineCacheStats.CreatedPipelines, pipelineCacheStats.CreationTime);
+		ImGui::Text("Pipeline Cache Hits/Misses: %d/%d", pipelineCacheStats.CacheHits, pipelineCacheStats.CacheMisses);
+
+		ImGui::Separator();
+		const VulkanAccelerationStructureBuilder::Stats& asBuilderStats = VulkanAccelerationStructureBuilder::GetStats();
+		ImGui::Text("TLAS Builds/Refits/Skipped: %d/%d/%d", asBuilderStats.TLASBuilds, asBuilderStats.TLASRefits, asBuilderStats.TLASSkippedUpdates);
+		ImGui::Text("BLAS Built: %d (%d pending)", asBuilderStats.BuiltBLAS, asBuilderStats.PendingBLAS);
+		ImGui::Text("BLAS Compacted: %d (%.2f MB saved)", asBuilderStats.CompactedBLAS, asBuilderStats.CompactionSavedBytes / (1024.0f * 1024.0f));
+
+		ImGui::Separator();
+		const SceneVisibility& sceneVisibility = m_SceneRenderPassPipeline->GetSceneVisibility();
+		ImGui::Text("Scene Instances: %d (%d mesh groups)", sceneVisibility.GetInstanceCount(), (uint32_t)sceneVisibility.GetGroups().size());
+		for (uint32_t i = 0; i < sceneVisibility.GetViewCount(); i++)
+		{
+			const SceneView& view = sceneVisibility.GetView(i);
+			ImGui::Text("%s: %d/%d instances (%d submeshes)", view.Name.c_str(), (uint32_t)view.VisibleInstances.size(), sceneVisibility.GetInstanceCount(), view.VisibleSubmeshCount);
+		}
 		ImGui::End();
 	}
 
@@ -53,4 +84,4 @@ namespace Frost
 		VulkanRenderer::EndTimestampQuery(m_TimeStampPasses[passName]);
 	}
 
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "VulkanSceneEnvironment.h"
 
 #include "Frost/Renderer/Renderer.h"
+#include "Frost/Renderer/EnvironmentCache.h"
 #include "Frost/Platform/Vulkan/VulkanPipelineCompute.h"
 #include "Frost/Platform/Vulkan/VulkanMaterial.h"
 #include "Frost/Platform/Vulkan/VulkanContext.h"
@@ -85,8 +86,68 @@ namespace Frost
 		}
 	}
 
+	namespace Utils
+	{
+		static EnvironmentBakeSettings GetEnvironmentBakeSettings()
+		{
+			const RendererConfig& rendererConfig = Renderer::GetRendererConfig();
+
+			EnvironmentBakeSettings bakeSettings{};
+			bakeSettings.EnvironmentMapResolution = rendererConfig.EnvironmentMapResolution;
+			bakeSettings.IrradianceMapResolution = rendererConfig.IrradianceMapResolution;
+			bakeSettings.IrradianceMapSamples = rendererConfig.IrradianceMapSamples;
+			bakeSettings.Format = ImageFormat::RGBA16F;
+			return bakeSettings;
+		}
+
+		static Ref<TextureCubeMap> CreateEnvironmentCubeMap(const EnvironmentCubeMapData& cubeMapData)
+		{
+			ImageSpecification imageSpec{};
+			imageSpec.Format = ImageFormat::RGBA16F;
+			imageSpec.Usage = ImageUsage::Storage;
+			imageSpec.Width = cubeMapData.Width;
+			imageSpec.Height = cubeMapData.Height;
+			Ref<TextureCubeMap> cubeMap = TextureCubeMap::Create(imageSpec);
+
+			auto vulkanCubeMap = cubeMap.As<VulkanTextureCubeMap>();
+			if (vulkanCubeMap->GetMipChainLevels() != cubeMapData.MipCount || vulkanCubeMap->GetMipChainBufferSize() != cubeMapData.Data.Size)
+				return nullptr;
+
+			vulkanCubeMap->CopyFromHostBuffer(cubeMapData.Data);
+			return cubeMap;
+		}
+
+		static void ReadEnvironmentCubeMap(const Ref<TextureCubeMap>& cubeMap, EnvironmentCubeMapData& outCubeMapData)
+		{
+			auto vulkanCubeMap = cubeMap.As<VulkanTextureCubeMap>();
+
+			outCubeMapData.Width = vulkanCubeMap->GetWidth();
+			outCubeMapData.Height = vulkanCubeMap->GetHeight();
+			outCubeMapData.MipCount = vulkanCubeMap->GetMipChainLevels();
+			vulkanCubeMap->CopyToHostBuffer(outCubeMapData.Data);
+		}
+	}
+
 	bool VulkanSceneEnvironment::ComputeEnvironmentMap(const std::string& filepath, Ref<TextureCubeMap>& radianceMap, Ref<TextureCubeMap>& prefilteredMap, Ref<TextureCubeMap>& irradianceMap)
 	{
+		// Baking is slow, so the resulting cubemaps are cached on disk (keyed by the HDR file's content and the bake settings)
+		uint64_t cacheKey = EnvironmentCache::GetCacheKey(filepath, Utils::GetEnvironmentBakeSettings());
+
+		EnvironmentBakeData bakeData{};
+		if (EnvironmentCache::Load(cacheKey, bakeData))
+		{
+			radianceMap = Utils::CreateEnvironmentCubeMap(bakeData.RadianceMap);
+			prefilteredMap = Utils::CreateEnvironmentCubeMap(bakeData.PrefilteredMap);
+			irradianceMap = Utils::CreateEnvironmentCubeMap(bakeData.IrradianceMap);
+			bakeData.Release();
+
+			if (radianceMap && prefilteredMap && irradianceMap)
+				return true;
+
+			FROST_CORE_WARN("[EnvironmentCache] Cache entry for '{0}' doesn't match the current settings, baking it again", filepath);
+			EnvironmentCache::Invalidate(cacheKey);
+		}
+
 		// Creating the equirectangular map
 		TextureSpecification textureSpec{};
 		textureSpec.Usage = ImageUsage::ReadOnly;
@@ -103,7 +164,18 @@ namespace Frost
 		IrradianceMapCompute(irradianceMap, radianceMap);
 		PrefilteredMapCompute(prefilteredMap, radianceMap);
 
-		return environmentMap && radianceMap && prefilteredMap && irradianceMap;
+		bool success = environmentMap && radianceMap && prefilteredMap && irradianceMap;
+		if (success && cacheKey != 0)
+		{
+			Utils::ReadEnvironmentCubeMap(radianceMap, bakeData.RadianceMap);
+			Utils::ReadEnvironmentCubeMap(prefilteredMap, bakeData.PrefilteredMap);
+			Utils::ReadEnvironmentCubeMap(irradianceMap, bakeData.IrradianceMap);
+
+			EnvironmentCache::Store(cacheKey, bakeData);
+			bakeData.Release();
+		}
+
+		return success;
 	}
 
 	void VulkanSceneEnvironment::InitSkyBoxPipeline(Ref<RenderPass> renderPass)
@@ -3,7 +3,9 @@
 
 #include "Frost/Platform/Vulkan/VulkanContext.h"
 #include "Frost/Platform/Vulkan/VulkanBindlessAllocator.h"
+#include "Frost/Utils/Hash.h"
 
+#include <mutex>
 #include <filesystem>
 #include <shaderc/shaderc.hpp>
 #include <spirv-tools/optimizer.hpp>
@@ -22,6 +24,12 @@ namespace Frost
 		static void CreateCacheDirectoryIfNeeded();
 		static std::string GetNameFromFilepath(const std::string& filepath);
 		static std::string ReadFile(const std::string& filename);
+		static std::filesystem::path ResolveShaderInclude(const std::string& requestedSource, bool isRelative, const std::string& requestingSource);
+		static uint64_t HashShaderSource(const std::string& filepath, const std::string& source);
+		static uint64_t GetCachedShaderHash(const std::string& shaderName);
+		static void SetCachedShaderHash(const std::string& shaderName, uint64_t hashCode);
+		static bool ReadShaderBinary(const std::filesystem::path& filepath, std::vector<uint32_t>& outData);
+		static void WriteShaderBinary(const std::filesystem::path& filepath, const std::vector<uint32_t>& data);
 		VkShaderModule CreateShaderModule(const std::vector<uint32_t>& code);
 		VkShaderStageFlagBits ShaderTypeToStage(ShaderType type);
 		std::string ShaderTypeToString(ShaderType type);
@@ -34,6 +42,47 @@ namespace Frost
 		static VkShaderStageFlags GetShaderStagesFlagsFromShaderTypes(Vector<ShaderType> shaderTypes);
 	}
 
+	// Resolves the `#include` directives for shaderc (`#include "file"` relative to the including file, `#include <file>` relative to the shader directory)
+	class ShaderIncluder : public shaderc::CompileOptions::IncluderInterface
+	{
+	public:
+		virtual shaderc_include_result* GetInclude(const char* requestedSource, shaderc_include_type type, const char* requestingSource, size_t includeDepth) override
+		{
+			IncludeData* includeData = new IncludeData();
+
+			std::filesystem::path includePath = Utils::ResolveShaderInclude(requestedSource, type == shaderc_include_type_relative, requestingSource);
+			if (std::filesystem::exists(includePath))
+			{
+				includeData->SourceName = includePath.string();
+				includeData->Content = Utils::ReadFile(includeData->SourceName);
+			}
+			else
+			{
+				// An empty source name tells shaderc that the include failed, the content is the error message
+				includeData->Content = "Could not find the included file '" + includePath.string() + "'";
+			}
+
+			includeData->Result.source_name = includeData->SourceName.c_str();
+			includeData->Result.source_name_length = includeData->SourceName.size();
+			includeData->Result.content = includeData->Content.c_str();
+			includeData->Result.content_length = includeData->Content.size();
+			includeData->Result.user_data = includeData;
+			return &includeData->Result;
+		}
+
+		virtual void ReleaseInclude(shaderc_include_result* data) override
+		{
+			delete static_cast<IncludeData*>(data->user_data);
+		}
+	private:
+		struct IncludeData
+		{
+			std::string SourceName;
+			std::string Content;
+			shaderc_include_result Result{};
+		};
+	};
+
 	VulkanShader::VulkanShader(const std::string& filepath)
 		: m_Filepath(filepath)
 	{
@@ -76,6 +125,7 @@ namespace Frost
 	}
 
 	VulkanShader::VulkanShader(const std::string& filepath, const Vector<ShaderArray>& customMemberArraySizes)
+		: m_Filepath(filepath)
 	{
 		m_Name = Utils::GetNameFromFilepath(filepath);
 
@@ -83,6 +133,7 @@ namespace Frost
 		std::string source = Utils::ReadFile(filepath);
 		auto shaderSources = Utils::PreProccesShaders(source);
 		m_ShaderSources = shaderSources;
+		m_ShaderSource = source;
 
 		// Check if we use bindless in a shader
 		{
@@ -145,6 +196,7 @@ namespace Frost
 		const bool optimize = false;
 		if (optimize)
 			options.SetOptimizationLevel(shaderc_optimization_level_performance);
+		options.SetIncluder(std::make_unique<ShaderIncluder>());
 		
 		std::filesystem::path cacheDirectory = Utils::GetShaderCacheDirectory();
 
@@ -152,48 +204,31 @@ namespace Frost
 		shaderData.clear();
 
 		bool isFileChanged = IsFiledChanged();
-		if(isFileChanged)
-			CacheShaderSourceFile();
 
 		for (auto&& [stage, source] : shaderSources)
 		{
 			std::filesystem::path shaderFilePath = m_Filepath;
 			std::filesystem::path cachedPath = cacheDirectory / (shaderFilePath.filename().string() + Utils::ShaderStageCachedFileExtension(stage));
 
-			std::ifstream in(cachedPath, std::ios::in | std::ios::binary);
-			
-			if (!isFileChanged)
-			{
-				in.seekg(0, std::ios::end);
-				auto size = in.tellg();
-				in.seekg(0, std::ios::beg);
-
-				auto& data = shaderData[stage];
-				data.resize(size / sizeof(uint32_t));
-				in.read((char*)data.data(), size);
-			}
-			else
-			{
-				shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, Utils::ShaderStageToShaderC(stage), m_Filepath.c_str(), options);
-
-				if (module.GetCompilationStatus() != shaderc_compilation_status_success)
-				{
-					FROST_CORE_ERROR("Error in {0} shader:\n {1}", Utils::ShaderTypeToString(stage), module.GetErrorMessage());
-					FROST_ASSERT_MSG("Assertion requested!");
-				}
+			// Use the cached binary, unless the source has changed (or the binary went missing)
+			if (!isFileChanged && Utils::ReadShaderBinary(cachedPath, shaderData[stage]))
+				continue;
 
-				shaderData[stage] = std::vector<uint32_t>(module.cbegin(), module.cend());
+			shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, Utils::ShaderStageToShaderC(stage), m_Filepath.c_str(), options);
 
-				std::ofstream out(cachedPath, std::ios::out | std::ios::binary);
-				if (out.is_open())
-				{
-					auto& data = shaderData[stage];
-					out.write((char*)data.data(), data.size() * sizeof(uint32_t));
-					out.flush();
-					out.close();
-				}
+			if (module.GetCompilationStatus() != shaderc_compilation_status_success)
+			{
+				FROST_CORE_ERROR("Error in {0} shader:\n {1}", Utils::ShaderTypeToString(stage), module.GetErrorMessage());
+				FROST_ASSERT_MSG("Assertion requested!");
 			}
+
+			shaderData[stage] = std::vector<uint32_t>(module.cbegin(), module.cend());
+			Utils::WriteShaderBinary(cachedPath, shaderData[stage]);
 		}
+
+		// The hash is updated only after every stage was compiled and cached, so a failed compilation is retried on the next launch
+		if (isFileChanged)
+			CacheShaderSourceFile();
 	}
 
 
@@ -330,74 +365,15 @@ namespace Frost
 
 	bool VulkanShader::IsFiledChanged()
 	{
-		uint64_t oldHashCode = 0;
-		
-
-		{
-			// Hashing the new shader
-			m_ShaderSourceHashCode = std::hash<std::string>{}(m_ShaderSource);
-			FROST_CORE_INFO("[Shader] {0} shader hash code: {1}", m_Name, m_ShaderSourceHashCode);
-		}
-
-		{
-			std::ifstream instream("Resources/Cache/Shaders/Vulkan/Hash/ShaderHashes.hash", std::ios::in | std::ios::binary);
-			std::string hashFileContent;
-			instream.seekg(0, std::ios::end);
-			size_t size = instream.tellg();
-			if (size != -1)
-			{
-				hashFileContent.resize(size);
-				instream.seekg(0, std::ios::beg);
-				instream.read(&hashFileContent[0], size);
-
-				// Create A JSON, from the previous file for writing the new contents
-				nlohmann::json j = nlohmann::json::parse(hashFileContent);
-
-				if (j.contains(m_Name))
-					oldHashCode = j[m_Name];
-			}
-			else
-			{
-				return true;
-			}
-			instream.close();
-		}
-
-		if (oldHashCode == m_ShaderSourceHashCode)
-			return false;
+		// Hashing the new shader (together with every file it includes, so editing an included file recompiles only the shaders using it)
+		m_ShaderSourceHashCode = Utils::HashShaderSource(m_Filepath, m_ShaderSource);
 
-		return true;
+		return Utils::GetCachedShaderHash(m_Name) != m_ShaderSourceHashCode;
 	}
 
 	void VulkanShader::CacheShaderSourceFile()
 	{
-		nlohmann::json j;
-
-		std::ifstream instream("Resources/Cache/Shaders/Vulkan/Hash/ShaderHashes.hash", std::ios::in | std::ios::binary);
-		std::string hashFileContent;
-		instream.seekg(0, std::ios::end);
-		size_t size = instream.tellg();
-		if (size != -1)
-		{
-			hashFileContent.resize(size);
-			instream.seekg(0, std::ios::beg);
-			instream.read(&hashFileContent[0], size);
-
-			// Create A JSON, from the previous file for writing the new contents
-			j = nlohmann::json::parse(hashFileContent);
-		}
-
-		j[m_Name] = m_ShaderSourceHashCode;
-
-		std::string result = j.dump(4);
-
-		FILE* f = nullptr;
-		f = fopen("Resources/Cache/Shaders/Vulkan/Hash/ShaderHashes.hash", "w");
-		if (f)
-		{
-			fwrite(result.c_str(), sizeof(char), result.size(), f);
-			fclose(f);
-		}
+		Utils::SetCachedShaderHash(m_Name, m_ShaderSourceHashCode);
 	}
 
 	void VulkanShader::Destroy()
@@ -438,13 +414,15 @@ namespace Frost
 
 		static void CreateCacheDirectoryIfNeeded()
 		{
+			// Shaders are loaded on multiple threads, so another thread might create the directories in the meantime (hence the error codes)
+			std::error_code errorCode;
 			std::string shaderCacheDirectory = GetShaderCacheDirectory();
 			if (!std::filesystem::exists(shaderCacheDirectory))
-				std::filesystem::create_directories(shaderCacheDirectory);
+				std::filesystem::create_directories(shaderCacheDirectory, errorCode);
 
 			std::string shaderHashCacheDirectory = GetShaderHashCacheDirectory();
 			if (!std::filesystem::exists(shaderHashCacheDirectory))
-				std::filesystem::create_directories(shaderHashCacheDirectory);
+				std::filesystem::create_directories(shaderHashCacheDirectory, errorCode);
 		}
 
 		static std::string GetNameFromFilepath(const std::string& filepath)
@@ -483,6 +461,159 @@ namespace Frost
 			return result;
 		}
 
+		static std::filesystem::path ResolveShaderInclude(const std::string& requestedSource, bool isRelative, const std::string& requestingSource)
+		{
+			if (isRelative)
+				return (std::filesystem::path(requestingSource).parent_path() / requestedSource).lexically_normal();
+
+			return (std::filesystem::path("Resources/Shaders") / requestedSource).lexically_normal();
+		}
+
+		static uint64_t HashShaderSource(const std::string& filepath, const std::string& source, std::unordered_set<std::string>& visitedFiles)
+		{
+			uint64_t hashCode = Hash::GenerateFNVHash(source);
+
+			// Every included file is hashed into the shader's hash (each file only once, even if it's included multiple times)
+			const char* includeToken = "#include";
+			size_t pos = source.find(includeToken, 0);
+			while (pos != std::string::npos)
+			{
+				size_t eol = source.find_first_of("\r\n", pos);
+				std::string line = source.substr(pos, eol == std::string::npos ? std::string::npos : eol - pos);
+
+				size_t nameBegin = line.find_first_of("\"<");
+				if (nameBegin != std::string::npos)
+				{
+					bool isRelative = line[nameBegin] == '"';
+					size_t nameEnd = line.find(isRelative ? '"' : '>', nameBegin + 1);
+					if (nameEnd != std::string::npos)
+					{
+						std::string requestedSource = line.substr(nameBegin + 1, nameEnd - nameBegin - 1);
+						std::string includePath = ResolveShaderInclude(requestedSource, isRelative, filepath).string();
+
+						if (visitedFiles.insert(includePath).second)
+						{
+							std::string includeSource = ReadFile(includePath);
+							hashCode = Hash::Combine(hashCode, HashShaderSource(includePath, includeSource, visitedFiles));
+						}
+					}
+				}
+
+				pos = eol == std::string::npos ? std::string::npos : source.find(includeToken, eol);
+			}
+
+			return hashCode;
+		}
+
+		static uint64_t HashShaderSource(const std::string& filepath, const std::string& source)
+		{
+			std::unordered_set<std::string> visitedFiles;
+			return HashShaderSource(filepath, source, visitedFiles);
+		}
+
+		// `ShaderHashes.hash` is shared by every shader and shaders are compiled on multiple threads,
+		// so the file is parsed only once and every access to it goes through the lock
+		struct ShaderHashFile
+		{
+			std::mutex Mutex;
+			nlohmann::json Hashes;
+			bool IsLoaded = false;
+		};
+		static ShaderHashFile s_ShaderHashFile;
+
+		static std::filesystem::path GetShaderHashFilepath()
+		{
+			return std::filesystem::path(GetShaderHashCacheDirectory()) / "ShaderHashes.hash";
+		}
+
+		static void LoadShaderHashFileIfNeeded()
+		{
+			if (s_ShaderHashFile.IsLoaded) return;
+			s_ShaderHashFile.IsLoaded = true;
+
+			std::string hashFileContent;
+			std::filesystem::path hashFilepath = GetShaderHashFilepath();
+			if (std::filesystem::exists(hashFilepath))
+				hashFileContent = ReadFile(hashFilepath.string());
+
+			// A corrupted hash file only means that every shader gets recompiled
+			s_ShaderHashFile.Hashes = nlohmann::json::parse(hashFileContent, nullptr, false);
+			if (!s_ShaderHashFile.Hashes.is_object())
+				s_ShaderHashFile.Hashes = nlohmann::json::object();
+		}
+
+		static uint64_t GetCachedShaderHash(const std::string& shaderName)
+		{
+			std::scoped_lock<std::mutex> lock(s_ShaderHashFile.Mutex);
+			LoadShaderHashFileIfNeeded();
+
+			const nlohmann::json& hashes = s_ShaderHashFile.Hashes;
+			if (hashes.contains(shaderName) && hashes[shaderName].is_number_unsigned())
+				return hashes[shaderName].get<uint64_t>();
+			return 0;
+		}
+
+		static void SetCachedShaderHash(const std::string& shaderName, uint64_t hashCode)
+		{
+			std::scoped_lock<std::mutex> lock(s_ShaderHashFile.Mutex);
+			LoadShaderHashFileIfNeeded();
+
+			s_ShaderHashFile.Hashes[shaderName] = hashCode;
+			std::string result = s_ShaderHashFile.Hashes.dump(4);
+
+			// Write into a temporary file first and then replace the old one, so the file is never left half written
+			std::filesystem::path hashFilepath = GetShaderHashFilepath();
+			std::filesystem::path tempFilepath = hashFilepath.string() + ".tmp";
+			{
+				std::ofstream out(tempFilepath, std::ios::out | std::ios::binary);
+				out.write(result.c_str(), result.size());
+			}
+
+			std::error_code errorCode;
+			std::filesystem::rename(tempFilepath, hashFilepath, errorCode);
+			if (errorCode)
+			{
+				FROST_CORE_ERROR("[Shader] Failed to write the shader hash file '{0}'", hashFilepath.string());
+				std::filesystem::remove(tempFilepath, errorCode);
+			}
+		}
+
+		static bool ReadShaderBinary(const std::filesystem::path& filepath, std::vector<uint32_t>& outData)
+		{
+			std::ifstream in(filepath, std::ios::in | std::ios::binary);
+			if (!in)
+				return false;
+
+			in.seekg(0, std::ios::end);
+			auto size = in.tellg();
+			if (size <= 0 || size % sizeof(uint32_t) != 0)
+				return false;
+			in.seekg(0, std::ios::beg);
+
+			outData.resize(size / sizeof(uint32_t));
+			in.read((char*)outData.data(), size);
+			return in.good();
+		}
+
+		static void WriteShaderBinary(const std::filesystem::path& filepath, const std::vector<uint32_t>& data)
+		{
+			// The temporary file is unique per shader stage, so the shaders compiled in parallel never write into the same file
+			std::filesystem::path tempFilepath = filepath.string() + ".tmp";
+			{
+				std::ofstream out(tempFilepath, std::ios::out | std::ios::binary);
+				if (!out.is_open())
+					return;
+				out.write((char*)data.data(), data.size() * sizeof(uint32_t));
+			}
+
+			std::error_code errorCode;
+			std::filesystem::rename(tempFilepath, filepath, errorCode);
+			if (errorCode)
+			{
+				FROST_CORE_ERROR("[Shader] Failed to write the shader binary '{0}'", filepath.string());
+				std::filesystem::remove(tempFilepath, errorCode);
+			}
+		}
 
 		VkShaderModule CreateShaderModule(const std::vector<uint32_t>& code)
 		{
@@ -6,6 +6,7 @@
 #include "Frost/Platform/Vulkan/VulkanRenderer.h"
 #include "Frost/Platform/Vulkan/VulkanContext.h"
 #include "Frost/Asset/AssetManager.h"
+#include "Frost/Renderer/TextureCache.h"
 
 #include <stb_image.h>
 #include <tinyexr/tinyexr.h>
@@ -77,96 +78,25 @@ namespace Frost
 				 textureSpec.Format == ImageFormat::BC5)
 		{
 
-			CMP_MipSet textureMipSet;
-			CMP_LoadTexture(filepath.c_str(), &textureMipSet);
+			// Compressing is slow, so the result is cached on disk (keyed by the file's content and the compression settings)
+			TextureCompressionSettings compressionSettings{};
+			compressionSettings.Format = textureSpec.Format;
 
-
-			// Generate the mips before compressing, so when it will compress, it will do the mips as well.
-			{
-				uint32_t totalMipMapLevels = Utils::CalculateMipMapLevels(textureMipSet.dwWidth, textureMipSet.dwHeight);
-				uint32_t compressedMipMapLevels = (uint32_t)glm::max((int32_t)totalMipMapLevels - 2, 0);
-				CMP_GenerateMIPLevels(&textureMipSet, compressedMipMapLevels);
-			}
-
-
-
-			// Initialize the compressed mip set and compress the mips.
-			CMP_MipSet compresstedMipSet;
+			CompressedTextureData compressedTextureData{};
+			if (!TextureCache::LoadOrCompress(filepath, compressionSettings, compressedTextureData))
 			{
-				compresstedMipSet.m_nWidth = textureMipSet.m_nWidth;
-				compresstedMipSet.m_nHeight = textureMipSet.m_nHeight;
-				compresstedMipSet.m_nDepth = textureMipSet.m_nDepth;
-
-				// Set the compression parameters
-				CMP_CompressOptions options = { 0 };
-				options.dwSize = sizeof(options);
-				options.fquality = 0.05f;
-				options.dwnumThreads = 8;
-
-				switch (textureSpec.Format)
-				{
-					case ImageFormat::RGB_BC1:
-					case ImageFormat::RGBA_BC1:  options.DestFormat = CMP_FORMAT_BC1; break;
-					case ImageFormat::BC2:		 options.DestFormat = CMP_FORMAT_BC2; break;
-					case ImageFormat::BC3:		 options.DestFormat = CMP_FORMAT_BC3; break;
-					case ImageFormat::BC4:		 options.DestFormat = CMP_FORMAT_BC4; break;
-					case ImageFormat::BC5:		 options.DestFormat = CMP_FORMAT_BC5; break;
-					default: FROST_ASSERT_MSG("Something is wrong! :(");
-				}
-
-				// Compress
-				CMP_ERROR status = CMP_ConvertMipTexture(&textureMipSet, &compresstedMipSet, &options, nullptr);
-			}
-
-			
-			// Pack all the compressed mip set into a single buffer for it to copy more efficiently into the image buffer
-			Buffer compressedMipSetBuffer{};
-			{
-				// Compute the total buffer size required
-				uint64_t totalBufferSize = 0;
-				for (uint32_t i = 0; i < compresstedMipSet.m_nMipLevels; i++)
-				{
-					totalBufferSize += Utils::CalculateImageBufferSize(
-						compresstedMipSet.m_pMipLevelTable[i]->m_nWidth,
-						compresstedMipSet.m_pMipLevelTable[i]->m_nHeight,
-						textureSpec.Format
-					);
-				}
-
-				// Allocate the whole buffer
-				compressedMipSetBuffer.Allocate(totalBufferSize);
-				
-
-				uint64_t bufferOffset = 0;
-				for (uint32_t i = 0; i < compresstedMipSet.m_nMipLevels; i++)
-				{
-					// Get the current mip image buffer size
-					uint64_t mipBufferSize = Utils::CalculateImageBufferSize(
-						compresstedMipSet.m_pMipLevelTable[i]->m_nWidth,
-						compresstedMipSet.m_pMipLevelTable[i]->m_nHeight,
-						textureSpec.Format
-					);
-					
-					// Write into the buffer with an offset
-					compressedMipSetBuffer.Write(compresstedMipSet.m_pMipLevelTable[i]->m_pbData, mipBufferSize, bufferOffset);
-
-					// Add the current mip buffer size to the buffer offset
-					bufferOffset += mipBufferSize;
-				}
+				FROST_CORE_WARN("Texture with filepath '{0}' couldn't be compressed", filepath);
+				m_IsLoaded = false;
+				return;
 			}
 
-			m_TextureData.Data = (void*)compressedMipSetBuffer.Data;
-			m_TextureData.Size = compressedMipSetBuffer.GetSize();
+			m_TextureData = compressedTextureData.Data;
 
-			width = compresstedMipSet.m_pMipLevelTable[0]->m_nWidth;
-			height = compresstedMipSet.m_pMipLevelTable[0]->m_nHeight;
-			imageFormat = textureSpec.Format;
+			width = compressedTextureData.Width;
+			height = compressedTextureData.Height;
+			imageFormat = compressedTextureData.Format;
 
 			m_IsLoaded = true;
-
-			// After copying the buffers into our own packed mip buffer, we do not those anymore
-			CMP_FreeMipSet(&textureMipSet);
-			CMP_FreeMipSet(&compresstedMipSet);
 		}
 		else if (extension == ".exr")
 		{
@@ -639,6 +569,114 @@ namespace Frost
 		m_ImageLayout = newImageLayout;
 	}
 
+	Vector<VkBufferImageCopy> VulkanTextureCubeMap::GetMipChainCopyRegions() const
+	{
+		Vector<VkBufferImageCopy> copyRegions(m_MipLevelCount);
+
+		uint64_t bufferOffset = 0;
+		for (uint32_t mip = 0; mip < m_MipLevelCount; mip++)
+		{
+			uint32_t mipWidth = m_MipLevelCount > 1 ? std::get<0>(m_MipSizes.at(mip)) : m_ImageSpecification.Width;
+			uint32_t mipHeight = m_MipLevelCount > 1 ? std::get<1>(m_MipSizes.at(mip)) : m_ImageSpecification.Height;
+
+			// All 6 faces of a mip are copied in one region, so they are placed one after another in the buffer
+			VkBufferImageCopy& region = copyRegions[mip];
+			region.bufferOffset = bufferOffset;
+			region.bufferRowLength = 0;
+			region.bufferImageHeight = 0;
+			region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			region.imageSubresource.mipLevel = mip;
+			region.imageSubresource.baseArrayLayer = 0;
+			region.imageSubresource.layerCount = 6;
+			region.imageOffset = { 0, 0, 0 };
+			region.imageExtent = { mipWidth, mipHeight, 1 };
+
+			bufferOffset += Utils::CalculateImageBufferSize(mipWidth, mipHeight, m_ImageSpecification.Format) * 6;
+		}
+
+		return copyRegions;
+	}
+
+	uint32_t VulkanTextureCubeMap::GetMipChainBufferSize() const
+	{
+		Vector<VkBufferImageCopy> copyRegions = GetMipChainCopyRegions();
+		const VkBufferImageCopy& lastRegion = copyRegions.back();
+
+		VkDeviceSize lastMipSize = Utils::CalculateImageBufferSize(lastRegion.imageExtent.width, lastRegion.imageExtent.height, m_ImageSpecification.Format) * 6;
+		return static_cast<uint32_t>(lastRegion.bufferOffset + lastMipSize);
+	}
+
+	void VulkanTextureCubeMap::CopyToHostBuffer(Buffer& outBuffer)
+	{
+		Vector<VkBufferImageCopy> copyRegions = GetMipChainCopyRegions();
+		uint32_t bufferSize = GetMipChainBufferSize();
+
+		// Making a readback buffer to copy the image into
+		VkBuffer readbackBuffer;
+		VulkanMemoryInfo readbackBufferMemory;
+		VulkanAllocator::AllocateBuffer(bufferSize, { BufferUsage::TransferDst }, MemoryUsage::GPU_TO_CPU, readbackBuffer, readbackBufferMemory);
+
+		// Recording a temporary commandbuffer for copying
+		VkCommandBuffer cmdBuf = VulkanContext::GetCurrentDevice()->AllocateCommandBuffer(RenderQueueType::Graphics, true);
+
+		VkImageLayout imageLayout = m_ImageLayout;
+		TransitionLayout(cmdBuf, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, Utils::GetPipelineStageFlagsFromLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL));
+
+		vkCmdCopyImageToBuffer(cmdBuf, m_Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, readbackBuffer, (uint32_t)copyRegions.size(), copyRegions.data());
+
+		TransitionLayout(cmdBuf, imageLayout,
+			Utils::GetPipelineStageFlagsFromLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL), Utils::GetPipelineStageFlagsFromLayout(imageLayout));
+
+		// Ending the temporary commandbuffer (this waits for the copy to finish)
+		VulkanContext::GetCurrentDevice()->FlushCommandBuffer(cmdBuf);
+
+		// Copying the data
+		outBuffer.Allocate(bufferSize);
+
+		void* copyData;
+		VulkanAllocator::BindBuffer(readbackBuffer, readbackBufferMemory, &copyData);
+		memcpy(outBuffer.Data, copyData, static_cast<size_t>(bufferSize));
+		VulkanAllocator::UnbindBuffer(readbackBufferMemory);
+
+		VulkanAllocator::DeleteBuffer(readbackBuffer, readbackBufferMemory);
+	}
+
+	void VulkanTextureCubeMap::CopyFromHostBuffer(const Buffer& buffer)
+	{
+		Vector<VkBufferImageCopy> copyRegions = GetMipChainCopyRegions();
+		uint32_t bufferSize = GetMipChainBufferSize();
+		FROST_ASSERT(bool(buffer.Size == bufferSize), "The buffer doesn't match the cubemap's mip chain size!");
+
+		// Making a staging buffer to copy the data
+		VkBuffer stagingBuffer;
+		VulkanMemoryInfo stagingBufferMemory;
+		VulkanAllocator::AllocateBuffer(bufferSize, { BufferUsage::TransferSrc }, MemoryUsage::CPU_TO_GPU, stagingBuffer, stagingBufferMemory);
+
+		// Copying the data
+		void* copyData;
+		VulkanAllocator::BindBuffer(stagingBuffer, stagingBufferMemory, &copyData);
+		memcpy(copyData, buffer.Data, static_cast<size_t>(bufferSize));
+		VulkanAllocator::UnbindBuffer(stagingBufferMemory);
+
+		// Recording a temporary commandbuffer for copying
+		VkCommandBuffer cmdBuf = VulkanContext::GetCurrentDevice()->AllocateCommandBuffer(RenderQueueType::Graphics, true);
+
+		VkImageLayout imageLayout = m_ImageLayout;
+		TransitionLayout(cmdBuf, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, Utils::GetPipelineStageFlagsFromLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL));
+
+		vkCmdCopyBufferToImage(cmdBuf, stagingBuffer, m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)copyRegions.size(), copyRegions.data());
+
+		TransitionLayout(cmdBuf, imageLayout,
+			Utils::GetPipelineStageFlagsFromLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL), Utils::GetPipelineStageFlagsFromLayout(imageLayout));
+
+		// Ending the temporary commandbuffer for copying
+		VulkanContext::GetCurrentDevice()->FlushCommandBuffer(cmdBuf);
+
+		VulkanAllocator::DeleteBuffer(stagingBuffer, stagingBufferMemory);
+	}
+
 	void VulkanTextureCubeMap::UpdateDescriptor()
 	{
 		m_DescriptorInfo[DescriptorImageType::Sampled].imageView = m_ImageView;
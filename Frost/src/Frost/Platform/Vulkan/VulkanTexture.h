@@ -69,6 +69,12 @@ namespace Frost
 
 		void GenerateMipMaps(VkCommandBuffer cmdBuffer, VkImageLayout newImageLayout);
 
+		// Copies the whole mip chain from/to a tightly packed buffer (for every mip, the 6 faces are stored one after another)
+		// These are blocking operations and should only be used when loading/baking
+		void CopyToHostBuffer(Buffer& outBuffer);
+		void CopyFromHostBuffer(const Buffer& buffer);
+		uint32_t GetMipChainBufferSize() const;
+
 		virtual uint32_t GetWidth() const override { return m_ImageSpecification.Width; }
 		virtual uint32_t GetHeight() const override { return m_ImageSpecification.Height; }
 		virtual uint32_t GetMipChainLevels() const override { return m_MipLevelCount; }
@@ -97,6 +103,7 @@ namespace Frost
 	private:
 		void UpdateDescriptor();
 		void CalculateMipSizes();
+		Vector<VkBufferImageCopy> GetMipChainCopyRegions() const;
 	private:
 		VkImage m_Image = VK_NULL_HANDLE;
 		VulkanMemoryInfo m_ImageMemory;
@@ -57,6 +57,11 @@ namespace Frost
 		}
 	}
 
+	MeshSkeleton::MeshSkeleton(ozz::unique_ptr<ozz::animation::Skeleton> skeleton, const glm::mat3& skeletonTransform)
+		: m_Skeleton(std::move(skeleton)), m_SkeletonTransform(skeletonTransform)
+	{
+	}
+
 	MeshSkeleton::~MeshSkeleton()
 	{
 	}
@@ -98,6 +103,16 @@ namespace Frost
 		}
 	}
 
+	Animation::Animation(const std::string& name, ozz::unique_ptr<ozz::animation::Animation> animation, MeshAsset* mesh)
+		: m_Name(name), m_Animation(std::move(animation)), m_Skeleton(mesh->m_Skeleton)
+	{
+		if (m_Animation)
+		{
+			m_IsLoaded = true;
+			m_Duration = m_Animation->duration();
+		}
+	}
+
 	Animation::~Animation()
 	{
 	}
@@ -40,6 +40,7 @@ namespace Frost
 	{
 	public:
 		MeshSkeleton(const aiScene* scene);
+		MeshSkeleton(ozz::unique_ptr<ozz::animation::Skeleton> skeleton, const glm::mat3& skeletonTransform); // From an already built skeleton (cooked meshes)
 		virtual ~MeshSkeleton();
 
 		const ozz::animation::Skeleton& GetInternalSkeleton() const { return *m_Skeleton; }
@@ -54,6 +55,7 @@ namespace Frost
 	{
 	public:
 		Animation(const aiAnimation* animation, MeshAsset* mesh);
+		Animation(const std::string& name, ozz::unique_ptr<ozz::animation::Animation> animation, MeshAsset* mesh); // From an already built animation (cooked meshes)
 		virtual ~Animation();
 
 		const std::string& GetName() const { return m_Name; }
@@ -190,4 +192,4 @@ namespace Frost
 		friend class MeshAsset;
 	};
 
-}
\ No newline at end of file
+}
\ No newline at end of file
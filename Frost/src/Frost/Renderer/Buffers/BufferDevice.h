@@ -30,6 +30,13 @@ namespace Frost
 		uint64_t Size = 0;
 	};
 
+	// A byte range of a buffer (used for uploading only the parts that changed)
+	struct BufferRegion
+	{
+		uint64_t Offset = 0;
+		uint64_t Size = 0;
+	};
+
 	// A block of memory both on cpu/gpu memory
 	struct HeapBlock
 	{
@@ -37,7 +44,7 @@ namespace Frost
 		Buffer HostBuffer;              // CPU Memory
 	};
 
-	class BufferDevice
+	class BufferDevice : public RefCounted
 	{
 	public:
 		virtual ~BufferDevice() {}
@@ -46,6 +53,7 @@ namespace Frost
 		virtual BufferData GetBufferData() const = 0;
 		virtual void SetData(uint64_t size, void* data) = 0;
 		virtual void SetData(void* data) = 0;
+		virtual void SetData(void* data, const Vector<BufferRegion>& regions) = 0; // Copies only the regions (offsets are relative to `data`)
 
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
@@ -0,0 +1,208 @@
+#include "frostpch.h"
+#include "EnvironmentCache.h"
+
+#include "Frost/Project/Project.h"
+#include "Frost/Utils/FileSystem.h"
+#include "Frost/Utils/Hash.h"
+
+#include <iomanip>
+
+namespace Frost
+{
+	namespace Utils
+	{
+		static std::filesystem::path GetEnvironmentCacheDirectory()
+		{
+			return Project::GetProjectDirectory() / std::filesystem::path("Resources/Cache/Environment");
+		}
+
+		static void CreateEnvironmentCacheDirectoryIfNeeded()
+		{
+			std::filesystem::path cacheDirectory = GetEnvironmentCacheDirectory();
+			if (!std::filesystem::exists(cacheDirectory))
+				std::filesystem::create_directories(cacheDirectory);
+		}
+
+		static std::filesystem::path GetEnvironmentCacheFilepath(uint64_t cacheKey)
+		{
+			std::stringstream ss;
+			ss << std::hex << std::setw(16) << std::setfill('0') << cacheKey;
+			return GetEnvironmentCacheDirectory() / (ss.str() + ".fenv"); // fenv - Frost Environment
+		}
+	}
+
+	// Bump it when the file layout or the bake shaders change, so old entries are ignored
+	static constexpr uint32_t s_EnvironmentCacheVersion = 2;
+	static constexpr uint32_t s_EnvironmentCacheMagic = 0x564E4546; // "FENV"
+
+	// The cubemap headers are hashed with the data, so their sizes can't be shifted between each other (or their dimensions changed) unnoticed
+	static uint64_t GetEntryHash(const EnvironmentCacheHeader& header, const Byte* data)
+	{
+		uint64_t hash = Hash::GenerateFNVHash(header.CubeMaps, sizeof(header.CubeMaps));
+		return Hash::GenerateFNVHash(data, header.DataSize, hash);
+	}
+
+	uint64_t EnvironmentCache::GetCacheKey(const std::filesystem::path& sourceFilepath, const EnvironmentBakeSettings& settings)
+	{
+		if (!FileSystem::Exists(sourceFilepath))
+			return 0;
+
+		Buffer sourceBuffer = FileSystem::ReadBytes(sourceFilepath);
+		if (!sourceBuffer)
+			return 0;
+
+		uint64_t key = GetCacheKey(sourceBuffer, settings);
+		sourceBuffer.Release();
+		return key;
+	}
+
+	uint64_t EnvironmentCache::GetCacheKey(const Buffer& sourceData, const EnvironmentBakeSettings& settings)
+	{
+		uint64_t key = Hash::GenerateFNVHash(sourceData.Data, sourceData.Size);
+		key = Hash::Combine(key, s_EnvironmentCacheVersion);
+		key = Hash::Combine(key, settings.EnvironmentMapResolution);
+		key = Hash::Combine(key, settings.IrradianceMapResolution);
+		key = Hash::Combine(key, settings.IrradianceMapSamples);
+		key = Hash::Combine(key, static_cast<uint32_t>(settings.Format));
+		return key;
+	}
+
+	bool EnvironmentCache::Load(uint64_t cacheKey, EnvironmentBakeData& outBakeData)
+	{
+		if (cacheKey == 0) return false;
+
+		std::filesystem::path cacheFilepath = Utils::GetEnvironmentCacheFilepath(cacheKey);
+		if (!FileSystem::Exists(cacheFilepath))
+			return false;
+
+		std::error_code errorCode;
+		Buffer cacheBuffer;
+		if (std::filesystem::file_size(cacheFilepath, errorCode) >= sizeof(EnvironmentCacheHeader) && !errorCode)
+			cacheBuffer = FileSystem::ReadBytes(cacheFilepath);
+
+		bool isValid = Deserialize(cacheKey, cacheBuffer, outBakeData);
+		cacheBuffer.Release();
+
+		if (!isValid)
+		{
+			FROST_CORE_WARN("[EnvironmentCache] Cache entry '{0}' is corrupted or outdated, deleting it", cacheFilepath.string());
+			Invalidate(cacheKey);
+			return false;
+		}
+		return true;
+	}
+
+	void EnvironmentCache::Store(uint64_t cacheKey, const EnvironmentBakeData& bakeData)
+	{
+		if (cacheKey == 0) return;
+
+		Buffer cacheBuffer = Serialize(cacheKey, bakeData);
+		if (!cacheBuffer) return;
+
+		Utils::CreateEnvironmentCacheDirectoryIfNeeded();
+
+		// Write into a temporary file first, so a crash while writing can't leave a half written entry behind
+		std::filesystem::path cacheFilepath = Utils::GetEnvironmentCacheFilepath(cacheKey);
+		std::filesystem::path tempFilepath = cacheFilepath.string() + ".tmp";
+		bool success = FileSystem::WriteBytes(tempFilepath, cacheBuffer);
+		cacheBuffer.Release();
+
+		std::error_code errorCode;
+		if (success)
+			std::filesystem::rename(tempFilepath, cacheFilepath, errorCode);
+
+		if (!success || errorCode)
+		{
+			FROST_CORE_ERROR("[EnvironmentCache] Failed to write the cache entry '{0}'", cacheFilepath.string());
+			std::filesystem::remove(tempFilepath, errorCode);
+		}
+	}
+
+	Buffer EnvironmentCache::Serialize(uint64_t cacheKey, const EnvironmentBakeData& bakeData)
+	{
+		const EnvironmentCubeMapData* cubeMaps[3] = { &bakeData.RadianceMap, &bakeData.PrefilteredMap, &bakeData.IrradianceMap };
+
+		EnvironmentCacheHeader header{};
+		header.Magic = s_EnvironmentCacheMagic;
+		header.Version = s_EnvironmentCacheVersion;
+		header.CacheKey = cacheKey;
+		header.DataSize = 0;
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			if (!cubeMaps[i]->Data) return {};
+
+			header.CubeMaps[i].Width = cubeMaps[i]->Width;
+			header.CubeMaps[i].Height = cubeMaps[i]->Height;
+			header.CubeMaps[i].MipCount = cubeMaps[i]->MipCount;
+			header.CubeMaps[i].DataSize = cubeMaps[i]->Data.Size;
+			header.DataSize += cubeMaps[i]->Data.Size;
+		}
+
+		Buffer cacheBuffer;
+		cacheBuffer.Allocate(static_cast<uint32_t>(sizeof(EnvironmentCacheHeader) + header.DataSize));
+
+		uint32_t dataOffset = sizeof(EnvironmentCacheHeader);
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			cacheBuffer.Write(cubeMaps[i]->Data.Data, cubeMaps[i]->Data.Size, dataOffset);
+			dataOffset += cubeMaps[i]->Data.Size;
+		}
+
+		header.DataHash = GetEntryHash(header, (Byte*)cacheBuffer.Data + sizeof(EnvironmentCacheHeader));
+		cacheBuffer.Write(&header, sizeof(EnvironmentCacheHeader), 0);
+		return cacheBuffer;
+	}
+
+	bool EnvironmentCache::Deserialize(uint64_t cacheKey, const Buffer& cacheBuffer, EnvironmentBakeData& outBakeData)
+	{
+		// Validate the entry, before trusting anything that is written in it
+		if (!cacheBuffer || cacheBuffer.Size < sizeof(EnvironmentCacheHeader))
+			return false;
+
+		EnvironmentCacheHeader header;
+		memcpy(&header, cacheBuffer.Data, sizeof(EnvironmentCacheHeader));
+
+		uint64_t cubeMapsDataSize = 0;
+		for (auto& cubeMapHeader : header.CubeMaps)
+			cubeMapsDataSize += cubeMapHeader.DataSize;
+
+		const Byte* data = (const Byte*)cacheBuffer.Data + sizeof(EnvironmentCacheHeader);
+		bool isValid = header.Magic == s_EnvironmentCacheMagic &&
+		               header.Version == s_EnvironmentCacheVersion &&
+		               header.CacheKey == cacheKey &&
+		               header.DataSize == cubeMapsDataSize &&
+		               header.DataSize == cacheBuffer.Size - sizeof(EnvironmentCacheHeader) &&
+		               header.DataHash == GetEntryHash(header, data);
+		if (!isValid)
+			return false;
+
+		EnvironmentCubeMapData* cubeMaps[3] = { &outBakeData.RadianceMap, &outBakeData.PrefilteredMap, &outBakeData.IrradianceMap };
+
+		uint32_t dataOffset = 0;
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			const EnvironmentCacheCubeMapHeader& cubeMapHeader = header.CubeMaps[i];
+
+			cubeMaps[i]->Width = cubeMapHeader.Width;
+			cubeMaps[i]->Height = cubeMapHeader.Height;
+			cubeMaps[i]->MipCount = cubeMapHeader.MipCount;
+			cubeMaps[i]->Data.Allocate(cubeMapHeader.DataSize);
+			cubeMaps[i]->Data.Write((Byte*)data + dataOffset, cubeMapHeader.DataSize, 0);
+
+			dataOffset += cubeMapHeader.DataSize;
+		}
+		return true;
+	}
+
+	void EnvironmentCache::Invalidate(uint64_t cacheKey)
+	{
+		std::error_code errorCode;
+		std::filesystem::remove(Utils::GetEnvironmentCacheFilepath(cacheKey), errorCode);
+	}
+
+	void EnvironmentCache::Clear()
+	{
+		std::error_code errorCode;
+		std::filesystem::remove_all(Utils::GetEnvironmentCacheDirectory(), errorCode);
+	}
+}
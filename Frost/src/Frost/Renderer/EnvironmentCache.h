@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Frost/Core/Buffer.h"
+#include "Frost/Renderer/Image.h"
+
+#include <filesystem>
+
+namespace Frost
+{
+	// Settings which change the output of the environment map bake (all of them are part of the cache key)
+	struct EnvironmentBakeSettings
+	{
+		uint32_t EnvironmentMapResolution = 0;
+		uint32_t IrradianceMapResolution = 0;
+		uint32_t IrradianceMapSamples = 0;
+		ImageFormat Format = ImageFormat::None;
+	};
+
+	// One baked cubemap with its whole mip chain packed into one buffer (for every mip, the 6 faces are tightly packed)
+	struct EnvironmentCubeMapData
+	{
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t MipCount = 0;
+		Buffer Data;
+	};
+
+	struct EnvironmentBakeData
+	{
+		EnvironmentCubeMapData RadianceMap;
+		EnvironmentCubeMapData PrefilteredMap;
+		EnvironmentCubeMapData IrradianceMap;
+
+		void Release()
+		{
+			RadianceMap.Data.Release();
+			PrefilteredMap.Data.Release();
+			IrradianceMap.Data.Release();
+		}
+	};
+
+	// Written at the start of every cache entry, followed by the data of the 3 cubemaps
+	struct EnvironmentCacheCubeMapHeader
+	{
+		uint32_t Width;
+		uint32_t Height;
+		uint32_t MipCount;
+		uint32_t DataSize;
+	};
+
+	struct EnvironmentCacheHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t CacheKey;
+		EnvironmentCacheCubeMapHeader CubeMaps[3]; // Radiance, prefiltered, irradiance
+		uint64_t DataSize;
+		uint64_t DataHash;
+	};
+
+	// Disk cache for the baked IBL cubemaps of HDR environment maps (stored in `Resources/Cache/Environment` of the project).
+	// Entries are keyed by the hash of the HDR file's content plus the bake settings,
+	// so changing the environment map resolution (or the HDR itself) automatically produces a new entry.
+	class EnvironmentCache
+	{
+	public:
+		// Returns 0 if the source file couldn't be read
+		static uint64_t GetCacheKey(const std::filesystem::path& sourceFilepath, const EnvironmentBakeSettings& settings);
+		static uint64_t GetCacheKey(const Buffer& sourceData, const EnvironmentBakeSettings& settings);
+
+		static bool Load(uint64_t cacheKey, EnvironmentBakeData& outBakeData);
+		static void Store(uint64_t cacheKey, const EnvironmentBakeData& bakeData);
+
+		static void Invalidate(uint64_t cacheKey);
+		static void Clear();
+
+		// In-memory layout of an entry (header + cubemaps), used by `Load`/`Store`. The returned buffer is owned by the caller,
+		// and is empty if one of the cubemaps has no data
+		static Buffer Serialize(uint64_t cacheKey, const EnvironmentBakeData& bakeData);
+		// Returns false if the entry is corrupted, was written by another version or belongs to another key
+		static bool Deserialize(uint64_t cacheKey, const Buffer& cacheBuffer, EnvironmentBakeData& outBakeData);
+	};
+}
@@ -114,7 +114,7 @@ namespace Frost
 		ImageMemoryProperties MemoryProperties = ImageMemoryProperties::GPU_ONLY;
 	};
 
-	class Image
+	class Image : public RefCounted
 	{
 	public:
 		virtual ~Image() {}
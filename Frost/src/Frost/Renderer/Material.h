@@ -17,7 +17,7 @@ namespace Frost
 {
 	enum class GraphicsType;
 
-	class Material
+	class Material : public RefCounted
 	{
 	public:
 		virtual ~Material() {}
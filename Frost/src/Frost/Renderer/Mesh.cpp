@@ -2,12 +2,14 @@
 #include "Mesh.h"
 
 #include "Frost/Utils/Timer.h"
+#include "Frost/Utils/Hash.h"
 #include "Frost/Asset/AssetManager.h"
 
 #include "Frost/Renderer/Renderer.h"
 #include "Frost/Renderer/Animation.h"
 #include "Frost/Renderer/OZZAssimpImporter.h"
 #include "Frost/Renderer/BindlessAllocator.h"
+#include "Frost/Renderer/MeshCache.h"
 
 #include "Frost/EntitySystem/Scene.h"
 #include "Frost/EntitySystem/Entity.h"
@@ -34,14 +36,27 @@ namespace Frost
 {
 	static DefaultMeshStorage s_DefaultMeshStorage;
 
-	Ref<MeshAsset> MeshAsset::Load(const std::string& filepath, MaterialInstance material /*= {}*/)
+	uint64_t MeshImportSettings::GetHash() const
 	{
-		return CreateRef<MeshAsset>(filepath, material);
+		uint32_t lodCount = glm::clamp(LODCount, 1u, MaxMeshLODCount);
+
+		uint64_t hash = Hash::Combine(Hash::FNVOffsetBasis, lodCount);
+		for (uint32_t lod = 1; lod < lodCount; lod++)
+		{
+			hash = Hash::Combine(hash, LODs[lod - 1].IndexRatio);
+			hash = Hash::Combine(hash, LODs[lod - 1].TargetError);
+		}
+		return hash;
+	}
+
+	Ref<MeshAsset> MeshAsset::Load(const std::string& filepath, MaterialInstance material /*= {}*/, const MeshImportSettings& importSettings /*= {}*/)
+	{
+		return CreateRef<MeshAsset>(filepath, material, importSettings);
 	}
 
 	Ref<MeshAsset> MeshAsset::LoadCustomMesh(const std::string& filepath, MaterialInstance material, MeshBuildSettings meshBuildSettings /*= {}*/)
 	{
-		return CreateRef<MeshAsset>(filepath, material, meshBuildSettings);
+		return CreateRef<MeshAsset>(filepath, material, MeshImportSettings{}, meshBuildSettings);
 	}
 
 	void MeshAsset::InitDefaultMeshes()
@@ -91,10 +106,33 @@ namespace Frost
 			aiProcess_LimitBoneWeights |        // If more than N (=4) bone weights, discard least influencing bones and renormalise sum to 1
 			aiProcess_ValidateDataStructure;    // Validation
 
+		static std::string GetMaterialTexturePath(const std::string& meshFilepath, const aiString& aiTexPath)
+		{
+			std::filesystem::path path = meshFilepath;
+			auto parentPath = path.parent_path();
+			parentPath /= std::string(aiTexPath.data);
+			std::string texturePath = parentPath.string();
+			std::replace(texturePath.begin(), texturePath.end(), '/', '\\'); // This is the standart rule of paths in this engine
+			return texturePath;
+		}
 	}
 
-	MeshAsset::MeshAsset(const std::string& filepath, MaterialInstance material, MeshBuildSettings meshBuildSettings)
-		: m_Material(material), m_Filepath(filepath)
+	MeshAsset::MeshAsset(const std::string& filepath, MaterialInstance material, const MeshImportSettings& importSettings, MeshBuildSettings meshBuildSettings)
+		: m_Material(material), m_Filepath(filepath), m_ImportSettings(importSettings)
+	{
+		// The cooked version of the mesh is used whenever it's up to date, so Assimp and meshoptimizer only run on the first import
+		Vector<MaterialSlot> materialSlots;
+		if (!MeshCache::LoadOrImport(filepath, *this, materialSlots))
+			return;
+		m_IsLoaded = true;
+
+		CreateBuffers(meshBuildSettings);
+
+		if (meshBuildSettings.LoadMaterials)
+			LoadMaterials(materialSlots);
+	}
+
+	bool MeshAsset::ImportFromFile(const std::string& filepath, Vector<MaterialSlot>& outMaterialSlots)
 	{
 		m_Importer = CreateScope<Assimp::Importer>();
 
@@ -103,12 +141,11 @@ namespace Frost
 		if ((!scene || !scene->HasMeshes()))
 		{
 			FROST_CORE_ERROR(m_Importer->GetErrorString());
-			return;
+			return false;
 		}
 		FROST_ASSERT(!(!scene || !scene->HasMeshes()), m_Importer->GetErrorString());
 
 		m_Scene = scene;
-		m_IsLoaded = true;
 		m_IsAnimated = scene->HasAnimations();
 		//m_IsAnimated = false;
 		
@@ -119,8 +156,9 @@ namespace Frost
 
 
 
-		Ref<Texture2D> whiteTexture = Renderer::GetWhiteLUT();
 #if 0
+		Ref<Texture2D> whiteTexture = Renderer::GetWhiteLUT();
+
 		// Allocate texture slots before storing the vertex data, because we are using bindless
 		// We are using `scene->mNumMaterials * 4`, because each mesh has a albedo, roughness, metalness and normal map
 		for (uint32_t i = 0; i < scene->mNumMaterials * 4; i++)
@@ -278,67 +316,57 @@ namespace Frost
 					1.1f
 				);
 
-#if 0
-				float currentThreshold = 1.0f;
-
-				Vector<Index> lodIndices(indexCount);
-				for (uint32_t lod = 1; lod <= 2; lod++)
+				// LOD chain (LOD 0 is the optimized submesh itself). The simplifier works on the submesh's own vertex range,
+				// so it doesn't have to go through all the vertices that were imported before this submesh
+				uint32_t lodCount = glm::clamp(m_ImportSettings.LODCount, 1u, MaxMeshLODCount);
+				if (lodCount > 1)
 				{
-					currentThreshold = currentThreshold / 2.0f;
-					size_t targetIndexCount = size_t(indexCount * currentThreshold);
-					float targetError = 0.01f;
-					unsigned int options = meshopt_SimplifyLockBorder; // meshopt_SimplifyX flags, 0 is a safe default
-
+					const float* submeshPositions = (const float*)((Byte*)verticesData + uint64_t(maxIndex) * verticesDataStructureSize);
+					size_t submeshVertexCount = verticesSize - maxIndex;
 
-					float lodError = 0.0f;
-					size_t finalIndicesCount = meshopt_simplify(
-						(uint32_t*)lodIndices.data(), (uint32_t*)lastIndexPointer, indexCount,
-						(float*)verticesData, verticesSize, verticesDataStructureSize,
-						targetIndexCount, targetError, options, &lodError
-					);
+					Vector<uint32_t> submeshIndices(indexCount);
+					for (uint32_t i = 0; i < indexCount; i++)
+						submeshIndices[i] = ((uint32_t*)lastIndexPointer)[i] - maxIndex;
 
-					lodIndices.resize(finalIndicesCount / 3);
+					// The simplifier's error is relative to the submesh extents, while the runtime selection needs it in object space
+					float errorScale = meshopt_simplifyScale(submeshPositions, submeshVertexCount, verticesDataStructureSize);
 
-					meshopt_optimizeVertexCache((uint32_t*)lodIndices.data(), (uint32_t*)lodIndices.data(), finalIndicesCount, verticesSize);
-
-					m_IndicesLODs[lod].insert(m_IndicesLODs[lod].end(), lodIndices.begin(), lodIndices.end());
-
-
-					SubmeshLOD& submeshLOD = m_SubmeshLODs[lod].emplace_back();
-					submeshLOD.BaseIndex = 0; // TODO:??
-					submeshLOD.IndexCount = finalIndicesCount;
+					Vector<uint32_t> lodIndices(indexCount);
+					float previousLODError = 0.0f;
+					for (uint32_t lod = 1; lod < lodCount; lod++)
+					{
+						const MeshImportSettings::LODLevel& lodLevel = m_ImportSettings.LODs[lod - 1];
+						size_t targetIndexCount = size_t(indexCount * glm::clamp(lodLevel.IndexRatio, 0.0f, 1.0f)) / 3 * 3;
+						unsigned int options = meshopt_SimplifyLockBorder; // Keeps the submeshes watertight with each other
+
+						float lodError = 0.0f;
+						size_t lodIndexCount = meshopt_simplify(
+							lodIndices.data(), submeshIndices.data(), indexCount,
+							submeshPositions, submeshVertexCount, verticesDataStructureSize,
+							targetIndexCount, lodLevel.TargetError, options, &lodError
+						);
+						meshopt_optimizeVertexCache(lodIndices.data(), lodIndices.data(), lodIndexCount, submeshVertexCount);
+
+						// The errors have to grow with the LOD, otherwise the selection could skip a level back and forth
+						previousLODError = glm::max(previousLODError, lodError * errorScale);
+
+						Vector<Index>& indicesLOD = m_IndicesLODs[lod];
+						SubmeshLOD& submeshLOD = m_SubmeshLODs[lod].emplace_back();
+						submeshLOD.BaseIndex = static_cast<uint32_t>(indicesLOD.size()) * 3; // Offsetted into the global index buffer later
+						submeshLOD.IndexCount = static_cast<uint32_t>(lodIndexCount);
+						submeshLOD.Error = previousLODError;
+
+						for (size_t i = 0; i < lodIndexCount; i += 3)
+							indicesLOD.push_back({ maxIndex + lodIndices[i], maxIndex + lodIndices[i + 1], maxIndex + lodIndices[i + 2] });
+					}
 				}
-#endif
 			}
 			maxIndex = subMeshLastIndex + 1;
 
 			//FROST_CORE_INFO(m);
 		}
 
-#if 0
-		{
-			// Add the LOD 0
-			m_GlobalSubmeshIndices.insert(m_GlobalSubmeshIndices.end(), m_SubmeshIndices.begin(), m_SubmeshIndices.end());
-
-			// Set the offset from the LOD 0 of the mesh
-			uint32_t submeshLODIndicesOffset = m_SubmeshIndices.size() * 3;
-
-			// Add the rest of LODs
-			for (uint32_t lod = 1; lod <= 1; lod++)
-			{
-				// Offset the indices of the submesh to the global index buffer
-				for (uint32_t submeshIndex = 0; submeshIndex < m_SubmeshLODs[lod].size(); submeshIndex++)
-				{
-					SubmeshLOD& submeshLOD = m_SubmeshLODs[lod][submeshIndex];
-					submeshLOD.BaseIndex = submeshLODIndicesOffset;
-
-					submeshLODIndicesOffset += submeshLOD.IndexCount;
-				}
-
-				m_GlobalSubmeshIndices.insert(m_GlobalSubmeshIndices.end(), m_IndicesLODs[lod].begin(), m_IndicesLODs[lod].end());
-			}
-		}
-#endif
+		BuildGlobalSubmeshIndices();
 
 
 
@@ -413,10 +441,109 @@ namespace Frost
 			}
 		}
 
-		
 
+
+		// Material slots (their textures are loaded afterwards, in `LoadMaterials`)
+		outMaterialSlots.resize(scene->mNumMaterials);
+		for (uint32_t i = 0; i < scene->mNumMaterials; i++)
+		{
+			auto aiMaterial = scene->mMaterials[i];
+			MaterialSlot& materialSlot = outMaterialSlots[i];
+
+			auto aiMaterialName = aiMaterial->GetName();
+			materialSlot.Name = aiMaterialName.C_Str();
+
+			aiColor3D aiColor, aiEmission;
+			// Getting the albedo color
+			if (aiMaterial->Get(AI_MATKEY_COLOR_DIFFUSE, aiColor) == AI_SUCCESS)
+			{
+				glm::vec3 materialColor = { aiColor.r, aiColor.g, aiColor.b };
+				materialSlot.AlbedoColor = glm::vec4(materialColor, 1.0f);
+			}
+
+			// Geting the emission factor
+			if (aiMaterial->Get(AI_MATKEY_COLOR_EMISSIVE, aiEmission) == AI_SUCCESS)
+			{
+				materialSlot.EmissionFactor = aiEmission.r;
+			}
+
+
+			float shininess, metalness;
+			// Getting the shininess/roughness factor
+			if (aiMaterial->Get(AI_MATKEY_SHININESS, shininess) != aiReturn_SUCCESS)
+				shininess = 80.0f; // Default value
+
+			// Getting the metalness factor
+			if (aiMaterial->Get(AI_MATKEY_REFLECTIVITY, metalness) != aiReturn_SUCCESS)
+				metalness = 0.0f;
+
+			// Clamping the values
+			float roughness = 1.0f - glm::sqrt(shininess / 100.0f);
+			if (roughness == 1.0f) roughness = 0.99f;
+
+			materialSlot.RoughnessFactor = roughness;
+			materialSlot.MetalnessFactor = metalness;
+
+
+			// Albedo Map
+			aiString aiTexPath;
+			if (aiMaterial->GetTexture(aiTextureType_DIFFUSE, 0, &aiTexPath) == AI_SUCCESS)
+				materialSlot.Textures.AlbedoFilepath = Utils::GetMaterialTexturePath(filepath, aiTexPath);
+
+			// Normal map
+			if (aiMaterial->GetTexture(aiTextureType_NORMALS, 0, &aiTexPath) == AI_SUCCESS)
+				materialSlot.Textures.NormalMapFilepath = Utils::GetMaterialTexturePath(filepath, aiTexPath);
+
+			// Roughness map
+			if (aiMaterial->GetTexture(aiTextureType_SHININESS, 0, &aiTexPath) == AI_SUCCESS)
+				materialSlot.Textures.RoughnessMapFilepath = Utils::GetMaterialTexturePath(filepath, aiTexPath);
+
+			// Metalness map
+			for (uint32_t p = 0; p < aiMaterial->mNumProperties; p++)
+			{
+				auto prop = aiMaterial->mProperties[p];
+
+				if (prop->mType == aiPTI_String)
+				{
+					std::string key = prop->mKey.data;
+					if (key == "$raw.ReflectionFactor|file")
+					{
+						materialSlot.Textures.MetalnessMapFilepath = Utils::GetMaterialTexturePath(filepath, aiTexPath);
+						break;
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void MeshAsset::BuildGlobalSubmeshIndices()
+	{
+		// LOD 0 uses the optimized submesh indices as they are
+		m_GlobalSubmeshIndices = m_SubmeshIndices;
+
+		Vector<SubmeshLOD>& submeshesLOD0 = m_SubmeshLODs[0];
+		submeshesLOD0.clear();
+		for (const Submesh& submesh : m_Submeshes)
+			submeshesLOD0.push_back({ submesh.BaseIndex, submesh.IndexCount, 0.0f });
+
+		// The rest of the LODs are appended after it, so all of them can be drawn from a single index buffer
+		for (uint32_t lod = 1; lod < m_SubmeshLODs.size(); lod++)
+		{
+			uint32_t lodBaseIndex = static_cast<uint32_t>(m_GlobalSubmeshIndices.size()) * 3;
+			for (SubmeshLOD& submeshLOD : m_SubmeshLODs[lod])
+				submeshLOD.BaseIndex += lodBaseIndex;
+
+			const Vector<Index>& indicesLOD = m_IndicesLODs[lod];
+			m_GlobalSubmeshIndices.insert(m_GlobalSubmeshIndices.end(), indicesLOD.begin(), indicesLOD.end());
+		}
+	}
+
+	void MeshAsset::CreateBuffers(const MeshBuildSettings& meshBuildSettings)
+	{
 		m_SubmeshIndexBuffers = IndexBuffer::Create(m_SubmeshIndices.data(), (uint32_t)m_SubmeshIndices.size() * sizeof(Index));
-		//m_GlobalSubmeshIndexBuffers = IndexBuffer::Create(m_GlobalSubmeshIndices.data(), (uint32_t)m_GlobalSubmeshIndices.size() * sizeof(Index));
+		m_GlobalSubmeshIndexBuffers = IndexBuffer::Create(m_GlobalSubmeshIndices.data(), (uint32_t)m_GlobalSubmeshIndices.size() * sizeof(Index));
 
 		// Vertex/Index buffer
 		if (m_IsAnimated)
@@ -442,121 +569,77 @@ namespace Frost
 #endif
 		}
 
-		// Materials
-		if (scene->HasMaterials() && meshBuildSettings.LoadMaterials)
-		{
-			//m_Textures.reserve(scene->mNumMaterials);
-			m_TexturesList.resize(scene->mNumMaterials * 4);
-			m_MaterialData.resize(scene->mNumMaterials);
-			m_MaterialNames.resize(scene->mNumMaterials);
 
-			for (uint32_t i = 0; i < scene->mNumMaterials; i++)
-			{
-				// Albedo -         vec4        (16 bytes)
-				// Roughness -      float       (4 bytes)
-				// Metalness -      float       (4 bytes)
-				// Emission -       float       (4 bytes)
-				// UseNormalMap -   uint32_t    (4 bytes)
-				// Texture IDs -    4 uint32_t  (16 bytes)
-				m_MaterialData[i].Allocate(48);
-
-				// Fill up the data in the correct order for us to copy it later
-				DataStorage& materialData = m_MaterialData[i];
-				materialData.Add("AlbedoColor", glm::vec4(0.0f));
-				materialData.Add("EmissionFactor", 0.0f);
-				materialData.Add("RoughnessFactor", 0.0f);
-				materialData.Add("MetalnessFactor", 0.0f);
-
-				materialData.Add("UseNormalMap", 0);
-
-				materialData.Add("AlbedoTexture", 0);
-				materialData.Add("RoughnessTexture", 0);
-				materialData.Add("MetalnessTexture", 0);
-				materialData.Add("NormalTexture", 0);
-
-
-				// Each mesh has 4 textures, and se we allocated numMaterials * 4 texture slots.
-				uint32_t albedoTextureIndex = (i * 4) + 0;
-				uint32_t roughnessTextureIndex = (i * 4) + 1;
-				uint32_t metalnessTextureIndex = (i * 4) + 2;
-				uint32_t normalMapTextureIndex = (i * 4) + 3;
-
-
-				//m_MaterialData[i].Set("AlbedoTexture", m_TextureAllocatorSlots[albedoTextureIndex]);
-				//m_MaterialData[i].Set("NormalTexture", m_TextureAllocatorSlots[normalMapTextureIndex]);
-				//m_MaterialData[i].Set("RoughnessTexture", m_TextureAllocatorSlots[roughnessTextureIndex]);
-				//m_MaterialData[i].Set("MetalnessTexture", m_TextureAllocatorSlots[metalnessTextureIndex]);
+	}
 
-				auto aiMaterial = scene->mMaterials[i];
+	void MeshAsset::LoadMaterials(const Vector<MaterialSlot>& materialSlots)
+	{
+		Ref<Texture2D> whiteTexture = Renderer::GetWhiteLUT();
 
-				auto aiMaterialName = aiMaterial->GetName();
-				m_MaterialNames[i] = aiMaterialName.C_Str();
+		//m_Textures.reserve(materialSlots.size());
+		m_TexturesList.resize(materialSlots.size() * 4);
+		m_MaterialData.resize(materialSlots.size());
+		m_MaterialNames.resize(materialSlots.size());
 
-				uint32_t textureCount = aiMaterial->GetTextureCount(aiTextureType_DIFFUSE);
+		for (uint32_t i = 0; i < materialSlots.size(); i++)
+		{
+			const MaterialSlot& materialSlot = materialSlots[i];
 
-				aiColor3D aiColor, aiEmission;
-				// Getting the albedo color
-				if (aiMaterial->Get(AI_MATKEY_COLOR_DIFFUSE, aiColor) == AI_SUCCESS)
-				{
-					glm::vec3 materialColor = { aiColor.r, aiColor.g, aiColor.b };
+			// Albedo -         vec4        (16 bytes)
+			// Roughness -      float       (4 bytes)
+			// Metalness -      float       (4 bytes)
+			// Emission -       float       (4 bytes)
+			// UseNormalMap -   uint32_t    (4 bytes)
+			// Texture IDs -    4 uint32_t  (16 bytes)
+			m_MaterialData[i].Allocate(48);
 
-					m_MaterialData[i].Set("AlbedoColor", glm::vec4(materialColor, 1.0f));
-				}
+			// Fill up the data in the correct order for us to copy it later
+			DataStorage& materialData = m_MaterialData[i];
+			materialData.Add("AlbedoColor", glm::vec4(0.0f));
+			materialData.Add("EmissionFactor", 0.0f);
+			materialData.Add("RoughnessFactor", 0.0f);
+			materialData.Add("MetalnessFactor", 0.0f);
 
-				// Geting the emission factor
-				if (aiMaterial->Get(AI_MATKEY_COLOR_EMISSIVE, aiEmission) == AI_SUCCESS)
-				{
-					m_MaterialData[i].Set("EmissionFactor", aiEmission.r);
-				}
+			materialData.Add("UseNormalMap", 0);
 
+			materialData.Add("AlbedoTexture", 0);
+			materialData.Add("RoughnessTexture", 0);
+			materialData.Add("MetalnessTexture", 0);
+			materialData.Add("NormalTexture", 0);
 
-				float shininess, metalness;
-				// Getting the shininess/roughness factor
-				if (aiMaterial->Get(AI_MATKEY_SHININESS, shininess) != aiReturn_SUCCESS)
-					shininess = 80.0f; // Default value
 
-				// Getting the metalness factor
-				if (aiMaterial->Get(AI_MATKEY_REFLECTIVITY, metalness) != aiReturn_SUCCESS)
-					metalness = 0.0f;
+			// Each mesh has 4 textures, and se we allocated numMaterials * 4 texture slots.
+			uint32_t albedoTextureIndex = (i * 4) + 0;
+			uint32_t roughnessTextureIndex = (i * 4) + 1;
+			uint32_t metalnessTextureIndex = (i * 4) + 2;
+			uint32_t normalMapTextureIndex = (i * 4) + 3;
 
-				// Clamping the values
-				float roughness = 1.0f - glm::sqrt(shininess / 100.0f);
-				if (roughness == 1.0f) roughness = 0.99f;
+			m_MaterialNames[i] = materialSlot.Name;
 
-				m_MaterialData[i].Set("RoughnessFactor", roughness);
-				m_MaterialData[i].Set("MetalnessFactor", metalness);
+			m_MaterialData[i].Set("AlbedoColor", materialSlot.AlbedoColor);
+			m_MaterialData[i].Set("EmissionFactor", materialSlot.EmissionFactor);
+			m_MaterialData[i].Set("RoughnessFactor", materialSlot.RoughnessFactor);
+			m_MaterialData[i].Set("MetalnessFactor", materialSlot.MetalnessFactor);
 
 
 
-				// Albedo Map
-				aiString aiTexPath;
-				bool hasAlbedoMap = aiMaterial->GetTexture(aiTextureType_DIFFUSE, 0, &aiTexPath) == AI_SUCCESS;
-				if (hasAlbedoMap)
+			// Albedo Map
+			if (!materialSlot.Textures.AlbedoFilepath.empty())
+			{
+				const std::string& texturePath = materialSlot.Textures.AlbedoFilepath;
+
+				TextureSpecification textureSpec{};
+				textureSpec.Usage = ImageUsage::ReadOnly;
+				textureSpec.Format = ImageFormat::RGBA8;
+				textureSpec.UseMips = true;
+				textureSpec.FlipTexture = false;
+				Ref<Texture2D> texture = AssetManager::GetOrLoadAsset<Texture2D>(texturePath, (void*)&textureSpec);
+				if (texture)
 				{
-					std::filesystem::path path = filepath;
-					auto parentPath = path.parent_path();
-					parentPath /= std::string(aiTexPath.data);
-					std::string texturePath = parentPath.string();
-					std::replace(texturePath.begin(), texturePath.end(), '/', '\\'); // This is the standart rule of paths in this engine
-
-					TextureSpecification textureSpec{};
-					textureSpec.Usage = ImageUsage::ReadOnly;
-					textureSpec.Format = ImageFormat::RGBA8;
-					textureSpec.UseMips = true;
-					textureSpec.FlipTexture = false;
-					Ref<Texture2D> texture = AssetManager::GetOrLoadAsset<Texture2D>(texturePath, (void*)&textureSpec);
-					if (texture)
+					if (texture->Loaded())
 					{
-						if (texture->Loaded())
-						{
-							texture->GenerateMipMaps();
-							m_TexturesList[albedoTextureIndex] = texture;
-						}
-						else
-						{
-							FROST_CORE_ERROR("Couldn't load texture: {0}", texturePath);
-							m_TexturesList[albedoTextureIndex] = whiteTexture;
-						}
+						texture->GenerateMipMaps();
+						m_TexturesList[albedoTextureIndex] = texture;
 					}
 					else
 					{
@@ -566,43 +649,37 @@ namespace Frost
 				}
 				else
 				{
+					FROST_CORE_ERROR("Couldn't load texture: {0}", texturePath);
 					m_TexturesList[albedoTextureIndex] = whiteTexture;
 				}
+			}
+			else
+			{
+				m_TexturesList[albedoTextureIndex] = whiteTexture;
+			}
 
 
-				// Normal map
-				bool hasNormalMap = aiMaterial->GetTexture(aiTextureType_NORMALS, 0, &aiTexPath) == AI_SUCCESS;
-				if (hasNormalMap)
+			// Normal map
+			if (!materialSlot.Textures.NormalMapFilepath.empty())
+			{
+				const std::string& texturePath = materialSlot.Textures.NormalMapFilepath;
+
+				TextureSpecification textureSpec{};
+				textureSpec.Usage = ImageUsage::ReadOnly;
+				textureSpec.FlipTexture = true;
+				Ref<Texture2D> texture = AssetManager::GetOrLoadAsset<Texture2D>(texturePath, (void*)&textureSpec);
+				if (texture)
 				{
-					std::filesystem::path path = filepath;
-					auto parentPath = path.parent_path();
-					parentPath /= std::string(aiTexPath.data);
-					std::string texturePath = parentPath.string();
-					std::replace(texturePath.begin(), texturePath.end(), '/', '\\'); // This is the standart rule of paths in this engine
-
-					TextureSpecification textureSpec{};
-					textureSpec.Usage = ImageUsage::ReadOnly;
-					textureSpec.FlipTexture = true;
-					Ref<Texture2D> texture = AssetManager::GetOrLoadAsset<Texture2D>(texturePath, (void*)&textureSpec);
-					if (texture)
+					if (texture->Loaded())
 					{
-						if (texture->Loaded())
-						{
-							m_TexturesList[normalMapTextureIndex] = texture;
-							m_MaterialData[i].Set("UseNormalMap", uint32_t(1));
-
-							// If the normal map uses BC5 compression, then we should indicate that in the pixel shader,
-							// the Blue channel will be computed with R and G channel.
-							if (texture->GetSpecification().Format == ImageFormat::BC5)
-							{
-								m_MaterialData[i].Set("UseNormalMap", uint32_t(2));
-							}
-						}
-						else
+						m_TexturesList[normalMapTextureIndex] = texture;
+						m_MaterialData[i].Set("UseNormalMap", uint32_t(1));
+
+						// If the normal map uses BC5 compression, then we should indicate that in the pixel shader,
+						// the Blue channel will be computed with R and G channel.
+						if (texture->GetSpecification().Format == ImageFormat::BC5)
 						{
-							FROST_CORE_ERROR("Couldn't load normal texture: {0}", texturePath);
-							m_TexturesList[normalMapTextureIndex] = whiteTexture;
-							m_MaterialData[i].Set("UseNormalMap", uint32_t(0));
+							m_MaterialData[i].Set("UseNormalMap", uint32_t(2));
 						}
 					}
 					else
@@ -614,36 +691,32 @@ namespace Frost
 				}
 				else
 				{
+					FROST_CORE_ERROR("Couldn't load normal texture: {0}", texturePath);
 					m_TexturesList[normalMapTextureIndex] = whiteTexture;
 					m_MaterialData[i].Set("UseNormalMap", uint32_t(0));
 				}
+			}
+			else
+			{
+				m_TexturesList[normalMapTextureIndex] = whiteTexture;
+				m_MaterialData[i].Set("UseNormalMap", uint32_t(0));
+			}
+
 
+			// Roughness map
+			if (!materialSlot.Textures.RoughnessMapFilepath.empty())
+			{
+				const std::string& texturePath = materialSlot.Textures.RoughnessMapFilepath;
 
-				// Roughness map
-				bool hasRoughnessMap = aiMaterial->GetTexture(aiTextureType_SHININESS, 0, &aiTexPath) == AI_SUCCESS;
-				if (hasRoughnessMap)
+				TextureSpecification textureSpec{};
+				textureSpec.Usage = ImageUsage::ReadOnly;
+				textureSpec.FlipTexture = true;
+				Ref<Texture2D> texture = AssetManager::GetOrLoadAsset<Texture2D>(texturePath, (void*)&textureSpec);
+				if (texture)
 				{
-					std::filesystem::path path = filepath;
-					auto parentPath = path.parent_path();
-					parentPath /= std::string(aiTexPath.data);
-					std::string texturePath = parentPath.string();
-					std::replace(texturePath.begin(), texturePath.end(), '/', '\\'); // This is the standart rule of paths in this engine
-
-					TextureSpecification textureSpec{};
-					textureSpec.Usage = ImageUsage::ReadOnly;
-					textureSpec.FlipTexture = true;
-					Ref<Texture2D> texture = AssetManager::GetOrLoadAsset<Texture2D>(texturePath, (void*)&textureSpec);
-					if (texture)
+					if (texture->Loaded())
 					{
-						if (texture->Loaded())
-						{
-							m_TexturesList[roughnessTextureIndex] = texture;
-						}
-						else
-						{
-							FROST_CORE_ERROR("Couldn't load roughess texture: {0}", texturePath);
-							m_TexturesList[roughnessTextureIndex] = whiteTexture;
-						}
+						m_TexturesList[roughnessTextureIndex] = texture;
 					}
 					else
 					{
@@ -653,77 +726,32 @@ namespace Frost
 				}
 				else
 				{
+					FROST_CORE_ERROR("Couldn't load roughess texture: {0}", texturePath);
 					m_TexturesList[roughnessTextureIndex] = whiteTexture;
 				}
+			}
+			else
+			{
+				m_TexturesList[roughnessTextureIndex] = whiteTexture;
+			}
 
 
-				bool metalnessTextureFound = false;
-				for (uint32_t p = 0; p < aiMaterial->mNumProperties; p++)
-				{
-					auto prop = aiMaterial->mProperties[p];
-
-					if (prop->mType == aiPTI_String)
-					{
-						uint32_t strLength = *(uint32_t*)prop->mData;
-						std::string str(prop->mData + 4, strLength);
-
-						std::string key = prop->mKey.data;
-						if (key == "$raw.ReflectionFactor|file")
-						{
-							std::filesystem::path path = filepath;
-							auto parentPath = path.parent_path();
-							parentPath /= std::string(aiTexPath.data);
-							std::string texturePath = parentPath.string();
-							std::replace(texturePath.begin(), texturePath.end(), '/', '\\'); // This is the standart rule of paths in this engine
-
-							TextureSpecification textureSpec{};
-							textureSpec.Usage = ImageUsage::ReadOnly;
-							textureSpec.FlipTexture = true;
-							Ref<Texture2D> texture = AssetManager::GetOrLoadAsset<Texture2D>(texturePath, (void*)&textureSpec);
-							if (texture)
-							{
-								if (texture->Loaded())
-								{
-									metalnessTextureFound = true;
-
-									m_TexturesList[metalnessTextureIndex] = whiteTexture;
-								}
-								else
-								{
-									FROST_CORE_ERROR("Couldn't load metalness texture: {0}", texturePath);
-								}
-							}
-							else
-							{
-								FROST_CORE_ERROR("Couldn't load metalness texture: {0}", texturePath);
-							}
-							break;
-						}
-					}
-
-				}
+			// Metalness map (the metalness texture isn't used yet, so a white texture is bound either way)
+			if (!materialSlot.Textures.MetalnessMapFilepath.empty())
+			{
+				const std::string& texturePath = materialSlot.Textures.MetalnessMapFilepath;
 
-				if (!metalnessTextureFound)
+				TextureSpecification textureSpec{};
+				textureSpec.Usage = ImageUsage::ReadOnly;
+				textureSpec.FlipTexture = true;
+				Ref<Texture2D> texture = AssetManager::GetOrLoadAsset<Texture2D>(texturePath, (void*)&textureSpec);
+				if (!texture || !texture->Loaded())
 				{
-					m_TexturesList[metalnessTextureIndex] = whiteTexture;
+					FROST_CORE_ERROR("Couldn't load metalness texture: {0}", texturePath);
 				}
 			}
+			m_TexturesList[metalnessTextureIndex] = whiteTexture;
 		}
-		else
-		{
-			//auto mi = Material::Create(m_MeshShader, "MeshShader-Default");
-			//mi->Set("u_AlbedoTexture", whiteTexture);
-			//mi->Set("u_NormalTexture", whiteTexture);
-			//mi->Set("u_MetalnessTexture", whiteTexture);
-
-			//mi->Set("u_MaterialUniform.AlbedoColor", glm::vec3(0.8f));
-			//mi->Set("u_MaterialUniform.Emission", 0.0f);
-			//mi->Set("u_MaterialUniform.Roughness", 0.0f);
-			//mi->Set("u_MaterialUniform.Metalness", 0.0f);
-			//mi->Set("u_MaterialUniform.UseNormalMap", uint32_t(0));
-		}
-
-		return;
 	}
 
 	MeshAsset::MeshAsset(const Vector<Vertex>& vertices, const Vector<Index>& indices, const glm::mat4& transform)
@@ -750,7 +778,7 @@ namespace Frost
 		uint32_t framesInFlight = Renderer::GetRendererConfig().FramesInFlight;
 		size_t numMaterials = m_MaterialData.size();
 
-		Ref<MeshAsset> newMeshAsset = MeshAsset::Load(totalFilepath);
+		Ref<MeshAsset> newMeshAsset = MeshAsset::Load(totalFilepath, {}, m_ImportSettings);
 
 		if (!newMeshAsset->IsLoaded())
 		{
@@ -775,7 +803,11 @@ namespace Frost
 		m_Vertices = newMeshAsset->m_Vertices;
 		m_SkinnedVertices = newMeshAsset->m_SkinnedVertices;
 		m_Indices = newMeshAsset->m_Indices;
+		m_SubmeshIndices = newMeshAsset->m_SubmeshIndices;
+		m_GlobalSubmeshIndices = newMeshAsset->m_GlobalSubmeshIndices;
 		m_Submeshes = newMeshAsset->m_Submeshes;
+		m_IndicesLODs = newMeshAsset->m_IndicesLODs;
+		m_SubmeshLODs = newMeshAsset->m_SubmeshLODs;
 
 		// Bone/Animation information
 		m_BoneCount = newMeshAsset->m_BoneCount;
@@ -792,6 +824,7 @@ namespace Frost
 
 		m_AccelerationStructure = newMeshAsset->m_AccelerationStructure;
 		m_SubmeshIndexBuffers = newMeshAsset->m_SubmeshIndexBuffers;
+		m_GlobalSubmeshIndexBuffers = newMeshAsset->m_GlobalSubmeshIndexBuffers;
 
 		// There is an explanation above for why we need this
 		if (doAllMeshesNeedReset)
@@ -1050,4 +1083,4 @@ namespace Frost
 	{
 	}
 
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "Frost/Renderer/MaterialAsset.h"
 #include "Frost/Renderer/Material.h"
+#include "Frost/Renderer/MeshImportSettings.h"
 #include "Frost/Renderer/Animation.h"
 #include "Frost/Renderer/Buffers/IndexBuffer.h"
 #include "Frost/Renderer/Buffers/VertexBuffer.h"
@@ -101,8 +102,9 @@ namespace Frost
 
 	struct SubmeshLOD
 	{
-		uint32_t BaseIndex;
+		uint32_t BaseIndex; // Into the global submesh index buffer (`MeshAsset::GetGlobalSubmeshIndexBuffer`)
 		uint32_t IndexCount;
+		float Error; // Object space deviation from the full detail submesh (0 for LOD 0)
 	};
 	using IndicesLOD = uint32_t;
 
@@ -126,7 +128,7 @@ namespace Frost
 		// The constructor is private for several reasons, firstly beacuse here we pass some custom settings for the mesh to be built,
 		// and that should be done only internally. The user shouldn't access any of that, instead there is the `Load` function which just requires the filepath
 		struct MeshBuildSettings;
-		MeshAsset(const std::string& filepath, MaterialInstance material, MeshBuildSettings meshBuildSettings = {});
+		MeshAsset(const std::string& filepath, MaterialInstance material, const MeshImportSettings& importSettings, MeshBuildSettings meshBuildSettings = {});
 		MeshAsset(const Vector<Vertex>& vertices, const Vector<Index>& indices, const glm::mat4& transform);
 	public:
 		MeshAsset() = default; // Constructor which basically does nothing
@@ -144,7 +146,9 @@ namespace Frost
 		const Vector<Index>& GetIndices() const { return m_Indices; }
 
 		const Vector<Submesh>& GetSubMeshes() const { return m_Submeshes; }
-		const Vector<SubmeshLOD>& GetSubMeshesLOD(uint32_t lod) { return m_SubmeshLODs[lod]; }
+		const Vector<SubmeshLOD>& GetSubMeshesLOD(uint32_t lod) const { return m_SubmeshLODs.at(lod); }
+		uint32_t GetLODCount() const { return static_cast<uint32_t>(m_SubmeshLODs.size()); }
+		const MeshImportSettings& GetImportSettings() const { return m_ImportSettings; }
 		const Vector<Ref<Animation>>& GetAnimations() const { return m_Animations; }
 		const Ref<MeshSkeleton>& GetMeshSkeleton() const { return m_Skeleton; }
 
@@ -176,8 +180,16 @@ namespace Frost
 		///A void SetNewTexture(uint32_t textureId, Ref<Texture2D> texture);
 
 		static const DefaultMeshStorage& GetDefaultMeshes();
-		static Ref<MeshAsset> Load(const std::string& filepath, MaterialInstance material = {});
+		static Ref<MeshAsset> Load(const std::string& filepath, MaterialInstance material = {}, const MeshImportSettings& importSettings = {});
+
+		struct MaterialSlot;
 	private:
+		// Fills the mesh data (vertices, indices, submeshes, LODs, bones, animations) using Assimp. The material textures are only collected into `outMaterialSlots`
+		bool ImportFromFile(const std::string& filepath, Vector<MaterialSlot>& outMaterialSlots);
+		void BuildGlobalSubmeshIndices();
+		void CreateBuffers(const MeshBuildSettings& meshBuildSettings);
+		void LoadMaterials(const Vector<MaterialSlot>& materialSlots);
+
 		void TraverseNodes(aiNode* node, const glm::mat4& parentTransform = glm::mat4(1.0f), uint32_t level = 0);
 
 		static Ref<MeshAsset> LoadCustomMesh(const std::string& filepath, MaterialInstance material, MeshBuildSettings meshBuildSettings = {});
@@ -186,6 +198,7 @@ namespace Frost
 		static void DestroyDefaultMeshes();
 	private:
 		std::string m_Filepath;
+		MeshImportSettings m_ImportSettings;
 		bool m_IsLoaded = false;
 		bool m_IsAnimated = false;
 		
@@ -201,8 +214,8 @@ namespace Frost
 		Vector<Index> m_GlobalSubmeshIndices; // Index buffer containing all indices offsetted + all LODs
 		Vector<Submesh> m_Submeshes;
 
-		HashMap<IndicesLOD, Vector<Index>> m_IndicesLODs;
-		HashMap<IndicesLOD, Vector<SubmeshLOD>> m_SubmeshLODs;
+		HashMap<IndicesLOD, Vector<Index>> m_IndicesLODs; // Simplified indices of every LOD (except LOD 0), offsetted like `m_SubmeshIndices`
+		HashMap<IndicesLOD, Vector<SubmeshLOD>> m_SubmeshLODs; // Index ranges of every LOD (LOD 0 included), per submesh
 
 		// Bone/Animation information
 		uint32_t m_BoneCount = 0;
@@ -244,6 +257,20 @@ namespace Frost
 			std::string MetalnessMapFilepath = "";
 		};
 
+	public:
+		// Material as it is described in the source file, before any of its textures are loaded (this is what gets stored into the cooked mesh)
+		struct MaterialSlot
+		{
+			std::string Name;
+			glm::vec4 AlbedoColor = glm::vec4(0.0f);
+			float EmissionFactor = 0.0f;
+			float RoughnessFactor = 0.0f;
+			float MetalnessFactor = 0.0f;
+
+			TextureMaterialFilepaths Textures;
+		};
+	private:
+
 		struct MeshBuildSettings
 		{
 			bool LoadMaterials = true; // Mostly for serialization (it loads materials internally)
@@ -256,6 +283,7 @@ namespace Frost
 		friend class Animation;
 		friend class SceneSerializer;
 		friend class CookingFactory;
+		friend class MeshCache;
 		friend class Renderer;
 		friend struct MaterialMeshPointer;
 		friend class Ref<MeshAsset>;
@@ -318,4 +346,4 @@ namespace Frost
 		friend struct MaterialMeshPointer;
 		friend class MeshAsset;
 	};
-}
\ No newline at end of file
+}
\ No newline at end of file
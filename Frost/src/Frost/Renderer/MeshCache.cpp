@@ -0,0 +1,423 @@
+#include "frostpch.h"
+#include "MeshCache.h"
+#include "MeshCacheFormat.h"
+
+#include "Frost/Project/Project.h"
+#include "Frost/Utils/FileSystem.h"
+#include "Frost/Utils/Hash.h"
+
+#include <ozz/base/io/stream.h>
+#include <ozz/base/io/archive.h>
+#include <ozz/animation/runtime/skeleton.h>
+#include <ozz/animation/runtime/animation.h>
+
+#include <iomanip>
+
+namespace Frost
+{
+	namespace Utils
+	{
+		static std::filesystem::path GetMeshCacheDirectory()
+		{
+			return Project::GetProjectDirectory() / std::filesystem::path("Resources/Cache/Meshes");
+		}
+
+		static void CreateMeshCacheDirectoryIfNeeded()
+		{
+			std::filesystem::path cacheDirectory = GetMeshCacheDirectory();
+			if (!std::filesystem::exists(cacheDirectory))
+				std::filesystem::create_directories(cacheDirectory);
+		}
+
+		static std::filesystem::path GetMeshCacheFilepath(const std::filesystem::path& sourceFilepath)
+		{
+			uint64_t pathHash = Hash::GenerateFNVHash(sourceFilepath.lexically_normal().string());
+
+			std::stringstream ss;
+			ss << std::hex << std::setw(16) << std::setfill('0') << pathHash;
+			return GetMeshCacheDirectory() / (ss.str() + ".fmesh"); // fmesh - Frost Cooked Mesh
+		}
+	}
+
+	// Skeletons and animations are stored with ozz's own archive format
+	template<typename T>
+	static void WriteOzzObject(MeshCacheWriter& writer, const T& object)
+	{
+		ozz::io::MemoryStream stream;
+		ozz::io::OArchive archive(&stream);
+		archive << object;
+
+		Vector<Byte> data(stream.Size());
+		stream.Seek(0, ozz::io::Stream::kSet);
+		stream.Read(data.data(), data.size());
+		writer.WriteArray(data);
+	}
+
+	template<typename T>
+	static ozz::unique_ptr<T> ReadOzzObject(MeshCacheReader& reader)
+	{
+		Vector<Byte> data;
+		if (!reader.ReadArray(data))
+			return nullptr;
+
+		ozz::io::MemoryStream stream;
+		stream.Write(data.data(), data.size());
+		stream.Seek(0, ozz::io::Stream::kSet);
+
+		ozz::io::IArchive archive(&stream);
+		if (!archive.TestTag<T>())
+			return nullptr;
+
+		ozz::unique_ptr<T> object = ozz::make_unique<T>();
+		archive >> *object;
+		return object;
+	}
+
+	uint64_t MeshCache::GetSourceStamp(const std::filesystem::path& sourceFilepath, const MeshImportSettings& importSettings)
+	{
+		std::error_code errorCode;
+		uint64_t fileSize = std::filesystem::file_size(sourceFilepath, errorCode);
+		if (errorCode)
+			return 0;
+
+		auto lastWriteTime = std::filesystem::last_write_time(sourceFilepath, errorCode);
+		if (errorCode)
+			return 0;
+
+		uint64_t stamp = Hash::GenerateFNVHash(sourceFilepath.lexically_normal().string());
+		stamp = Hash::Combine(stamp, fileSize);
+		stamp = Hash::Combine(stamp, static_cast<int64_t>(lastWriteTime.time_since_epoch().count()));
+		stamp = Hash::Combine(stamp, MeshCacheVersion);
+		stamp = Hash::Combine(stamp, importSettings.GetHash());
+		return stamp;
+	}
+
+	bool MeshCache::Load(const std::filesystem::path& sourceFilepath, MeshAsset& meshAsset, Vector<MeshAsset::MaterialSlot>& outMaterialSlots)
+	{
+		return LoadEntry(Utils::GetMeshCacheFilepath(sourceFilepath), sourceFilepath, meshAsset, outMaterialSlots);
+	}
+
+	bool MeshCache::LoadEntry(const std::filesystem::path& cacheFilepath, const std::filesystem::path& sourceFilepath, MeshAsset& meshAsset, Vector<MeshAsset::MaterialSlot>& outMaterialSlots)
+	{
+		uint64_t sourceStamp = GetSourceStamp(sourceFilepath, meshAsset.m_ImportSettings);
+		if (sourceStamp == 0) return false;
+
+		if (!FileSystem::Exists(cacheFilepath))
+			return false;
+
+		// The whole entry is brought in with a single read
+		Buffer cacheBuffer = FileSystem::ReadBytes(cacheFilepath);
+
+		MeshCacheHeader header{};
+		MeshCacheEntryStatus entryStatus = MeshCacheReader::ValidateEntry((Byte*)cacheBuffer.Data, cacheBuffer.Size, sourceStamp, header);
+		if (entryStatus == MeshCacheEntryStatus::Outdated)
+		{
+			cacheBuffer.Release();
+			return false;
+		}
+
+		bool isValid = entryStatus == MeshCacheEntryStatus::Valid;
+
+		// Everything is read into temporaries first, so the mesh asset isn't touched if the entry turns out to be broken
+		Vector<Vertex> vertices;
+		Vector<AnimatedVertex> skinnedVertices;
+		Vector<Index> indices;
+		Vector<Index> submeshIndices;
+		Vector<Index> globalSubmeshIndices;
+		Vector<Submesh> submeshes;
+		HashMap<IndicesLOD, Vector<Index>> indicesLODs;
+		HashMap<IndicesLOD, Vector<SubmeshLOD>> submeshLODs;
+		uint32_t boneCount = 0;
+		Vector<BoneInfo> boneInfo;
+		Ref<MeshSkeleton> skeleton;
+		Vector<std::pair<std::string, ozz::unique_ptr<ozz::animation::Animation>>> animations;
+		Vector<MeshAsset::MaterialSlot> materialSlots;
+
+		if (isValid)
+		{
+			MeshCacheReader reader((Byte*)cacheBuffer.Data + sizeof(MeshCacheHeader), header.DataSize);
+
+			// Vertex/Index streams
+			reader.ReadArray(vertices);
+			reader.ReadArray(skinnedVertices);
+			reader.ReadArray(indices);
+			reader.ReadArray(submeshIndices);
+			reader.ReadArray(globalSubmeshIndices);
+
+			// Submeshes
+			uint32_t submeshCount = reader.Read<uint32_t>();
+			for (uint32_t i = 0; i < submeshCount && !reader.HasFailed(); i++)
+			{
+				Submesh& submesh = submeshes.emplace_back();
+				submesh.BaseVertex = reader.Read<uint32_t>();
+				submesh.BaseIndex = reader.Read<uint32_t>();
+				submesh.MaterialIndex = reader.Read<uint32_t>();
+				submesh.IndexCount = reader.Read<uint32_t>();
+				submesh.VertexCount = reader.Read<uint32_t>();
+				submesh.BoundingBox = reader.Read<Math::BoundingBox>();
+				submesh.Transform = reader.Read<glm::mat4>();
+				reader.ReadString(submesh.MeshName);
+			}
+
+			// LODs
+			uint32_t indicesLODCount = reader.Read<uint32_t>();
+			for (uint32_t i = 0; i < indicesLODCount && !reader.HasFailed(); i++)
+			{
+				IndicesLOD lod = reader.Read<IndicesLOD>();
+				reader.ReadArray(indicesLODs[lod]);
+			}
+
+			uint32_t submeshLODCount = reader.Read<uint32_t>();
+			for (uint32_t i = 0; i < submeshLODCount && !reader.HasFailed(); i++)
+			{
+				IndicesLOD lod = reader.Read<IndicesLOD>();
+				reader.ReadArray(submeshLODs[lod]);
+			}
+
+			// Bones
+			boneCount = reader.Read<uint32_t>();
+			uint32_t boneInfoCount = reader.Read<uint32_t>();
+			for (uint32_t i = 0; i < boneInfoCount && !reader.HasFailed(); i++)
+			{
+				glm::mat4 inverseBindPose = reader.Read<glm::mat4>();
+				uint32_t jointIndex = reader.Read<uint32_t>();
+				boneInfo.emplace_back(inverseBindPose, jointIndex);
+			}
+
+			// Skeleton/Animations
+			if (reader.Read<uint32_t>() && !reader.HasFailed())
+			{
+				glm::mat3 skeletonTransform = reader.Read<glm::mat3>();
+				ozz::unique_ptr<ozz::animation::Skeleton> ozzSkeleton = ReadOzzObject<ozz::animation::Skeleton>(reader);
+				if (ozzSkeleton)
+					skeleton = CreateRef<MeshSkeleton>(std::move(ozzSkeleton), skeletonTransform);
+				else
+					isValid = false;
+			}
+
+			uint32_t animationCount = reader.Read<uint32_t>();
+			for (uint32_t i = 0; i < animationCount && !reader.HasFailed() && isValid; i++)
+			{
+				auto& [name, animation] = animations.emplace_back();
+				reader.ReadString(name);
+				animation = ReadOzzObject<ozz::animation::Animation>(reader);
+				if (!animation)
+					isValid = false;
+			}
+
+			// Material slots
+			uint32_t materialSlotCount = reader.Read<uint32_t>();
+			for (uint32_t i = 0; i < materialSlotCount && !reader.HasFailed(); i++)
+			{
+				MeshAsset::MaterialSlot& materialSlot = materialSlots.emplace_back();
+				reader.ReadString(materialSlot.Name);
+				materialSlot.AlbedoColor = reader.Read<glm::vec4>();
+				materialSlot.EmissionFactor = reader.Read<float>();
+				materialSlot.RoughnessFactor = reader.Read<float>();
+				materialSlot.MetalnessFactor = reader.Read<float>();
+				reader.ReadString(materialSlot.Textures.AlbedoFilepath);
+				reader.ReadString(materialSlot.Textures.NormalMapFilepath);
+				reader.ReadString(materialSlot.Textures.RoughnessMapFilepath);
+				reader.ReadString(materialSlot.Textures.MetalnessMapFilepath);
+			}
+
+			isValid = isValid && !reader.HasFailed() && reader.IsAtEnd();
+		}
+		cacheBuffer.Release();
+
+		if (!isValid)
+		{
+			FROST_CORE_WARN("[MeshCache] Cooked mesh '{0}' is corrupted or outdated, deleting it", cacheFilepath.string());
+			std::error_code errorCode;
+			std::filesystem::remove(cacheFilepath, errorCode);
+			return false;
+		}
+
+		meshAsset.m_IsAnimated = header.IsAnimated != 0;
+		meshAsset.m_Vertices = std::move(vertices);
+		meshAsset.m_SkinnedVertices = std::move(skinnedVertices);
+		meshAsset.m_Indices = std::move(indices);
+		meshAsset.m_SubmeshIndices = std::move(submeshIndices);
+		meshAsset.m_GlobalSubmeshIndices = std::move(globalSubmeshIndices);
+		meshAsset.m_Submeshes = std::move(submeshes);
+		meshAsset.m_IndicesLODs = std::move(indicesLODs);
+		meshAsset.m_SubmeshLODs = std::move(submeshLODs);
+		meshAsset.m_BoneCount = boneCount;
+		meshAsset.m_BoneInfo = std::move(boneInfo);
+		meshAsset.m_Skeleton = skeleton;
+
+		// Animations keep a reference to the skeleton of the mesh, so they are created after it was set
+		meshAsset.m_Animations.resize(animations.size());
+		for (size_t i = 0; i < animations.size(); i++)
+			meshAsset.m_Animations[i] = Ref<Animation>::Create(animations[i].first, std::move(animations[i].second), &meshAsset);
+
+		outMaterialSlots = std::move(materialSlots);
+		return true;
+	}
+
+	void MeshCache::Store(const std::filesystem::path& sourceFilepath, const MeshAsset& meshAsset, const Vector<MeshAsset::MaterialSlot>& materialSlots)
+	{
+		Utils::CreateMeshCacheDirectoryIfNeeded();
+
+		StoreEntry(Utils::GetMeshCacheFilepath(sourceFilepath), sourceFilepath, meshAsset, materialSlots);
+	}
+
+	bool MeshCache::StoreEntry(const std::filesystem::path& cacheFilepath, const std::filesystem::path& sourceFilepath, const MeshAsset& meshAsset, const Vector<MeshAsset::MaterialSlot>& materialSlots)
+	{
+		uint64_t sourceStamp = GetSourceStamp(sourceFilepath, meshAsset.m_ImportSettings);
+		if (sourceStamp == 0) return false;
+
+		// Meshes whose skeleton or animations couldn't be built are not cooked, so the errors are reported again on the next import
+		if (meshAsset.m_IsAnimated && (!meshAsset.m_Skeleton || !meshAsset.m_Skeleton->GetInternalSkeletonPtr()))
+			return false;
+		for (auto& animation : meshAsset.m_Animations)
+		{
+			if (!animation->GetInternalAnimationPtr())
+				return false;
+		}
+
+		MeshCacheWriter writer;
+
+		// Vertex/Index streams
+		writer.WriteArray(meshAsset.m_Vertices);
+		writer.WriteArray(meshAsset.m_SkinnedVertices);
+		writer.WriteArray(meshAsset.m_Indices);
+		writer.WriteArray(meshAsset.m_SubmeshIndices);
+		writer.WriteArray(meshAsset.m_GlobalSubmeshIndices);
+
+		// Submeshes
+		writer.Write(static_cast<uint32_t>(meshAsset.m_Submeshes.size()));
+		for (auto& submesh : meshAsset.m_Submeshes)
+		{
+			writer.Write(submesh.BaseVertex);
+			writer.Write(submesh.BaseIndex);
+			writer.Write(submesh.MaterialIndex);
+			writer.Write(submesh.IndexCount);
+			writer.Write(submesh.VertexCount);
+			writer.Write(submesh.BoundingBox);
+			writer.Write(submesh.Transform);
+			writer.WriteString(submesh.MeshName);
+		}
+
+		// LODs
+		writer.Write(static_cast<uint32_t>(meshAsset.m_IndicesLODs.size()));
+		for (auto& [lod, lodIndices] : meshAsset.m_IndicesLODs)
+		{
+			writer.Write(lod);
+			writer.WriteArray(lodIndices);
+		}
+
+		writer.Write(static_cast<uint32_t>(meshAsset.m_SubmeshLODs.size()));
+		for (auto& [lod, lodSubmeshes] : meshAsset.m_SubmeshLODs)
+		{
+			writer.Write(lod);
+			writer.WriteArray(lodSubmeshes);
+		}
+
+		// Bones
+		writer.Write(meshAsset.m_BoneCount);
+		writer.Write(static_cast<uint32_t>(meshAsset.m_BoneInfo.size()));
+		for (auto& boneInfo : meshAsset.m_BoneInfo)
+		{
+			writer.Write(boneInfo.InverseBindPose);
+			writer.Write(boneInfo.JointIndex);
+		}
+
+		// Skeleton/Animations
+		writer.Write(static_cast<uint32_t>(meshAsset.m_Skeleton != nullptr));
+		if (meshAsset.m_Skeleton)
+		{
+			writer.Write(meshAsset.m_Skeleton->GetSkeletonTransform());
+			WriteOzzObject(writer, meshAsset.m_Skeleton->GetInternalSkeleton());
+		}
+
+		writer.Write(static_cast<uint32_t>(meshAsset.m_Animations.size()));
+		for (auto& animation : meshAsset.m_Animations)
+		{
+			writer.WriteString(animation->GetName());
+			WriteOzzObject(writer, animation->GetInternalAnimation());
+		}
+
+		// Material slots
+		writer.Write(static_cast<uint32_t>(materialSlots.size()));
+		for (auto& materialSlot : materialSlots)
+		{
+			writer.WriteString(materialSlot.Name);
+			writer.Write(materialSlot.AlbedoColor);
+			writer.Write(materialSlot.EmissionFactor);
+			writer.Write(materialSlot.RoughnessFactor);
+			writer.Write(materialSlot.MetalnessFactor);
+			writer.WriteString(materialSlot.Textures.AlbedoFilepath);
+			writer.WriteString(materialSlot.Textures.NormalMapFilepath);
+			writer.WriteString(materialSlot.Textures.RoughnessMapFilepath);
+			writer.WriteString(materialSlot.Textures.MetalnessMapFilepath);
+		}
+
+		Vector<Byte>& data = writer.GetData();
+		if (data.size() > UINT32_MAX)
+		{
+			FROST_CORE_WARN("[MeshCache] Mesh '{0}' is too big to be cooked", sourceFilepath.string());
+			return false;
+		}
+		writer.FinishEntry(sourceStamp, meshAsset.m_IsAnimated);
+
+		// Write into a temporary file first, so a crash while writing can't leave a half written entry behind
+		std::filesystem::path tempFilepath = cacheFilepath.string() + ".tmp";
+		bool success = FileSystem::WriteBytes(tempFilepath, Buffer(data.data(), static_cast<uint32_t>(data.size())));
+
+		std::error_code errorCode;
+		if (success)
+			std::filesystem::rename(tempFilepath, cacheFilepath, errorCode);
+
+		if (!success || errorCode)
+		{
+			FROST_CORE_ERROR("[MeshCache] Failed to write the cooked mesh '{0}'", cacheFilepath.string());
+			std::filesystem::remove(tempFilepath, errorCode);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool MeshCache::LoadOrImport(const std::filesystem::path& sourceFilepath, MeshAsset& meshAsset, Vector<MeshAsset::MaterialSlot>& outMaterialSlots)
+	{
+		if (Load(sourceFilepath, meshAsset, outMaterialSlots))
+			return true;
+
+		if (!Import(sourceFilepath, meshAsset, outMaterialSlots))
+			return false;
+
+		Store(sourceFilepath, meshAsset, outMaterialSlots);
+		return true;
+	}
+
+	bool MeshCache::Import(const std::filesystem::path& sourceFilepath, MeshAsset& meshAsset, Vector<MeshAsset::MaterialSlot>& outMaterialSlots)
+	{
+		return meshAsset.ImportFromFile(sourceFilepath.string(), outMaterialSlots);
+	}
+
+	void MeshCache::Invalidate(const std::filesystem::path& sourceFilepath)
+	{
+		std::error_code errorCode;
+		std::filesystem::remove(Utils::GetMeshCacheFilepath(sourceFilepath), errorCode);
+	}
+
+	void MeshCache::Clear()
+	{
+		std::error_code errorCode;
+		std::filesystem::remove_all(Utils::GetMeshCacheDirectory(), errorCode);
+	}
+
+	uint64_t MeshCache::GetCacheSize()
+	{
+		uint64_t cacheSize = 0;
+
+		std::error_code errorCode;
+		for (auto& entry : std::filesystem::directory_iterator(Utils::GetMeshCacheDirectory(), errorCode))
+		{
+			if (entry.is_regular_file())
+				cacheSize += entry.file_size();
+		}
+		return cacheSize;
+	}
+}
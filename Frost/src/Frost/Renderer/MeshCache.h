@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Frost/Renderer/Mesh.h"
+
+#include <filesystem>
+
+namespace Frost
+{
+	// Disk cache for imported meshes (stored as cooked `.fmesh` files in `Resources/Cache/Meshes` of the project).
+	// A cooked mesh holds the final vertex/index streams (already optimized by meshoptimizer), the submeshes with their bounds,
+	// the LODs, the bones, the ozz skeleton/animations and the material slots, so loading it is a single file read and a few memcpys.
+	// Entries are named after the source filepath and store the size/write time of the source file (and the import settings),
+	// so editing the source mesh or changing its LOD settings simply overwrites its entry on the next import.
+	class MeshCache
+	{
+	public:
+		// Returns false if there is no valid cooked version of the source file (the mesh asset is left untouched in that case)
+		static bool Load(const std::filesystem::path& sourceFilepath, MeshAsset& meshAsset, Vector<MeshAsset::MaterialSlot>& outMaterialSlots);
+		static void Store(const std::filesystem::path& sourceFilepath, const MeshAsset& meshAsset, const Vector<MeshAsset::MaterialSlot>& materialSlots);
+
+		// Loads the cooked version of the source file, or imports it (and cooks the result) when there is none
+		static bool LoadOrImport(const std::filesystem::path& sourceFilepath, MeshAsset& meshAsset, Vector<MeshAsset::MaterialSlot>& outMaterialSlots);
+
+		// Imports the source file with Assimp (and processes it with meshoptimizer), without touching the cache
+		static bool Import(const std::filesystem::path& sourceFilepath, MeshAsset& meshAsset, Vector<MeshAsset::MaterialSlot>& outMaterialSlots);
+
+		// Reads/writes a single cooked file, used by `Load`/`Store` with the project's cache directory.
+		// A corrupted cooked file is deleted when it is read
+		static bool LoadEntry(const std::filesystem::path& cacheFilepath, const std::filesystem::path& sourceFilepath, MeshAsset& meshAsset, Vector<MeshAsset::MaterialSlot>& outMaterialSlots);
+		static bool StoreEntry(const std::filesystem::path& cacheFilepath, const std::filesystem::path& sourceFilepath, const MeshAsset& meshAsset, const Vector<MeshAsset::MaterialSlot>& materialSlots);
+
+		static void Invalidate(const std::filesystem::path& sourceFilepath);
+		static void Clear();
+
+		static uint64_t GetCacheSize();
+	private:
+		// Identifies the version of the source file that was cooked, with the settings it was imported with. Returns 0 if the source file doesn't exist
+		static uint64_t GetSourceStamp(const std::filesystem::path& sourceFilepath, const MeshImportSettings& importSettings);
+	};
+}
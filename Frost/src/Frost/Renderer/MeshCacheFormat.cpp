@@ -0,0 +1,37 @@
+#include "frostpch.h"
+#include "MeshCacheFormat.h"
+
+#include "Frost/Utils/Hash.h"
+
+namespace Frost
+{
+	void MeshCacheWriter::FinishEntry(uint64_t sourceStamp, bool isAnimated)
+	{
+		MeshCacheHeader header{};
+		header.Magic = MeshCacheMagic;
+		header.Version = MeshCacheVersion;
+		header.SourceStamp = sourceStamp;
+		header.IsAnimated = isAnimated ? 1 : 0;
+		header.DataSize = m_Data.size() - sizeof(MeshCacheHeader);
+		header.DataHash = Hash::GenerateFNVHash(m_Data.data() + sizeof(MeshCacheHeader), header.DataSize);
+		memcpy(m_Data.data(), &header, sizeof(MeshCacheHeader));
+	}
+
+	MeshCacheEntryStatus MeshCacheReader::ValidateEntry(const Byte* entryData, uint64_t entrySize, uint64_t sourceStamp, MeshCacheHeader& outHeader)
+	{
+		if (!entryData || entrySize < sizeof(MeshCacheHeader))
+			return MeshCacheEntryStatus::Corrupted;
+
+		memcpy(&outHeader, entryData, sizeof(MeshCacheHeader));
+		if (outHeader.Magic != MeshCacheMagic || outHeader.Version != MeshCacheVersion)
+			return MeshCacheEntryStatus::Corrupted;
+
+		// An outdated entry (the source file was changed) is simply overwritten by the next `Store`
+		if (outHeader.SourceStamp != sourceStamp)
+			return MeshCacheEntryStatus::Outdated;
+
+		bool isValid = outHeader.DataSize == entrySize - sizeof(MeshCacheHeader) &&
+		               outHeader.DataHash == Hash::GenerateFNVHash(entryData + sizeof(MeshCacheHeader), outHeader.DataSize);
+		return isValid ? MeshCacheEntryStatus::Valid : MeshCacheEntryStatus::Corrupted;
+	}
+}
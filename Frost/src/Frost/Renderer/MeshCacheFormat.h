@@ -0,0 +1,142 @@
+#pragma once
+
+namespace Frost
+{
+	// Bump it when the file layout, the Assimp import flags or the mesh processing (meshoptimizer passes, LODs) change, so old entries are ignored
+	static constexpr uint32_t MeshCacheVersion = 2;
+	static constexpr uint32_t MeshCacheMagic = 0x30534D46; // "FMS0"
+
+	struct MeshCacheHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t SourceStamp;
+		uint32_t IsAnimated;
+		uint32_t Padding;
+		uint64_t DataSize;
+		uint64_t DataHash;
+	};
+
+	enum class MeshCacheEntryStatus
+	{
+		Valid,
+		Outdated, // Written by this version, but for an older version of the source file
+		Corrupted
+	};
+
+	// Appends values and arrays of trivially copyable types as raw bytes (arrays are prefixed by their element count).
+	// The header is reserved at the start and only filled by `FinishEntry`, once the data hash is known
+	class MeshCacheWriter
+	{
+	public:
+		MeshCacheWriter()
+		{
+			Write(MeshCacheHeader{});
+		}
+
+		void WriteBytes(const void* data, uint64_t size)
+		{
+			const Byte* bytes = static_cast<const Byte*>(data);
+			m_Data.insert(m_Data.end(), bytes, bytes + size);
+		}
+
+		template<typename T>
+		void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written as raw bytes");
+			WriteBytes(&value, sizeof(T));
+		}
+
+		template<typename T>
+		void WriteArray(const Vector<T>& values)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written as raw bytes");
+			Write(static_cast<uint32_t>(values.size()));
+			WriteBytes(values.data(), values.size() * sizeof(T));
+		}
+
+		void WriteString(const std::string& str)
+		{
+			Write(static_cast<uint32_t>(str.size()));
+			WriteBytes(str.data(), str.size());
+		}
+
+		void FinishEntry(uint64_t sourceStamp, bool isAnimated);
+
+		Vector<Byte>& GetData() { return m_Data; }
+	private:
+		Vector<Byte> m_Data;
+	};
+
+	// Reads back what `MeshCacheWriter` wrote. Reading past the end doesn't crash, it only marks the reader as failed
+	class MeshCacheReader
+	{
+	public:
+		MeshCacheReader(const Byte* data, uint64_t size)
+			: m_Data(data), m_Size(size)
+		{
+		}
+
+		bool ReadBytes(void* data, uint64_t size)
+		{
+			if (m_Failed || size > m_Size - m_Offset)
+			{
+				m_Failed = true;
+				return false;
+			}
+			if (size == 0)
+				return true;
+
+			memcpy(data, m_Data + m_Offset, size);
+			m_Offset += size;
+			return true;
+		}
+
+		template<typename T>
+		T Read()
+		{
+			T value{};
+			ReadBytes(&value, sizeof(T));
+			return value;
+		}
+
+		template<typename T>
+		bool ReadArray(Vector<T>& values)
+		{
+			uint64_t count = Read<uint32_t>();
+			if (m_Failed || count * sizeof(T) > m_Size - m_Offset)
+			{
+				m_Failed = true;
+				return false;
+			}
+
+			values.resize(count);
+			return ReadBytes(values.data(), count * sizeof(T));
+		}
+
+		bool ReadString(std::string& str)
+		{
+			uint64_t size = Read<uint32_t>();
+			if (m_Failed || size > m_Size - m_Offset)
+			{
+				m_Failed = true;
+				return false;
+			}
+
+			str.assign(reinterpret_cast<const char*>(m_Data + m_Offset), size);
+			m_Offset += size;
+			return true;
+		}
+
+		bool HasFailed() const { return m_Failed; }
+		bool IsAtEnd() const { return m_Offset == m_Size; }
+
+		// Checks the header and the data hash of a whole entry (as written by `MeshCacheWriter`), before anything of it is read
+		static MeshCacheEntryStatus ValidateEntry(const Byte* entryData, uint64_t entrySize, uint64_t sourceStamp, MeshCacheHeader& outHeader);
+	private:
+		const Byte* m_Data;
+		uint64_t m_Size;
+		uint64_t m_Offset = 0;
+		bool m_Failed = false;
+	};
+}
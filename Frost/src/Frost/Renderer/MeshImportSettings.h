@@ -0,0 +1,22 @@
+#pragma once
+
+namespace Frost
+{
+	static constexpr uint32_t MaxMeshLODCount = 4; // Including the full detail LOD 0
+
+	// Settings of the LOD chain which is built by meshoptimizer at import (they are part of the cooked mesh's stamp).
+	// Stored per mesh in the asset registry, so they are kept in this light header (the asset metadata includes it)
+	struct MeshImportSettings
+	{
+		struct LODLevel
+		{
+			float IndexRatio;  // Target index count, relative to LOD 0
+			float TargetError; // Max deviation that the simplifier may introduce, relative to the submesh extents
+		};
+
+		uint32_t LODCount = 3; // Including LOD 0, clamped to `MaxMeshLODCount`
+		LODLevel LODs[MaxMeshLODCount - 1] = { { 0.5f, 0.01f }, { 0.25f, 0.02f }, { 0.125f, 0.05f } };
+
+		uint64_t GetHash() const;
+	};
+}
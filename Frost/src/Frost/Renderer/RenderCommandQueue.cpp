@@ -1,75 +1,231 @@
 #include "frostpch.h"
 #include "RenderCommandQueue.h"
 
+#include "Frost/Core/JobSystem.h"
+#include "Frost/Math/Alignment.h"
+
 namespace Frost
 {
-	RenderCommandQueue::RenderCommandQueue()
-	{
-		// Allocate 10Mb buffer
-		m_CommandBuffer = new uint8_t[10 * 1024 * 1024];
-		m_CommandBufferPtr = m_CommandBuffer;
+	// Chunks are allocated with this alignment, so payloads can request any alignment up to it
+	static constexpr uint32_t s_ChunkAlignment = 64;
+
+	static std::atomic<uint64_t> s_NextQueueID = 0;
+
+	// Lane keys are sorted by `MergeThreadLanes`, so the explicit lanes (given by the caller) are merged before the job worker lanes
+	static constexpr uint64_t s_WorkerLaneBit = 1ull << 32;
 
-		// Setting all the memory to `0`
-		memset(m_CommandBuffer, 0, 10 * 1024 * 1024);
+	// Cached, since `std::this_thread::get_id()` is a library call and `Allocate` checks it for every command
+	static thread_local std::thread::id t_ThreadID = std::this_thread::get_id();
+
+	RenderCommandQueue::RenderCommandQueue(uint32_t chunkSize)
+		: m_ChunkSize(chunkSize), m_QueueID(s_NextQueueID.fetch_add(1)), m_OwnerThreadID(std::this_thread::get_id())
+	{
+		m_Chunks.push_back(AllocateChunk(m_ChunkSize));
 	}
 
 	RenderCommandQueue::~RenderCommandQueue()
 	{
-		delete[] m_CommandBuffer;
+		for (auto& chunk : m_Chunks)
+			FreeChunk(chunk);
+		for (auto& chunk : m_FreeChunks)
+			FreeChunk(chunk);
+	}
+
+	RenderCommandQueue::Chunk RenderCommandQueue::AllocateChunk(uint32_t size)
+	{
+		Chunk chunk;
+		chunk.Data = static_cast<Byte*>(operator new(size, std::align_val_t(s_ChunkAlignment)));
+		chunk.Size = size;
+		chunk.Offset = 0;
+		return chunk;
+	}
+
+	void RenderCommandQueue::FreeChunk(Chunk& chunk)
+	{
+		operator delete(chunk.Data, std::align_val_t(s_ChunkAlignment));
+		chunk.Data = nullptr;
+	}
+
+	void* RenderCommandQueue::Allocate(RenderCommandFn fn, uint32_t size, uint32_t alignment)
+	{
+		if (t_ThreadID != m_OwnerThreadID)
+		{
+			uint32_t workerIndex = JobSystem::GetThreadIndex();
+			FROST_ASSERT(bool(workerIndex != 0), "Render commands recorded outside of the job workers need an explicit lane (AllocateInLane)!");
+			return GetLane(s_WorkerLaneBit | workerIndex)->AllocateInternal(fn, size, alignment);
+		}
+
+		return AllocateInternal(fn, size, alignment);
+	}
+
+	void* RenderCommandQueue::AllocateInLane(uint32_t laneIndex, RenderCommandFn fn, uint32_t size, uint32_t alignment)
+	{
+		return GetLane(laneIndex)->AllocateInternal(fn, size, alignment);
 	}
 
-	void* RenderCommandQueue::Allocate(RenderCommandFn fn, uint32_t size)
+	void* RenderCommandQueue::AllocateInternal(RenderCommandFn fn, uint32_t size, uint32_t alignment)
 	{
-		///////////////////////////////////// ALIGNMENT /////////////////////////////////////////////
+		///////////////////////////////////// LAYOUT ////////////////////////////////////////////////
 		//                 ||----------------------------------------------------------------------||
-		// What we store:  ||         FUNCTION         |  SIZE OF THE FUNCTION   |   VOID POINTER  ||
-		// Memory size:    ||  sizeof(RenderCommandFn) |    sizeof(uint32_t)	 |   sizeof(void*) ||
-		// Memory size:    ||          N bytes         |         4 bytes      	 |      1 byte     ||
+		// What we store:  ||      COMMAND HEADER      |        PADDING          |     PAYLOAD     ||
+		// Memory size:    ||  sizeof(CommandHeader)   | until `alignment` bytes |   `size` bytes  ||
 		//                 ||----------------------------------------------------------------------||
 		/////////////////////////////////////////////////////////////////////////////////////////////
+		alignment = std::max<uint32_t>(alignment, alignof(CommandHeader));
+		FROST_ASSERT(bool(alignment <= s_ChunkAlignment && (alignment & (alignment - 1)) == 0), "Unsupported render command alignment!");
 
-		// We move the pointer n bytes (n = sizeof(RenderCommandFn)) - for later allocating the std::function<void()>
-		*(RenderCommandFn*)m_CommandBufferPtr = fn;
-		m_CommandBufferPtr += sizeof(RenderCommandFn);
+		// Worst case size of the command, since headers are only aligned to `alignof(CommandHeader)` (computed in 64 bits, so huge payloads can't overflow)
+		uint64_t maxCommandSize = sizeof(CommandHeader) + (alignment - alignof(CommandHeader)) + Math::AlignUp<uint64_t>(size, alignof(CommandHeader));
+		FROST_ASSERT(bool(maxCommandSize <= UINT32_MAX), "Render command is too big!");
 
-		// We add at the end the size of the RenderCommandFn
-		*(uint32_t*)m_CommandBufferPtr = size;
-		m_CommandBufferPtr += sizeof(uint32_t);
+		Chunk& chunk = GetChunkForCommand(maxCommandSize, alignment);
 
-		// We allocate another byte for knowing the address
-		// (which we later give to the std::function constructor to store the information of the function)
-		void* memory = m_CommandBufferPtr;
-		m_CommandBufferPtr += size;
+		uint32_t headerOffset = chunk.Offset;
+		uint32_t payloadOffset = Math::AlignUp<uint32_t>(headerOffset + sizeof(CommandHeader), alignment);
+		uint32_t nextCommandOffset = Math::AlignUp<uint32_t>(payloadOffset + size, alignof(CommandHeader));
+
+		CommandHeader* header = reinterpret_cast<CommandHeader*>(chunk.Data + headerOffset);
+		header->Function = fn;
+		header->PayloadOffset = payloadOffset - headerOffset;
+		header->CommandSize = nextCommandOffset - headerOffset;
+
+		chunk.Offset = nextCommandOffset;
 
 		// Increase the command count and return the address for the specific function
 		m_CommandCount++;
-		return memory;
+		return chunk.Data + payloadOffset;
 	}
 
-	void RenderCommandQueue::Execute()
+	RenderCommandQueue::Chunk& RenderCommandQueue::GetChunkForCommand(uint64_t commandSize, uint32_t alignment)
+	{
+		Chunk& currentChunk = m_Chunks.back();
+		if (currentChunk.Offset + commandSize <= currentChunk.Size)
+			return currentChunk;
+
+		// The command doesn't fit, so continue into a new chunk (reusing an already executed one if possible)
+		if (commandSize <= m_ChunkSize && !m_FreeChunks.empty())
+		{
+			m_Chunks.push_back(m_FreeChunks.back());
+			m_Chunks.back().Offset = 0;
+			m_FreeChunks.pop_back();
+		}
+		else
+		{
+			// Commands bigger than the chunk size get a dedicated chunk
+			uint32_t chunkSize = std::max<uint32_t>(m_ChunkSize, static_cast<uint32_t>(commandSize));
+			m_Chunks.push_back(AllocateChunk(chunkSize));
+		}
+
+		return m_Chunks.back();
+	}
+
+	RenderCommandQueue* RenderCommandQueue::GetLane(uint64_t laneKey)
+	{
+		// Queue IDs are never reused and lanes live as long as their queue, so the cached entries can never dangle
+		thread_local HashMap<uint64_t, RenderCommandQueue*> t_Lanes;
+		// A thread usually records a whole batch into the same lane, so the last lookup is checked before the map
+		thread_local uint64_t t_LastCacheKey = UINT64_MAX;
+		thread_local RenderCommandQueue* t_LastLane = nullptr;
+
+		uint64_t cacheKey = (m_QueueID << 33) | laneKey;
+		if (cacheKey == t_LastCacheKey)
+			return t_LastLane;
+
+		auto it = t_Lanes.find(cacheKey);
+		if (it != t_Lanes.end())
+		{
+			t_LastCacheKey = cacheKey;
+			t_LastLane = it->second;
+			return it->second;
+		}
+
+		std::scoped_lock<std::mutex> lock(m_ThreadLanesMutex);
+		Scope<RenderCommandQueue>& lane = m_ThreadLanes[laneKey];
+		if (!lane)
+			lane = CreateScope<RenderCommandQueue>(m_ChunkSize);
+
+		t_Lanes[cacheKey] = lane.get();
+		t_LastCacheKey = cacheKey;
+		t_LastLane = lane.get();
+		return lane.get();
+	}
+
+	void RenderCommandQueue::MergeThreadLanes()
 	{
-		// Pointer to the first function
-		Byte* buffer = m_CommandBuffer;
+		FROST_ASSERT(bool(std::this_thread::get_id() == m_OwnerThreadID), "Render command lanes can only be merged by the owner thread!");
 
-		for (uint32_t i = 0; i < m_CommandCount; i++)
+		std::scoped_lock<std::mutex> lock(m_ThreadLanesMutex);
+		for (auto& [laneKey, lane] : m_ThreadLanes)
 		{
-			// Move the pointer to n bytes (n = sizeof(RenderCommandFn))
-			RenderCommandFn function = *(RenderCommandFn*)buffer;
-			buffer += sizeof(RenderCommandFn);
+			if (lane->m_CommandCount == 0) continue;
 
-			// Move the pointer 4 bytes
-			uint32_t size = *(uint32_t*)buffer;
-			buffer += sizeof(uint32_t);
+			// Move the recorded chunks at the end of this queue (no command is copied)
+			uint32_t movedChunkCount = static_cast<uint32_t>(lane->m_Chunks.size());
+			for (auto& chunk : lane->m_Chunks)
+				m_Chunks.push_back(chunk);
+			m_CommandCount += lane->m_CommandCount;
+			lane->m_Chunks.clear();
 
-			// Execute the function
-			function(buffer);
+			// Give the lane back as many (already executed) chunks as it used, so in steady state it records without allocating
+			while (movedChunkCount-- > 0 && !m_FreeChunks.empty())
+			{
+				lane->m_FreeChunks.push_back(m_FreeChunks.back());
+				m_FreeChunks.pop_back();
+			}
 
-			// Move 1 byte (because we allocated a void* for the address)
-			buffer += size;
+			if (!lane->m_FreeChunks.empty())
+			{
+				lane->m_Chunks.push_back(lane->m_FreeChunks.back());
+				lane->m_Chunks.back().Offset = 0;
+				lane->m_FreeChunks.pop_back();
+			}
+			else
+			{
+				lane->m_Chunks.push_back(AllocateChunk(m_ChunkSize));
+			}
+			lane->m_CommandCount = 0;
 		}
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		FROST_ASSERT(bool(std::this_thread::get_id() == m_OwnerThreadID), "Render commands can only be executed by the owner thread!");
+
+		// Using indices, because commands are allowed to submit new commands while executing (they will be executed in this loop as well)
+		for (uint32_t chunkIndex = 0; chunkIndex < m_Chunks.size(); chunkIndex++)
+		{
+			uint32_t offset = 0;
+			while (offset < m_Chunks[chunkIndex].Offset)
+			{
+				Byte* commandAddress = m_Chunks[chunkIndex].Data + offset;
+				CommandHeader* header = reinterpret_cast<CommandHeader*>(commandAddress);
+
+				// Execute the function
+				header->Function(commandAddress + header->PayloadOffset);
 
-		// After finishing executing the functions, change pointer's address to the beginning of the buffer / And set the commandCount to 0
-		m_CommandBufferPtr = m_CommandBuffer;
+				offset += header->CommandSize;
+			}
+		}
+
+		// After finishing executing the functions, recycle the chunks and set the commandCount to 0
+		for (uint32_t i = 1; i < m_Chunks.size(); i++)
+		{
+			// Dedicated chunks for huge commands are not kept around
+			if (m_Chunks[i].Size > m_ChunkSize)
+				FreeChunk(m_Chunks[i]);
+			else
+				m_FreeChunks.push_back(m_Chunks[i]);
+		}
+		m_Chunks.resize(1);
+		m_Chunks[0].Offset = 0;
 		m_CommandCount = 0;
 	}
+
+	uint64_t RenderCommandQueue::GetUsedSize() const
+	{
+		uint64_t usedSize = 0;
+		for (auto& chunk : m_Chunks)
+			usedSize += chunk.Offset;
+		return usedSize;
+	}
 }
\ No newline at end of file
@@ -1,21 +1,70 @@
 #pragma once
 
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <thread>
+
 namespace Frost
 {
 	typedef void(*RenderCommandFn)(void*);
-	
+
 	class RenderCommandQueue
 	{
 	public:
-		RenderCommandQueue();
+		RenderCommandQueue(uint32_t chunkSize = 2 * 1024 * 1024); // 2MB chunks
 		~RenderCommandQueue();
 
-		void* Allocate(RenderCommandFn func, uint32_t size);
+		// Reserves memory for a command payload. When called from a job worker (instead of the thread that created the queue),
+		// the command is recorded into the lane of that worker (`JobSystem::GetThreadIndex()`), which gets merged back by `MergeThreadLanes()`
+		void* Allocate(RenderCommandFn func, uint32_t size, uint32_t alignment = alignof(std::max_align_t));
+
+		// Same as `Allocate`, but records into the lane given by the caller (e.g. the index of a job), so the merged order
+		// doesn't depend on which thread ran the job. A lane must only be recorded by one thread at a time
+		void* AllocateInLane(uint32_t laneIndex, RenderCommandFn func, uint32_t size, uint32_t alignment = alignof(std::max_align_t));
+
+		// Appends the commands recorded into the lanes, sorted by lane index: the explicit lanes come first, then the job worker lanes.
+		// Must be called from the owner thread, while no other thread is recording into this queue
+		void MergeThreadLanes();
 
 		void Execute();
+
+		uint32_t GetCommandCount() const { return m_CommandCount; }
+		uint64_t GetUsedSize() const;
+		uint32_t GetChunkCount() const { return static_cast<uint32_t>(m_Chunks.size() + m_FreeChunks.size()); }
 	private:
-		uint8_t* m_CommandBuffer;
-		uint8_t* m_CommandBufferPtr;
+		struct Chunk
+		{
+			Byte* Data = nullptr;
+			uint32_t Size = 0;
+			uint32_t Offset = 0;
+		};
+
+		// Stored in front of every command
+		struct CommandHeader
+		{
+			RenderCommandFn Function;
+			uint32_t PayloadOffset; // Offset from the header to the (aligned) payload
+			uint32_t CommandSize;   // Offset from the header to the next command
+		};
+
+		void* AllocateInternal(RenderCommandFn func, uint32_t size, uint32_t alignment);
+		Chunk& GetChunkForCommand(uint64_t commandSize, uint32_t alignment);
+		Chunk AllocateChunk(uint32_t size);
+		void FreeChunk(Chunk& chunk);
+
+		RenderCommandQueue* GetLane(uint64_t laneKey);
+	private:
+		Vector<Chunk> m_Chunks; // Chunks in recording order
+		Vector<Chunk> m_FreeChunks; // Already executed chunks, ready to be reused
+		uint32_t m_ChunkSize;
 		uint32_t m_CommandCount = 0;
+
+		uint64_t m_QueueID;
+		std::thread::id m_OwnerThreadID;
+
+		// Recording lanes sorted by key (only used by the queue which owns them)
+		std::map<uint64_t, Scope<RenderCommandQueue>> m_ThreadLanes;
+		std::mutex m_ThreadLanesMutex;
 	};
 }
\ No newline at end of file
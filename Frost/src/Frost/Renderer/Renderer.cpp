@@ -53,71 +53,76 @@ namespace Frost
 		// Init the shaders
 		s_Data->m_ShaderLibrary = Ref<ShaderLibrary>::Create();
 
-		//Renderer::GetShaderLibrary()->Load("Resources/Shaders/GeometryPassIndirectBindless.glsl");
-		//Renderer::GetShaderLibrary()->Load("Resources/Shaders/GeometryPass.glsl");
-		//Renderer::GetShaderLibrary()->Load("Resources/Shaders/PBRDeffered.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/PBRDeffered_Compute.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/PreethamSky.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/PathTracer.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/EquirectangularToCubeMap.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/EnvironmentIrradiance.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/EnvironmentMipFilter.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/RenderSkybox.glsl");
-		//Renderer::GetShaderLibrary()->Load("Resources/Shaders/GeometryPassIndirect.glsl");
-		//Renderer::GetShaderLibrary()->Load("Resources/Shaders/OcclusionCulling.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/OcclusionCulling_V3.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/HiZBufferBuilder.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/TiledPointLightCulling.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/TiledRectangularLightCulling.glsl");
-		//Renderer::GetShaderLibrary()->Load("Resources/Shaders/ScreenSpaceReflections.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/SSR.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/GaussianBlur.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/VisibilityBuffer.glsl");
-		//Renderer::GetShaderLibrary()->Load("Resources/Shaders/AmbientOcclusion.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/AO.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/AmbientOcclusionDenoiser.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/AmbientOcclusionTAA.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/SpatialDenoiser.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/Bloom.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/ColorCorrection.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/Transmittance.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/MultiScatter.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/SkyViewBuilder.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/SkyViewIrradiance.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/SkyViewFilter.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/AerialPerspective.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/ApplyAerial.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/Voxelization.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/VoxelFilter.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/ShadowDepthPass.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/ShadowCompute.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/VoxelConeTracing.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/FroxelVolumePopulate.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/VolumetricCompute.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/VolumetricBlur.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/VolumetricInjectLight.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/VolumetricGatherLight.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/VolumetricTAA.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/CloudPerlinNoise.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/CloudWoorleyNoise.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/CloudComputeVolumetric.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/BatchRendererQuad.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/BatchRendererLine.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/Wireframe.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/SceneGrid.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/EntityGlow.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/LineDetection.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/GeometryPassIndirectInstancedBindless.glsl");
-		//Renderer::GetShaderLibrary()->Load("Resources/Shaders/BloomConvolution.glsl");
-		//Renderer::GetShaderLibrary()->Load("Resources/Shaders/BloomConvolutionFilter.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/FXAA.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/TAA.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/BloomConvolutionRadix2_512.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/BloomConvolutionRadix2_1024.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/BloomConvolutionRadix2_2048.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/BloomConvolutionRadix4_4096.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/ExpandImageToPowerTwo.glsl");
-		Renderer::GetShaderLibrary()->Load("Resources/Shaders/BloomKernelConvertToRGBA8.glsl");
+		// Shaders are compiled and reflected in parallel
+		Vector<std::string> shaderFilepaths =
+		{
+			//"Resources/Shaders/GeometryPassIndirectBindless.glsl",
+			//"Resources/Shaders/GeometryPass.glsl",
+			//"Resources/Shaders/PBRDeffered.glsl",
+			"Resources/Shaders/PBRDeffered_Compute.glsl",
+			"Resources/Shaders/PreethamSky.glsl",
+			"Resources/Shaders/PathTracer.glsl",
+			"Resources/Shaders/EquirectangularToCubeMap.glsl",
+			"Resources/Shaders/EnvironmentIrradiance.glsl",
+			"Resources/Shaders/EnvironmentMipFilter.glsl",
+			"Resources/Shaders/RenderSkybox.glsl",
+			//"Resources/Shaders/GeometryPassIndirect.glsl",
+			//"Resources/Shaders/OcclusionCulling.glsl",
+			"Resources/Shaders/OcclusionCulling_V3.glsl",
+			"Resources/Shaders/HiZBufferBuilder.glsl",
+			"Resources/Shaders/TiledPointLightCulling.glsl",
+			"Resources/Shaders/TiledRectangularLightCulling.glsl",
+			//"Resources/Shaders/ScreenSpaceReflections.glsl",
+			"Resources/Shaders/SSR.glsl",
+			"Resources/Shaders/GaussianBlur.glsl",
+			"Resources/Shaders/VisibilityBuffer.glsl",
+			//"Resources/Shaders/AmbientOcclusion.glsl",
+			"Resources/Shaders/AO.glsl",
+			"Resources/Shaders/AmbientOcclusionDenoiser.glsl",
+			"Resources/Shaders/AmbientOcclusionTAA.glsl",
+			"Resources/Shaders/SpatialDenoiser.glsl",
+			"Resources/Shaders/Bloom.glsl",
+			"Resources/Shaders/ColorCorrection.glsl",
+			"Resources/Shaders/Transmittance.glsl",
+			"Resources/Shaders/MultiScatter.glsl",
+			"Resources/Shaders/SkyViewBuilder.glsl",
+			"Resources/Shaders/SkyViewIrradiance.glsl",
+			"Resources/Shaders/SkyViewFilter.glsl",
+			"Resources/Shaders/AerialPerspective.glsl",
+			"Resources/Shaders/ApplyAerial.glsl",
+			"Resources/Shaders/Voxelization.glsl",
+			"Resources/Shaders/VoxelFilter.glsl",
+			"Resources/Shaders/ShadowDepthPass.glsl",
+			"Resources/Shaders/ShadowCompute.glsl",
+			"Resources/Shaders/VoxelConeTracing.glsl",
+			"Resources/Shaders/FroxelVolumePopulate.glsl",
+			"Resources/Shaders/VolumetricCompute.glsl",
+			"Resources/Shaders/VolumetricBlur.glsl",
+			"Resources/Shaders/VolumetricInjectLight.glsl",
+			"Resources/Shaders/VolumetricGatherLight.glsl",
+			"Resources/Shaders/VolumetricTAA.glsl",
+			"Resources/Shaders/CloudPerlinNoise.glsl",
+			"Resources/Shaders/CloudWoorleyNoise.glsl",
+			"Resources/Shaders/CloudComputeVolumetric.glsl",
+			"Resources/Shaders/BatchRendererQuad.glsl",
+			"Resources/Shaders/BatchRendererLine.glsl",
+			"Resources/Shaders/Wireframe.glsl",
+			"Resources/Shaders/SceneGrid.glsl",
+			"Resources/Shaders/EntityGlow.glsl",
+			"Resources/Shaders/LineDetection.glsl",
+			"Resources/Shaders/GeometryPassIndirectInstancedBindless.glsl",
+			//"Resources/Shaders/BloomConvolution.glsl",
+			//"Resources/Shaders/BloomConvolutionFilter.glsl",
+			"Resources/Shaders/FXAA.glsl",
+			"Resources/Shaders/TAA.glsl",
+			"Resources/Shaders/BloomConvolutionRadix2_512.glsl",
+			"Resources/Shaders/BloomConvolutionRadix2_1024.glsl",
+			"Resources/Shaders/BloomConvolutionRadix2_2048.glsl",
+			"Resources/Shaders/BloomConvolutionRadix4_4096.glsl",
+			"Resources/Shaders/ExpandImageToPowerTwo.glsl",
+			"Resources/Shaders/BloomKernelConvertToRGBA8.glsl"
+		};
+		Renderer::GetShaderLibrary()->Load(shaderFilepaths);
 
 		
 		// Init the pools
@@ -228,9 +233,14 @@ namespace Frost
 		s_RendererAPI->SubmitWireframeMesh(mesh, transform, color, lineWidth);
 	}
 
-	uint32_t Renderer::ReadPixelFromFramebufferEntityID(uint32_t x, uint32_t y)
+	void Renderer::RequestEntityIDPick(uint32_t x, uint32_t y, const std::function<void(uint32_t)>& callback)
+	{
+		s_RendererAPI->RequestEntityIDPick(x, y, callback);
+	}
+
+	void Renderer::RequestEntityIDPickRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::function<void(const Vector<uint32_t>&)>& callback)
 	{
-		return s_RendererAPI->ReadPixelFromFramebufferEntityID(x, y);
+		s_RendererAPI->RequestEntityIDPickRect(x, y, width, height, callback);
 	}
 
 	uint32_t Renderer::GetCurrentFrameIndex()
@@ -318,6 +328,15 @@ namespace Frost
 		return s_Data->EditorIcons[name];
 	}
 
+	void Renderer::SubmitCmdsToRender()
+	{
+		// Commands recorded from worker threads are appended in a deterministic (lane creation) order
+		s_CommandQueue->MergeThreadLanes();
+		s_DeletionCommandQueue->MergeThreadLanes();
+
+		s_RendererAPI->SubmitCmdsToRender();
+	}
+
 	void Renderer::ExecuteCommandBuffer()
 	{
 		s_CommandQueue->Execute();
@@ -364,4 +383,4 @@ namespace Frost
 		return nullptr;
 	}
 
-}
\ No newline at end of file
+}
\ No newline at end of file
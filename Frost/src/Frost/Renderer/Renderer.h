@@ -26,12 +26,20 @@ namespace Frost
 			// TODO: The rasterizer and the rt should have the same number of instances support (currently the rt has 2k, rasterizer has 16k)
 			uint32_t MaxMesh = static_cast<uint32_t>(std::pow(2, 12)); // 4096
 			uint32_t MaxInstance = static_cast<uint32_t>(std::pow(2, 10)); // 1024
+
+			// The TLAS is refitted when only the transforms change, but the quality of a refitted TLAS slowly degrades,
+			// so it is fully rebuilt after this many refits in a row
+			uint32_t MaxTLASRefits = 64;
+
+			// Scratch memory available for the BLAS builds of one frame (a BLAS that is bigger than this is built alone)
+			uint64_t BLASBuildScratchBudget = 64 * 1024 * 1024; // 64MB
 		} RayTracing;
 
 		struct Renderer2DSettings
 		{
 			uint64_t MaxQuads = static_cast<uint64_t>(std::pow(2, 16)); // 65536
 			uint64_t MaxLines = static_cast<uint64_t>(std::pow(2, 16)); // 65536
+			uint32_t MaxCachedTextLayouts = 4096; // The least recently used text layouts are evicted over this limit
 		} Renderer2D;
 
 		// Maximum amount of meshes for the indirect drawing buffer
@@ -54,6 +62,15 @@ namespace Frost
 
 		// Volumetric Pass
 		uint32_t VoluemtricFroxelSlicesZ = 128;
+
+		// Initial size of the transient memory arena (one per frame in flight)
+		uint64_t FrameAllocatorSize = 4 * 1024 * 1024; // 4MB
+
+		// Disk cache of the BC compressed textures (least recently used entries are deleted above this size)
+		uint64_t TextureCacheMaxSize = 2ull * 1024 * 1024 * 1024; // 2GB
+
+		// Persistent staging memory used for the buffer uploads (bigger uploads get a temporary staging buffer)
+		uint64_t StagingRingSize = 64 * 1024 * 1024; // 64MB
 	};
 
 	// Memory Usage:
@@ -85,7 +102,8 @@ namespace Frost
 		static void EndFrame() { s_RendererAPI->EndFrame(); }
 
 		// Submit rendering commands to the graphics queue
-		static void SubmitCmdsToRender() { s_RendererAPI->SubmitCmdsToRender(); }
+		// (commands recorded from other threads are merged into the main queue here)
+		static void SubmitCmdsToRender();
 
 		static void BeginScene(Ref<Scene> scene, Ref<EditorCamera>& camera) { s_RendererAPI->BeginScene(scene, camera); }
 		static void BeginScene(Ref<Scene> scene, Ref<RuntimeCamera>& camera) { s_RendererAPI->BeginScene(scene, camera); }
@@ -104,7 +122,10 @@ namespace Frost
 		static void SubmitText(const std::string& string, const Ref<Font>& font, const glm::mat4& transform, float maxWidth, float lineHeightOffset = 0.0f, float kerningOffset = 0.0f, const glm::vec4& color = glm::vec4(1.0f));
 		static void SubmitWireframeMesh(Ref<Mesh> mesh, const glm::mat4& transform, const glm::vec4& color = glm::vec4(1.0f), float lineWidth = 1.0f);
 
-		static uint32_t ReadPixelFromFramebufferEntityID(uint32_t x, uint32_t y);
+		// Entity picking is asynchronous (the callbacks are called a few frames later, once the GPU has finished the readback)
+		// A single pixel pick returns UINT32_MAX if there is no entity, a rectangle pick returns every entity in it once
+		static void RequestEntityIDPick(uint32_t x, uint32_t y, const std::function<void(uint32_t)>& callback);
+		static void RequestEntityIDPickRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::function<void(const Vector<uint32_t>&)>& callback);
 		static uint32_t GetCurrentFrameIndex();
 		static uint64_t GetFrameCount();
 		static Ref<Scene> GetActiveScene();
@@ -122,7 +143,7 @@ namespace Frost
 
 				pFunc->~FuncT();
 			};
-			auto storageBuffer = GetRenderCommandQueue().Allocate(renderCmd, sizeof(func));
+			auto storageBuffer = GetRenderCommandQueue().Allocate(renderCmd, sizeof(func), alignof(FuncT));
 			new (storageBuffer) FuncT(std::forward<FuncT>(func));
 		}
 
@@ -135,7 +156,7 @@ namespace Frost
 
 				pFunc->~FuncT();
 			};
-			auto storageBuffer = GetDeletionCommandQueue().Allocate(renderCmd, sizeof(func));
+			auto storageBuffer = GetDeletionCommandQueue().Allocate(renderCmd, sizeof(func), alignof(FuncT));
 			new (storageBuffer) FuncT(std::forward<FuncT>(func));
 		}
 
@@ -191,4 +212,4 @@ namespace Frost
 
 		static Ref<RendererDebugger> Create();
 	};
-}
\ No newline at end of file
+}
\ No newline at end of file
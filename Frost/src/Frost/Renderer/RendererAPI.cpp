@@ -53,11 +53,6 @@ namespace Frost
 		data.EntityID = entityID;
 
 		m_SubmeshCount += mesh->GetMeshAsset()->GetSubMeshes().size();
-
-		if (m_MeshInstanceCount.find(mesh->GetMeshAsset()->Handle) == m_MeshInstanceCount.end())
-			m_MeshInstanceCount.insert({ mesh->GetMeshAsset()->Handle, 0 });
-
-		m_MeshInstanceCount[mesh->GetMeshAsset()->Handle]++;
 	}
 
 	void RenderQueue::AddWireframeMesh(Ref<Mesh> mesh, const glm::mat4& transform, const glm::vec4& color, float lineWidth)
@@ -185,7 +180,6 @@ namespace Frost
 
 		m_Data.clear();
 		m_TextRendererData.clear();
-		m_MeshInstanceCount.clear();
 		m_LightData.PointLights.clear();
 		m_LightData.RectangularLights.clear();
 		m_FogVolumeData.clear();
@@ -204,4 +198,4 @@ namespace Frost
 			return 0;
 	}
 
-}
\ No newline at end of file
+}
\ No newline at end of file
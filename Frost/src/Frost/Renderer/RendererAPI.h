@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Frost/Core/FrameAllocator.h"
+
 #include "Frost/Renderer/RenderPass.h"
 #include "Frost/Renderer/RenderCommandQueue.h"
 #include "Frost/Renderer/Mesh.h"
@@ -52,7 +54,8 @@ namespace Frost
 		virtual void SubmitText(const std::string& string, const Ref<Font>& font, const glm::mat4& transform, float maxWidth, float lineHeightOffset, float kerningOffset, const glm::vec4& color) = 0;
 		virtual void SubmitWireframeMesh(Ref<Mesh> mesh, const glm::mat4& transform, const glm::vec4& color, float lineWidth) = 0;
 
-		virtual uint32_t ReadPixelFromFramebufferEntityID(uint32_t x, uint32_t y) = 0;
+		virtual void RequestEntityIDPick(uint32_t x, uint32_t y, const std::function<void(uint32_t)>& callback) = 0;
+		virtual void RequestEntityIDPickRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::function<void(const Vector<uint32_t>&)>& callback) = 0;
 		virtual uint32_t GetCurrentFrameIndex() = 0;
 		virtual uint64_t GetFrameCount() = 0;
 		virtual Ref<Scene> GetActiveScene() = 0;
@@ -100,7 +103,6 @@ namespace Frost
 			uint32_t EntityID;
 		};
 		Vector<RenderQueue::RenderData> m_Data;
-		HashMap<UUID, uint32_t> m_MeshInstanceCount;
 		//uint32_t m_SelectedEntityID;
 
 		struct LightData
@@ -220,4 +222,4 @@ namespace Frost
 		uint32_t ViewPortWidth;
 		uint32_t ViewPortHeight;
 	};
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -19,6 +19,18 @@ namespace Frost
 		ShadowPass.m_ShowCascadesDebug = 0;
 		ShadowPass.UsePCSS = 1;
 		ShadowPass.CascadeCount = 4;
+		ShadowPass.CacheStaticCascades = 1;
+		ShadowPass.CascadeUpdateInterval[0] = 1;
+		ShadowPass.CascadeUpdateInterval[1] = 2;
+		ShadowPass.CascadeUpdateInterval[2] = 4;
+		ShadowPass.CascadeUpdateInterval[3] = 8;
+		ShadowPass.LODBias = 1.0f;
+
+		// Mesh LODs
+		MeshLOD.Enabled = 1;
+		MeshLOD.ScreenErrorThreshold = 1.0f;
+		MeshLOD.Hysteresis = 0.25f;
+		MeshLOD.LODBias = 0.0f;
 
 		// Bloom
 		Bloom.Enabled = 1;
@@ -43,6 +55,7 @@ namespace Frost
 		// Voxel Cone Tracing
 		VoxelGI.EnableVoxelization = 0;
 		VoxelGI.EnableGlobalIllumination = 0;
+		VoxelGI.UseClipmapVoxelization = 1;
 
 		VoxelGI.VoxelSize = 1.0f;
 
@@ -24,8 +24,23 @@ namespace Frost
 			int32_t m_ShowCascadesDebug;
 			int32_t UsePCSS;
 			int32_t CascadeCount;
+
+			// Static casters are rendered into a cache and only re-rendered when their cascade moves (or they change),
+			// the dynamic ones are drawn on top every frame
+			int32_t CacheStaticCascades;
+			int32_t CascadeUpdateInterval[4]; // In frames, how often each cascade can be refitted to the camera
+
+			float LODBias; // Added to the camera's LOD bias, shadows can use coarser LODs without it being noticeable
 		} ShadowPass;
 
+		struct MeshLODSettings
+		{
+			int32_t Enabled;
+			float ScreenErrorThreshold; // In pixels, the coarsest LOD whose projected error stays under it is picked
+			float Hysteresis; // Fraction of the threshold that the error has to cross before switching back and forth
+			float LODBias; // log2 multiplier of the threshold, positive values pick coarser LODs
+		} MeshLOD;
+
 		struct BloomSettings
 		{
 			int32_t Enabled;
@@ -56,6 +71,7 @@ namespace Frost
 		{
 			int32_t EnableGlobalIllumination;
 			int32_t EnableVoxelization;
+			int32_t UseClipmapVoxelization; // Keep the voxels between frames and only revoxelize the dirty bricks
 
 			float VoxelSize;
 			int32_t UseIndirectDiffuse;
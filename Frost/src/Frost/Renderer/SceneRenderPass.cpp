@@ -33,6 +33,14 @@ namespace Frost
 	{
 		if (renderQueue.m_Data.size() != 0)
 		{
+			// The instances are grouped and culled for every view once, before the passes read them
+			m_SceneVisibility.BeginFrame(renderQueue);
+			for (auto& renderPass : m_RenderPasses)
+			{
+				renderPass->OnRegisterViews(renderQueue, m_SceneVisibility);
+			}
+			m_SceneVisibility.CullViews();
+
 			for (auto& renderPass : m_RenderPasses)
 			{
 				renderPass->OnUpdate(renderQueue);
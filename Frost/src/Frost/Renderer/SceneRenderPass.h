@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Frost/Renderer/RendererAPI.h"
+#include "Frost/Renderer/SceneVisibility.h"
 
 #include <typeindex>
 
@@ -15,6 +16,7 @@ namespace Frost
 
 		virtual void Init(SceneRenderPassPipeline* renderPassPipeline) = 0;
 		virtual void InitLate() = 0; // After initializating all the renderpasses, `init late` is being called
+		virtual void OnRegisterViews(const RenderQueue& renderQueue, SceneVisibility& sceneVisibility) {} // Before `OnUpdate`, the views which the pass culls against are added here
 		virtual void OnUpdate(const RenderQueue& renderQueue) = 0;
 		virtual void OnRenderDebug() = 0;
 		virtual void OnResize(uint32_t width, uint32_t height) = 0;
@@ -110,8 +112,11 @@ namespace Frost
 		void UpdateRendererDebugger();
 		void InitLateRenderPasses();
 
+		const SceneVisibility& GetSceneVisibility() const { return m_SceneVisibility; }
+
 	private:
 		Vector<Ref<SceneRenderPass>> m_RenderPasses;
+		SceneVisibility m_SceneVisibility;
 
 		std::unordered_map<std::string, Ref<SceneRenderPass>> m_RenderPassesMap;
 		std::unordered_map<std::type_index, Ref<SceneRenderPass>> m_RenderPassesByTypeId;
@@ -0,0 +1,275 @@
+#include "frostpch.h"
+#include "SceneVisibility.h"
+
+#include "Frost/Core/JobSystem.h"
+#include "Frost/Renderer/Renderer.h"
+#include "Frost/Utils/Hash.h"
+
+namespace Frost
+{
+	void SceneVisibility::BeginFrame(const RenderQueue& renderQueue)
+	{
+		uint32_t instanceCount = renderQueue.GetQueueSize();
+
+		m_Groups.clear();
+		m_GroupedInstances.resize(instanceCount);
+		m_Instances.resize(instanceCount);
+		m_ViewCount = 0;
+
+		// Sorting by the mesh asset handle (and then by the queue index) groups the instances and keeps the order deterministic
+		m_SortKeys.resize(instanceCount);
+		for (uint32_t i = 0; i < instanceCount; i++)
+			m_SortKeys[i] = { (uint64_t)renderQueue.m_Data[i].Mesh->GetMeshAsset()->Handle, i };
+		std::sort(m_SortKeys.begin(), m_SortKeys.end());
+
+		// How many times an (entity id, mesh asset) pair was already submitted this frame
+		FrameHashMap<uint64_t, uint32_t> instanceKeyOccurrences;
+		instanceKeyOccurrences.reserve(instanceCount);
+
+		uint32_t submeshInstanceCount = 0;
+		for (uint32_t i = 0; i < instanceCount; i++)
+		{
+			uint32_t queueIndex = m_SortKeys[i].second;
+			if (m_Groups.empty() || m_SortKeys[i].first != (uint64_t)m_Groups.back().MeshAssetHandle)
+			{
+				Mesh* mesh = renderQueue.m_Data[queueIndex].Mesh.Raw();
+				uint32_t submeshCount = static_cast<uint32_t>(mesh->GetMeshAsset()->GetSubMeshes().size());
+				uint32_t lodCount = std::max(mesh->GetMeshAsset()->GetLODCount(), 1u);
+				m_Groups.push_back({ mesh->GetMeshAsset()->Handle, mesh, submeshCount, lodCount, i, 0, 0 });
+			}
+
+			SceneMeshGroup& group = m_Groups.back();
+			SceneMeshInstance& instance = m_Instances[queueIndex];
+			m_GroupedInstances[i] = queueIndex;
+			instance.GroupIndex = static_cast<uint32_t>(m_Groups.size()) - 1;
+			instance.IndexInGroup = group.InstanceCount++;
+
+			// An entity can submit the same mesh more than once, so the occurrence index (in queue order) keeps the keys of the copies apart
+			uint64_t entityMeshKey = Hash::Combine(Hash::Combine(Hash::FNVOffsetBasis, renderQueue.m_Data[queueIndex].EntityID), m_SortKeys[i].first);
+			uint32_t occurrence = instanceKeyOccurrences[entityMeshKey]++;
+			instance.InstanceKey = occurrence == 0 ? entityMeshKey : Hash::Combine(entityMeshKey, occurrence);
+		}
+
+		for (SceneMeshGroup& group : m_Groups)
+		{
+			group.FirstSubmeshInstance = submeshInstanceCount;
+			submeshInstanceCount += group.SubmeshCount * group.InstanceCount;
+		}
+
+		// The submesh transforms and bounds are computed once here, instead of by every pass
+		m_SubmeshTransforms.resize(submeshInstanceCount);
+		m_SubmeshBounds.Clear();
+		m_SubmeshBounds.Reserve(submeshInstanceCount);
+
+		for (const SceneMeshGroup& group : m_Groups)
+		{
+			const Vector<Submesh>& submeshes = group.Mesh->GetMeshAsset()->GetSubMeshes();
+			for (uint32_t submeshIndex = 0; submeshIndex < group.SubmeshCount; submeshIndex++)
+			{
+				for (uint32_t i = 0; i < group.InstanceCount; i++)
+				{
+					const RenderQueue::RenderData& renderData = renderQueue.m_Data[m_GroupedInstances[group.FirstInstance + i]];
+
+					// Using skeletal (dynamic) submesh transforms, instead of the static ones which are found in the mesh asset
+					glm::mat4 modelMatrix = renderData.Transform * renderData.Mesh->GetSkeletalSubmeshes()[submeshIndex].Transform;
+
+					uint32_t submeshInstanceIndex = group.FirstSubmeshInstance + (submeshIndex * group.InstanceCount) + i;
+					m_SubmeshTransforms[submeshInstanceIndex] = modelMatrix;
+					m_SubmeshBounds.AddTransformed(submeshes[submeshIndex].BoundingBox, modelMatrix);
+				}
+			}
+
+			// Whole instance bounds (the union of its submeshes)
+			for (uint32_t i = 0; i < group.InstanceCount; i++)
+			{
+				SceneMeshInstance& instance = m_Instances[m_GroupedInstances[group.FirstInstance + i]];
+				instance.BoundsMin = glm::vec3(FLT_MAX);
+				instance.BoundsMax = glm::vec3(-FLT_MAX);
+				for (uint32_t submeshIndex = 0; submeshIndex < group.SubmeshCount; submeshIndex++)
+				{
+					uint32_t submeshInstanceIndex = group.FirstSubmeshInstance + (submeshIndex * group.InstanceCount) + i;
+					glm::vec3 center = m_SubmeshBounds.GetCenter(submeshInstanceIndex);
+					glm::vec3 extents = m_SubmeshBounds.GetExtents(submeshInstanceIndex);
+					instance.BoundsMin = glm::min(instance.BoundsMin, center - extents);
+					instance.BoundsMax = glm::max(instance.BoundsMax, center + extents);
+				}
+			}
+		}
+
+		uint32_t cameraView = AddView("Camera", renderQueue.m_Camera->GetViewProjectionVK());
+		FROST_ASSERT(bool(cameraView == CameraView), "The camera must be the first view!");
+
+		const glm::mat4& projectionMatrix = renderQueue.m_Camera->GetProjectionMatrix();
+		SceneViewLOD cameraLOD;
+		cameraLOD.Enabled = true;
+		cameraLOD.Orthographic = projectionMatrix[3][3] == 1.0f;
+		cameraLOD.Position = renderQueue.m_Camera->GetPosition();
+		cameraLOD.ProjectionScale = glm::abs(projectionMatrix[1][1]) * renderQueue.ViewPortHeight * 0.5f;
+		cameraLOD.Bias = Renderer::GetRendererSettings().MeshLOD.LODBias;
+		SetViewLOD(cameraView, cameraLOD);
+	}
+
+	SceneView& SceneVisibility::AllocateView(const std::string& name)
+	{
+		if (m_ViewCount == m_Views.size())
+			m_Views.emplace_back();
+
+		SceneView& view = m_Views[m_ViewCount++];
+		if (view.Name != name)
+		{
+			// The LODs of the previous frame belonged to another view
+			view.Name = name;
+			view.LODHistory.clear();
+		}
+		view.LOD = {};
+		return view;
+	}
+
+	uint32_t SceneVisibility::AddView(const std::string& name, const glm::mat4& viewProjection)
+	{
+		SceneView& view = AllocateView(name);
+		view.Frustum = Math::ViewFrustum::FromViewProjection(viewProjection);
+		return m_ViewCount - 1;
+	}
+
+	uint32_t SceneVisibility::AddView(const std::string& name, const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+	{
+		SceneView& view = AllocateView(name);
+		view.Frustum = Math::ViewFrustum::FromBounds(boundsMin, boundsMax);
+		return m_ViewCount - 1;
+	}
+
+	void SceneVisibility::CullViews()
+	{
+		// The views are independent from each other, so each one is culled by its own job
+		JobSystem::ParallelFor(m_ViewCount, [this](uint32_t viewIndex)
+		{
+			CullView(m_Views[viewIndex]);
+		}, 1);
+	}
+
+	void SceneVisibility::CullView(SceneView& view)
+	{
+		Math::FrustumCull(view.Frustum, m_SubmeshBounds, view.SubmeshVisibility);
+
+		view.InstanceVisibility.assign((m_Instances.size() + 63) / 64, 0);
+		view.VisibleInstances.clear();
+		view.GroupRanges.resize(m_Groups.size());
+		view.VisibleSubmeshCount = 0;
+
+		for (uint32_t groupIndex = 0; groupIndex < m_Groups.size(); groupIndex++)
+		{
+			const SceneMeshGroup& group = m_Groups[groupIndex];
+			SceneViewGroupRange& groupRange = view.GroupRanges[groupIndex];
+			groupRange.FirstVisible = static_cast<uint32_t>(view.VisibleInstances.size());
+
+			for (uint32_t i = 0; i < group.InstanceCount; i++)
+			{
+				uint32_t visibleSubmeshes = 0;
+				for (uint32_t submeshIndex = 0; submeshIndex < group.SubmeshCount; submeshIndex++)
+					visibleSubmeshes += Math::IsVisible(view.SubmeshVisibility, group.FirstSubmeshInstance + (submeshIndex * group.InstanceCount) + i);
+
+				if (visibleSubmeshes != 0)
+				{
+					uint32_t queueIndex = m_GroupedInstances[group.FirstInstance + i];
+					view.InstanceVisibility[queueIndex / 64] |= 1ull << (queueIndex % 64);
+					view.VisibleInstances.push_back(queueIndex);
+					view.VisibleSubmeshCount += visibleSubmeshes;
+				}
+			}
+
+			groupRange.VisibleCount = static_cast<uint32_t>(view.VisibleInstances.size()) - groupRange.FirstVisible;
+		}
+
+		SelectViewLODs(view);
+	}
+
+	namespace Utils
+	{
+		// The coarsest LOD whose projected error stays under the threshold (the errors grow with the LOD)
+		static uint32_t SelectLOD(const Vector<SubmeshLOD>* const* submeshLODs, uint32_t lodCount, uint32_t submeshIndex, float pixelsPerUnit, float threshold)
+		{
+			uint32_t lod = 0;
+			while (lod + 1 < lodCount && (*submeshLODs[lod + 1])[submeshIndex].Error * pixelsPerUnit <= threshold)
+				lod++;
+			return lod;
+		}
+	}
+
+	void SceneVisibility::SelectViewLODs(SceneView& view)
+	{
+		const RendererSettings::MeshLODSettings& lodSettings = Renderer::GetRendererSettings().MeshLOD;
+
+		view.SubmeshLODs.assign(m_SubmeshTransforms.size(), 0);
+		memset(view.LODSubmeshCounts, 0, sizeof(view.LODSubmeshCounts));
+		view.LODSubmeshCounts[0] = view.VisibleSubmeshCount;
+
+		// Last frame's selection is kept aside, so the instances which aren't visible anymore are dropped from the history
+		std::swap(view.LODHistory, view.PreviousLODHistory);
+		view.LODHistory.clear();
+
+		if (!lodSettings.Enabled || !view.LOD.Enabled)
+			return;
+
+		float threshold = lodSettings.ScreenErrorThreshold * glm::exp2(view.LOD.Bias);
+		float hysteresis = glm::clamp(lodSettings.Hysteresis, 0.0f, 0.9f);
+
+		for (const SceneMeshGroup& group : m_Groups)
+		{
+			if (group.LODCount <= 1)
+				continue;
+
+			const Vector<SubmeshLOD>* submeshLODs[MaxMeshLODCount];
+			const MeshAsset* meshAsset = group.Mesh->GetMeshAsset().Raw();
+			uint32_t lodCount = std::min(group.LODCount, MaxMeshLODCount);
+			for (uint32_t lod = 0; lod < lodCount; lod++)
+				submeshLODs[lod] = &meshAsset->GetSubMeshesLOD(lod);
+
+			for (uint32_t submeshIndex = 0; submeshIndex < group.SubmeshCount; submeshIndex++)
+			{
+				for (uint32_t i = 0; i < group.InstanceCount; i++)
+				{
+					uint32_t submeshInstanceIndex = group.FirstSubmeshInstance + (submeshIndex * group.InstanceCount) + i;
+					if (!Math::IsVisible(view.SubmeshVisibility, submeshInstanceIndex))
+						continue;
+
+					// The object space errors are scaled into world space by the largest axis scale of the submesh transform
+					const glm::mat4& transform = m_SubmeshTransforms[submeshInstanceIndex];
+					float maxScale2 = glm::max(glm::max(glm::dot(glm::vec3(transform[0]), glm::vec3(transform[0])), glm::dot(glm::vec3(transform[1]), glm::vec3(transform[1]))), glm::dot(glm::vec3(transform[2]), glm::vec3(transform[2])));
+					float pixelsPerUnit = view.LOD.ProjectionScale * glm::sqrt(maxScale2);
+
+					if (!view.LOD.Orthographic)
+					{
+						// Distance from the closest point of the bounding sphere, the full detail is kept while the view is inside of it
+						float distance = glm::length(m_SubmeshBounds.GetCenter(submeshInstanceIndex) - view.LOD.Position) - glm::length(m_SubmeshBounds.GetExtents(submeshInstanceIndex));
+						if (distance <= 0.0f)
+							continue;
+						pixelsPerUnit /= distance;
+					}
+
+					uint32_t queueIndex = m_GroupedInstances[group.FirstInstance + i];
+					uint64_t historyKey = Hash::Combine(m_Instances[queueIndex].InstanceKey, submeshIndex);
+
+					uint32_t lod;
+					auto previousIt = view.PreviousLODHistory.find(historyKey);
+					if (previousIt != view.PreviousLODHistory.end())
+					{
+						// Keep the previous LOD while it is still inside of the hysteresis band
+						uint32_t finestLOD = Utils::SelectLOD(submeshLODs, lodCount, submeshIndex, pixelsPerUnit, threshold * (1.0f - hysteresis));
+						uint32_t coarsestLOD = Utils::SelectLOD(submeshLODs, lodCount, submeshIndex, pixelsPerUnit, threshold * (1.0f + hysteresis));
+						lod = glm::clamp<uint32_t>(previousIt->second, finestLOD, coarsestLOD);
+					}
+					else
+					{
+						lod = Utils::SelectLOD(submeshLODs, lodCount, submeshIndex, pixelsPerUnit, threshold);
+					}
+
+					view.SubmeshLODs[submeshInstanceIndex] = static_cast<uint8_t>(lod);
+					view.LODHistory[historyKey] = static_cast<uint8_t>(lod);
+					view.LODSubmeshCounts[0]--;
+					view.LODSubmeshCounts[lod]++;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Frost/Renderer/RendererAPI.h"
+#include "Frost/Math/FrustumCulling.h"
+
+namespace Frost
+{
+	// All the instances of one mesh asset which were submitted this frame
+	struct SceneMeshGroup
+	{
+		AssetHandle MeshAssetHandle;
+		Mesh* Mesh; // Mesh of the first instance (all the instances share the same mesh asset)
+		uint32_t SubmeshCount;
+		uint32_t LODCount; // At least 1 (LOD 0 is the full detail mesh)
+
+		uint32_t FirstInstance; // Into `SceneVisibility::GetGroupedInstances()`
+		uint32_t InstanceCount;
+
+		uint32_t FirstSubmeshInstance; // Into the submesh bounds/transforms, which are laid out per submesh, per instance
+	};
+
+	struct SceneMeshInstance // Per render queue entry
+	{
+		uint32_t GroupIndex;
+		uint32_t IndexInGroup;
+
+		uint64_t InstanceKey; // Entity id + mesh asset + occurrence of that pair in the frame, stays the same between frames (unlike the render queue index)
+
+		// World space AABB of all the submeshes
+		glm::vec3 BoundsMin;
+		glm::vec3 BoundsMax;
+	};
+
+	struct SceneViewGroupRange
+	{
+		uint32_t FirstVisible; // Into `SceneView::VisibleInstances`
+		uint32_t VisibleCount;
+	};
+
+	// How the LODs are picked for a view. The projected error (in pixels) of a LOD is its object space error,
+	// scaled by the submesh transform and by `ProjectionScale`, and divided by the distance for perspective views
+	struct SceneViewLOD
+	{
+		bool Enabled = false; // If disabled, the view always uses LOD 0
+		bool Orthographic = false;
+		glm::vec3 Position{ 0.0f };
+		float ProjectionScale = 0.0f; // Pixels per world unit (at a distance of 1, for perspective views)
+		float Bias = 0.0f; // log2 multiplier of the error threshold, positive values pick coarser LODs
+	};
+
+	struct SceneView
+	{
+		std::string Name;
+		Math::ViewFrustum Frustum;
+		SceneViewLOD LOD;
+
+		Vector<uint64_t> SubmeshVisibility;  // One bit per submesh instance (same layout as the submesh bounds)
+		Vector<uint64_t> InstanceVisibility; // One bit per render queue entry, set when any of its submeshes is visible
+
+		// Render queue indices of the visible instances, grouped by mesh asset in the order of the groups
+		Vector<uint32_t> VisibleInstances;
+		Vector<SceneViewGroupRange> GroupRanges; // Per group
+		uint32_t VisibleSubmeshCount = 0;
+
+		Vector<uint8_t> SubmeshLODs; // Selected LOD per submesh instance (same layout as the submesh bounds)
+		uint32_t LODSubmeshCounts[MaxMeshLODCount] = {}; // Visible submesh instances per LOD
+
+		// LODs that were selected last frame (by the instance key and submesh index), for the hysteresis
+		HashMap<uint64_t, uint8_t> LODHistory;
+		HashMap<uint64_t, uint8_t> PreviousLODHistory;
+	};
+
+	// Shared per frame stage which runs before the scene render passes (`SceneRenderPassPipeline::UpdateRenderPasses`).
+	// It groups the render queue by mesh asset and computes the submesh transforms and world bounds only once,
+	// then every pass registers its views (shadow cascades, voxel volume...) and all of them are culled together.
+	// The passes only read the results, so the same instance is not regrouped or transformed again by every pass.
+	class SceneVisibility
+	{
+	public:
+		static constexpr uint32_t CameraView = 0; // Always registered, from the render queue's camera
+
+		void BeginFrame(const RenderQueue& renderQueue);
+
+		// Views can only be added between `BeginFrame` and `CullViews`. The returned index is valid only for the current frame
+		uint32_t AddView(const std::string& name, const glm::mat4& viewProjection);
+		uint32_t AddView(const std::string& name, const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+		void SetViewLOD(uint32_t viewIndex, const SceneViewLOD& lod) { m_Views[viewIndex].LOD = lod; }
+
+		void CullViews();
+
+		const Vector<SceneMeshGroup>& GetGroups() const { return m_Groups; }
+		const Vector<uint32_t>& GetGroupedInstances() const { return m_GroupedInstances; } // Render queue indices, sorted by group
+		const SceneMeshInstance& GetInstance(uint32_t queueIndex) const { return m_Instances[queueIndex]; }
+		uint32_t GetInstanceCount() const { return static_cast<uint32_t>(m_Instances.size()); }
+
+		// Instance transform multiplied by the (skeletal) submesh transform
+		const glm::mat4& GetSubmeshTransform(uint32_t queueIndex, uint32_t submeshIndex) const { return m_SubmeshTransforms[GetSubmeshInstanceIndex(queueIndex, submeshIndex)]; }
+
+		uint32_t GetViewCount() const { return m_ViewCount; }
+		const SceneView& GetView(uint32_t viewIndex) const { return m_Views[viewIndex]; }
+
+		bool IsInstanceVisible(uint32_t viewIndex, uint32_t queueIndex) const
+		{
+			return Math::IsVisible(m_Views[viewIndex].InstanceVisibility, queueIndex);
+		}
+
+		bool IsSubmeshVisible(uint32_t viewIndex, uint32_t queueIndex, uint32_t submeshIndex) const
+		{
+			return Math::IsVisible(m_Views[viewIndex].SubmeshVisibility, GetSubmeshInstanceIndex(queueIndex, submeshIndex));
+		}
+
+		// Only valid for the visible submeshes
+		uint32_t GetSubmeshLOD(uint32_t viewIndex, uint32_t queueIndex, uint32_t submeshIndex) const
+		{
+			return m_Views[viewIndex].SubmeshLODs[GetSubmeshInstanceIndex(queueIndex, submeshIndex)];
+		}
+	private:
+		uint32_t GetSubmeshInstanceIndex(uint32_t queueIndex, uint32_t submeshIndex) const
+		{
+			const SceneMeshInstance& instance = m_Instances[queueIndex];
+			const SceneMeshGroup& group = m_Groups[instance.GroupIndex];
+			return group.FirstSubmeshInstance + (submeshIndex * group.InstanceCount) + instance.IndexInGroup;
+		}
+
+		SceneView& AllocateView(const std::string& name);
+		void CullView(SceneView& view);
+		void SelectViewLODs(SceneView& view);
+	private:
+		Vector<SceneMeshGroup> m_Groups;
+		Vector<uint32_t> m_GroupedInstances;
+		Vector<SceneMeshInstance> m_Instances;
+		Vector<std::pair<uint64_t, uint32_t>> m_SortKeys; // (mesh asset handle, render queue index)
+
+		Vector<glm::mat4> m_SubmeshTransforms;
+		Math::CullingBounds m_SubmeshBounds;
+
+		// Views are kept between frames, so their arrays don't have to be allocated again
+		Vector<SceneView> m_Views;
+		uint32_t m_ViewCount = 0;
+	};
+}
@@ -3,6 +3,7 @@
 
 #include "Frost/Platform/Vulkan/VulkanShader.h"
 #include "Frost/Renderer/Renderer.h"
+#include "Frost/Core/JobSystem.h"
 #include "Frost/Utils/Timer.h"
 
 #include <spirv_cross.hpp>
@@ -62,7 +63,8 @@ namespace Frost
 
 	void ShaderLibrary::Add(const std::string& name, const Ref<Shader>& shader)
 	{
-		FROST_ASSERT(!Exists(name), "Shader already exists!");
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		FROST_ASSERT(bool(m_Shaders.find(name) == m_Shaders.end()), "Shader already exists!");
 		m_Shaders[name] = shader;
 	}
 
@@ -79,20 +81,42 @@ namespace Frost
 	void ShaderLibrary::Load(const std::string& filepath, const Vector<ShaderArray>& customMemberArraySizes)
 	{
 		auto shader = Shader::Create(filepath, customMemberArraySizes);
-		auto& name = shader->GetName();
+		Add(shader);
+	}
 
-		FROST_ASSERT(!Exists(name), "Shader already exists!");
-		m_Shaders[name] = shader;
+	void ShaderLibrary::Load(const Vector<std::string>& filepaths)
+	{
+		auto startTime = std::chrono::high_resolution_clock::now();
+
+		// Every shader is read, compiled (or loaded from the cache) and reflected independently from the others
+		Vector<float> loadTimes(filepaths.size());
+		JobSystem::ParallelFor(static_cast<uint32_t>(filepaths.size()), [&filepaths, &loadTimes, this](uint32_t index)
+		{
+			auto shaderStartTime = std::chrono::high_resolution_clock::now();
+
+			auto shader = Shader::Create(filepaths[index]);
+			Add(shader);
+
+			loadTimes[index] = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - shaderStartTime).count();
+		}, 1);
+
+		float totalTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+		for (uint32_t i = 0; i < filepaths.size(); i++)
+			FROST_CORE_TRACE("[ShaderLibrary] Shader '{0}' loaded in {1} ms", GetShaderNameFromFilepath(filepaths[i]), loadTimes[i]);
+		FROST_CORE_INFO("[ShaderLibrary] {0} shaders loaded in {1} ms ({2} worker threads)", filepaths.size(), totalTime, JobSystem::GetWorkerCount());
 	}
 
 	Ref<Shader> ShaderLibrary::Get(const std::string& name)
 	{
-		FROST_ASSERT(Exists(name), "Shader not found!");
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		FROST_ASSERT(bool(m_Shaders.find(name) != m_Shaders.end()), "Shader not found!");
 		return m_Shaders[name];
 	}
 
 	bool ShaderLibrary::Exists(const std::string& name) const
 	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
 		return m_Shaders.find(name) != m_Shaders.end();
 	}
 
@@ -2,6 +2,8 @@
 
 #include <glm/glm.hpp>
 
+#include <mutex>
+
 using VkDescriptorSetLayout = struct VkDescriptorSetLayout_T*;
 
 namespace Frost
@@ -46,6 +48,7 @@ namespace Frost
 		static Ref<Shader> Create(const std::string& filepath, const Vector<ShaderArray>& customMemberArraySizes);
 	};
 
+	// NOTE: Adding/getting shaders is thread safe, so shaders can be loaded from the `JobSystem` workers
 	class ShaderLibrary
 	{
 	public:
@@ -57,6 +60,9 @@ namespace Frost
 		void Load(const std::string& filepath);
 		void Load(const std::string& filepath, const Vector<ShaderArray>& customMemberArraySizes);
 
+		// Compiles and reflects the shaders in parallel on the `JobSystem` workers (blocks until all of them are loaded)
+		void Load(const Vector<std::string>& filepaths);
+
 		Ref<Shader> Get(const std::string& name);
 
 		bool Exists(const std::string& name) const;
@@ -64,6 +70,7 @@ namespace Frost
 		void Clear();
 	private:
 		HashMap<std::string, Ref<Shader>> m_Shaders;
+		mutable std::mutex m_Mutex;
 	};
 
 	struct ShaderArray
@@ -0,0 +1,361 @@
+#include "frostpch.h"
+#include "TextureCache.h"
+
+#include "Frost/Renderer/Renderer.h"
+#include "Frost/Project/Project.h"
+#include "Frost/Utils/FileSystem.h"
+#include "Frost/Utils/Hash.h"
+#include "Frost/Platform/Vulkan/VulkanImage.h"
+
+#include <compressonator.h>
+
+#include <iomanip>
+
+namespace Frost
+{
+	namespace Utils
+	{
+		static std::filesystem::path GetTextureCacheDirectory()
+		{
+			return Project::GetProjectDirectory() / std::filesystem::path("Resources/Cache/Textures");
+		}
+
+		static void CreateTextureCacheDirectoryIfNeeded()
+		{
+			std::filesystem::path cacheDirectory = GetTextureCacheDirectory();
+			if (!std::filesystem::exists(cacheDirectory))
+				std::filesystem::create_directories(cacheDirectory);
+		}
+
+		static std::filesystem::path GetTextureCacheFilepath(uint64_t cacheKey)
+		{
+			std::stringstream ss;
+			ss << std::hex << std::setw(16) << std::setfill('0') << cacheKey;
+			return GetTextureCacheDirectory() / (ss.str() + ".ftc"); // ftc - Frost Texture Cache
+		}
+	}
+
+	// Bump it when the file layout or the compressor output changes, so old entries are ignored
+	static constexpr uint32_t s_TextureCacheVersion = 2;
+	static constexpr uint32_t s_TextureCacheMagic = 0x30435446; // "FTC0"
+
+	// The texture description is hashed with the data, so a corrupted header can't make the data be uploaded with a wrong size/format
+	static uint64_t GetEntryHash(const TextureCacheHeader& header, const Byte* data)
+	{
+		uint64_t hash = Hash::Combine(Hash::FNVOffsetBasis, header.Width);
+		hash = Hash::Combine(hash, header.Height);
+		hash = Hash::Combine(hash, header.MipCount);
+		hash = Hash::Combine(hash, header.Format);
+		return Hash::GenerateFNVHash(data, header.DataSize, hash);
+	}
+
+	uint64_t TextureCache::GetCacheKey(const std::filesystem::path& sourceFilepath, const TextureCompressionSettings& settings)
+	{
+		if (!FileSystem::Exists(sourceFilepath))
+			return 0;
+
+		Buffer sourceBuffer = FileSystem::ReadBytes(sourceFilepath);
+		if (!sourceBuffer)
+			return 0;
+
+		uint64_t key = Hash::GenerateFNVHash(sourceBuffer.Data, sourceBuffer.Size);
+		sourceBuffer.Release();
+
+		key = Hash::Combine(key, s_TextureCacheVersion);
+		key = Hash::Combine(key, static_cast<uint32_t>(settings.Format));
+		key = Hash::Combine(key, settings.Quality);
+		key = Hash::Combine(key, settings.MipLevelsToSkip);
+		return key;
+	}
+
+	bool TextureCache::Load(uint64_t cacheKey, CompressedTextureData& outTextureData)
+	{
+		if (cacheKey == 0) return false;
+
+		return LoadEntry(Utils::GetTextureCacheFilepath(cacheKey), cacheKey, outTextureData);
+	}
+
+	bool TextureCache::LoadEntry(const std::filesystem::path& cacheFilepath, uint64_t cacheKey, CompressedTextureData& outTextureData)
+	{
+		if (!FileSystem::Exists(cacheFilepath))
+			return false;
+
+		std::error_code errorCode;
+		Buffer cacheBuffer;
+		if (std::filesystem::file_size(cacheFilepath, errorCode) >= sizeof(TextureCacheHeader) && !errorCode)
+			cacheBuffer = FileSystem::ReadBytes(cacheFilepath);
+
+		bool isValid = Deserialize(cacheKey, cacheBuffer, outTextureData);
+		cacheBuffer.Release();
+
+		if (!isValid)
+		{
+			FROST_CORE_WARN("[TextureCache] Cache entry '{0}' is corrupted or outdated, deleting it", cacheFilepath.string());
+			std::filesystem::remove(cacheFilepath, errorCode);
+			return false;
+		}
+
+		// The write time is used as the "last used" time for the LRU cleanup
+		std::filesystem::last_write_time(cacheFilepath, std::filesystem::file_time_type::clock::now(), errorCode);
+
+		return true;
+	}
+
+	void TextureCache::Store(uint64_t cacheKey, const CompressedTextureData& textureData)
+	{
+		if (cacheKey == 0 || !textureData.Data) return;
+
+		Utils::CreateTextureCacheDirectoryIfNeeded();
+
+		if (StoreEntry(Utils::GetTextureCacheFilepath(cacheKey), cacheKey, textureData))
+			EnforceSizeLimit();
+	}
+
+	bool TextureCache::StoreEntry(const std::filesystem::path& cacheFilepath, uint64_t cacheKey, const CompressedTextureData& textureData)
+	{
+		Buffer cacheBuffer = Serialize(cacheKey, textureData);
+
+		// Write into a temporary file first, so a crash while writing can't leave a half written entry behind
+		std::filesystem::path tempFilepath = cacheFilepath.string() + ".tmp";
+		bool success = FileSystem::WriteBytes(tempFilepath, cacheBuffer);
+		cacheBuffer.Release();
+
+		std::error_code errorCode;
+		if (success)
+			std::filesystem::rename(tempFilepath, cacheFilepath, errorCode);
+
+		if (!success || errorCode)
+		{
+			FROST_CORE_ERROR("[TextureCache] Failed to write the cache entry '{0}'", cacheFilepath.string());
+			std::filesystem::remove(tempFilepath, errorCode);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool TextureCache::LoadOrCompress(const std::filesystem::path& sourceFilepath, const TextureCompressionSettings& settings, CompressedTextureData& outTextureData)
+	{
+		uint64_t cacheKey = GetCacheKey(sourceFilepath, settings);
+		if (Load(cacheKey, outTextureData))
+			return true;
+
+		if (!Compress(sourceFilepath, settings, outTextureData))
+			return false;
+
+		Store(cacheKey, outTextureData);
+		return true;
+	}
+
+	bool TextureCache::Compress(const std::filesystem::path& sourceFilepath, const TextureCompressionSettings& settings, CompressedTextureData& outTextureData)
+	{
+		CMP_MipSet textureMipSet{};
+		if (CMP_LoadTexture(sourceFilepath.string().c_str(), &textureMipSet) != CMP_OK)
+		{
+			FROST_CORE_ERROR("[TextureCache] Failed to load the texture '{0}'", sourceFilepath.string());
+			return false;
+		}
+
+		// Generate the mips before compressing, so when it will compress, it will do the mips as well.
+		{
+			uint32_t totalMipMapLevels = Utils::CalculateMipMapLevels(textureMipSet.dwWidth, textureMipSet.dwHeight);
+			uint32_t compressedMipMapLevels = (uint32_t)glm::max((int32_t)totalMipMapLevels - (int32_t)settings.MipLevelsToSkip, 0);
+			CMP_GenerateMIPLevels(&textureMipSet, compressedMipMapLevels);
+		}
+
+		// Initialize the compressed mip set and compress the mips.
+		CMP_MipSet compressedMipSet{};
+		{
+			compressedMipSet.m_nWidth = textureMipSet.m_nWidth;
+			compressedMipSet.m_nHeight = textureMipSet.m_nHeight;
+			compressedMipSet.m_nDepth = textureMipSet.m_nDepth;
+
+			// Set the compression parameters
+			CMP_CompressOptions options = { 0 };
+			options.dwSize = sizeof(options);
+			options.fquality = settings.Quality;
+			options.dwnumThreads = 8;
+
+			switch (settings.Format)
+			{
+				case ImageFormat::RGB_BC1:
+				case ImageFormat::RGBA_BC1:  options.DestFormat = CMP_FORMAT_BC1; break;
+				case ImageFormat::BC2:		 options.DestFormat = CMP_FORMAT_BC2; break;
+				case ImageFormat::BC3:		 options.DestFormat = CMP_FORMAT_BC3; break;
+				case ImageFormat::BC4:		 options.DestFormat = CMP_FORMAT_BC4; break;
+				case ImageFormat::BC5:		 options.DestFormat = CMP_FORMAT_BC5; break;
+				default: FROST_ASSERT_MSG("Something is wrong! :(");
+			}
+
+			// Compress
+			if (CMP_ConvertMipTexture(&textureMipSet, &compressedMipSet, &options, nullptr) != CMP_OK)
+			{
+				FROST_CORE_ERROR("[TextureCache] Failed to compress the texture '{0}'", sourceFilepath.string());
+				CMP_FreeMipSet(&textureMipSet);
+				CMP_FreeMipSet(&compressedMipSet);
+				return false;
+			}
+		}
+
+		// Pack all the compressed mip set into a single buffer for it to copy more efficiently into the image buffer
+		Buffer compressedMipSetBuffer{};
+		{
+			// Compute the total buffer size required
+			uint64_t totalBufferSize = 0;
+			for (uint32_t i = 0; i < compressedMipSet.m_nMipLevels; i++)
+			{
+				totalBufferSize += Utils::CalculateImageBufferSize(
+					compressedMipSet.m_pMipLevelTable[i]->m_nWidth,
+					compressedMipSet.m_pMipLevelTable[i]->m_nHeight,
+					settings.Format
+				);
+			}
+
+			// Allocate the whole buffer (with `malloc`, because the texture data is freed with `free` in `Destroy`)
+			compressedMipSetBuffer.Data = malloc(totalBufferSize);
+			compressedMipSetBuffer.Size = static_cast<uint32_t>(totalBufferSize);
+
+			uint64_t bufferOffset = 0;
+			for (uint32_t i = 0; i < compressedMipSet.m_nMipLevels; i++)
+			{
+				// Get the current mip image buffer size
+				uint64_t mipBufferSize = Utils::CalculateImageBufferSize(
+					compressedMipSet.m_pMipLevelTable[i]->m_nWidth,
+					compressedMipSet.m_pMipLevelTable[i]->m_nHeight,
+					settings.Format
+				);
+
+				// Write into the buffer with an offset
+				compressedMipSetBuffer.Write(compressedMipSet.m_pMipLevelTable[i]->m_pbData, mipBufferSize, bufferOffset);
+
+				// Add the current mip buffer size to the buffer offset
+				bufferOffset += mipBufferSize;
+			}
+		}
+
+		outTextureData.Width = compressedMipSet.m_pMipLevelTable[0]->m_nWidth;
+		outTextureData.Height = compressedMipSet.m_pMipLevelTable[0]->m_nHeight;
+		outTextureData.MipCount = compressedMipSet.m_nMipLevels;
+		outTextureData.Format = settings.Format;
+		outTextureData.Data = compressedMipSetBuffer;
+
+		// After copying the buffers into our own packed mip buffer, we do not those anymore
+		CMP_FreeMipSet(&textureMipSet);
+		CMP_FreeMipSet(&compressedMipSet);
+		return true;
+	}
+
+	Buffer TextureCache::Serialize(uint64_t cacheKey, const CompressedTextureData& textureData)
+	{
+		TextureCacheHeader header{};
+		header.Magic = s_TextureCacheMagic;
+		header.Version = s_TextureCacheVersion;
+		header.CacheKey = cacheKey;
+		header.Width = textureData.Width;
+		header.Height = textureData.Height;
+		header.MipCount = textureData.MipCount;
+		header.Format = static_cast<uint32_t>(textureData.Format);
+		header.DataSize = textureData.Data.Size;
+		header.DataHash = GetEntryHash(header, (const Byte*)textureData.Data.Data);
+
+		Buffer cacheBuffer;
+		cacheBuffer.Allocate(sizeof(TextureCacheHeader) + textureData.Data.Size);
+		cacheBuffer.Write(&header, sizeof(TextureCacheHeader), 0);
+		cacheBuffer.Write(textureData.Data.Data, textureData.Data.Size, sizeof(TextureCacheHeader));
+		return cacheBuffer;
+	}
+
+	bool TextureCache::Deserialize(uint64_t cacheKey, const Buffer& cacheBuffer, CompressedTextureData& outTextureData)
+	{
+		// Validate the entry, before trusting anything that is written in it
+		if (!cacheBuffer || cacheBuffer.Size < sizeof(TextureCacheHeader))
+			return false;
+
+		TextureCacheHeader header;
+		memcpy(&header, cacheBuffer.Data, sizeof(TextureCacheHeader));
+
+		const Byte* data = (const Byte*)cacheBuffer.Data + sizeof(TextureCacheHeader);
+		bool isValid = header.Magic == s_TextureCacheMagic &&
+		               header.Version == s_TextureCacheVersion &&
+		               header.CacheKey == cacheKey &&
+		               header.DataSize == cacheBuffer.Size - sizeof(TextureCacheHeader) &&
+		               header.DataHash == GetEntryHash(header, data);
+		if (!isValid)
+			return false;
+
+		outTextureData.Width = header.Width;
+		outTextureData.Height = header.Height;
+		outTextureData.MipCount = header.MipCount;
+		outTextureData.Format = static_cast<ImageFormat>(header.Format);
+		outTextureData.Data.Data = malloc(header.DataSize);
+		outTextureData.Data.Size = static_cast<uint32_t>(header.DataSize);
+		memcpy(outTextureData.Data.Data, data, header.DataSize);
+		return true;
+	}
+
+	void TextureCache::Invalidate(uint64_t cacheKey)
+	{
+		std::error_code errorCode;
+		std::filesystem::remove(Utils::GetTextureCacheFilepath(cacheKey), errorCode);
+	}
+
+	void TextureCache::Clear()
+	{
+		std::error_code errorCode;
+		std::filesystem::remove_all(Utils::GetTextureCacheDirectory(), errorCode);
+	}
+
+	uint64_t TextureCache::GetCacheSize()
+	{
+		uint64_t cacheSize = 0;
+
+		std::error_code errorCode;
+		for (auto& entry : std::filesystem::directory_iterator(Utils::GetTextureCacheDirectory(), errorCode))
+		{
+			if (entry.is_regular_file())
+				cacheSize += entry.file_size();
+		}
+		return cacheSize;
+	}
+
+	void TextureCache::EnforceSizeLimit()
+	{
+		struct CacheEntry
+		{
+			std::filesystem::path Filepath;
+			std::filesystem::file_time_type LastUsed;
+			uint64_t Size;
+		};
+
+		Vector<CacheEntry> entries;
+		uint64_t cacheSize = 0;
+
+		std::error_code errorCode;
+		for (auto& entry : std::filesystem::directory_iterator(Utils::GetTextureCacheDirectory(), errorCode))
+		{
+			if (!entry.is_regular_file() || entry.path().extension() != ".ftc")
+				continue;
+
+			entries.push_back({ entry.path(), entry.last_write_time(), entry.file_size() });
+			cacheSize += entries.back().Size;
+		}
+
+		uint64_t maxCacheSize = Renderer::GetRendererConfig().TextureCacheMaxSize;
+		if (cacheSize <= maxCacheSize)
+			return;
+
+		// Delete the least recently used entries first
+		std::sort(entries.begin(), entries.end(), [](const CacheEntry& a, const CacheEntry& b) { return a.LastUsed < b.LastUsed; });
+
+		for (auto& entry : entries)
+		{
+			if (cacheSize <= maxCacheSize)
+				break;
+
+			if (std::filesystem::remove(entry.Filepath, errorCode))
+				cacheSize -= entry.Size;
+		}
+
+		FROST_CORE_INFO("[TextureCache] Cache size was over the limit, trimmed it to {0} MB", cacheSize / (1024 * 1024));
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Frost/Core/Buffer.h"
+#include "Frost/Renderer/Image.h"
+
+#include <filesystem>
+
+namespace Frost
+{
+	// Settings which change the output of the texture compression (all of them are part of the cache key)
+	struct TextureCompressionSettings
+	{
+		ImageFormat Format = ImageFormat::None;
+		float Quality = 0.05f;
+		uint32_t MipLevelsToSkip = 2; // The smallest mips are not compressed
+	};
+
+	// Already compressed texture with its whole mip chain packed into one buffer, ready to be uploaded
+	struct CompressedTextureData
+	{
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t MipCount = 0;
+		ImageFormat Format = ImageFormat::None;
+		Buffer Data;
+	};
+
+	// Written at the start of every cache entry, followed by the compressed data
+	struct TextureCacheHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t CacheKey;
+		uint32_t Width;
+		uint32_t Height;
+		uint32_t MipCount;
+		uint32_t Format;
+		uint64_t DataSize;
+		uint64_t DataHash;
+	};
+
+	// Disk cache for BC compressed textures (stored in `Resources/Cache/Textures` of the project).
+	// Entries are keyed by the hash of the source file's content plus the compression settings,
+	// so editing a texture (or changing how it's compressed) automatically produces a new entry.
+	// The least recently used entries are deleted when the cache grows over `RendererConfig::TextureCacheMaxSize`.
+	class TextureCache
+	{
+	public:
+		// Returns 0 if the source file couldn't be read
+		static uint64_t GetCacheKey(const std::filesystem::path& sourceFilepath, const TextureCompressionSettings& settings);
+
+		// The returned data is allocated with `malloc` (the same as the other texture loaders), so it's owned by the texture
+		static bool Load(uint64_t cacheKey, CompressedTextureData& outTextureData);
+		static void Store(uint64_t cacheKey, const CompressedTextureData& textureData);
+
+		// Loads the cached entry of the source texture, or compresses it (and stores the result) when there is none
+		static bool LoadOrCompress(const std::filesystem::path& sourceFilepath, const TextureCompressionSettings& settings, CompressedTextureData& outTextureData);
+
+		// Generates the mips and compresses them, without touching the cache. The returned data is allocated with `malloc`
+		static bool Compress(const std::filesystem::path& sourceFilepath, const TextureCompressionSettings& settings, CompressedTextureData& outTextureData);
+
+		static void Invalidate(uint64_t cacheKey);
+		static void Clear();
+
+		static uint64_t GetCacheSize();
+
+		// In-memory layout of an entry (header + data), used by `Load`/`Store`. The returned buffer is owned by the caller
+		static Buffer Serialize(uint64_t cacheKey, const CompressedTextureData& textureData);
+		// Returns false if the entry is corrupted, was written by another version or belongs to another key
+		static bool Deserialize(uint64_t cacheKey, const Buffer& cacheBuffer, CompressedTextureData& outTextureData);
+
+		// Reads/writes a single entry file, used by `Load`/`Store` with the project's cache directory.
+		// A corrupted or outdated entry is deleted when it is read
+		static bool LoadEntry(const std::filesystem::path& cacheFilepath, uint64_t cacheKey, CompressedTextureData& outTextureData);
+		static bool StoreEntry(const std::filesystem::path& cacheFilepath, uint64_t cacheKey, const CompressedTextureData& textureData);
+	private:
+		static void EnforceSizeLimit();
+	};
+}
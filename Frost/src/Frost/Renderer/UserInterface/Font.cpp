@@ -347,4 +347,35 @@ namespace Frost
 		delete m_MSDFData;
 	}
 
+	TextFontMetrics Font::GetMetrics() const
+	{
+		const auto& metrics = m_MSDFData->FontGeometry.getMetrics();
+		return { metrics.ascenderY, metrics.descenderY, metrics.lineHeight };
+	}
+
+	bool Font::GetGlyph(char32_t character, TextGlyph& outGlyph) const
+	{
+		const msdf_atlas::GlyphGeometry* glyph = m_MSDFData->FontGeometry.getGlyph(character);
+		if (!glyph)
+			return false;
+
+		glyph->getQuadPlaneBounds(outGlyph.PlaneBounds.x, outGlyph.PlaneBounds.y, outGlyph.PlaneBounds.z, outGlyph.PlaneBounds.w);
+
+		// The atlas bounds are in texels
+		double texelWidth = 1.0 / m_TextureAtlas->GetWidth();
+		double texelHeight = 1.0 / m_TextureAtlas->GetHeight();
+		glyph->getQuadAtlasBounds(outGlyph.AtlasBounds.x, outGlyph.AtlasBounds.y, outGlyph.AtlasBounds.z, outGlyph.AtlasBounds.w);
+		outGlyph.AtlasBounds *= glm::dvec4(texelWidth, texelHeight, texelWidth, texelHeight);
+
+		outGlyph.Advance = glyph->getAdvance();
+		return true;
+	}
+
+	double Font::GetAdvance(char32_t character, char32_t nextCharacter, double glyphAdvance) const
+	{
+		double advance = glyphAdvance;
+		m_MSDFData->FontGeometry.getAdvance(advance, character, nextCharacter);
+		return advance;
+	}
+
 }
\ No newline at end of file
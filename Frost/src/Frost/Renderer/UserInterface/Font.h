@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Frost/Renderer/Texture.h"
+#include "Frost/Renderer/UserInterface/TextLayout.h"
 
 #include <filesystem>
 
@@ -10,7 +11,7 @@ namespace Frost
 	struct FontConfiguration;
 	struct FontInput;
 
-	class Font : public Asset
+	class Font : public TextLayoutFont
 	{
 	public:
 		Font(const std::filesystem::path& filepath);
@@ -21,6 +22,10 @@ namespace Frost
 
 		const std::string& GetFontName() const { return m_Name; }
 
+		virtual TextFontMetrics GetMetrics() const override;
+		virtual bool GetGlyph(char32_t character, TextGlyph& outGlyph) const override;
+		virtual double GetAdvance(char32_t character, char32_t nextCharacter, double glyphAdvance) const override;
+
 		//static void InitDefaultFont();
 		//static Ref<Font> GetDefaultFont();
 
@@ -0,0 +1,197 @@
+#include "frostpch.h"
+#include "TextLayout.h"
+
+#include "Frost/Utils/Hash.h"
+
+#include <codecvt>
+#include <locale>
+
+namespace Frost
+{
+	// From https://stackoverflow.com/questions/31302506/stdu32string-conversion-to-from-stdstring-and-stdu16string
+	static std::u32string To_UTF32(const std::string& s)
+	{
+		std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> conv;
+		return conv.from_bytes(s);
+	}
+
+	static bool NextLine(int index, const std::vector<int>& lines)
+	{
+		for (int line : lines)
+		{
+			if (line == index)
+				return true;
+		}
+		return false;
+	}
+
+	// Missing characters are shown as '?' (or skipped, if the font doesn't have it either)
+	static bool GetGlyphOrFallback(const TextLayoutFont& font, char32_t character, TextGlyph& outGlyph)
+	{
+		return font.GetGlyph(character, outGlyph) || font.GetGlyph('?', outGlyph);
+	}
+
+	void LayoutText(const TextLayoutFont& font, const std::string& string, float maxWidth, float lineHeightOffset, float kerningOffset, Vector<TextGlyphQuad>& outQuads)
+	{
+		outQuads.clear();
+
+		std::u32string utf32string = To_UTF32(string);
+		TextFontMetrics metrics = font.GetMetrics();
+		TextGlyph glyph;
+
+		// Computing the new lines in the text
+		Vector<int> nextLines;
+		{
+			double xOffset = 0.0;
+			double fsScale = 1 / (metrics.AscenderY - metrics.DescenderY);
+			double yOffset = -fsScale * metrics.AscenderY;
+			int lastSpace = -1;
+
+			for (int i = 0; i < utf32string.size(); i++)
+			{
+				char32_t character = utf32string[i];
+				if (character == '\n')
+				{
+					xOffset = 0;
+					yOffset -= fsScale * metrics.LineHeight + lineHeightOffset;
+					continue;
+				}
+
+				if (!GetGlyphOrFallback(font, character, glyph))
+					continue;
+
+				if (character != ' ')
+				{
+					// Calculate geometry for the glyph
+					glm::vec2 quadMin((float)glyph.PlaneBounds.x, (float)glyph.PlaneBounds.y);
+					glm::vec2 quadMax((float)glyph.PlaneBounds.z, (float)glyph.PlaneBounds.w);
+
+					quadMin *= fsScale;
+					quadMax *= fsScale;
+
+					quadMin += glm::vec2(xOffset, yOffset);
+					quadMax += glm::vec2(xOffset, yOffset);
+
+					if (quadMax.x > maxWidth && lastSpace != -1)
+					{
+						i = lastSpace;
+						nextLines.emplace_back(lastSpace);
+						lastSpace = -1;
+
+						xOffset = 0;
+						yOffset -= fsScale * metrics.LineHeight + lineHeightOffset;
+					}
+				}
+				else
+				{
+					lastSpace = i;
+				}
+
+				double advance = font.GetAdvance(character, utf32string[i + 1], glyph.Advance);
+				xOffset += fsScale * advance + kerningOffset;
+			}
+		}
+
+		{
+			double xOffset = 0.0;
+			double fsScale = 1 / (metrics.AscenderY - metrics.DescenderY);
+			double yOffset = 0.0;
+
+			for (int i = 0; i < utf32string.size(); i++)
+			{
+				char32_t character = utf32string[i];
+				if (character == '\n' || NextLine(i, nextLines))
+				{
+					xOffset = 0;
+					yOffset -= fsScale * metrics.LineHeight + lineHeightOffset;
+					continue;
+				}
+
+				if (!GetGlyphOrFallback(font, character, glyph))
+					continue;
+
+				double pl = (glyph.PlaneBounds.x * fsScale) + xOffset;
+				double pb = (glyph.PlaneBounds.y * fsScale) + yOffset;
+				double pr = (glyph.PlaneBounds.z * fsScale) + xOffset;
+				double pt = (glyph.PlaneBounds.w * fsScale) + yOffset;
+
+				TextGlyphQuad& glyphQuad = outQuads.emplace_back();
+				glyphQuad.PlaneBounds = { pl, pb, pr, pt };
+				glyphQuad.AtlasBounds = glm::vec4(glyph.AtlasBounds);
+
+				double advance = font.GetAdvance(character, utf32string[i + 1], glyph.Advance);
+				xOffset += fsScale * advance + kerningOffset;
+			}
+		}
+	}
+
+	void TextLayoutCache::BeginFrame()
+	{
+		m_FrameIndex++;
+		m_Stats = {};
+	}
+
+	const TextLayout& TextLayoutCache::GetTextLayout(const std::string& string, const Ref<TextLayoutFont>& font, float maxWidth, float lineHeightOffset, float kerningOffset)
+	{
+		uint64_t layoutKey = Hash::GenerateFNVHash(string);
+		layoutKey = Hash::Combine(layoutKey, reinterpret_cast<uint64_t>(font.Raw()));
+		layoutKey = Hash::Combine(layoutKey, maxWidth);
+		layoutKey = Hash::Combine(layoutKey, lineHeightOffset);
+		layoutKey = Hash::Combine(layoutKey, kerningOffset);
+
+		TextLayout& textLayout = m_Layouts[layoutKey];
+		textLayout.LastUsedFrame = m_FrameIndex;
+
+		// The whole input is compared (not only the hash), so a hash collision can't show the wrong text
+		bool isCached = textLayout.Font.Raw() == font.Raw() &&
+		                textLayout.MaxWidth == maxWidth &&
+		                textLayout.LineHeightOffset == lineHeightOffset &&
+		                textLayout.KerningOffset == kerningOffset &&
+		                textLayout.String == string;
+
+		if (isCached)
+		{
+			m_Stats.CacheHits++;
+			return textLayout;
+		}
+
+		// The font is kept alive by the entry, so its address can't be reused by another font while it's cached
+		textLayout.String = string;
+		textLayout.Font = font;
+		textLayout.MaxWidth = maxWidth;
+		textLayout.LineHeightOffset = lineHeightOffset;
+		textLayout.KerningOffset = kerningOffset;
+		LayoutText(*font, string, maxWidth, lineHeightOffset, kerningOffset, textLayout.Quads);
+
+		m_Stats.CacheMisses++;
+		return textLayout;
+	}
+
+	void TextLayoutCache::EvictLayouts(uint32_t maxCachedLayouts)
+	{
+		if (m_Layouts.size() > maxCachedLayouts)
+		{
+			Vector<std::pair<uint64_t, uint64_t>> entries; // Last used frame, key
+			entries.reserve(m_Layouts.size());
+			for (auto& [layoutKey, textLayout] : m_Layouts)
+				entries.emplace_back(textLayout.LastUsedFrame, layoutKey);
+
+			// Delete the least recently used layouts first
+			size_t evictCount = m_Layouts.size() - maxCachedLayouts;
+			std::nth_element(entries.begin(), entries.begin() + evictCount, entries.end());
+
+			for (size_t i = 0; i < evictCount; i++)
+				m_Layouts.erase(entries[i].second);
+
+			m_Stats.EvictedLayouts += static_cast<uint32_t>(evictCount);
+		}
+
+		m_Stats.CachedLayouts = static_cast<uint32_t>(m_Layouts.size());
+	}
+
+	void TextLayoutCache::Clear()
+	{
+		m_Layouts.clear();
+		m_Stats.CachedLayouts = 0;
+	}
+}
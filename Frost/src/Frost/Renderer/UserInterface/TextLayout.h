@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Frost/Asset/Asset.h"
+
+#include <glm/glm.hpp>
+
+namespace Frost
+{
+	struct TextFontMetrics
+	{
+		double AscenderY;
+		double DescenderY;
+		double LineHeight;
+	};
+
+	struct TextGlyph
+	{
+		glm::dvec4 PlaneBounds; // Left, bottom, right, top (in font units, before the font scale is applied)
+		glm::dvec4 AtlasBounds; // Left, bottom, right, top (normalized)
+		double Advance;
+	};
+
+	// What laying out a text needs from a font. `Font` implements it with its msdf data,
+	// so the layout (and its cache) doesn't depend on the renderer and can be tested with a fake font
+	class TextLayoutFont : public Asset
+	{
+	public:
+		virtual ~TextLayoutFont() {}
+
+		virtual TextFontMetrics GetMetrics() const = 0;
+
+		// Returns false when the font has no glyph for the character
+		virtual bool GetGlyph(char32_t character, TextGlyph& outGlyph) const = 0;
+
+		// `glyphAdvance` adjusted by the kerning between the two characters (it is returned as it is when the font has no kerning for them)
+		virtual double GetAdvance(char32_t character, char32_t nextCharacter, double glyphAdvance) const = 0;
+
+		static AssetType GetStaticType() { return AssetType::Font; }
+		virtual AssetType GetAssetType() const override { return AssetType::Font; }
+	};
+
+	// Glyph quad of an already laid out text, in the text's local space (before the transform is applied)
+	struct TextGlyphQuad
+	{
+		glm::vec4 PlaneBounds; // Left, bottom, right, top
+		glm::vec4 AtlasBounds; // Left, bottom, right, top (normalized)
+	};
+
+	// Laying out a text (utf8 decoding, glyph lookup, kerning and line wrapping) is only done when one of these changes,
+	// so the transform and color can be freely animated without invalidating the layout
+	struct TextLayout
+	{
+		std::string String;
+		Ref<TextLayoutFont> Font;
+		float MaxWidth;
+		float LineHeightOffset;
+		float KerningOffset;
+
+		Vector<TextGlyphQuad> Quads;
+		uint64_t LastUsedFrame = 0;
+	};
+
+	struct TextLayoutCacheStats
+	{
+		uint32_t CacheHits = 0;
+		uint32_t CacheMisses = 0;
+		uint32_t EvictedLayouts = 0;
+		uint32_t CachedLayouts = 0;
+	};
+
+	// Lays out the text without any caching (the quads are cleared first)
+	void LayoutText(const TextLayoutFont& font, const std::string& string, float maxWidth, float lineHeightOffset, float kerningOffset, Vector<TextGlyphQuad>& outQuads);
+
+	// Text layouts keyed by the string, font and the layout settings. The least recently used ones are evicted over a limit
+	class TextLayoutCache
+	{
+	public:
+		// Starts a new frame (the layouts used from now on are the most recent ones) and resets the stats
+		void BeginFrame();
+
+		const TextLayout& GetTextLayout(const std::string& string, const Ref<TextLayoutFont>& font, float maxWidth, float lineHeightOffset, float kerningOffset);
+
+		// Evicts the least recently used layouts, until at most `maxCachedLayouts` are left
+		void EvictLayouts(uint32_t maxCachedLayouts);
+
+		void Clear();
+
+		uint32_t GetCachedLayoutCount() const { return static_cast<uint32_t>(m_Layouts.size()); }
+		const TextLayoutCacheStats& GetStats() const { return m_Stats; }
+	private:
+		HashMap<uint64_t, TextLayout> m_Layouts;
+		uint64_t m_FrameIndex = 0;
+		TextLayoutCacheStats m_Stats;
+	};
+}
@@ -8,6 +8,7 @@
 #include <mono/metadata/debug-helpers.h>
 #include <mono/metadata/attrdefs.h>
 #include <mono/metadata/mono-gc.h>
+#include <mono/metadata/object.h>
 
 #include "Frost/Utils/FileSystem.h"
 
@@ -23,6 +24,7 @@ namespace Frost
 	static MonoAssembly* LoadAssemblyFromFile(const char* filepath);
 
 	static MonoObject* CallMethod(MonoObject* object, MonoMethod* method, void** params = nullptr);
+	static void HandleException(MonoObject* exception);
 
 	static MonoImage* GetAssemblyImage(MonoAssembly* assembly);
 	static MonoClass* GetClass(MonoImage* image, const EntityScriptClass& scriptClass);
@@ -61,6 +63,14 @@ namespace Frost
 	static MonoMethod* s_ExceptionMethod = nullptr;
 	static MonoClass* s_EntityClass = nullptr;
 
+	// Batched `OnUpdate` dispatch. The managed dispatcher (`Frost.Entity.UpdateEntities`) is called through an unmanaged thunk,
+	// so the whole scene is updated with a single native -> managed transition, instead of one `mono_runtime_invoke` per entity.
+	// The thunk (and the array of instances passed to it) belong to the core assembly domain, so they are recreated on every reload
+	using UpdateEntitiesThunk = void(__stdcall*)(MonoArray* entities, int32_t count, float deltaTime, MonoException** exception);
+	static UpdateEntitiesThunk s_UpdateEntitiesThunk = nullptr;
+	static uint32_t s_UpdateEntitiesArrayHandle = 0;
+	static uint32_t s_UpdateEntitiesArrayCapacity = 0;
+
 	static HashMap<UUID, HashMap<UUID, EntityInstanceData>> s_EntityInstanceMap; // Scene UUID -> Entity UID -> Entity Instance Data
 	static HashMap<std::string, EntityScriptClass> s_EntityClassMap;
 
@@ -105,9 +115,39 @@ namespace Frost
 		FROST_ASSERT_INTERNAL(rootDomain);
 	}
 
+	static void ReleaseUpdateEntitiesArray()
+	{
+		if (s_UpdateEntitiesArrayHandle)
+			mono_gchandle_free(s_UpdateEntitiesArrayHandle);
+
+		s_UpdateEntitiesArrayHandle = 0;
+		s_UpdateEntitiesArrayCapacity = 0;
+	}
+
+	// The array is reused every frame and only reallocated when the number of scripted entities grows
+	static MonoArray* GetUpdateEntitiesArray(uint32_t count)
+	{
+		if (count > s_UpdateEntitiesArrayCapacity)
+		{
+			ReleaseUpdateEntitiesArray();
+
+			uint32_t capacity = std::max(count + count / 2, 64u);
+			MonoArray* array = mono_array_new(mono_domain_get(), s_EntityClass, capacity);
+			s_UpdateEntitiesArrayHandle = mono_gchandle_new((MonoObject*)array, false);
+			s_UpdateEntitiesArrayCapacity = capacity;
+		}
+
+		// The handle is not pinned, so the GC is free to move the array. Always get the current address from the handle
+		return (MonoArray*)mono_gchandle_get_target(s_UpdateEntitiesArrayHandle);
+	}
+
 	bool ScriptEngine::LoadFrostRunTimeAssembly(const std::string& path)
 	{
 		s_CoreAssemblyPath = path;
+
+		ReleaseUpdateEntitiesArray();
+		s_UpdateEntitiesThunk = nullptr;
+
 		if (s_CurrentMonoDomain)
 		{
 			s_NewMonoDomain = mono_domain_create_appdomain("FrostRuntime", nullptr);
@@ -130,6 +170,12 @@ namespace Frost
 		s_ExceptionMethod = GetMethod(s_CoreAssemblyImage, "Frost.RuntimeException:OnException(object)");
 		s_EntityClass = mono_class_from_name(s_CoreAssemblyImage, "Frost", "Entity");
 
+		MonoMethod* updateEntitiesMethod = GetMethod(s_CoreAssemblyImage, "Frost.Entity:UpdateEntities(Frost.Entity[],int,single)");
+		if (updateEntitiesMethod)
+			s_UpdateEntitiesThunk = (UpdateEntitiesThunk)mono_method_get_unmanaged_thunk(updateEntitiesMethod);
+		else
+			FROST_CORE_WARN("[ScriptEngine] `Frost.Entity.UpdateEntities` was not found, entities will be updated one by one");
+
 		ScriptEngineRegistry::RegisterAll();
 
 		return true;
@@ -329,15 +375,52 @@ namespace Frost
 			CallMethod(entityInstance.GetInstance(), entityInstance.ScriptClass->OnCreateMethod);
 	}
 
-	void ScriptEngine::OnUpdateEntity(Entity entity, Timestep ts)
+	void ScriptEngine::OnUpdateEntities(Scene* scene, Timestep ts)
 	{
-		EntityInstance& entityInstance = GetEntityInstanceData(entity.GetSceneUUID(), entity.GetUUID()).Instance;
-		if (entityInstance.ScriptClass->OnUpdateMethod)
+		auto entityInstanceMap = s_EntityInstanceMap.find(scene->GetUUID());
+		if (entityInstanceMap == s_EntityInstanceMap.end())
+			return;
+
+		auto& entityInstances = entityInstanceMap->second;
+
+		// Fallback for a core assembly which doesn't have the managed dispatcher
+		if (!s_UpdateEntitiesThunk)
 		{
-			void* args[] = { &ts };
-			if(entityInstance.ScriptClass->OnUpdateMethod)
+			for (auto& [entityID, entityInstanceData] : entityInstances)
+			{
+				EntityInstance& entityInstance = entityInstanceData.Instance;
+				if (!entityInstance.Handle || !entityInstance.ScriptClass->OnUpdateMethod)
+					continue;
+
+				void* args[] = { &ts };
 				CallMethod(entityInstance.GetInstance(), entityInstance.ScriptClass->OnUpdateMethod, args);
+			}
+			return;
 		}
+
+		// Gather every instance which overrides `OnUpdate` into one contiguous array
+		// (instances without a handle haven't been instantiated yet, so they are skipped)
+		MonoArray* entities = GetUpdateEntitiesArray(static_cast<uint32_t>(entityInstances.size()));
+		int32_t count = 0;
+		for (auto& [entityID, entityInstanceData] : entityInstances)
+		{
+			EntityInstance& entityInstance = entityInstanceData.Instance;
+			if (!entityInstance.Handle || !entityInstance.ScriptClass->OnUpdateMethod)
+				continue;
+
+			mono_array_setref(entities, count, entityInstance.GetInstance());
+			count++;
+		}
+
+		if (count == 0)
+			return;
+
+		// The dispatcher clears the array once it is done, so it doesn't keep destroyed entities alive.
+		// Exceptions thrown by the scripts are handled (and logged) per entity in the dispatcher itself, this only catches the rest
+		MonoException* exception = nullptr;
+		s_UpdateEntitiesThunk(entities, count, ts.GetSeconds(), &exception);
+		if (exception)
+			HandleException((MonoObject*)exception);
 	}
 
 	void ScriptEngine::OnDestroyEntity(Entity entity)
@@ -813,6 +896,9 @@ namespace Frost
 
 	void ScriptEngine::ShutDownMono()
 	{
+		ReleaseUpdateEntitiesArray();
+		s_UpdateEntitiesThunk = nullptr;
+
 		s_NewMonoDomain = mono_domain_create_appdomain("FrostRuntime_ShutDown", nullptr);
 		mono_domain_set(s_NewMonoDomain, false);
 
@@ -835,20 +921,23 @@ namespace Frost
 		MonoObject* result = mono_runtime_invoke(method, object, params, &pException);
 
 		if (pException)
-		{
-			MonoClass* exceptionClass = mono_object_get_class(pException);
-			MonoType* exceptionType = mono_class_get_type(exceptionClass);
-			const char* typeName = mono_type_get_name(exceptionType);
-			std::string message = GetStringProperty("Message", exceptionClass, pException);
-			std::string stackTrace = GetStringProperty("StackTrace", exceptionClass, pException);
+			HandleException(pException);
+
+		return result;
+	}
 
-			FROST_CORE_ERROR("{0}: {1}. Stack Trace: {2}", typeName, message, stackTrace);
+	static void HandleException(MonoObject* exception)
+	{
+		MonoClass* exceptionClass = mono_object_get_class(exception);
+		MonoType* exceptionType = mono_class_get_type(exceptionClass);
+		const char* typeName = mono_type_get_name(exceptionType);
+		std::string message = GetStringProperty("Message", exceptionClass, exception);
+		std::string stackTrace = GetStringProperty("StackTrace", exceptionClass, exception);
 
-			void* args[] = { pException };
-			MonoObject* result = mono_runtime_invoke(s_ExceptionMethod, nullptr, args, nullptr);
-		}
+		FROST_CORE_ERROR("{0}: {1}. Stack Trace: {2}", typeName, message, stackTrace);
 
-		return result;
+		void* args[] = { exception };
+		mono_runtime_invoke(s_ExceptionMethod, nullptr, args, nullptr);
 	}
 
 	static uint32_t Instantiate(EntityScriptClass& scriptClass)
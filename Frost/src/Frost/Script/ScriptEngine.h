@@ -82,7 +82,8 @@ namespace Frost
 		static Scene* GetCurrentSceneContext();
 
 		static void OnCreateEntity(Entity entity);
-		static void OnUpdateEntity(Entity entity, Timestep ts);
+		// Updates every script instance of the scene with a single call into the managed dispatcher
+		static void OnUpdateEntities(Scene* scene, Timestep ts);
 		static void OnDestroyEntity(Entity entity);
 		static void OnPhysicsUpdateEntity(Entity entity, float fixedTimeStep);
 
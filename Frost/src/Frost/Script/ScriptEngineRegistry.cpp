@@ -3,6 +3,7 @@
 
 #include <mono/jit/jit.h>
 #include <mono/metadata/assembly.h>
+#include <mono/metadata/class.h>
 
 #include "ScriptInternalWrappers.h"
 
@@ -14,6 +15,9 @@ namespace Frost
 	HashMap<MonoType*, std::function<bool(Entity&)>> s_HasComponentFuncs;
 	HashMap<MonoType*, std::function<void(Entity&)>> s_CreateComponentFuncs;
 
+	// Offset of `Frost.Entity.m_NativeHandle` inside the managed object (used by the bulk internal calls)
+	uint32_t s_EntityNativeHandleOffset = 0;
+
 	extern MonoImage* s_CoreAssemblyImage;
 
 #define Component_RegisterType(Type) \
@@ -42,10 +46,25 @@ namespace Frost
 		Component_RegisterType(AnimationComponent);
 	}
 
+	static void InitEntityNativeHandle()
+	{
+		MonoClass* entityClass = mono_class_from_name(s_CoreAssemblyImage, "Frost", "Entity");
+		MonoClassField* nativeHandleField = entityClass ? mono_class_get_field_from_name(entityClass, "m_NativeHandle") : nullptr;
+		if (!nativeHandleField)
+		{
+			FROST_CORE_ERROR("No `m_NativeHandle` field found in the C# Entity class!");
+			s_EntityNativeHandleOffset = 0;
+			return;
+		}
+
+		s_EntityNativeHandleOffset = mono_field_get_offset(nativeHandleField);
+	}
+
 	void ScriptEngineRegistry::RegisterAll()
 	{
 		// TODO: Add all wrapper classes firstly
 		InitComponentTypes();
+		InitEntityNativeHandle();
 
 		// Log native methods
 		mono_add_internal_call("Frost.Log::LogMessage_Native", Frost::ScriptInternalCalls::Log::LogMessage);
@@ -85,7 +104,9 @@ namespace Frost
 		mono_add_internal_call("Frost.TransformComponent::GetRotation_Native", Frost::ScriptInternalCalls::Components::Transform::GetRotation);
 		mono_add_internal_call("Frost.TransformComponent::SetScale_Native", Frost::ScriptInternalCalls::Components::Transform::SetScale);
 		mono_add_internal_call("Frost.TransformComponent::GetScale_Native", Frost::ScriptInternalCalls::Components::Transform::GetScale);
-		mono_add_internal_call("Frost.TransformComponent::GetWorldSpaceTransform_Native", Frost::ScriptInternalCalls::Components::Transform::GetScale);
+		mono_add_internal_call("Frost.TransformComponent::GetWorldSpaceTransform_Native", Frost::ScriptInternalCalls::Components::Transform::GetWorldSpaceTransform);
+		mono_add_internal_call("Frost.TransformComponent::GetTransforms_Native", Frost::ScriptInternalCalls::Components::Transform::GetTransforms);
+		mono_add_internal_call("Frost.TransformComponent::SetTransforms_Native", Frost::ScriptInternalCalls::Components::Transform::SetTransforms);
 
 		// Texture2D class native methods
 		mono_add_internal_call("Frost.Texture2D::Constructor_Native", Frost::ScriptInternalCalls::RendererScript::Texture::Texture2DConstructor);
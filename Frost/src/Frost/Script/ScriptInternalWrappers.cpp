@@ -27,11 +27,39 @@ namespace Frost
 	extern HashMap<MonoType*, std::function<bool(Entity&)>> s_HasComponentFuncs;
 	extern HashMap<MonoType*, std::function<void(Entity&)>> s_CreateComponentFuncs;
 
+	extern uint32_t s_EntityNativeHandleOffset;
+
 	// Get the global variables from "BindlessAllocator.cpp"
 	extern std::unordered_map<uint32_t, WeakRef<Texture2D>> m_TextureSlots;
 
 namespace ScriptInternalCalls
 {
+	// Returns the entity of a managed `Frost.Entity`. The entt handle cached in `entityHandle` is used directly while the scene's
+	// entity generation hasn't changed, otherwise the entity is looked up by its UUID and the cache is updated
+	static Entity GetEntity(ScriptEntityHandle* entityHandle)
+	{
+		Scene* scene = ScriptEngine::GetCurrentSceneContext();
+		FROST_ASSERT(scene, "No active scene!");
+
+		if (entityHandle->Generation != scene->GetEntityGeneration())
+		{
+			const auto& entityMap = scene->GetEntityMap();
+			auto entityIt = entityMap.find(entityHandle->ID);
+			FROST_ASSERT(bool(entityIt != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
+
+			Entity entity = entityIt->second;
+			entityHandle->Handle = static_cast<uint32_t>(entity.Raw());
+			entityHandle->Generation = scene->GetEntityGeneration();
+		}
+
+		return Entity(static_cast<entt::entity>(entityHandle->Handle), scene);
+	}
+
+	static ScriptEntityHandle* GetEntityHandle(MonoObject* entityObject)
+	{
+		FROST_ASSERT(bool(entityObject && s_EntityNativeHandleOffset), "Invalid entity object!");
+		return reinterpret_cast<ScriptEntityHandle*>(reinterpret_cast<uint8_t*>(entityObject) + s_EntityNativeHandleOffset);
+	}
 
 	uint64_t EntityScript::GetParent(uint64_t entityID)
 	{
@@ -212,37 +240,24 @@ namespace ScriptInternalCalls
 		tagComponent.Tag = mono_string_to_utf8(tag);
 	}
 
-	void Components::Transform::SetTransform(uint64_t entityID, TransformComponent* inTransform)
+	void Components::Transform::SetTransform(ScriptEntityHandle* entityHandle, TransformComponent* inTransform)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		entity.GetComponent<TransformComponent>() = *inTransform;
+		entity.MarkTransformDirty();
 	}
 
-	void Components::Transform::GetTransform(uint64_t entityID, TransformComponent* outTransform)
+	void Components::Transform::GetTransform(ScriptEntityHandle* entityHandle, TransformComponent* outTransform)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		*outTransform = entity.GetComponent<TransformComponent>();
 	}
 
-	void Components::Transform::SetTranslation(uint64_t entityID, glm::vec3* inTranslation)
+	void Components::Transform::SetTranslation(ScriptEntityHandle* entityHandle, glm::vec3* inTranslation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		entity.GetComponent<TransformComponent>().Translation = *inTranslation;
+		entity.MarkTransformDirty();
 
 		if (entity.HasComponent<RigidBodyComponent>())
 		{
@@ -251,26 +266,17 @@ namespace ScriptInternalCalls
 		}
 	}
 
-	void Components::Transform::GetTranslation(uint64_t entityID, glm::vec3* outTranslation)
+	void Components::Transform::GetTranslation(ScriptEntityHandle* entityHandle, glm::vec3* outTranslation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		*outTranslation = entity.GetComponent<TransformComponent>().Translation;
 	}
 
-	void Components::Transform::SetRotation(uint64_t entityID, glm::vec3* inRotation)
+	void Components::Transform::SetRotation(ScriptEntityHandle* entityHandle, glm::vec3* inRotation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		entity.GetComponent<TransformComponent>().Rotation = *inRotation;
+		entity.MarkTransformDirty();
 
 		if (entity.HasComponent<RigidBodyComponent>())
 		{
@@ -279,50 +285,65 @@ namespace ScriptInternalCalls
 		}
 	}
 
-	void Components::Transform::GetRotation(uint64_t entityID, glm::vec3* outRotation)
+	void Components::Transform::GetRotation(ScriptEntityHandle* entityHandle, glm::vec3* outRotation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		*outRotation = entity.GetComponent<TransformComponent>().Rotation;
 	}
 
-	void Components::Transform::SetScale(uint64_t entityID, glm::vec3* inScale)
+	void Components::Transform::SetScale(ScriptEntityHandle* entityHandle, glm::vec3* inScale)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		entity.GetComponent<TransformComponent>().Scale = *inScale;
+		entity.MarkTransformDirty();
 	}
 
-	void Components::Transform::GetScale(uint64_t entityID, glm::vec3* outScale)
+	void Components::Transform::GetScale(ScriptEntityHandle* entityHandle, glm::vec3* outScale)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		*outScale = entity.GetComponent<TransformComponent>().Scale;
 	}
 
-	void Components::Transform::GetWorldSpaceTransform(uint64_t entityID, TransformComponent* outTransform)
+	void Components::Transform::GetWorldSpaceTransform(ScriptEntityHandle* entityHandle, TransformComponent* outTransform)
 	{
 		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		*outTransform = scene->GetTransformFromEntityAndParent(entity);
 	}
 
+	void Components::Transform::GetTransforms(MonoArray* entities, MonoArray* outTransforms, int32_t count)
+	{
+		FROST_ASSERT(bool(count <= mono_array_length(entities) && count <= mono_array_length(outTransforms)), "Array is too small!");
+
+		TransformComponent* transforms = mono_array_addr(outTransforms, TransformComponent, 0);
+		for (int32_t i = 0; i < count; i++)
+		{
+			Entity entity = GetEntity(GetEntityHandle(mono_array_get(entities, MonoObject*, i)));
+			transforms[i] = entity.GetComponent<TransformComponent>();
+		}
+	}
+
+	void Components::Transform::SetTransforms(MonoArray* entities, MonoArray* inTransforms, int32_t count)
+	{
+		FROST_ASSERT(bool(count <= mono_array_length(entities) && count <= mono_array_length(inTransforms)), "Array is too small!");
+
+		const TransformComponent* transforms = mono_array_addr(inTransforms, TransformComponent, 0);
+		for (int32_t i = 0; i < count; i++)
+		{
+			Entity entity = GetEntity(GetEntityHandle(mono_array_get(entities, MonoObject*, i)));
+			entity.GetComponent<TransformComponent>() = transforms[i];
+			entity.MarkTransformDirty();
+
+			// Same as `SetTranslation`/`SetRotation`, otherwise the simulation would move the entity back on the next step
+			if (entity.HasComponent<RigidBodyComponent>())
+			{
+				auto& actor = PhysicsEngine::GetScene()->GetActor(entity);
+				actor->SetTranslation(transforms[i].Translation);
+				actor->SetRotation(transforms[i].Rotation);
+			}
+		}
+	}
+
 	void Components::Camera::SetFOV(uint64_t entityID, float fov)
 	{
 		Scene* scene = ScriptEngine::GetCurrentSceneContext();
@@ -667,229 +688,149 @@ namespace ScriptInternalCalls
 		return ScriptComponent();
 	}
 
-	Frost::RigidBodyComponent::Type Components::Physics::RigidBody::GetBodyType(uint64_t entityID)
+	Frost::RigidBodyComponent::Type Components::Physics::RigidBody::GetBodyType(ScriptEntityHandle* entityHandle)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		if (entity.HasComponent<Frost::RigidBodyComponent>())
 		{
 			return entity.GetComponent<Frost::RigidBodyComponent>().BodyType;
 		}
 		else
 		{
-			FROST_CORE_ERROR("Entity with ID: {0} doesn't have Rigid Body Component", entityID);
+			FROST_CORE_ERROR("Entity with ID: {0} doesn't have Rigid Body Component", entityHandle->ID);
 		}
 		return Frost::RigidBodyComponent::Type();
 	}
 
-	void Components::Physics::RigidBody::SetTranslation(uint64_t entityID, glm::vec3* inTranslation)
+	void Components::Physics::RigidBody::SetTranslation(ScriptEntityHandle* entityHandle, glm::vec3* inTranslation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->SetTranslation(*inTranslation);
 	}
 
-	void Components::Physics::RigidBody::GetTranslation(uint64_t entityID, glm::vec3* outTranslation)
+	void Components::Physics::RigidBody::GetTranslation(ScriptEntityHandle* entityHandle, glm::vec3* outTranslation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		*outTranslation = actor->GetTranslation();
 	}
 
-	void Components::Physics::RigidBody::SetRotation(uint64_t entityID, glm::vec3* inRotation)
+	void Components::Physics::RigidBody::SetRotation(ScriptEntityHandle* entityHandle, glm::vec3* inRotation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->SetRotation(*inRotation);
 	}
 
-	void Components::Physics::RigidBody::GetRotation(uint64_t entityID, glm::vec3* outRotation)
+	void Components::Physics::RigidBody::GetRotation(ScriptEntityHandle* entityHandle, glm::vec3* outRotation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		*outRotation = actor->GetRotation();
 	}
 
-	void Components::Physics::RigidBody::SetMass(uint64_t entityID, float mass)
+	void Components::Physics::RigidBody::SetMass(ScriptEntityHandle* entityHandle, float mass)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->SetMass(mass);
 	}
 
-	float Components::Physics::RigidBody::GetMass(uint64_t entityID)
+	float Components::Physics::RigidBody::GetMass(ScriptEntityHandle* entityHandle)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		return actor->GetMass();
 	}
 
-	void Components::Physics::RigidBody::SetLinearVelocity(uint64_t entityID, glm::vec3* velocity)
+	void Components::Physics::RigidBody::SetLinearVelocity(ScriptEntityHandle* entityHandle, glm::vec3* velocity)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->SetLinearVelocity(*velocity);
 	}
 
-	void Components::Physics::RigidBody::GetLinearVelocity(uint64_t entityID, glm::vec3* velocity)
+	void Components::Physics::RigidBody::GetLinearVelocity(ScriptEntityHandle* entityHandle, glm::vec3* velocity)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		*velocity = actor->GetLinearVelocity();
 	}
 
-	void Components::Physics::RigidBody::SetAngularVelocity(uint64_t entityID, glm::vec3* velocity)
+	void Components::Physics::RigidBody::SetAngularVelocity(ScriptEntityHandle* entityHandle, glm::vec3* velocity)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->SetAngularVelocity(*velocity);
 	}
 
-	void Components::Physics::RigidBody::GetAngularVelocity(uint64_t entityID, glm::vec3* velocity)
+	void Components::Physics::RigidBody::GetAngularVelocity(ScriptEntityHandle* entityHandle, glm::vec3* velocity)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		*velocity = actor->GetAngularVelocity();
 	}
 
-	void Components::Physics::RigidBody::SetMaxLinearVelocity(uint64_t entityID, float maxVelocity)
+	void Components::Physics::RigidBody::SetMaxLinearVelocity(ScriptEntityHandle* entityHandle, float maxVelocity)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->SetMaxLinearVelocity(maxVelocity);
 	}
 
-	float Components::Physics::RigidBody::GetMaxLinearVelocity(uint64_t entityID)
+	float Components::Physics::RigidBody::GetMaxLinearVelocity(ScriptEntityHandle* entityHandle)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		return actor->GetMaxLinearVelocity();
 	}
 
-	void Components::Physics::RigidBody::SetMaxAngularVelocity(uint64_t entityID, float maxVelocity)
+	void Components::Physics::RigidBody::SetMaxAngularVelocity(ScriptEntityHandle* entityHandle, float maxVelocity)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->SetMaxAngularVelocity(maxVelocity);
 	}
 
-	float Components::Physics::RigidBody::GetMaxAngularVelocity(uint64_t entityID)
+	float Components::Physics::RigidBody::GetMaxAngularVelocity(ScriptEntityHandle* entityHandle)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		return actor->GetMaxAngularVelocity();
 	}
 
-	void Components::Physics::RigidBody::GetKinematicTarget(uint64_t entityID, glm::vec3* outTargetPosition, glm::vec3* outTargetRotation)
+	void Components::Physics::RigidBody::GetKinematicTarget(ScriptEntityHandle* entityHandle, glm::vec3* outTargetPosition, glm::vec3* outTargetRotation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
@@ -897,70 +838,45 @@ namespace ScriptInternalCalls
 		*outTargetRotation = actor->GetKinematicTargetRotation();
 	}
 
-	void Components::Physics::RigidBody::SetKinematicTarget(uint64_t entityID, glm::vec3* inTargetPosition, glm::vec3* inTargetRotation)
+	void Components::Physics::RigidBody::SetKinematicTarget(ScriptEntityHandle* entityHandle, glm::vec3* inTargetPosition, glm::vec3* inTargetRotation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->SetKinematicTarget(*inTargetPosition, *inTargetRotation);
 	}
 
-	void Components::Physics::RigidBody::AddForce(uint64_t entityID, glm::vec3* force, ForceMode forceMode)
+	void Components::Physics::RigidBody::AddForce(ScriptEntityHandle* entityHandle, glm::vec3* force, ForceMode forceMode)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->AddForce(*force, forceMode);
 	}
 
-	void Components::Physics::RigidBody::AddTorque(uint64_t entityID, glm::vec3* torque, ForceMode forceMode)
+	void Components::Physics::RigidBody::AddTorque(ScriptEntityHandle* entityHandle, glm::vec3* torque, ForceMode forceMode)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->AddForce(*torque, forceMode);
 	}
 
-	void Components::Physics::RigidBody::Rotate(uint64_t entityID, glm::vec3* rotation)
+	void Components::Physics::RigidBody::Rotate(ScriptEntityHandle* entityHandle, glm::vec3* rotation)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		Ref<PhysicsActor> actor = Frost::PhysicsEngine::GetScene()->GetActor(entity);
 		actor->Rotate(*rotation);
 	}
 
-	void Components::Physics::RigidBody::SetLockFlag(uint64_t entityID, ActorLockFlag flag, bool value)
+	void Components::Physics::RigidBody::SetLockFlag(ScriptEntityHandle* entityHandle, ActorLockFlag flag, bool value)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		auto& component = entity.GetComponent<RigidBodyComponent>();
@@ -968,14 +884,9 @@ namespace ScriptInternalCalls
 		actor->SetLockFlag(flag, value);
 	}
 
-	bool Components::Physics::RigidBody::IsLockFlagSet(uint64_t entityID, ActorLockFlag flag)
+	bool Components::Physics::RigidBody::IsLockFlagSet(ScriptEntityHandle* entityHandle, ActorLockFlag flag)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		auto& component = entity.GetComponent<RigidBodyComponent>();
@@ -983,14 +894,9 @@ namespace ScriptInternalCalls
 		return actor->IsLockFlagSet(flag);
 	}
 
-	uint32_t Components::Physics::RigidBody::GetLockFlags(uint64_t entityID, ActorLockFlag flag, bool value)
+	uint32_t Components::Physics::RigidBody::GetLockFlags(ScriptEntityHandle* entityHandle)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		auto& component = entity.GetComponent<RigidBodyComponent>();
@@ -998,14 +904,9 @@ namespace ScriptInternalCalls
 		return actor->GetLockFlags();
 	}
 
-	uint32_t Components::Physics::RigidBody::GetLayer(uint64_t entityID)
+	uint32_t Components::Physics::RigidBody::GetLayer(ScriptEntityHandle* entityHandle)
 	{
-		Scene* scene = ScriptEngine::GetCurrentSceneContext();
-		FROST_ASSERT(scene, "No active scene!");
-		const auto& entityMap = scene->GetEntityMap();
-		FROST_ASSERT(bool(entityMap.find(entityID) != entityMap.end()), "Invalid entity ID or entity doesn't exist in scene!");
-
-		Entity entity = entityMap.at(entityID);
+		Entity entity = GetEntity(entityHandle);
 		FROST_ASSERT_INTERNAL(entity.HasComponent<RigidBodyComponent>());
 
 		return entity.GetComponent<RigidBodyComponent>().Layer;
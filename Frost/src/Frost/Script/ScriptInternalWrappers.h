@@ -43,6 +43,16 @@ namespace Frost
 		Ref<Frost::Mesh> Mesh;
 	};
 
+	// Mirrors `Frost.Entity.NativeHandle` (FrostScriptCore), every managed entity has one.
+	// The internal calls cache the entt handle of the entity in it, so the UUID lookup is only done once per entity
+	// (or again after the scene's entity generation has changed, see `Scene::GetEntityGeneration`)
+	struct ScriptEntityHandle
+	{
+		uint64_t ID;
+		uint32_t Handle;
+		uint32_t Generation;
+	};
+
 	// Forward declaration
 	enum class ForceMode : uint8_t;
 	enum class ActorLockFlag;
@@ -122,19 +132,23 @@ namespace Frost { namespace ScriptInternalCalls
 
 		namespace Transform
 		{
-			void SetTransform(uint64_t entityID, TransformComponent* inTransform);
-			void GetTransform(uint64_t entityID, TransformComponent* outTransform);
+			void SetTransform(ScriptEntityHandle* entityHandle, TransformComponent* inTransform);
+			void GetTransform(ScriptEntityHandle* entityHandle, TransformComponent* outTransform);
 
-			void SetTranslation(uint64_t entityID, glm::vec3* inTranslation);
-			void GetTranslation(uint64_t entityID, glm::vec3* outTranslation);
+			void SetTranslation(ScriptEntityHandle* entityHandle, glm::vec3* inTranslation);
+			void GetTranslation(ScriptEntityHandle* entityHandle, glm::vec3* outTranslation);
 
-			void SetRotation(uint64_t entityID, glm::vec3* inRotation);
-			void GetRotation(uint64_t entityID, glm::vec3* outRotation);
+			void SetRotation(ScriptEntityHandle* entityHandle, glm::vec3* inRotation);
+			void GetRotation(ScriptEntityHandle* entityHandle, glm::vec3* outRotation);
 
-			void SetScale(uint64_t entityID, glm::vec3* inScale);
-			void GetScale(uint64_t entityID, glm::vec3* outScale);
+			void SetScale(ScriptEntityHandle* entityHandle, glm::vec3* inScale);
+			void GetScale(ScriptEntityHandle* entityHandle, glm::vec3* outScale);
 			
-			void GetWorldSpaceTransform(uint64_t entityID, TransformComponent* outTransform);;
+			void GetWorldSpaceTransform(ScriptEntityHandle* entityHandle, TransformComponent* outTransform);
+
+			// Bulk versions of Get/SetTransform (`entities` is a `Frost.Entity[]`, `transforms` is a `Frost.Transform[]`)
+			void GetTransforms(MonoArray* entities, MonoArray* outTransforms, int32_t count);
+			void SetTransforms(MonoArray* entities, MonoArray* inTransforms, int32_t count);
 		}
 
 		namespace Camera
@@ -168,39 +182,39 @@ namespace Frost { namespace ScriptInternalCalls
 
 			namespace RigidBody
 			{
-				Frost::RigidBodyComponent::Type GetBodyType(uint64_t entityID);
-				void SetTranslation(uint64_t entityID, glm::vec3* inTranslation);
-				void GetTranslation(uint64_t entityID, glm::vec3* outTranslation);
+				Frost::RigidBodyComponent::Type GetBodyType(ScriptEntityHandle* entityHandle);
+				void SetTranslation(ScriptEntityHandle* entityHandle, glm::vec3* inTranslation);
+				void GetTranslation(ScriptEntityHandle* entityHandle, glm::vec3* outTranslation);
 
-				void SetRotation(uint64_t entityID, glm::vec3* inRotation);
-				void GetRotation(uint64_t entityID, glm::vec3* outRotation);
+				void SetRotation(ScriptEntityHandle* entityHandle, glm::vec3* inRotation);
+				void GetRotation(ScriptEntityHandle* entityHandle, glm::vec3* outRotation);
 
-				void SetMass(uint64_t entityID, float mass);
-				float GetMass(uint64_t entityID);
+				void SetMass(ScriptEntityHandle* entityHandle, float mass);
+				float GetMass(ScriptEntityHandle* entityHandle);
 
-				void SetLinearVelocity(uint64_t entityID, glm::vec3* velocity);
-				void GetLinearVelocity(uint64_t entityID, glm::vec3* velocity);
-				void SetAngularVelocity(uint64_t entityID, glm::vec3* velocity);
-				void GetAngularVelocity(uint64_t entityID, glm::vec3* velocity);
+				void SetLinearVelocity(ScriptEntityHandle* entityHandle, glm::vec3* velocity);
+				void GetLinearVelocity(ScriptEntityHandle* entityHandle, glm::vec3* velocity);
+				void SetAngularVelocity(ScriptEntityHandle* entityHandle, glm::vec3* velocity);
+				void GetAngularVelocity(ScriptEntityHandle* entityHandle, glm::vec3* velocity);
 
-				void SetMaxLinearVelocity(uint64_t entityID, float maxVelocity);
-				float GetMaxLinearVelocity(uint64_t entityID);
-				void SetMaxAngularVelocity(uint64_t entityID, float maxVelocity);
-				float GetMaxAngularVelocity(uint64_t entityID);
+				void SetMaxLinearVelocity(ScriptEntityHandle* entityHandle, float maxVelocity);
+				float GetMaxLinearVelocity(ScriptEntityHandle* entityHandle);
+				void SetMaxAngularVelocity(ScriptEntityHandle* entityHandle, float maxVelocity);
+				float GetMaxAngularVelocity(ScriptEntityHandle* entityHandle);
 
-				void GetKinematicTarget(uint64_t entityID, glm::vec3* outTargetPosition, glm::vec3* outTargetRotation);
-				void SetKinematicTarget(uint64_t entityID, glm::vec3* inTargetPosition, glm::vec3* inTargetRotation);
+				void GetKinematicTarget(ScriptEntityHandle* entityHandle, glm::vec3* outTargetPosition, glm::vec3* outTargetRotation);
+				void SetKinematicTarget(ScriptEntityHandle* entityHandle, glm::vec3* inTargetPosition, glm::vec3* inTargetRotation);
 
-				void AddForce(uint64_t entityID, glm::vec3* force, ForceMode forceMode);
-				void AddTorque(uint64_t entityID, glm::vec3* torque, ForceMode forceMode);
+				void AddForce(ScriptEntityHandle* entityHandle, glm::vec3* force, ForceMode forceMode);
+				void AddTorque(ScriptEntityHandle* entityHandle, glm::vec3* torque, ForceMode forceMode);
 
-				void Rotate(uint64_t entityID, glm::vec3* rotation);
+				void Rotate(ScriptEntityHandle* entityHandle, glm::vec3* rotation);
 
-				void SetLockFlag(uint64_t entityID, ActorLockFlag flag, bool value);
-				bool IsLockFlagSet(uint64_t entityID, ActorLockFlag flag);
-				uint32_t GetLockFlags(uint64_t entityID, ActorLockFlag flag, bool value);
+				void SetLockFlag(ScriptEntityHandle* entityHandle, ActorLockFlag flag, bool value);
+				bool IsLockFlagSet(ScriptEntityHandle* entityHandle, ActorLockFlag flag);
+				uint32_t GetLockFlags(ScriptEntityHandle* entityHandle);
 
-				uint32_t GetLayer(uint64_t entityID);
+				uint32_t GetLayer(ScriptEntityHandle* entityHandle);
 			}
 
 			namespace BoxCollider
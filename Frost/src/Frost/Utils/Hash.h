@@ -0,0 +1,31 @@
+#pragma once
+
+namespace Frost::Hash
+{
+	// 64 bit FNV-1a (fast and stable between runs/platforms, so the results can be stored on disk)
+	static constexpr uint64_t FNVOffsetBasis = 14695981039346656037ull;
+	static constexpr uint64_t FNVPrime = 1099511628211ull;
+
+	inline uint64_t GenerateFNVHash(const void* data, uint64_t size, uint64_t hash = FNVOffsetBasis)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		for (uint64_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= FNVPrime;
+		}
+		return hash;
+	}
+
+	inline uint64_t GenerateFNVHash(const std::string& str, uint64_t hash = FNVOffsetBasis)
+	{
+		return GenerateFNVHash(str.data(), str.size(), hash);
+	}
+
+	template<typename T>
+	inline uint64_t Combine(uint64_t hash, const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be hashed by their bytes");
+		return GenerateFNVHash(&value, sizeof(T), hash);
+	}
+}
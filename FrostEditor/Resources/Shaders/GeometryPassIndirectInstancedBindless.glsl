@@ -6,13 +6,8 @@
 #extension GL_EXT_shader_explicit_arithmetic_types_int64 : require
 #extension GL_EXT_buffer_reference2 : require
 
-// Instanced vertex buffer
-layout(location = 0) in mat4 a_ModelSpaceMatrix;
-layout(location = 4) in mat4 a_WorldSpaceMatrix;
-layout(location = 8) in mat4 a_PreviousWorldSpaceMatrix;
-layout(location = 12) in uint64_t a_BoneInformationBDA;
-layout(location = 13) in uint a_MaterialIndexGlobalOffset;
-layout(location = 14) in uint a_EntityID;
+// Instanced vertex buffer (only the retained slot of the instance, the draws are built from per-LOD lists of slots)
+layout(location = 0) in uint a_InstanceSlot;
 
 //layout(location = 14) in uint a_IsMeshVisible;
 //layout(location = 15) in uint a_Padding0;
@@ -62,6 +57,26 @@ layout(location = 7) out flat int v_TextureIndex;
 layout(location = 8) out flat uint v_EntityID;
 layout(location = 9) out vec3 v_Color1;
 
+// Instance data, indexed by the retained slot (it stays in the same slot whatever LOD is drawn)
+struct MeshInstanceData
+{
+	mat4 ModelSpaceMatrix;
+	uint64_t BoneInformationBDA;
+	uint MaterialIndexGlobalOffset;
+	uint EntityID;
+};
+layout(set = 0, binding = 2, scalar) readonly buffer u_InstanceData
+{
+	MeshInstanceData Data[];
+} InstanceData;
+
+// Kept out of the instance data, so the instanced vertex buffer doesn't change when only the camera moves
+layout(set = 0, binding = 1) uniform CameraData
+{
+	mat4 ViewProjectionMatrix;
+	mat4 PreviousViewProjectionMatrix;
+} u_CameraData;
+
 layout(push_constant) uniform Constants
 {
 	mat4 ViewMatrix;
@@ -73,8 +88,10 @@ layout(push_constant) uniform Constants
 
 void main()
 {
+	MeshInstanceData instance = InstanceData.Data[a_InstanceSlot];
+
 	v_Color1 = vec3(1.0);
-	if(a_ModelSpaceMatrix[3][3] == 0.0)
+	if(instance.ModelSpaceMatrix[3][3] == 0.0)
 	{
 		gl_Position = vec4(1.0, 1.0, 1.0, 0.0);
 		return;
@@ -84,7 +101,7 @@ void main()
 	{
 
 
-		mat4 modelSpaceMatrix = a_ModelSpaceMatrix;
+		mat4 modelSpaceMatrix = instance.ModelSpaceMatrix;
 		modelSpaceMatrix[3][3] = 1.0;
 
 		vec3 position, normal, tangent;
@@ -97,7 +114,7 @@ void main()
 		if(u_PushConstant.IsAnimated == 1)
 		{
 			AnimatedVertices animatedVerticies = AnimatedVertices(u_PushConstant.VertexBufferBDA);
-			MeshBoneInformation boneInfo = MeshBoneInformation(a_BoneInformationBDA);
+			MeshBoneInformation boneInfo = MeshBoneInformation(instance.BoneInformationBDA);
 			AnimatedVertex vertex = animatedVerticies.v[gl_VertexIndex];
 
 			position = vertex.Position;
@@ -140,16 +157,16 @@ void main()
 		v_ViewPosition = vec3(u_PushConstant.ViewMatrix * modelSpaceMatrix * vec4(positionWithBoneTransform, 1.0f));
 
 		// Material indices
-		int meshIndex = int(a_MaterialIndexGlobalOffset + materialIndex);
+		int meshIndex = int(instance.MaterialIndexGlobalOffset + materialIndex);
 		v_BufferIndex = int(meshIndex);
 		v_TextureIndex = int(materialIndex);
-		v_EntityID = a_EntityID;
+		v_EntityID = instance.EntityID;
 
 		// Compute last frame's world position
-		v_PreviousPosition = (a_PreviousWorldSpaceMatrix * vec4(positionWithBoneTransform, 1.0f)).xyw;
+		v_PreviousPosition = (u_CameraData.PreviousViewProjectionMatrix * modelSpaceMatrix * vec4(positionWithBoneTransform, 1.0f)).xyw;
 
 		// Compute world position
-		vec4 worldPos = a_WorldSpaceMatrix * vec4(positionWithBoneTransform, 1.0f);
+		vec4 worldPos = u_CameraData.ViewProjectionMatrix * modelSpaceMatrix * vec4(positionWithBoneTransform, 1.0f);
 		gl_Position = worldPos;
 		v_CurrentPosition = gl_Position.xyw;
 	}
@@ -11,8 +11,6 @@ precision highp float;
 struct MeshInstancedVertexBuffer
 {
 	mat4 ModelSpaceMatrix;
-	mat4 WorldSpaceMatrix;
-	mat4 PreviousWorldSpaceMatrix;
 	uint64_t BoneInformationBDA;
 	uint MaterialIndexOffset;
 	uint EntityID;
@@ -6,8 +6,7 @@
 
 // Instanced vertex buffer
 layout(location = 0) in mat4 a_ModelSpaceMatrix;
-layout(location = 4) in mat4 a_WorldSpaceMatrix;
-layout(location = 8) in uint64_t a_BoneInformationBDA;
+layout(location = 4) in uint64_t a_BoneInformationBDA;
 
 struct Vertex
 {
@@ -12,6 +12,7 @@ layout(push_constant) uniform Constants
 	mat4 CameraViewMatrix;
 
 	vec4 CameraPosition_SampleMipLevel;
+	ivec4 ToroidalOffset; // .w = whether mip 0 is read from the (wrapped) albedo volume
 	
 	float ProjectionExtents;
 	float VoxelScale;
@@ -138,7 +139,12 @@ void main()
 
 	if(u_PushConstant.CameraPosition_SampleMipLevel.w == 0)
 	{
-		vec4 val = texelFetch(u_VoxelTexture, writePos, 0);
+		// The albedo volume of the clipmap is wrapped, but the lit volume (which is used for cone tracing) isn't
+		ivec3 readPos = writePos;
+		if(u_PushConstant.ToroidalOffset.w != 0)
+			readPos = (writePos + u_PushConstant.ToroidalOffset.xyz) % textureSize(u_VoxelTexture, 0);
+
+		vec4 val = texelFetch(u_VoxelTexture, readPos, 0);
 
 		if(val.r != 0.0f || val.g != 0.0f || val.b != 0.0f)
 		{
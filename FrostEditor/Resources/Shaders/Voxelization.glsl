@@ -8,8 +8,7 @@
 
 // Instanced vertex buffer
 layout(location = 0) in mat4 a_ModelSpaceMatrix;
-layout(location = 4) in mat4 a_WorldSpaceMatrix;
-layout(location = 8) in uint a_MaterialIndexOffset;
+layout(location = 4) in uint a_MaterialIndexOffset;
 
 struct Vertex
 {
@@ -31,6 +30,10 @@ layout(push_constant) uniform Constants
 	uint64_t VertexBufferBDA;
 	int VoxelDimensions;
 	int AtomicOperation;
+
+	ivec4 ToroidalOffset; // .w = whether the volume is addressed toroidally
+	ivec4 RegionMin;
+	ivec4 RegionMax;
 } u_PushConstant;
 
 
@@ -163,6 +166,10 @@ layout(push_constant) uniform Constants
 	uint64_t VertexBufferBDA;
 	int VoxelDimensions;
 	int AtomicOperation;
+
+	ivec4 ToroidalOffset; // .w = whether the volume is addressed toroidally
+	ivec4 RegionMin;
+	ivec4 RegionMax;
 } u_PushConstant;
 
 // Bindless
@@ -269,11 +276,20 @@ void main()
 	// Flip the Z
 	texcoord.z = u_PushConstant.VoxelDimensions - texcoord.z - 1;
 
+	// Only the region which was cleared is voxelized, the voxels outside of it are still valid
+	ivec3 voxelCoord = ivec3(texcoord.xyz);
+	if(any(lessThan(voxelCoord, u_PushConstant.RegionMin.xyz)) || any(greaterThanEqual(voxelCoord, u_PushConstant.RegionMax.xyz)))
+		discard;
+
+	// The clipmap volume is addressed toroidally, so it doesn't have to be moved when the camera moves
+	if(u_PushConstant.ToroidalOffset.w != 0)
+		voxelCoord = (voxelCoord + u_PushConstant.ToroidalOffset.xyz) % voxelDimensions;
+
 	// Atomic operations to get an averaged value, described in OpenGL insights about voxelization
 	// Required to avoid flickering when voxelizing every frame
 	if(u_PushConstant.AtomicOperation == 0)
-		imageStore(u_VoxelTexture_NonAtomic, ivec3(texcoord.xyz), vec4(vec3(o_Albedo.xyz), 1.0f));
+		imageStore(u_VoxelTexture_NonAtomic, voxelCoord, vec4(vec3(o_Albedo.xyz), 1.0f));
 	else
-		imageAtomicRGBA8Avg(ivec3(texcoord.xyz), vec4(vec3(o_Albedo.xyz), 1.0));
+		imageAtomicRGBA8Avg(voxelCoord, vec4(vec3(o_Albedo.xyz), 1.0));
 
 }
\ No newline at end of file
@@ -430,6 +430,7 @@ namespace Frost
 						tc.Translation = translation;
 						tc.Rotation += deltaRotation;
 						tc.Scale = scale;
+						selectedEntity.MarkTransformDirty();
 					}
 
 				}
@@ -636,15 +637,14 @@ namespace Frost
 
 					uint32_t mx = m.first, my = m.second;
 
-					Renderer::SubmitDeletion([&, mx, my]()
+					if (mx >= 0 && my >= 0 && mx < (int)m_ViewportSize.x && my < (int)m_ViewportSize.y && !m_IsGuizmoUsing && m_IsViewPortFocused)
 					{
-						if (mx >= 0 && my >= 0 && mx < (int)m_ViewportSize.x && my < (int)m_ViewportSize.y && !m_IsGuizmoUsing && m_IsViewPortFocused)
+						// The result comes back a few frames later, so the editor never waits for the GPU
+						Renderer::RequestEntityIDPick(mx, my, [&](uint32_t entityID)
 						{
-							uint32_t entityID = Renderer::ReadPixelFromFramebufferEntityID((uint32_t)mx, (uint32_t)my);
-
 							m_SceneHierarchyPanel->SetSelectedEntityByID(entityID);
-						}
-					});
+						});
+					}
 				}
 
 				m_WasMousePressedPrevFrame = true;
@@ -355,8 +355,10 @@ namespace Frost
 
 
 
-		DrawComponent<TransformComponent>("TRANSFORM", entity, [](auto& component)
+		DrawComponent<TransformComponent>("TRANSFORM", entity, [&entity](auto& component)
 		{
+			TransformComponent previousTransform = component;
+
 			UserInterface::DrawVec3CoordsEdit("Translation", component.Translation);
 
 			ImGui::SetCursorPosY(ImGui::GetCursorPosY() + 6.0f);
@@ -364,6 +366,9 @@ namespace Frost
 
 			ImGui::SetCursorPosY(ImGui::GetCursorPosY() + 6.0f);
 			UserInterface::DrawVec3CoordsEdit("Scale", component.Scale, 1.0f);
+
+			if (component.Translation != previousTransform.Translation || component.Rotation != previousTransform.Rotation || component.Scale != previousTransform.Scale)
+				entity.MarkTransformDirty();
 		});
 
 
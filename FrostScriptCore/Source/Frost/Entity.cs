@@ -1,11 +1,24 @@
 ﻿using System;
 using System.Collections.Generic;
 using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
 
 namespace Frost
 {
     public class Entity
     {
+        // Mirrors `ScriptEntityHandle` (ScriptInternalWrappers.h). The engine caches the native handle of the entity in here,
+        // so the internal calls don't have to look up the entity by its ID every time
+        [StructLayout(LayoutKind.Sequential)]
+        internal struct NativeHandle
+        {
+            internal ulong ID;
+            internal uint Handle;
+            internal uint Generation;
+        }
+
+        internal NativeHandle m_NativeHandle;
+
         private Action<Entity> m_CollisionBeginCallbacks;
         private Action<Entity> m_CollisionEndCallbacks;
         private Action<Entity> m_TriggerBeginCallbacks;
@@ -24,7 +37,11 @@ namespace Frost
         {
         }
 
-        public ulong ID { get; private set; }
+        public ulong ID
+        {
+            get => m_NativeHandle.ID;
+            private set => m_NativeHandle = new NativeHandle { ID = value };
+        }
         public string Tag => GetComponent<TagComponent>().Tag;
         public TransformComponent Transform
         {
@@ -195,6 +212,33 @@ namespace Frost
                 m_TriggerEndCallbacks.Invoke(new Entity(id));
         }
 
+        // Called once per frame by the engine (through an unmanaged thunk) with every entity that has to be updated,
+        // so the per-entity loop runs in managed code instead of crossing the native/managed boundary for each entity
+        private static void UpdateEntities(Entity[] entities, int count, float deltaTime)
+        {
+            try
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    // An exception of one script shouldn't stop the other entities from being updated
+                    try
+                    {
+                        entities[i].OnUpdate(deltaTime);
+                    }
+                    catch (Exception e)
+                    {
+                        Log.Error("{0}: {1}. Stack Trace: {2}", e.GetType().FullName, e.Message, e.StackTrace);
+                        RuntimeException.OnException(e);
+                    }
+                }
+            }
+            finally
+            {
+                // The array is reused by the engine, don't keep the entities alive until the next frame
+                Array.Clear(entities, 0, count);
+            }
+        }
+
 
 
         [MethodImpl(MethodImplOptions.InternalCall)]
@@ -41,13 +41,13 @@ namespace Frost
         {
             get
             {
-                GetTransform_Native(Entity.ID, out Transform result);
+                GetTransform_Native(ref Entity.m_NativeHandle, out Transform result);
                 return result;
             }
 
             set
             {
-                SetTransform_Native(Entity.ID, ref value);
+                SetTransform_Native(ref Entity.m_NativeHandle, ref value);
             }
         }
 
@@ -55,7 +55,7 @@ namespace Frost
         {
             get
             {
-                GetWorldSpaceTransform_Native(Entity.ID, out Transform result);
+                GetWorldSpaceTransform_Native(ref Entity.m_NativeHandle, out Transform result);
                 return result;
             }
         }
@@ -64,13 +64,13 @@ namespace Frost
         {
             get
             {
-                GetTranslation_Native(Entity.ID, out Vector3 result);
+                GetTranslation_Native(ref Entity.m_NativeHandle, out Vector3 result);
                 return result;
             }
 
             set
             {
-                SetTranslation_Native(Entity.ID, ref value);
+                SetTranslation_Native(ref Entity.m_NativeHandle, ref value);
             }
         }
 
@@ -78,13 +78,13 @@ namespace Frost
         {
             get
             {
-                GetRotation_Native(Entity.ID, out Vector3 result);
+                GetRotation_Native(ref Entity.m_NativeHandle, out Vector3 result);
                 return result;
             }
 
             set
             {
-                SetRotation_Native(Entity.ID, ref value);
+                SetRotation_Native(ref Entity.m_NativeHandle, ref value);
             }
         }
 
@@ -92,44 +92,80 @@ namespace Frost
         {
             get
             {
-                GetScale_Native(Entity.ID, out Vector3 result);
+                GetScale_Native(ref Entity.m_NativeHandle, out Vector3 result);
                 return result;
             }
 
             set
             {
-                SetScale_Native(Entity.ID, ref value);
+                SetScale_Native(ref Entity.m_NativeHandle, ref value);
+            }
+        }
+
+        // Bulk versions of `Transform`, the transforms of all the entities are read/written with a single internal call
+        public static void GetTransforms(Entity[] entities, Transform[] transforms) => GetTransforms(entities, transforms, entities.Length);
+        public static void SetTransforms(Entity[] entities, Transform[] transforms) => SetTransforms(entities, transforms, entities.Length);
+
+        public static void GetTransforms(Entity[] entities, Transform[] transforms, int count)
+        {
+            ValidateBulkArguments(entities, transforms, count);
+            GetTransforms_Native(entities, transforms, count);
+        }
+
+        public static void SetTransforms(Entity[] entities, Transform[] transforms, int count)
+        {
+            ValidateBulkArguments(entities, transforms, count);
+            SetTransforms_Native(entities, transforms, count);
+        }
+
+        private static void ValidateBulkArguments(Entity[] entities, Transform[] transforms, int count)
+        {
+            if (entities == null) throw new ArgumentNullException(nameof(entities));
+            if (transforms == null) throw new ArgumentNullException(nameof(transforms));
+            if (count < 0 || count > entities.Length || count > transforms.Length)
+                throw new ArgumentOutOfRangeException(nameof(count));
+
+            for (int i = 0; i < count; i++)
+            {
+                if (entities[i] == null)
+                    throw new ArgumentNullException(nameof(entities), $"Entity at index {i} is null");
             }
         }
 
         // For Transform
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void GetTransform_Native(ulong entityID, out Transform outTransform);
+        internal static extern void GetTransform_Native(ref Entity.NativeHandle entity, out Transform outTransform);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetTransform_Native(ulong entityID, ref Transform inTransform);
+        internal static extern void SetTransform_Native(ref Entity.NativeHandle entity, ref Transform inTransform);
 
         // For Translation
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void GetTranslation_Native(ulong entityID, out Vector3 outTranslation);
+        internal static extern void GetTranslation_Native(ref Entity.NativeHandle entity, out Vector3 outTranslation);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetTranslation_Native(ulong entityID, ref Vector3 inTranslation);
+        internal static extern void SetTranslation_Native(ref Entity.NativeHandle entity, ref Vector3 inTranslation);
 
         // For Rotation
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void GetRotation_Native(ulong entityID, out Vector3 outRotation);
+        internal static extern void GetRotation_Native(ref Entity.NativeHandle entity, out Vector3 outRotation);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetRotation_Native(ulong entityID, ref Vector3 inRotation);
+        internal static extern void SetRotation_Native(ref Entity.NativeHandle entity, ref Vector3 inRotation);
 
         // For Scale
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void GetScale_Native(ulong entityID, out Vector3 outScale);
+        internal static extern void GetScale_Native(ref Entity.NativeHandle entity, out Vector3 outScale);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetScale_Native(ulong entityID, ref Vector3 inScale);
+        internal static extern void SetScale_Native(ref Entity.NativeHandle entity, ref Vector3 inScale);
 
 
         // For Global Transform (from parent)
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void GetWorldSpaceTransform_Native(ulong entityID, out Transform outTransform);
+        internal static extern void GetWorldSpaceTransform_Native(ref Entity.NativeHandle entity, out Transform outTransform);
+
+        // Bulk
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void GetTransforms_Native(Entity[] entities, Transform[] outTransforms, int count);
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void SetTransforms_Native(Entity[] entities, Transform[] inTransforms, int count);
     }
 
     public class MeshComponent : Component
@@ -275,7 +311,7 @@ namespace Frost
         {
             get
             {
-                return GetBodyType_Native(Entity.ID);
+                return GetBodyType_Native(ref Entity.m_NativeHandle);
             }
         }
 
@@ -283,13 +319,13 @@ namespace Frost
         {
             get
             {
-                GetTranslation_Native(Entity.ID, out Vector3 translation);
+                GetTranslation_Native(ref Entity.m_NativeHandle, out Vector3 translation);
                 return translation;
             }
 
             set
             {
-                SetTranslation_Native(Entity.ID, ref value);
+                SetTranslation_Native(ref Entity.m_NativeHandle, ref value);
             }
         }
 
@@ -297,161 +333,161 @@ namespace Frost
         {
             get
             {
-                GetRotation_Native(Entity.ID, out Vector3 rotation);
+                GetRotation_Native(ref Entity.m_NativeHandle, out Vector3 rotation);
                 return rotation;
             }
 
             set
             {
-                SetRotation_Native(Entity.ID, ref value);
+                SetRotation_Native(ref Entity.m_NativeHandle, ref value);
             }
         }
 
         public float Mass
         {
-            get { return GetMass_Native(Entity.ID); }
-            set { SetMass_Native(Entity.ID, value); }
+            get { return GetMass_Native(ref Entity.m_NativeHandle); }
+            set { SetMass_Native(ref Entity.m_NativeHandle, value); }
         }
 
         public Vector3 LinearVelocity
         {
             get
             {
-                GetLinearVelocity_Native(Entity.ID, out Vector3 velocity);
+                GetLinearVelocity_Native(ref Entity.m_NativeHandle, out Vector3 velocity);
                 return velocity;
             }
 
-            set { SetLinearVelocity_Native(Entity.ID, ref value); }
+            set { SetLinearVelocity_Native(ref Entity.m_NativeHandle, ref value); }
         }
 
         public Vector3 AngularVelocity
         {
             get
             {
-                GetAngularVelocity_Native(Entity.ID, out Vector3 velocity);
+                GetAngularVelocity_Native(ref Entity.m_NativeHandle, out Vector3 velocity);
                 return velocity;
             }
 
-            set { SetAngularVelocity_Native(Entity.ID, ref value); }
+            set { SetAngularVelocity_Native(ref Entity.m_NativeHandle, ref value); }
         }
 
         public float MaxLinearVelocity
         {
-            get { return GetMaxLinearVelocity_Native(Entity.ID); }
-            set { SetMaxLinearVelocity_Native(Entity.ID, value); }
+            get { return GetMaxLinearVelocity_Native(ref Entity.m_NativeHandle); }
+            set { SetMaxLinearVelocity_Native(ref Entity.m_NativeHandle, value); }
         }
 
         public float MaxAngularVelocity
         {
-            get { return GetMaxAngularVelocity_Native(Entity.ID); }
-            set { SetMaxAngularVelocity_Native(Entity.ID, value); }
+            get { return GetMaxAngularVelocity_Native(ref Entity.m_NativeHandle); }
+            set { SetMaxAngularVelocity_Native(ref Entity.m_NativeHandle, value); }
         }
 
         // TODO: When I'll add physics layers, I must also add support to manage them from C# script
         public uint Layer
         {
-            get => GetLayer_Native(Entity.ID);
+            get => GetLayer_Native(ref Entity.m_NativeHandle);
         }
 
         public void GetKinematicTarget(out Vector3 targetPosition, out Vector3 targetRotation)
         {
-            GetKinematicTarget_Native(Entity.ID, out targetPosition, out targetRotation);
+            GetKinematicTarget_Native(ref Entity.m_NativeHandle, out targetPosition, out targetRotation);
         }
 
         public void SetKinematicTarget(Vector3 targetPosition, Vector3 targetRotation)
         {
-            SetKinematicTarget_Native(Entity.ID, ref targetPosition, ref targetRotation);
+            SetKinematicTarget_Native(ref Entity.m_NativeHandle, ref targetPosition, ref targetRotation);
         }
 
         public void AddForce(Vector3 force, ForceMode forceMode = ForceMode.Force)
         {
-            AddForce_Native(Entity.ID, ref force, forceMode);
+            AddForce_Native(ref Entity.m_NativeHandle, ref force, forceMode);
         }
 
         public void AddTorque(Vector3 torque, ForceMode forceMode = ForceMode.Force)
         {
-            AddTorque_Native(Entity.ID, ref torque, forceMode);
+            AddTorque_Native(ref Entity.m_NativeHandle, ref torque, forceMode);
         }
 
         // Rotation should be in radians
         public void Rotate(Vector3 rotation)
         {
-            Rotate_Native(Entity.ID, ref rotation);
+            Rotate_Native(ref Entity.m_NativeHandle, ref rotation);
         }
 
-        public void SetLockFlag(ActorLockFlag flag, bool value) => SetLockFlag_Native(Entity.ID, flag, value);
-        public bool IsLockFlagSet(ActorLockFlag flag) => IsLockFlagSet_Native(Entity.ID, flag);
-        public uint GetLockFlags() => GetLockFlags_Native(Entity.ID);
+        public void SetLockFlag(ActorLockFlag flag, bool value) => SetLockFlag_Native(ref Entity.m_NativeHandle, flag, value);
+        public bool IsLockFlagSet(ActorLockFlag flag) => IsLockFlagSet_Native(ref Entity.m_NativeHandle, flag);
+        public uint GetLockFlags() => GetLockFlags_Native(ref Entity.m_NativeHandle);
 
 
         // Body Type
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern Type GetBodyType_Native(ulong entityID);
+        internal static extern Type GetBodyType_Native(ref Entity.NativeHandle entity);
 
         // Position
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void GetTranslation_Native(ulong entityID, out Vector3 translation);
+        internal static extern void GetTranslation_Native(ref Entity.NativeHandle entity, out Vector3 translation);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetTranslation_Native(ulong entityID, ref Vector3 translation);
+        internal static extern void SetTranslation_Native(ref Entity.NativeHandle entity, ref Vector3 translation);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void GetRotation_Native(ulong entityID, out Vector3 rotation);
+        internal static extern void GetRotation_Native(ref Entity.NativeHandle entity, out Vector3 rotation);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetRotation_Native(ulong entityID, ref Vector3 rotation);
+        internal static extern void SetRotation_Native(ref Entity.NativeHandle entity, ref Vector3 rotation);
 
         // Mass
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern float GetMass_Native(ulong entityID);
+        internal static extern float GetMass_Native(ref Entity.NativeHandle entity);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetMass_Native(ulong entityID, float mass);
+        internal static extern void SetMass_Native(ref Entity.NativeHandle entity, float mass);
 
         // Velocity
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void GetLinearVelocity_Native(ulong entityID, out Vector3 velocity);
+        internal static extern void GetLinearVelocity_Native(ref Entity.NativeHandle entity, out Vector3 velocity);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetLinearVelocity_Native(ulong entityID, ref Vector3 velocity);
+        internal static extern void SetLinearVelocity_Native(ref Entity.NativeHandle entity, ref Vector3 velocity);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void GetAngularVelocity_Native(ulong entityID, out Vector3 velocity);
+        internal static extern void GetAngularVelocity_Native(ref Entity.NativeHandle entity, out Vector3 velocity);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetAngularVelocity_Native(ulong entityID, ref Vector3 velocity);
+        internal static extern void SetAngularVelocity_Native(ref Entity.NativeHandle entity, ref Vector3 velocity);
 
         // Max Velocity
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern float GetMaxLinearVelocity_Native(ulong entityID);
+        internal static extern float GetMaxLinearVelocity_Native(ref Entity.NativeHandle entity);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetMaxLinearVelocity_Native(ulong entityID, float maxVelocity);
+        internal static extern void SetMaxLinearVelocity_Native(ref Entity.NativeHandle entity, float maxVelocity);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern float GetMaxAngularVelocity_Native(ulong entityID);
+        internal static extern float GetMaxAngularVelocity_Native(ref Entity.NativeHandle entity);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetMaxAngularVelocity_Native(ulong entityID, float maxVelocity);
+        internal static extern void SetMaxAngularVelocity_Native(ref Entity.NativeHandle entity, float maxVelocity);
 
         // Kinematics
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void GetKinematicTarget_Native(ulong entityID, out Vector3 targetPosition, out Vector3 targetRotation);
+        internal static extern void GetKinematicTarget_Native(ref Entity.NativeHandle entity, out Vector3 targetPosition, out Vector3 targetRotation);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetKinematicTarget_Native(ulong entityID, ref Vector3 targetPosition, ref Vector3 targetRotation);
+        internal static extern void SetKinematicTarget_Native(ref Entity.NativeHandle entity, ref Vector3 targetPosition, ref Vector3 targetRotation);
 
 
         // Addition of Torque/Force
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void AddForce_Native(ulong entityID, ref Vector3 force, ForceMode forceMode);
+        internal static extern void AddForce_Native(ref Entity.NativeHandle entity, ref Vector3 force, ForceMode forceMode);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void AddTorque_Native(ulong entityID, ref Vector3 torque, ForceMode forceMode);
+        internal static extern void AddTorque_Native(ref Entity.NativeHandle entity, ref Vector3 torque, ForceMode forceMode);
 
         // Rotate
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void Rotate_Native(ulong entityID, ref Vector3 rotation);
+        internal static extern void Rotate_Native(ref Entity.NativeHandle entity, ref Vector3 rotation);
 
         // Lock Flags
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void SetLockFlag_Native(ulong entityID, ActorLockFlag flag, bool value);
+        internal static extern void SetLockFlag_Native(ref Entity.NativeHandle entity, ActorLockFlag flag, bool value);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern bool IsLockFlagSet_Native(ulong entityID, ActorLockFlag flag);
+        internal static extern bool IsLockFlagSet_Native(ref Entity.NativeHandle entity, ActorLockFlag flag);
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern uint GetLockFlags_Native(ulong entityID);
+        internal static extern uint GetLockFlags_Native(ref Entity.NativeHandle entity);
 
         // Layers
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern uint GetLayer_Native(ulong entityID);
+        internal static extern uint GetLayer_Native(ref Entity.NativeHandle entity);
     }
 
     public class BoxColliderComponent : Component
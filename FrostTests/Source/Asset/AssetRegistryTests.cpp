@@ -0,0 +1,106 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Asset/AssetRegistry.h"
+
+namespace Frost::Tests
+{
+	static AssetMetadata CreateMetadata(uint64_t handle, const std::filesystem::path& path)
+	{
+		AssetMetadata metadata;
+		metadata.Handle = handle;
+		metadata.Type = AssetType::Texture;
+		metadata.FilePath = path;
+		return metadata;
+	}
+
+	// Every entry has to be found through its handle, pointing to the entry itself
+	static bool IsHandleIndexConsistent(const AssetRegistry& registry)
+	{
+		for (const auto& [path, metadata] : registry)
+		{
+			if (metadata.Handle == 0) continue;
+
+			const AssetMetadata* indexed = registry.Get(metadata.Handle);
+			if (indexed != &metadata || indexed->FilePath != metadata.FilePath)
+				return false;
+		}
+		return true;
+	}
+
+	FROST_TEST(AssetRegistryIndexFollowsSet)
+	{
+		AssetRegistry registry;
+		registry.Set("Textures/A.png", CreateMetadata(1, "Textures/A.png"));
+		registry.Set("Textures/B.png", CreateMetadata(2, "Textures/B.png"));
+		FROST_CHECK(registry.Get(AssetHandle(1))->FilePath == "Textures/A.png");
+		FROST_CHECK(registry.Get(AssetHandle(3)) == nullptr);
+
+		// Overwriting a path with another handle drops the old handle
+		registry.Set("Textures/A.png", CreateMetadata(3, "Textures/A.png"));
+		FROST_CHECK(registry.Get(AssetHandle(1)) == nullptr);
+		FROST_CHECK(registry.Get(AssetHandle(3))->FilePath == "Textures/A.png");
+		FROST_CHECK(registry.Count() == 2);
+
+		// Entries without a handle are never indexed
+		registry.Set("Textures/C.png", CreateMetadata(0, "Textures/C.png"));
+		FROST_CHECK(registry.Get(AssetHandle(0)) == nullptr);
+
+		registry.SetDataLoaded(AssetHandle(2), true);
+		FROST_CHECK(registry.Get("Textures/B.png").IsDataLoaded);
+
+		FROST_CHECK(IsHandleIndexConsistent(registry));
+	}
+
+	FROST_TEST(AssetRegistryIndexFollowsRename)
+	{
+		AssetRegistry registry;
+		registry.Set("Meshes/Old.fbx", CreateMetadata(10, "Meshes/Old.fbx"));
+
+		FROST_CHECK(registry.Rename("Meshes/Old.fbx", "Meshes/New.fbx"));
+		FROST_CHECK(!registry.Contains("Meshes/Old.fbx"));
+		FROST_CHECK(registry.Contains("Meshes/New.fbx"));
+		FROST_CHECK(registry.Get(AssetHandle(10))->FilePath == "Meshes/New.fbx");
+
+		FROST_CHECK(!registry.Rename("Meshes/Missing.fbx", "Meshes/Other.fbx"));
+		FROST_CHECK(registry.Count() == 1);
+		FROST_CHECK(IsHandleIndexConsistent(registry));
+	}
+
+	FROST_TEST(AssetRegistryIndexFollowsRemoveAndClear)
+	{
+		AssetRegistry registry;
+		registry.Set("A.mat", CreateMetadata(1, "A.mat"));
+		registry.Set("B.mat", CreateMetadata(2, "B.mat"));
+
+		FROST_CHECK(registry.Remove("A.mat") == 1);
+		FROST_CHECK(registry.Remove("A.mat") == 0);
+		FROST_CHECK(registry.Get(AssetHandle(1)) == nullptr);
+		FROST_CHECK(registry.Get(AssetHandle(2)) != nullptr);
+		FROST_CHECK(IsHandleIndexConsistent(registry));
+
+		registry.Clear();
+		FROST_CHECK(registry.Count() == 0);
+		FROST_CHECK(registry.Get(AssetHandle(2)) == nullptr);
+	}
+
+	FROST_TEST(AssetRegistryIndexSurvivesRehashing)
+	{
+		// Enough entries to rehash the registry several times, with renames and removals in between
+		AssetRegistry registry;
+		for (uint64_t i = 1; i <= 5000; i++)
+		{
+			std::string path = "Assets/" + std::to_string(i) + ".png";
+			registry.Set(path, CreateMetadata(i, path));
+		}
+		for (uint64_t i = 1; i <= 5000; i += 3)
+			registry.Rename("Assets/" + std::to_string(i) + ".png", "Renamed/" + std::to_string(i) + ".png");
+		for (uint64_t i = 2; i <= 5000; i += 3)
+			registry.Remove("Assets/" + std::to_string(i) + ".png");
+
+		FROST_CHECK(IsHandleIndexConsistent(registry));
+		FROST_CHECK(registry.Get(AssetHandle(1))->FilePath == "Renamed/1.png");
+		FROST_CHECK(registry.Get(AssetHandle(2)) == nullptr);
+		FROST_CHECK(registry.Get(AssetHandle(3))->FilePath == "Assets/3.png");
+	}
+}
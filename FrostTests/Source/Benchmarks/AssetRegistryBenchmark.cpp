@@ -0,0 +1,81 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Asset/AssetRegistry.h"
+
+#include <chrono>
+
+namespace Frost::Tests
+{
+	// 100k registry entries: filling, looking up every handle (index vs the previous linear scan), renaming and removing
+	FROST_BENCHMARK(AssetRegistryHandleLookup)
+	{
+		static constexpr uint64_t s_EntryCount = 100'000;
+		static constexpr uint64_t s_LinearLookupCount = 200; // The linear scan is too slow to look up every handle
+
+		Vector<std::filesystem::path> paths;
+		paths.reserve(s_EntryCount);
+		for (uint64_t i = 1; i <= s_EntryCount; i++)
+			paths.push_back("Assets/Folder" + std::to_string(i % 100) + "/" + std::to_string(i) + ".png");
+
+		AssetRegistry registry;
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint64_t i = 1; i <= s_EntryCount; i++)
+		{
+			AssetMetadata metadata;
+			metadata.Handle = i;
+			metadata.Type = AssetType::Texture;
+			metadata.FilePath = paths[i - 1];
+			registry.Set(paths[i - 1], metadata);
+		}
+		auto end = std::chrono::high_resolution_clock::now();
+		double setSeconds = std::chrono::duration<double>(end - start).count();
+
+		uint64_t foundCount = 0;
+		start = std::chrono::high_resolution_clock::now();
+		for (uint64_t i = 1; i <= s_EntryCount; i++)
+			foundCount += registry.Get(AssetHandle(i)) != nullptr;
+		end = std::chrono::high_resolution_clock::now();
+		double indexSeconds = std::chrono::duration<double>(end - start).count();
+		FROST_CHECK(foundCount == s_EntryCount);
+
+		// Previous lookup: iterating the registry until the handle matches
+		foundCount = 0;
+		start = std::chrono::high_resolution_clock::now();
+		for (uint64_t i = 0; i < s_LinearLookupCount; i++)
+		{
+			AssetHandle handle = (i * 7919) % s_EntryCount + 1;
+			for (const auto& [path, metadata] : registry)
+			{
+				if (metadata.Handle == handle)
+				{
+					foundCount++;
+					break;
+				}
+			}
+		}
+		end = std::chrono::high_resolution_clock::now();
+		double linearSeconds = std::chrono::duration<double>(end - start).count();
+		FROST_CHECK(foundCount == s_LinearLookupCount);
+
+		start = std::chrono::high_resolution_clock::now();
+		for (uint64_t i = 0; i < s_EntryCount; i += 10)
+			registry.Rename(paths[i], "Renamed" / paths[i]);
+		end = std::chrono::high_resolution_clock::now();
+		double renameSeconds = std::chrono::duration<double>(end - start).count();
+		FROST_CHECK(registry.Get(AssetHandle(1))->FilePath == "Renamed" / paths[0]);
+
+		start = std::chrono::high_resolution_clock::now();
+		for (uint64_t i = 1; i < s_EntryCount; i += 10)
+			registry.Remove(paths[i]);
+		end = std::chrono::high_resolution_clock::now();
+		double removeSeconds = std::chrono::duration<double>(end - start).count();
+		FROST_CHECK(registry.Count() == s_EntryCount - s_EntryCount / 10);
+
+		FROST_CORE_INFO("    Set:             {0:.1f} ns/entry", setSeconds * 1e9 / s_EntryCount);
+		FROST_CORE_INFO("    Handle index:    {0:.1f} ns/lookup", indexSeconds * 1e9 / s_EntryCount);
+		FROST_CORE_INFO("    Linear scan:     {0:.1f} ns/lookup", linearSeconds * 1e9 / s_LinearLookupCount);
+		FROST_CORE_INFO("    Rename:          {0:.1f} ns/entry", renameSeconds * 1e9 / (s_EntryCount / 10));
+		FROST_CORE_INFO("    Remove:          {0:.1f} ns/entry", removeSeconds * 1e9 / (s_EntryCount / 10));
+	}
+}
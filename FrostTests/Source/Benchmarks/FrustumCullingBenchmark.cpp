@@ -0,0 +1,73 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Math/FrustumCulling.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <bitset>
+#include <chrono>
+#include <random>
+
+namespace Frost::Tests
+{
+	// 100k world space boxes culled against a perspective frustum: the SIMD batches (AVX in Release/Dist, SSE in Debug),
+	// the scalar reference path and the per box `IsBoxVisible` test
+	FROST_BENCHMARK(FrustumCull100kBoxes)
+	{
+		static constexpr uint32_t s_BoxCount = 100'000;
+		static constexpr uint32_t s_Iterations = 50;
+
+		glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+		glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(10.0f, 3.0f, 20.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		Math::ViewFrustum frustum = Math::ViewFrustum::FromViewProjection(projection * view);
+
+		std::mt19937 random(7);
+		std::uniform_real_distribution<float> position(-300.0f, 300.0f);
+		std::uniform_real_distribution<float> extent(0.1f, 5.0f);
+
+		Math::CullingBounds bounds;
+		bounds.Reserve(s_BoxCount);
+		for (uint32_t i = 0; i < s_BoxCount; i++)
+			bounds.Add({ position(random), position(random) * 0.1f, position(random) }, { extent(random), extent(random), extent(random) });
+
+		Vector<uint64_t> simdMask;
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < s_Iterations; i++)
+			Math::FrustumCull(frustum, bounds, simdMask);
+		auto end = std::chrono::high_resolution_clock::now();
+		double simdSeconds = std::chrono::duration<double>(end - start).count() / s_Iterations;
+
+		Vector<uint64_t> scalarMask(simdMask.size());
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < s_Iterations; i++)
+			Math::FrustumCullScalar(frustum, bounds, 0, s_BoxCount, scalarMask.data());
+		end = std::chrono::high_resolution_clock::now();
+		double scalarSeconds = std::chrono::duration<double>(end - start).count() / s_Iterations;
+
+		uint32_t perBoxVisibleCount = 0;
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < s_Iterations; i++)
+		{
+			perBoxVisibleCount = 0;
+			for (uint32_t box = 0; box < s_BoxCount; box++)
+			{
+				glm::vec3 center = bounds.GetCenter(box);
+				glm::vec3 extents = bounds.GetExtents(box);
+				perBoxVisibleCount += frustum.IsBoxVisible(center - extents, center + extents);
+			}
+		}
+		end = std::chrono::high_resolution_clock::now();
+		double perBoxSeconds = std::chrono::duration<double>(end - start).count() / s_Iterations;
+
+		uint32_t visibleCount = 0;
+		for (uint64_t word : simdMask)
+			visibleCount += uint32_t(std::bitset<64>(word).count());
+		FROST_CHECK(simdMask == scalarMask);
+		FROST_CHECK(visibleCount == perBoxVisibleCount);
+
+		FROST_CORE_INFO("    {0} boxes, {1} visible", s_BoxCount, visibleCount);
+		FROST_CORE_INFO("    SIMD:    {0:.3f} ms", simdSeconds * 1000.0);
+		FROST_CORE_INFO("    Scalar:  {0:.3f} ms", scalarSeconds * 1000.0);
+		FROST_CORE_INFO("    Per box: {0:.3f} ms", perBoxSeconds * 1000.0);
+	}
+}
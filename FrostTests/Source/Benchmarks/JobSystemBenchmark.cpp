@@ -0,0 +1,69 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Core/JobSystem.h"
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace Frost::Tests
+{
+	// Compute bound ParallelFor (no shared writes), from 0 workers (only the waiting main thread) up to one worker per hardware thread
+	FROST_BENCHMARK(JobSystemParallelForScaling)
+	{
+		static constexpr uint32_t s_ItemCount = 1 << 16;
+		static constexpr uint32_t s_WorkPerItem = 256;
+		static constexpr uint32_t s_RepeatCount = 10;
+
+		Vector<float> results(s_ItemCount);
+		uint32_t maxWorkerCount = std::max(1u, std::thread::hardware_concurrency());
+
+		double baselineSeconds = 0.0;
+		for (uint32_t workerCount = 0; workerCount <= maxWorkerCount; workerCount = workerCount == 0 ? 1 : workerCount * 2)
+		{
+			JobSystem::Init(workerCount);
+
+			auto start = std::chrono::high_resolution_clock::now();
+			for (uint32_t repeat = 0; repeat < s_RepeatCount; repeat++)
+			{
+				JobSystem::ParallelFor(s_ItemCount, [&results](uint32_t index)
+				{
+					float value = float(index);
+					for (uint32_t i = 0; i < s_WorkPerItem; i++)
+						value = std::sqrt(value + float(i));
+					results[index] = value;
+				});
+			}
+			auto end = std::chrono::high_resolution_clock::now();
+			double seconds = std::chrono::duration<double>(end - start).count();
+
+			JobSystem::ShutDown();
+
+			if (workerCount == 0)
+				baselineSeconds = seconds;
+
+			FROST_CHECK(results[s_ItemCount - 1] > 0.0f);
+			FROST_CORE_INFO("    {0} workers: {1:.2f} ms per ParallelFor ({2:.2f}x)", workerCount, seconds * 1000.0 / s_RepeatCount, baselineSeconds / seconds);
+		}
+	}
+
+	// Overhead of tiny jobs (batch size 1), where the queue locking and the stealing dominate
+	FROST_BENCHMARK(JobSystemTinyJobThroughput)
+	{
+		static constexpr uint32_t s_JobCount = 100'000;
+
+		JobSystem::Init();
+
+		std::atomic<uint32_t> sum = 0;
+		auto start = std::chrono::high_resolution_clock::now();
+		JobSystem::ParallelFor(s_JobCount, [&sum](uint32_t) { sum.fetch_add(1, std::memory_order_relaxed); }, 1);
+		auto end = std::chrono::high_resolution_clock::now();
+		double seconds = std::chrono::duration<double>(end - start).count();
+
+		FROST_CHECK(sum == s_JobCount);
+		FROST_CORE_INFO("    {0} workers: {1:.2f} M jobs/s", JobSystem::GetWorkerCount(), s_JobCount / seconds / 1'000'000.0);
+
+		JobSystem::ShutDown();
+	}
+}
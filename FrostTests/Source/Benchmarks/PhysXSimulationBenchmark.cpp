@@ -0,0 +1,113 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Core/JobSystem.h"
+#include "Frost/Physics/PhysicsSettings.h"
+#include "Frost/Physics/PhysX/PhysXInternal.h"
+#include "Frost/Physics/PhysX/PhysXUtils.h"
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace Frost::Tests
+{
+	// Same description as `PhysXScene`, without the contact listener (no engine scene or entities are needed)
+	static physx::PxScene* CreateBenchmarkScene(const PhysicsSettings& settings)
+	{
+		physx::PxSceneDesc sceneDesc(PhysXInternal::GetPhysXHandle().getTolerancesScale());
+		sceneDesc.flags |= physx::PxSceneFlag::eENABLE_CCD | physx::PxSceneFlag::eENABLE_PCM;
+		sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ENHANCED_DETERMINISM;
+		sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
+		sceneDesc.gravity = PhysXUtils::ToPhysXVector(settings.Gravity);
+		sceneDesc.broadPhaseType = PhysXUtils::GetBroadphaseType(settings.BroadphaseAlgorithm);
+		sceneDesc.cpuDispatcher = PhysXInternal::GetCPUDispatcher();
+		sceneDesc.filterShader = (physx::PxSimulationFilterShader)PhysXInternal::FilterShader;
+		sceneDesc.frictionType = PhysXUtils::GetPhysXFrictionType(settings.FrictionModel);
+
+		return PhysXInternal::GetPhysXHandle().createScene(sceneDesc);
+	}
+
+	// Stacks of 10 boxes on a ground plane, so every run starts from the same contacts.
+	// Every shape is in layer 0 and collides with it (the filter shader suppresses the pairs otherwise)
+	static void AddBoxStacks(physx::PxScene* scene, physx::PxMaterial* material, uint32_t bodyCount)
+	{
+		static constexpr uint32_t s_StackHeight = 10;
+
+		physx::PxPhysics& physics = PhysXInternal::GetPhysXHandle();
+		physx::PxFilterData filterData(1, 1, 0, 0);
+
+		physx::PxRigidStatic* ground = physx::PxCreatePlane(physics, physx::PxPlane(0.0f, 1.0f, 0.0f, 0.0f), *material);
+		physx::PxShape* groundShape = nullptr;
+		ground->getShapes(&groundShape, 1);
+		groundShape->setSimulationFilterData(filterData);
+		scene->addActor(*ground);
+
+		uint32_t stackCount = (bodyCount + s_StackHeight - 1) / s_StackHeight;
+		uint32_t gridSize = uint32_t(std::ceil(std::sqrt(float(stackCount))));
+		for (uint32_t i = 0; i < bodyCount; i++)
+		{
+			uint32_t stack = i / s_StackHeight;
+			uint32_t level = i % s_StackHeight;
+			physx::PxVec3 position(float(stack % gridSize) * 2.0f, 0.5f + float(level) * 1.01f, float(stack / gridSize) * 2.0f);
+
+			physx::PxRigidDynamic* body = physx::PxCreateDynamic(physics, physx::PxTransform(position), physx::PxBoxGeometry(0.5f, 0.5f, 0.5f), *material, 1.0f);
+			physx::PxShape* shape = nullptr;
+			body->getShapes(&shape, 1);
+			shape->setSimulationFilterData(filterData);
+			scene->addActor(*body);
+		}
+	}
+
+	// 5k to 20k bodies simulated headless for 2 seconds (120 fixed steps), with the `PhysXJobDispatcher` limited to 1, 2, 4, ... threads
+	FROST_BENCHMARK(PhysXSimulationThreadScaling)
+	{
+		static constexpr uint32_t s_StepCount = 120;
+		static constexpr float s_FixedTimestep = 1.0f / 60.0f;
+
+		JobSystem::Init();
+		PhysXInternal::Initialize();
+
+		PhysicsSettings settings;
+		physx::PxMaterial* material = PhysXInternal::GetPhysXHandle().createMaterial(0.6f, 0.6f, 0.0f);
+
+		uint32_t maxThreadCount = std::max(1u, JobSystem::GetWorkerCount());
+		for (uint32_t bodyCount : { 5'000u, 10'000u, 20'000u })
+		{
+			FROST_CORE_INFO("    {0} bodies", bodyCount);
+
+			double singleThreadSeconds = 0.0;
+			for (uint32_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+			{
+				PhysXInternal::SetSimulationThreadCount(threadCount);
+
+				physx::PxScene* scene = CreateBenchmarkScene(settings);
+				AddBoxStacks(scene, material, bodyCount);
+
+				auto start = std::chrono::high_resolution_clock::now();
+				for (uint32_t step = 0; step < s_StepCount; step++)
+				{
+					scene->simulate(s_FixedTimestep);
+					scene->fetchResults(true);
+				}
+				auto end = std::chrono::high_resolution_clock::now();
+				double seconds = std::chrono::duration<double>(end - start).count();
+
+				FROST_CHECK(scene->getNbActors(physx::PxActorTypeFlag::eRIGID_DYNAMIC) == bodyCount);
+				scene->release();
+
+				if (threadCount == 1)
+					singleThreadSeconds = seconds;
+
+				FROST_CORE_INFO("      {0} threads: {1:.2f} ms per step ({2:.2f}x)", threadCount, seconds * 1000.0 / s_StepCount, singleThreadSeconds / seconds);
+			}
+		}
+
+		// Back to every worker, as `PhysXScene` would set it from the default settings
+		PhysXInternal::SetSimulationThreadCount(settings.WorkerThreadCount);
+
+		material->release();
+		PhysXInternal::Shutdown();
+		JobSystem::ShutDown();
+	}
+}
@@ -0,0 +1,102 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Core/JobSystem.h"
+#include "Frost/EntitySystem/Scene.h"
+#include "Frost/EntitySystem/Entity.h"
+#include "Frost/Physics/PhysicsEngine.h"
+
+#include <chrono>
+
+namespace Frost::Tests
+{
+	static double SimulateSteps(uint32_t stepCount, const std::function<void()>& beforeStep = {})
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t step = 0; step < stepCount; step++)
+		{
+			if (beforeStep)
+				beforeStep();
+			PhysicsEngine::Simulate(Timestep(1.0f / 60.0f));
+		}
+		auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double>(end - start).count() / stepCount;
+	}
+
+	// 10k static boxes with 2k dynamic boxes resting (and falling asleep) on them, so almost nothing is active.
+	// A step should cost only what is active or was written, not the number of actors in the scene
+	FROST_BENCHMARK(PhysicsMostlySleepingScene)
+	{
+		static constexpr uint32_t s_StaticCount = 10'000;
+		static constexpr uint32_t s_DynamicCount = 2'000;
+		static constexpr uint32_t s_GridSize = 100;
+		static constexpr uint32_t s_SettleStepCount = 600;
+		static constexpr uint32_t s_StepCount = 120;
+		static constexpr uint32_t s_WrittenStaticCount = 100;
+
+		JobSystem::Init();
+		PhysicsEngine::Initialize();
+
+		{
+			Scene scene("Benchmark");
+
+			Vector<Entity> staticEntities;
+			staticEntities.reserve(s_StaticCount);
+			for (uint32_t i = 0; i < s_StaticCount; i++)
+			{
+				Entity entity = scene.CreateEntity();
+				entity.Transform().Translation = { float(i % s_GridSize) * 2.0f, 0.0f, float(i / s_GridSize) * 2.0f };
+				entity.AddComponent<RigidBodyComponent>().BodyType = RigidBodyComponent::Type::Static;
+				entity.AddComponent<BoxColliderComponent>();
+				staticEntities.push_back(entity);
+			}
+
+			for (uint32_t i = 0; i < s_DynamicCount; i++)
+			{
+				// On top of every fifth static box
+				uint32_t base = i * (s_StaticCount / s_DynamicCount);
+				Entity entity = scene.CreateEntity();
+				entity.Transform().Translation = { float(base % s_GridSize) * 2.0f, 1.0f, float(base / s_GridSize) * 2.0f };
+				entity.AddComponent<RigidBodyComponent>().BodyType = RigidBodyComponent::Type::Dynamic;
+				entity.AddComponent<BoxColliderComponent>();
+			}
+
+			scene.OnRuntimeStart();
+
+			// Let the dynamic boxes come to rest and fall asleep
+			SimulateSteps(s_SettleStepCount);
+
+			double idleSeconds = SimulateSteps(s_StepCount);
+
+			// A few static actors moved every step (by scripts or the editor), they are the only ones which are synchronized
+			uint32_t frame = 0;
+			double fewWrittenSeconds = SimulateSteps(s_StepCount, [&]()
+			{
+				for (uint32_t i = 0; i < s_WrittenStaticCount; i++)
+				{
+					Entity entity = staticEntities[(frame * s_WrittenStaticCount + i) % s_StaticCount];
+					entity.Transform().Translation.y = (frame % 2) ? 0.001f : 0.0f;
+					entity.MarkTransformDirty();
+				}
+				frame++;
+			});
+
+			// Every static actor marked every step, which is what the previous per step scan of all the static actors cost
+			double allMarkedSeconds = SimulateSteps(s_StepCount, [&]()
+			{
+				for (Entity entity : staticEntities)
+					entity.MarkTransformDirty();
+			});
+
+			scene.OnRuntimeEnd();
+
+			FROST_CORE_INFO("    {0} static and {1} dynamic actors", s_StaticCount, s_DynamicCount);
+			FROST_CORE_INFO("    Nothing written:     {0:.3f} ms per step", idleSeconds * 1000.0);
+			FROST_CORE_INFO("    {0} statics written: {1:.3f} ms per step", s_WrittenStaticCount, fewWrittenSeconds * 1000.0);
+			FROST_CORE_INFO("    Every static marked: {0:.3f} ms per step", allMarkedSeconds * 1000.0);
+		}
+
+		PhysicsEngine::ShutDown();
+		JobSystem::ShutDown();
+	}
+}
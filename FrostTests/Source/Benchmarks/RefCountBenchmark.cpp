@@ -0,0 +1,94 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include <chrono>
+#include <thread>
+
+namespace Frost::Tests
+{
+	namespace
+	{
+		struct IntrusiveObject : public RefCounted
+		{
+			uint64_t Value = 0;
+		};
+
+		struct HeapCountedObject
+		{
+			uint64_t Value = 0;
+		};
+
+		static constexpr uint32_t s_CopiesPerThread = 1'000'000;
+
+		// Every thread copies (and destroys) a `Ref` to the same instance, which is the contended case of the render queue submission
+		template<typename T>
+		double MeasureCopyDestroyThroughput(uint32_t threadCount)
+		{
+			Ref<T> sharedRef = Ref<T>::Create();
+
+			std::atomic<uint64_t> checksum = 0;
+			Vector<std::thread> threads;
+			threads.reserve(threadCount);
+
+			auto start = std::chrono::high_resolution_clock::now();
+			for (uint32_t i = 0; i < threadCount; i++)
+			{
+				threads.emplace_back([&sharedRef, &checksum]()
+				{
+					uint64_t localChecksum = 0;
+					for (uint32_t copy = 0; copy < s_CopiesPerThread; copy++)
+					{
+						Ref<T> ref = sharedRef;
+						localChecksum += ref->Value;
+					}
+					checksum.fetch_add(localChecksum, std::memory_order_relaxed);
+				});
+			}
+
+			for (auto& thread : threads)
+				thread.join();
+			auto end = std::chrono::high_resolution_clock::now();
+
+			FROST_CHECK(checksum.load() == 0);
+			FROST_CHECK(sharedRef.GetRefCount() == 1);
+
+			double seconds = std::chrono::duration<double>(end - start).count();
+			return (double(s_CopiesPerThread) * threadCount) / seconds / 1'000'000.0;
+		}
+	}
+
+	FROST_BENCHMARK(RefCopyDestroyThroughput)
+	{
+		for (uint32_t threadCount : { 1u, 2u, 4u, 8u, 16u })
+		{
+			double intrusive = MeasureCopyDestroyThroughput<IntrusiveObject>(threadCount);
+			double heapCounted = MeasureCopyDestroyThroughput<HeapCountedObject>(threadCount);
+
+			FROST_CORE_INFO("    {0:>2} thread(s): intrusive {1:.1f} M copies/s, heap counted {2:.1f} M copies/s", threadCount, intrusive, heapCounted);
+		}
+	}
+
+	FROST_BENCHMARK(RefCreateDestroyThroughput)
+	{
+		// Creation/destruction is the only place the debug live reference registry is touched
+		for (uint32_t threadCount : { 1u, 4u, 16u })
+		{
+			Vector<std::thread> threads;
+			auto start = std::chrono::high_resolution_clock::now();
+			for (uint32_t i = 0; i < threadCount; i++)
+			{
+				threads.emplace_back([]()
+				{
+					for (uint32_t j = 0; j < s_CopiesPerThread / 10; j++)
+						Ref<IntrusiveObject> ref = Ref<IntrusiveObject>::Create();
+				});
+			}
+			for (auto& thread : threads)
+				thread.join();
+			auto end = std::chrono::high_resolution_clock::now();
+
+			double seconds = std::chrono::duration<double>(end - start).count();
+			FROST_CORE_INFO("    {0:>2} thread(s): {1:.1f} M creates/s", threadCount, (double(s_CopiesPerThread / 10) * threadCount) / seconds / 1'000'000.0);
+		}
+	}
+}
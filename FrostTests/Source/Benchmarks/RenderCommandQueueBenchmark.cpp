@@ -0,0 +1,180 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Renderer/RenderCommandQueue.h"
+
+#include <chrono>
+
+namespace Frost::Tests
+{
+	// The queue the renderer used before: one 10MB buffer, unaligned payloads and no support for other threads (so they share a mutex here)
+	class LegacyRenderCommandQueue
+	{
+	public:
+		LegacyRenderCommandQueue()
+		{
+			m_CommandBuffer = new uint8_t[s_BufferSize];
+			m_CommandBufferPtr = m_CommandBuffer;
+			memset(m_CommandBuffer, 0, s_BufferSize);
+		}
+
+		~LegacyRenderCommandQueue()
+		{
+			delete[] m_CommandBuffer;
+		}
+
+		void* Allocate(RenderCommandFn fn, uint32_t size)
+		{
+			*(RenderCommandFn*)m_CommandBufferPtr = fn;
+			m_CommandBufferPtr += sizeof(RenderCommandFn);
+
+			*(uint32_t*)m_CommandBufferPtr = size;
+			m_CommandBufferPtr += sizeof(uint32_t);
+
+			void* memory = m_CommandBufferPtr;
+			m_CommandBufferPtr += size;
+
+			m_CommandCount++;
+			return memory;
+		}
+
+		void Execute()
+		{
+			uint8_t* buffer = m_CommandBuffer;
+			for (uint32_t i = 0; i < m_CommandCount; i++)
+			{
+				RenderCommandFn function = *(RenderCommandFn*)buffer;
+				buffer += sizeof(RenderCommandFn);
+
+				uint32_t size = *(uint32_t*)buffer;
+				buffer += sizeof(uint32_t);
+
+				function(buffer);
+				buffer += size;
+			}
+
+			m_CommandBufferPtr = m_CommandBuffer;
+			m_CommandCount = 0;
+		}
+
+		std::mutex& GetMutex() { return m_Mutex; }
+	private:
+		static constexpr uint32_t s_BufferSize = 10 * 1024 * 1024;
+
+		uint8_t* m_CommandBuffer;
+		uint8_t* m_CommandBufferPtr;
+		uint32_t m_CommandCount = 0;
+		std::mutex m_Mutex;
+	};
+
+	// A typical render command: a lambda capturing a matrix and a pointer
+	struct BenchmarkCommand
+	{
+		std::array<float, 16> Transform;
+		uint64_t* Sum;
+	};
+
+	static void ExecuteBenchmarkCommand(void* payload)
+	{
+		BenchmarkCommand* command = static_cast<BenchmarkCommand*>(payload);
+		*command->Sum += uint64_t(command->Transform[12]);
+	}
+
+	static constexpr uint32_t s_QueueFrameCount = 100;
+	static constexpr uint32_t s_CommandsPerFrame = 20'000; // Fits in the 10MB of the old queue
+
+	FROST_BENCHMARK(RenderCommandQueueSingleThreadThroughput)
+	{
+		uint64_t legacySum = 0, sum = 0;
+
+		LegacyRenderCommandQueue legacyQueue;
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_QueueFrameCount; frame++)
+		{
+			for (uint32_t i = 0; i < s_CommandsPerFrame; i++)
+				new (legacyQueue.Allocate(ExecuteBenchmarkCommand, sizeof(BenchmarkCommand))) BenchmarkCommand{ {}, &legacySum };
+			legacyQueue.Execute();
+		}
+		auto end = std::chrono::high_resolution_clock::now();
+		double legacySeconds = std::chrono::duration<double>(end - start).count();
+
+		RenderCommandQueue queue;
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_QueueFrameCount; frame++)
+		{
+			for (uint32_t i = 0; i < s_CommandsPerFrame; i++)
+				new (queue.Allocate(ExecuteBenchmarkCommand, sizeof(BenchmarkCommand), alignof(BenchmarkCommand))) BenchmarkCommand{ {}, &sum };
+			queue.Execute();
+		}
+		end = std::chrono::high_resolution_clock::now();
+		double seconds = std::chrono::duration<double>(end - start).count();
+
+		FROST_CHECK(legacySum == sum);
+
+		double commandCount = double(s_CommandsPerFrame) * s_QueueFrameCount;
+		FROST_CORE_INFO("    Old queue:          {0:.1f} M commands/s", commandCount / legacySeconds / 1'000'000.0);
+		FROST_CORE_INFO("    Chunked queue:      {0:.1f} M commands/s", commandCount / seconds / 1'000'000.0);
+	}
+
+	// Several threads recording a frame's worth of commands, then the owner thread merging and executing them
+	FROST_BENCHMARK(RenderCommandQueueMultiThreadThroughput)
+	{
+		uint32_t threadCount = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+		uint32_t commandsPerThread = s_CommandsPerFrame / threadCount;
+
+		// Execution runs on the owner thread only, so the sums don't need to be atomic
+		uint64_t legacySum = 0, sum = 0;
+
+		LegacyRenderCommandQueue legacyQueue;
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_QueueFrameCount; frame++)
+		{
+			Vector<std::thread> threads;
+			for (uint32_t t = 0; t < threadCount; t++)
+			{
+				threads.emplace_back([&legacyQueue, &legacySum, commandsPerThread]()
+				{
+					for (uint32_t i = 0; i < commandsPerThread; i++)
+					{
+						std::scoped_lock<std::mutex> lock(legacyQueue.GetMutex());
+						new (legacyQueue.Allocate(ExecuteBenchmarkCommand, sizeof(BenchmarkCommand))) BenchmarkCommand{ {}, &legacySum };
+					}
+				});
+			}
+			for (auto& thread : threads)
+				thread.join();
+			legacyQueue.Execute();
+		}
+		auto end = std::chrono::high_resolution_clock::now();
+		double legacySeconds = std::chrono::duration<double>(end - start).count();
+
+		RenderCommandQueue queue;
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_QueueFrameCount; frame++)
+		{
+			Vector<std::thread> threads;
+			for (uint32_t t = 0; t < threadCount; t++)
+			{
+				threads.emplace_back([&queue, &sum, commandsPerThread, t]()
+				{
+					for (uint32_t i = 0; i < commandsPerThread; i++)
+						new (queue.AllocateInLane(t, ExecuteBenchmarkCommand, sizeof(BenchmarkCommand), alignof(BenchmarkCommand))) BenchmarkCommand{ {}, &sum };
+				});
+			}
+			for (auto& thread : threads)
+				thread.join();
+			queue.MergeThreadLanes();
+			queue.Execute();
+		}
+		end = std::chrono::high_resolution_clock::now();
+		double seconds = std::chrono::duration<double>(end - start).count();
+
+		FROST_CHECK(legacySum == sum);
+
+		// Thread creation is included in both measurements
+		double commandCount = double(commandsPerThread) * threadCount * s_QueueFrameCount;
+		FROST_CORE_INFO("    {0} recording threads", threadCount);
+		FROST_CORE_INFO("    Old queue + mutex:  {0:.1f} M commands/s", commandCount / legacySeconds / 1'000'000.0);
+		FROST_CORE_INFO("    Lanes:              {0:.1f} M commands/s", commandCount / seconds / 1'000'000.0);
+	}
+}
@@ -0,0 +1,128 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/EntitySystem/Scene.h"
+#include "Frost/EntitySystem/Entity.h"
+
+#include <chrono>
+
+namespace Frost::Tests
+{
+	static constexpr uint32_t s_HierarchyEntityCount = 10'000;
+	static constexpr uint32_t s_HierarchyFrameCount = 100;
+
+	// Builds `s_HierarchyEntityCount` entities, split into root entities that each own a chain of `depth - 1` descendants
+	static void CreateHierarchy(Scene& scene, uint32_t depth, Vector<Entity>& roots, Vector<Entity>& entities)
+	{
+		entities.reserve(s_HierarchyEntityCount);
+		for (uint32_t i = 0; i < s_HierarchyEntityCount / depth; i++)
+		{
+			Entity parent = scene.CreateEntity();
+			roots.push_back(parent);
+			entities.push_back(parent);
+
+			for (uint32_t j = 1; j < depth; j++)
+			{
+				Entity child = scene.CreateEntity();
+				scene.ParentEntity(parent, child);
+				child.Transform().Translation = glm::vec3(0.0f, 1.0f, 0.0f);
+				child.MarkTransformDirty();
+				entities.push_back(child);
+				parent = child;
+			}
+		}
+		scene.UpdateWorldTransforms();
+	}
+
+	static void RunHierarchyBenchmark(uint32_t depth)
+	{
+		Scene scene("Benchmark", false);
+		Vector<Entity> roots, entities;
+		CreateHierarchy(scene, depth, roots, entities);
+
+		// Previous getter: every query walked up to the root, comparing the TRS snapshot of each ancestor
+		glm::vec3 sum = glm::vec3(0.0f);
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_HierarchyFrameCount; frame++)
+		{
+			for (Entity entity : entities)
+			{
+				bool dirty = false;
+				for (Entity current = entity; current; current = scene.FindEntityByUUID(current.GetParent()))
+				{
+					const auto& worldTransform = current.GetComponent<WorldTransformComponent>();
+					dirty |= worldTransform.IsDirty(current.GetComponent<TransformComponent>(), current.GetParent());
+				}
+				if (!dirty)
+					sum += glm::vec3(entity.GetComponent<WorldTransformComponent>().WorldTransform[3]);
+			}
+		}
+		auto end = std::chrono::high_resolution_clock::now();
+		double ancestorWalkSeconds = std::chrono::duration<double>(end - start).count();
+
+		// Current getter: clean entities return the cached matrix after a local flag check
+		glm::vec3 cachedSum = glm::vec3(0.0f);
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_HierarchyFrameCount; frame++)
+		{
+			for (Entity entity : entities)
+				cachedSum += glm::vec3(scene.GetTransformMatFromEntityAndParent(entity)[3]);
+		}
+		end = std::chrono::high_resolution_clock::now();
+		double cleanQuerySeconds = std::chrono::duration<double>(end - start).count();
+		FROST_CHECK(sum == cachedSum);
+
+		// Moving every root each frame, then flushing with the per frame top-down pass
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_HierarchyFrameCount; frame++)
+		{
+			for (Entity root : roots)
+			{
+				root.Transform().Translation.x += 1.0f;
+				root.MarkTransformDirty();
+			}
+			scene.UpdateWorldTransforms();
+		}
+		end = std::chrono::high_resolution_clock::now();
+		double frameUpdateSeconds = std::chrono::duration<double>(end - start).count();
+
+		// Moving every root each frame, then querying the leaves before the per frame pass ran
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_HierarchyFrameCount; frame++)
+		{
+			for (Entity root : roots)
+			{
+				root.Transform().Translation.x += 1.0f;
+				root.MarkTransformDirty();
+			}
+			for (Entity entity : entities)
+				scene.GetTransformMatFromEntityAndParent(entity);
+		}
+		end = std::chrono::high_resolution_clock::now();
+		double lazyQuerySeconds = std::chrono::duration<double>(end - start).count();
+
+		// Every root moved by one unit per frame, every child sits one unit above its parent
+		glm::vec3 expectedLeaf = glm::vec3(2.0f * s_HierarchyFrameCount, float(depth - 1), 0.0f);
+		glm::vec3 leaf = glm::vec3(scene.GetTransformMatFromEntityAndParent(entities[depth - 1])[3]);
+		FROST_CHECK(glm::all(glm::lessThan(glm::abs(leaf - expectedLeaf), glm::vec3(0.01f))));
+
+		double queryCount = double(entities.size()) * s_HierarchyFrameCount;
+		FROST_CORE_INFO("    {0} roots, depth {1}", roots.size(), depth);
+		FROST_CORE_INFO("    Ancestor walk query: {0:.1f} M queries/s", queryCount / ancestorWalkSeconds / 1'000'000.0);
+		FROST_CORE_INFO("    Clean query:         {0:.1f} M queries/s", queryCount / cleanQuerySeconds / 1'000'000.0);
+		FROST_CORE_INFO("    Move roots + frame update:  {0:.3f} ms/frame", frameUpdateSeconds * 1000.0 / s_HierarchyFrameCount);
+		FROST_CORE_INFO("    Move roots + lazy queries:  {0:.3f} ms/frame", lazyQuerySeconds * 1000.0 / s_HierarchyFrameCount);
+	}
+
+	// 10k entities as 100 chains of 100 entities
+	FROST_BENCHMARK(SceneHierarchyDeepTransforms)
+	{
+		RunHierarchyBenchmark(100);
+	}
+
+	// 10k entities as 2.5k chains of 4 entities, closer to a typical prefab hierarchy
+	FROST_BENCHMARK(SceneHierarchyShallowTransforms)
+	{
+		RunHierarchyBenchmark(4);
+	}
+}
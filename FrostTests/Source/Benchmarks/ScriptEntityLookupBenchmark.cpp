@@ -0,0 +1,67 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/EntitySystem/Scene.h"
+#include "Frost/EntitySystem/Entity.h"
+#include "Frost/Script/ScriptEngine.h"
+#include "Frost/Script/ScriptInternalWrappers.h"
+
+#include <chrono>
+
+namespace Frost::Tests
+{
+	// Native side of the transform internal calls, for a scene of 10k entities without rigid bodies.
+	// The managed -> native transition isn't included (that needs a mono domain), so this measures only what the cached handle saves
+	FROST_BENCHMARK(ScriptTransformInternalCallThroughput)
+	{
+		static constexpr uint32_t s_EntityCount = 10'000;
+		static constexpr uint32_t s_FrameCount = 100;
+
+		Scene scene("Benchmark", false);
+		Scene* previousSceneContext = ScriptEngine::GetCurrentSceneContext();
+		ScriptEngine::SetSceneContext(&scene);
+
+		Vector<ScriptEntityHandle> entityHandles;
+		entityHandles.reserve(s_EntityCount);
+		for (uint32_t i = 0; i < s_EntityCount; i++)
+		{
+			Entity entity = scene.CreateEntity();
+			entityHandles.push_back({ entity.GetUUID(), 0, UINT32_MAX });
+		}
+
+		glm::vec3 translation = glm::vec3(1.0f, 2.0f, 3.0f);
+
+		// Previous path: every call resolved the UUID through the scene's entity map
+		auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_FrameCount; frame++)
+		{
+			for (const ScriptEntityHandle& entityHandle : entityHandles)
+			{
+				const auto& entityMap = scene.GetEntityMap();
+				Entity entity = entityMap.at(entityHandle.ID);
+				entity.GetComponent<TransformComponent>().Translation = translation;
+			}
+		}
+		auto end = std::chrono::high_resolution_clock::now();
+		double uuidLookupSeconds = std::chrono::duration<double>(end - start).count();
+
+		// Current path: the entt handle cached on the managed entity, validated by the scene's entity generation
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_FrameCount; frame++)
+		{
+			for (ScriptEntityHandle& entityHandle : entityHandles)
+				ScriptInternalCalls::Components::Transform::SetTranslation(&entityHandle, &translation);
+		}
+		end = std::chrono::high_resolution_clock::now();
+		double cachedHandleSeconds = std::chrono::duration<double>(end - start).count();
+
+		for (const ScriptEntityHandle& entityHandle : entityHandles)
+			FROST_CHECK(scene.GetEntityMap().at(entityHandle.ID).GetComponent<TransformComponent>().Translation == translation);
+
+		double callCount = double(s_EntityCount) * s_FrameCount;
+		FROST_CORE_INFO("    UUID lookup:   {0:.1f} M calls/s", callCount / uuidLookupSeconds / 1'000'000.0);
+		FROST_CORE_INFO("    Cached handle: {0:.1f} M calls/s", callCount / cachedHandleSeconds / 1'000'000.0);
+
+		ScriptEngine::SetSceneContext(previousSceneContext);
+	}
+}
@@ -0,0 +1,77 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/EntitySystem/Scene.h"
+#include "Frost/EntitySystem/Entity.h"
+#include "Frost/Script/ScriptEngine.h"
+
+#include <chrono>
+#include <filesystem>
+
+namespace Frost::Tests
+{
+	// The mono runtime and the core assembly are next to the editor, and the sandbox scripts have to be built first
+	static constexpr const char* s_EditorDirectory = "../FrostEditor";
+	static constexpr const char* s_CoreAssemblyPath = "Resources/Scripts/FrostScriptCore.dll";
+	static constexpr const char* s_AppAssemblyPath = "SandboxProject/Assets/Scripts/Binaries/Sandbox.dll";
+
+	// `Frost.FogController` has an empty `OnUpdate`, so only the cost of dispatching the calls is measured
+	static constexpr const char* s_ScriptModuleName = "Frost.FogController";
+
+	// `ScriptEngine::OnUpdateEntities` for 1k and 10k scripted entities (a single call into the managed dispatcher per frame)
+	FROST_BENCHMARK(ScriptOnUpdateEntities)
+	{
+		static constexpr uint32_t s_FrameCount = 100;
+
+		std::filesystem::path previousDirectory = std::filesystem::current_path();
+		if (std::filesystem::exists(s_EditorDirectory))
+			std::filesystem::current_path(s_EditorDirectory);
+
+		if (!std::filesystem::exists(s_CoreAssemblyPath) || !std::filesystem::exists(s_AppAssemblyPath))
+		{
+			FROST_CORE_WARN("    Skipped, the script assemblies were not found in '{0}'", std::filesystem::current_path().string());
+			std::filesystem::current_path(previousDirectory);
+			return;
+		}
+
+		ScriptEngine::Init(s_CoreAssemblyPath);
+		ScriptEngine::LoadAppAssembly(s_AppAssemblyPath);
+		Scene* previousSceneContext = ScriptEngine::GetCurrentSceneContext();
+
+		for (uint32_t entityCount : { 1'000u, 10'000u })
+		{
+			Scene scene("Benchmark");
+			ScriptEngine::SetSceneContext(&scene);
+
+			// Adding the component initializes the script class (through the scene's construct hook), instantiating it is what `Scene::OnRuntimeStart` does
+			Vector<Entity> entities;
+			entities.reserve(entityCount);
+			for (uint32_t i = 0; i < entityCount; i++)
+			{
+				Entity entity = scene.CreateEntity();
+				entity.AddComponent<ScriptComponent>(s_ScriptModuleName);
+				entities.push_back(entity);
+			}
+			for (Entity entity : entities)
+				ScriptEngine::InstantiateEntityClass(entity);
+
+			// The first update allocates the dispatcher's array
+			ScriptEngine::OnUpdateEntities(&scene, Timestep(1.0f / 60.0f));
+
+			auto start = std::chrono::high_resolution_clock::now();
+			for (uint32_t frame = 0; frame < s_FrameCount; frame++)
+				ScriptEngine::OnUpdateEntities(&scene, Timestep(1.0f / 60.0f));
+			auto end = std::chrono::high_resolution_clock::now();
+			double seconds = std::chrono::duration<double>(end - start).count() / s_FrameCount;
+
+			FROST_CHECK(ScriptEngine::GetEntityInstanceMap().at(scene.GetUUID()).size() == entityCount);
+			FROST_CORE_INFO("    {0} entities: {1:.3f} ms per frame ({2:.1f} ns per entity)", entityCount, seconds * 1000.0, seconds * 1'000'000'000.0 / entityCount);
+
+			ScriptEngine::ShutdownScene(&scene);
+		}
+
+		ScriptEngine::SetSceneContext(previousSceneContext);
+		ScriptEngine::ShutDown();
+		std::filesystem::current_path(previousDirectory);
+	}
+}
@@ -0,0 +1,77 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Renderer/TestTextFont.h"
+
+#include <chrono>
+
+namespace Frost::Tests
+{
+	// 10k labels laid out every frame: the first (cold) frame, a warm frame where every layout is cached,
+	// and frames where 10% of the labels change their text (like counters or timers)
+	FROST_BENCHMARK(TextLayoutCache10kLabels)
+	{
+		static constexpr uint32_t s_LabelCount = 10'000;
+		static constexpr uint32_t s_FrameCount = 20;
+		static constexpr uint32_t s_MaxCachedLayouts = 4096 * 4;
+
+		Ref<TestTextFont> font = Ref<TestTextFont>::Create();
+
+		Vector<std::string> labels;
+		labels.reserve(s_LabelCount);
+		for (uint32_t i = 0; i < s_LabelCount; i++)
+			labels.push_back("Label " + std::to_string(i) + " - Health: " + std::to_string(i % 100));
+
+		TextLayoutCache cache;
+		uint64_t quadCount = 0;
+
+		auto layoutFrame = [&]()
+		{
+			cache.BeginFrame();
+			for (const std::string& label : labels)
+				quadCount += cache.GetTextLayout(label, font, 8.0f, 0.0f, 0.0f).Quads.size();
+			cache.EvictLayouts(s_MaxCachedLayouts);
+		};
+
+		auto start = std::chrono::high_resolution_clock::now();
+		layoutFrame();
+		auto end = std::chrono::high_resolution_clock::now();
+		double coldSeconds = std::chrono::duration<double>(end - start).count();
+		FROST_CHECK(cache.GetStats().CacheMisses == s_LabelCount);
+
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_FrameCount; frame++)
+			layoutFrame();
+		end = std::chrono::high_resolution_clock::now();
+		double warmSeconds = std::chrono::duration<double>(end - start).count() / s_FrameCount;
+		FROST_CHECK(cache.GetStats().CacheHits == s_LabelCount);
+
+		start = std::chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < s_FrameCount; frame++)
+		{
+			for (uint32_t i = frame % 10; i < s_LabelCount; i += 10)
+				labels[i] = "Label " + std::to_string(i) + " - Health: " + std::to_string(frame);
+			layoutFrame();
+		}
+		end = std::chrono::high_resolution_clock::now();
+		double changingSeconds = std::chrono::duration<double>(end - start).count() / s_FrameCount;
+
+		// No caching at all, for reference
+		Vector<TextGlyphQuad> quads;
+		start = std::chrono::high_resolution_clock::now();
+		for (const std::string& label : labels)
+		{
+			LayoutText(*font, label, 8.0f, 0.0f, 0.0f, quads);
+			quadCount += quads.size();
+		}
+		end = std::chrono::high_resolution_clock::now();
+		double uncachedSeconds = std::chrono::duration<double>(end - start).count();
+
+		FROST_CHECK(quadCount > 0);
+		FROST_CORE_INFO("    {0} labels, {1} cached layouts", s_LabelCount, cache.GetCachedLayoutCount());
+		FROST_CORE_INFO("    Uncached:           {0:.3f} ms per frame", uncachedSeconds * 1000.0);
+		FROST_CORE_INFO("    Cold cache:         {0:.3f} ms", coldSeconds * 1000.0);
+		FROST_CORE_INFO("    Warm cache:         {0:.3f} ms per frame", warmSeconds * 1000.0);
+		FROST_CORE_INFO("    10% changing texts: {0:.3f} ms per frame", changingSeconds * 1000.0);
+	}
+}
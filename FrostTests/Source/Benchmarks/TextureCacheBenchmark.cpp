@@ -0,0 +1,78 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Renderer/TextureCache.h"
+
+#include <chrono>
+#include <filesystem>
+
+namespace Frost::Tests
+{
+	// Texture of the sandbox project (the tests run from their project directory)
+	static constexpr const char* s_SourceTexturePath = "../FrostEditor/SandboxProject/Assets/Textures/fields.jpg";
+
+	// Loading a BC compressed texture the first time (hashing the source, generating the mips, compressing and writing the entry)
+	// against every other time (hashing the source and reading the entry back)
+	FROST_BENCHMARK(TextureCacheColdVsWarmLoad)
+	{
+		static constexpr uint32_t s_WarmLoadCount = 20;
+
+		if (!std::filesystem::exists(s_SourceTexturePath))
+		{
+			FROST_CORE_WARN("    Skipped, the texture '{0}' was not found", s_SourceTexturePath);
+			return;
+		}
+
+		// A directory of its own, so the project's cache isn't needed (nor touched)
+		std::filesystem::path cacheDirectory = std::filesystem::temp_directory_path() / "FrostTextureCacheBenchmark";
+		std::filesystem::create_directories(cacheDirectory);
+
+		for (ImageFormat format : { ImageFormat::RGBA_BC1, ImageFormat::BC3 })
+		{
+			TextureCompressionSettings settings{};
+			settings.Format = format;
+
+			auto start = std::chrono::high_resolution_clock::now();
+			uint64_t cacheKey = TextureCache::GetCacheKey(s_SourceTexturePath, settings);
+			std::filesystem::path cacheFilepath = cacheDirectory / (std::to_string(cacheKey) + ".ftc");
+
+			CompressedTextureData compressedData;
+			bool isCompressed = TextureCache::Compress(s_SourceTexturePath, settings, compressedData);
+			FROST_CHECK(isCompressed);
+			if (!isCompressed)
+				continue;
+
+			FROST_CHECK(TextureCache::StoreEntry(cacheFilepath, cacheKey, compressedData));
+			auto end = std::chrono::high_resolution_clock::now();
+			double coldSeconds = std::chrono::duration<double>(end - start).count();
+
+			start = std::chrono::high_resolution_clock::now();
+			for (uint32_t i = 0; i < s_WarmLoadCount; i++)
+			{
+				CompressedTextureData cachedData;
+				uint64_t warmCacheKey = TextureCache::GetCacheKey(s_SourceTexturePath, settings);
+				FROST_CHECK(TextureCache::LoadEntry(cacheFilepath, warmCacheKey, cachedData));
+
+				// The cached entry has to be exactly what was compressed
+				FROST_CHECK(cachedData.Data.Size == compressedData.Data.Size);
+				FROST_CHECK(cachedData.MipCount == compressedData.MipCount);
+				if (cachedData.Data.Size == compressedData.Data.Size)
+					FROST_CHECK(memcmp(cachedData.Data.Data, compressedData.Data.Data, compressedData.Data.Size) == 0);
+
+				free(cachedData.Data.Data);
+			}
+			end = std::chrono::high_resolution_clock::now();
+			double warmSeconds = std::chrono::duration<double>(end - start).count() / s_WarmLoadCount;
+
+			FROST_CORE_INFO("    {0}x{1} {2}, {3} mips, {4} KB", compressedData.Width, compressedData.Height,
+				format == ImageFormat::BC3 ? "BC3" : "BC1", compressedData.MipCount, compressedData.Data.Size / 1024);
+			FROST_CORE_INFO("        Cold (compress + store): {0:.3f} ms", coldSeconds * 1000.0);
+			FROST_CORE_INFO("        Warm (cached entry):     {0:.3f} ms ({1:.1f}x faster)", warmSeconds * 1000.0, coldSeconds / warmSeconds);
+
+			free(compressedData.Data.Data);
+		}
+
+		std::error_code errorCode;
+		std::filesystem::remove_all(cacheDirectory, errorCode);
+	}
+}
@@ -0,0 +1,140 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Core/JobSystem.h"
+
+#include <thread>
+
+namespace Frost::Tests
+{
+	FROST_TEST(JobSystemRunsInlineWithoutInit)
+	{
+		FROST_CHECK(!JobSystem::IsInitialized());
+
+		uint32_t value = 0;
+		JobCounter counter;
+		JobSystem::Execute([&value]() { value = 1; }, &counter);
+		FROST_CHECK(value == 1);
+		FROST_CHECK(counter.IsDone());
+		JobSystem::Wait(counter);
+	}
+
+	FROST_TEST(ParallelForVisitsEveryIndexOnce)
+	{
+		JobSystem::Init(4);
+
+		static constexpr uint32_t s_Count = 10'007; // Not a multiple of any batch size
+		for (uint32_t batchSize : { 0u, 1u, 7u, 1000u, s_Count * 2 })
+		{
+			Vector<std::atomic<uint32_t>> visits(s_Count);
+			JobSystem::ParallelFor(s_Count, [&visits](uint32_t index) { visits[index]++; }, batchSize);
+
+			bool visitedOnce = true;
+			for (const auto& visitCount : visits)
+				visitedOnce &= visitCount == 1;
+			FROST_CHECK(visitedOnce);
+		}
+
+		// Nothing to do is not an error
+		uint32_t callCount = 0;
+		JobSystem::ParallelFor(0, [&callCount](uint32_t) { callCount++; });
+		FROST_CHECK(callCount == 0);
+
+		JobSystem::ShutDown();
+	}
+
+	FROST_TEST(JobCounterDependenciesAreRespected)
+	{
+		JobSystem::Init(4);
+
+		static constexpr uint32_t s_Count = 4096;
+		Vector<uint32_t> values(s_Count, 0);
+
+		// Three stages over the same data, each one waiting for the previous one
+		JobCounter fillCounter, doubleCounter, checkCounter;
+		JobSystem::ParallelForAsync(s_Count, [&values](uint32_t index)
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(index % 64 == 0 ? 200 : 0));
+			values[index] = index;
+		}, fillCounter, 64);
+		JobSystem::ParallelForAsync(s_Count, [&values](uint32_t index) { values[index] *= 2; }, doubleCounter, 64, &fillCounter);
+
+		std::atomic<uint32_t> wrongValues = 0;
+		JobSystem::ParallelForAsync(s_Count, [&values, &wrongValues](uint32_t index)
+		{
+			if (values[index] != index * 2)
+				wrongValues++;
+		}, checkCounter, 64, &doubleCounter);
+
+		JobSystem::Wait(checkCounter);
+		FROST_CHECK(fillCounter.IsDone() && doubleCounter.IsDone());
+		FROST_CHECK(wrongValues == 0);
+
+		JobSystem::ShutDown();
+	}
+
+	FROST_TEST(WaitHelpsWithoutWorkers)
+	{
+		JobSystem::Init(0);
+		FROST_CHECK(JobSystem::GetWorkerCount() == 0);
+
+		std::thread::id mainThreadID = std::this_thread::get_id();
+		std::atomic<uint32_t> executedCount = 0;
+		std::atomic<uint32_t> otherThreadCount = 0;
+
+		// The jobs are queued (not executed inline), so only the waiting thread can run them
+		JobCounter firstCounter, secondCounter;
+		for (uint32_t i = 0; i < 100; i++)
+		{
+			JobSystem::Execute([&]()
+			{
+				executedCount++;
+				otherThreadCount += std::this_thread::get_id() != mainThreadID;
+			}, &firstCounter);
+		}
+		FROST_CHECK(firstCounter.GetValue() == 100);
+
+		// Queued after the jobs it depends on, but popped first (the owner thread takes the newest job)
+		bool dependencyDone = false;
+		JobSystem::Execute([&]() { dependencyDone = firstCounter.IsDone(); }, &secondCounter, &firstCounter);
+
+		JobSystem::Wait(secondCounter);
+		FROST_CHECK(executedCount == 100);
+		FROST_CHECK(otherThreadCount == 0);
+		FROST_CHECK(dependencyDone);
+
+		JobSystem::ShutDown();
+	}
+
+	FROST_TEST(IdleWorkersStealJobs)
+	{
+		JobSystem::Init(3);
+
+		// Every job is pushed into the queue of a single worker, so the other workers can only get them by stealing
+		static constexpr uint32_t s_JobCount = 64;
+		std::atomic<uint32_t> threadMask = 0;
+		JobCounter spawnCounter, counter;
+		JobSystem::Execute([&]()
+		{
+			for (uint32_t i = 0; i < s_JobCount; i++)
+			{
+				JobSystem::Execute([&]()
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+					threadMask |= 1u << JobSystem::GetThreadIndex();
+				}, &counter);
+			}
+		}, &spawnCounter);
+
+		JobSystem::Wait(spawnCounter);
+		JobSystem::Wait(counter);
+
+		// At least two threads ran the jobs spawned by one worker
+		uint32_t threadCount = 0;
+		for (uint32_t mask = threadMask; mask != 0; mask &= mask - 1)
+			threadCount++;
+		FROST_CHECK(threadCount >= 2);
+
+		JobSystem::ShutDown();
+	}
+}
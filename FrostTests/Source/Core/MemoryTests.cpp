@@ -0,0 +1,128 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+namespace Frost::Tests
+{
+	namespace
+	{
+		struct IntrusiveObject : public RefCounted
+		{
+			int Value = 1;
+		};
+
+		struct HeapCountedObject
+		{
+			int Value = 2;
+		};
+	}
+
+	FROST_TEST(RefSharesIntrusiveCounter)
+	{
+		Ref<IntrusiveObject> ref = Ref<IntrusiveObject>::Create();
+		Ref<IntrusiveObject> copy = ref;
+		FROST_CHECK(ref.GetRefCount() == 2);
+
+		// Rebuilding a `Ref` from the raw pointer shares the counter stored in the object
+		Ref<IntrusiveObject> fromRaw = Ref<IntrusiveObject>(ref.Raw());
+		FROST_CHECK(ref.GetRefCount() == 3);
+
+		copy.Reset();
+		FROST_CHECK(ref.GetRefCount() == 2);
+	}
+
+	FROST_TEST(RefSelfAssignmentKeepsInstance)
+	{
+		Ref<HeapCountedObject> ref = Ref<HeapCountedObject>::Create();
+		Ref<HeapCountedObject>& alias = ref;
+		ref = alias;
+		FROST_CHECK(ref.GetRefCount() == 1);
+		FROST_CHECK(ref->Value == 2);
+	}
+
+	FROST_TEST(WeakRefExpiresWithInstance)
+	{
+		WeakRef<IntrusiveObject> intrusiveWeak;
+		WeakRef<HeapCountedObject> heapWeak;
+		{
+			Ref<IntrusiveObject> intrusive = Ref<IntrusiveObject>::Create();
+			Ref<HeapCountedObject> heap = Ref<HeapCountedObject>::Create();
+			intrusiveWeak = intrusive;
+			heapWeak = heap;
+
+			WeakRef<IntrusiveObject> copy = intrusiveWeak;
+			FROST_CHECK(copy.IsValid());
+			FROST_CHECK(intrusiveWeak.AsRef<IntrusiveObject>()->Value == 1);
+			FROST_CHECK(heapWeak.IsValid());
+
+			// Weak refs don't keep the instance alive
+			FROST_CHECK(intrusive.GetRefCount() == 1);
+		}
+
+		FROST_CHECK(!intrusiveWeak.IsValid());
+		FROST_CHECK(!heapWeak.IsValid());
+		FROST_CHECK(!intrusiveWeak.AsRef<IntrusiveObject>());
+	}
+
+	FROST_TEST(WeakRefReassignment)
+	{
+		Ref<IntrusiveObject> first = Ref<IntrusiveObject>::Create();
+		Ref<IntrusiveObject> second = Ref<IntrusiveObject>::Create();
+
+		WeakRef<IntrusiveObject> weak = first;
+		weak = first;
+		weak = second;
+		first.Reset();
+		FROST_CHECK(weak.IsValid());
+
+		weak = nullptr;
+		FROST_CHECK(!weak.IsValid());
+	}
+
+	FROST_TEST(WeakRefUpgradeRacesWithLastRelease)
+	{
+		// Other threads keep upgrading weak refs while the last strong ref is released.
+		// An upgrade must either keep the instance alive or return null, never a destroyed instance
+		constexpr uint32_t iterationCount = 2000;
+		constexpr uint32_t threadCount = 4;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; iteration++)
+		{
+			Ref<IntrusiveObject> intrusive = Ref<IntrusiveObject>::Create();
+			Ref<HeapCountedObject> heap = Ref<HeapCountedObject>::Create();
+			WeakRef<IntrusiveObject> intrusiveWeak = intrusive;
+			WeakRef<HeapCountedObject> heapWeak = heap;
+
+			std::atomic<uint32_t> startedThreads = 0;
+			std::atomic<bool> invalidValue = false;
+
+			Vector<std::thread> threads;
+			for (uint32_t i = 0; i < threadCount; i++)
+			{
+				threads.emplace_back([&]()
+				{
+					startedThreads.fetch_add(1);
+					for (uint32_t j = 0; j < 64; j++)
+					{
+						if (Ref<IntrusiveObject> upgraded = intrusiveWeak.AsRef<IntrusiveObject>(); upgraded && upgraded->Value != 1)
+							invalidValue = true;
+						if (Ref<HeapCountedObject> upgraded = heapWeak.AsRef<HeapCountedObject>(); upgraded && upgraded->Value != 2)
+							invalidValue = true;
+					}
+				});
+			}
+
+			while (startedThreads.load() < threadCount)
+				std::this_thread::yield();
+
+			intrusive.Reset();
+			heap.Reset();
+
+			for (auto& thread : threads)
+				thread.join();
+
+			FROST_CHECK(!invalidValue);
+			FROST_CHECK(!intrusiveWeak.AsRef<IntrusiveObject>());
+			FROST_CHECK(!heapWeak.AsRef<HeapCountedObject>());
+		}
+	}
+}
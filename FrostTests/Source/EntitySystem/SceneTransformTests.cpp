@@ -0,0 +1,81 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/EntitySystem/Scene.h"
+#include "Frost/EntitySystem/Entity.h"
+
+namespace Frost::Tests
+{
+	static glm::vec3 GetWorldTranslation(Scene& scene, Entity entity)
+	{
+		return glm::vec3(scene.GetTransformMatFromEntityAndParent(entity)[3]);
+	}
+
+	static bool IsNear(const glm::vec3& a, const glm::vec3& b)
+	{
+		return glm::all(glm::lessThan(glm::abs(a - b), glm::vec3(0.0001f)));
+	}
+
+	FROST_TEST(WorldTransformFollowsMarkedAncestors)
+	{
+		Scene scene("Test", false);
+		Entity root = scene.CreateEntity("Root");
+		Entity child = scene.CreateEntity("Child");
+		Entity grandChild = scene.CreateEntity("GrandChild");
+		scene.ParentEntity(root, child);
+		scene.ParentEntity(child, grandChild);
+		scene.UpdateWorldTransforms();
+
+		FROST_CHECK(IsNear(GetWorldTranslation(scene, grandChild), glm::vec3(0.0f)));
+
+		// Marked writes are visible right away, without waiting for the per frame update
+		root.Transform().Translation = glm::vec3(1.0f, 2.0f, 3.0f);
+		root.MarkTransformDirty();
+		FROST_CHECK(scene.GetRegistry().get<WorldTransformComponent>(grandChild).Dirty);
+		FROST_CHECK(IsNear(GetWorldTranslation(scene, grandChild), glm::vec3(1.0f, 2.0f, 3.0f)));
+
+		// Rebuilding from the grandchild cleaned its dirty ancestors as well
+		FROST_CHECK(!scene.GetRegistry().get<WorldTransformComponent>(root).Dirty);
+		FROST_CHECK(!scene.GetRegistry().get<WorldTransformComponent>(child).Dirty);
+
+		child.Transform().Translation = glm::vec3(0.0f, 1.0f, 0.0f);
+		child.MarkTransformDirty();
+		FROST_CHECK(IsNear(GetWorldTranslation(scene, child), glm::vec3(1.0f, 3.0f, 3.0f)));
+		FROST_CHECK(IsNear(GetWorldTranslation(scene, grandChild), glm::vec3(1.0f, 3.0f, 3.0f)));
+		FROST_CHECK(IsNear(GetWorldTranslation(scene, root), glm::vec3(1.0f, 2.0f, 3.0f)));
+	}
+
+	FROST_TEST(WorldTransformCatchesUnmarkedWritesOncePerFrame)
+	{
+		Scene scene("Test", false);
+		Entity root = scene.CreateEntity("Root");
+		Entity child = scene.CreateEntity("Child");
+		scene.ParentEntity(root, child);
+		scene.UpdateWorldTransforms();
+
+		root.Transform().Translation = glm::vec3(5.0f, 0.0f, 0.0f);
+		scene.UpdateWorldTransforms();
+		FROST_CHECK(IsNear(GetWorldTranslation(scene, child), glm::vec3(5.0f, 0.0f, 0.0f)));
+	}
+
+	FROST_TEST(WorldTransformKeptWhenReparenting)
+	{
+		Scene scene("Test", false);
+		Entity parent = scene.CreateEntity("Parent");
+		Entity child = scene.CreateEntity("Child");
+		parent.Transform().Translation = glm::vec3(10.0f, 0.0f, 0.0f);
+		child.Transform().Translation = glm::vec3(12.0f, 0.0f, 0.0f);
+		scene.UpdateWorldTransforms();
+
+		scene.ParentEntity(parent, child);
+		FROST_CHECK(IsNear(child.Transform().Translation, glm::vec3(2.0f, 0.0f, 0.0f)));
+		FROST_CHECK(IsNear(GetWorldTranslation(scene, child), glm::vec3(12.0f, 0.0f, 0.0f)));
+
+		parent.Transform().Translation = glm::vec3(0.0f);
+		parent.MarkTransformDirty();
+		FROST_CHECK(IsNear(GetWorldTranslation(scene, child), glm::vec3(2.0f, 0.0f, 0.0f)));
+
+		scene.UnparentEntity(child);
+		FROST_CHECK(IsNear(GetWorldTranslation(scene, child), glm::vec3(2.0f, 0.0f, 0.0f)));
+	}
+}
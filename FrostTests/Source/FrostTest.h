@@ -0,0 +1,39 @@
+#pragma once
+
+// Minimal test harness for the CPU side of the engine (no GPU/window is created).
+// Tests are registered statically and run by `Main.cpp`; benchmarks only run when `--benchmarks` is passed
+namespace Frost::Tests
+{
+	using TestFunction = void(*)();
+
+	struct TestCase
+	{
+		const char* Name;
+		TestFunction Function;
+		bool IsBenchmark;
+	};
+
+	Vector<TestCase>& GetTestCases();
+	void ReportFailure(const char* file, int line, const char* expression);
+
+	struct TestRegistrar
+	{
+		TestRegistrar(const char* name, TestFunction function, bool isBenchmark)
+		{
+			GetTestCases().push_back({ name, function, isBenchmark });
+		}
+	};
+}
+
+#define FROST_TEST(name) \
+	static void name(); \
+	static ::Frost::Tests::TestRegistrar name##_Registrar(#name, &name, false); \
+	static void name()
+
+#define FROST_BENCHMARK(name) \
+	static void name(); \
+	static ::Frost::Tests::TestRegistrar name##_Registrar(#name, &name, true); \
+	static void name()
+
+#define FROST_CHECK(expression) \
+	do { if (!(expression)) ::Frost::Tests::ReportFailure(__FILE__, __LINE__, #expression); } while (false)
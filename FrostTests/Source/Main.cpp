@@ -0,0 +1,59 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include <chrono>
+
+namespace Frost::Tests
+{
+	static uint32_t s_FailureCount = 0;
+
+	Vector<TestCase>& GetTestCases()
+	{
+		// Function-local static, so the registrars of every translation unit can use it during static initialization
+		static Vector<TestCase> s_TestCases;
+		return s_TestCases;
+	}
+
+	void ReportFailure(const char* file, int line, const char* expression)
+	{
+		FROST_CORE_ERROR("    {0}({1}): FROST_CHECK({2}) failed", file, line, expression);
+		s_FailureCount++;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace Frost::Tests;
+
+	Frost::Log::Init();
+
+	bool runBenchmarks = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::string(argv[i]) == "--benchmarks")
+			runBenchmarks = true;
+	}
+
+	uint32_t failedTests = 0;
+	for (const TestCase& testCase : GetTestCases())
+	{
+		if (testCase.IsBenchmark && !runBenchmarks)
+			continue;
+
+		uint32_t previousFailureCount = s_FailureCount;
+
+		auto start = std::chrono::high_resolution_clock::now();
+		testCase.Function();
+		auto end = std::chrono::high_resolution_clock::now();
+
+		double milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+		bool passed = s_FailureCount == previousFailureCount;
+		if (!passed)
+			failedTests++;
+
+		FROST_CORE_INFO("[{0}] {1} ({2:.3f} ms)", passed ? "PASSED" : "FAILED", testCase.Name, milliseconds);
+	}
+
+	FROST_CORE_INFO("{0} test(s) failed", failedTests);
+	return failedTests == 0 ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Math/FrustumCulling.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+
+namespace Frost::Tests
+{
+	static Math::ViewFrustum CreateTestFrustum()
+	{
+		glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+		glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(10.0f, 3.0f, 20.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		return Math::ViewFrustum::FromViewProjection(projection * view);
+	}
+
+	static void FillRandomBounds(Math::CullingBounds& bounds, uint32_t count, uint32_t seed)
+	{
+		std::mt19937 random(seed);
+		std::uniform_real_distribution<float> position(-300.0f, 300.0f);
+		std::uniform_real_distribution<float> extent(0.1f, 5.0f);
+
+		bounds.Clear();
+		for (uint32_t i = 0; i < count; i++)
+			bounds.Add({ position(random), position(random) * 0.1f, position(random) }, { extent(random), extent(random), extent(random) });
+	}
+
+	// Culls [start, start + count) with both paths and compares every box with `IsBoxVisible`
+	static void CheckRangeMatchesScalar(const Math::ViewFrustum& frustum, const Math::CullingBounds& bounds, uint32_t start, uint32_t count)
+	{
+		uint32_t wordCount = (count + 63) / 64;
+		Vector<uint64_t> simdMask(wordCount + 1, ~0ull);
+		Vector<uint64_t> scalarMask(wordCount + 1, ~0ull);
+		Math::FrustumCull(frustum, bounds, start, count, simdMask.data());
+		Math::FrustumCullScalar(frustum, bounds, start, count, scalarMask.data());
+
+		for (uint32_t i = 0; i < wordCount; i++)
+			FROST_CHECK(simdMask[i] == scalarMask[i]);
+
+		// Nothing after the range is written (or reported as visible)
+		FROST_CHECK(simdMask[wordCount] == ~0ull);
+		if (count % 64 != 0)
+			FROST_CHECK((simdMask[wordCount - 1] >> (count % 64)) == 0);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			glm::vec3 center = bounds.GetCenter(start + i);
+			glm::vec3 extents = bounds.GetExtents(start + i);
+			FROST_CHECK(Math::IsVisible(simdMask, i) == frustum.IsBoxVisible(center - extents, center + extents));
+		}
+	}
+
+	FROST_TEST(FrustumCullSIMDMatchesScalar)
+	{
+		Math::ViewFrustum frustum = CreateTestFrustum();
+
+		Math::CullingBounds bounds;
+		FillRandomBounds(bounds, 10'003, 1); // Not a multiple of the batch size
+		CheckRangeMatchesScalar(frustum, bounds, 0, bounds.GetCount());
+
+		// Sub ranges, as they are split between threads
+		CheckRangeMatchesScalar(frustum, bounds, 64, 100);
+		CheckRangeMatchesScalar(frustum, bounds, 640, 5);
+		CheckRangeMatchesScalar(frustum, bounds, 9984, bounds.GetCount() - 9984);
+		CheckRangeMatchesScalar(frustum, bounds, 128, 0);
+	}
+
+	FROST_TEST(FrustumCullBoxesTouchingThePlanes)
+	{
+		// Boxes exactly touching a plane are visible, boxes just outside of it are not (in both paths)
+		Math::ViewFrustum frustum = Math::ViewFrustum::FromBounds({ -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f });
+
+		Math::CullingBounds bounds;
+		bounds.Add({ 2.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });   // Touches +X
+		bounds.Add({ 0.0f, -3.0f, 0.0f }, { 1.0f, 2.0f, 1.0f });  // Touches -Y
+		bounds.Add({ 0.0f, 0.0f, 2.5f }, { 1.0f, 1.0f, 1.0f });   // Outside +Z
+		bounds.Add({ -2.25f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }); // Outside -X
+		bounds.Add({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f });   // Point inside
+		bounds.Add({ 0.0f, 0.0f, 0.0f }, { 9.0f, 9.0f, 9.0f });   // Encloses the frustum
+
+		Vector<uint64_t> simdMask;
+		Math::FrustumCull(frustum, bounds, simdMask);
+		FROST_CHECK(simdMask.size() == 1);
+		FROST_CHECK(simdMask[0] == 0b110011);
+
+		Vector<uint64_t> scalarMask(1);
+		Math::FrustumCullScalar(frustum, bounds, 0, bounds.GetCount(), scalarMask.data());
+		FROST_CHECK(scalarMask[0] == simdMask[0]);
+	}
+
+	FROST_TEST(FrustumCullEmptyBounds)
+	{
+		Math::CullingBounds bounds;
+		Vector<uint64_t> mask(4, ~0ull);
+		Math::FrustumCull(CreateTestFrustum(), bounds, mask);
+		FROST_CHECK(mask.empty());
+	}
+}
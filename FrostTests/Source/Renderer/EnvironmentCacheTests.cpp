@@ -0,0 +1,147 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Renderer/EnvironmentCache.h"
+
+namespace Frost::Tests
+{
+	static constexpr uint64_t s_TestEnvironmentCacheKey = 0x0F1E2D3C4B5A6978ull;
+
+	static void FillTestCubeMap(EnvironmentCubeMapData& cubeMap, uint32_t size, uint32_t mipCount, Byte seed)
+	{
+		cubeMap.Width = size;
+		cubeMap.Height = size;
+		cubeMap.MipCount = mipCount;
+		cubeMap.Data.Allocate(size * size * 6 * 4);
+		for (uint32_t i = 0; i < cubeMap.Data.Size; i++)
+			cubeMap.Data.As<Byte>()[i] = static_cast<Byte>(i * 3 + seed);
+	}
+
+	static EnvironmentBakeData CreateTestBakeData()
+	{
+		EnvironmentBakeData bakeData;
+		FillTestCubeMap(bakeData.RadianceMap, 8, 4, 1);
+		FillTestCubeMap(bakeData.PrefilteredMap, 8, 4, 2);
+		FillTestCubeMap(bakeData.IrradianceMap, 4, 1, 3);
+		return bakeData;
+	}
+
+	static bool IsSameCubeMap(const EnvironmentCubeMapData& a, const EnvironmentCubeMapData& b)
+	{
+		return a.Width == b.Width && a.Height == b.Height && a.MipCount == b.MipCount &&
+		       a.Data.Size == b.Data.Size && memcmp(a.Data.Data, b.Data.Data, a.Data.Size) == 0;
+	}
+
+	FROST_TEST(EnvironmentCacheKeyDependsOnSourceAndSettings)
+	{
+		Byte sourceBytes[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		Buffer sourceData(sourceBytes, sizeof(sourceBytes));
+
+		EnvironmentBakeSettings settings;
+		settings.EnvironmentMapResolution = 1024;
+		settings.IrradianceMapResolution = 32;
+		settings.IrradianceMapSamples = 180;
+		settings.Format = ImageFormat::RGBA32F;
+
+		uint64_t key = EnvironmentCache::GetCacheKey(sourceData, settings);
+		FROST_CHECK(key == EnvironmentCache::GetCacheKey(sourceData, settings));
+
+		// Every bake setting (and the HDR content) is part of the key
+		EnvironmentBakeSettings otherSettings = settings;
+		otherSettings.EnvironmentMapResolution = 2048;
+		FROST_CHECK(key != EnvironmentCache::GetCacheKey(sourceData, otherSettings));
+
+		otherSettings = settings;
+		otherSettings.IrradianceMapResolution = 64;
+		FROST_CHECK(key != EnvironmentCache::GetCacheKey(sourceData, otherSettings));
+
+		otherSettings = settings;
+		otherSettings.IrradianceMapSamples = 181;
+		FROST_CHECK(key != EnvironmentCache::GetCacheKey(sourceData, otherSettings));
+
+		otherSettings = settings;
+		otherSettings.Format = ImageFormat::RGBA16F;
+		FROST_CHECK(key != EnvironmentCache::GetCacheKey(sourceData, otherSettings));
+
+		sourceBytes[7] = 9;
+		FROST_CHECK(key != EnvironmentCache::GetCacheKey(sourceData, settings));
+	}
+
+	FROST_TEST(EnvironmentCacheRoundTrip)
+	{
+		EnvironmentBakeData bakeData = CreateTestBakeData();
+		Buffer cacheBuffer = EnvironmentCache::Serialize(s_TestEnvironmentCacheKey, bakeData);
+		FROST_CHECK(cacheBuffer);
+
+		EnvironmentBakeData loadedData;
+		FROST_CHECK(EnvironmentCache::Deserialize(s_TestEnvironmentCacheKey, cacheBuffer, loadedData));
+		FROST_CHECK(IsSameCubeMap(loadedData.RadianceMap, bakeData.RadianceMap));
+		FROST_CHECK(IsSameCubeMap(loadedData.PrefilteredMap, bakeData.PrefilteredMap));
+		FROST_CHECK(IsSameCubeMap(loadedData.IrradianceMap, bakeData.IrradianceMap));
+
+		// Entries of another key are never returned
+		EnvironmentBakeData otherKeyData;
+		FROST_CHECK(!EnvironmentCache::Deserialize(s_TestEnvironmentCacheKey + 1, cacheBuffer, otherKeyData));
+
+		loadedData.Release();
+		cacheBuffer.Release();
+		bakeData.Release();
+	}
+
+	FROST_TEST(EnvironmentCacheSkipsIncompleteBakes)
+	{
+		EnvironmentBakeData bakeData = CreateTestBakeData();
+		bakeData.IrradianceMap.Data.Release();
+
+		Buffer cacheBuffer = EnvironmentCache::Serialize(s_TestEnvironmentCacheKey, bakeData);
+		FROST_CHECK(!cacheBuffer);
+
+		bakeData.Release();
+	}
+
+	FROST_TEST(EnvironmentCacheRejectsCorruptedEntries)
+	{
+		EnvironmentBakeData bakeData = CreateTestBakeData();
+		Buffer cacheBuffer = EnvironmentCache::Serialize(s_TestEnvironmentCacheKey, bakeData);
+		bakeData.Release();
+
+		// Lets `corrupt` modify a copy of the entry and returns whether it was still accepted
+		auto deserializeCorrupted = [&](auto corrupt)
+		{
+			Buffer corruptedBuffer;
+			corruptedBuffer.Allocate(cacheBuffer.Size);
+			corruptedBuffer.Write(cacheBuffer.Data, cacheBuffer.Size);
+			uint32_t allocatedSize = corruptedBuffer.Size;
+
+			corrupt(corruptedBuffer);
+
+			EnvironmentBakeData loadedData;
+			bool isValid = EnvironmentCache::Deserialize(s_TestEnvironmentCacheKey, corruptedBuffer, loadedData);
+
+			loadedData.Release();
+			corruptedBuffer.Size = allocatedSize;
+			corruptedBuffer.Release();
+			return isValid;
+		};
+
+		FROST_CHECK(deserializeCorrupted([](Buffer& buffer) {}));
+		FROST_CHECK(!deserializeCorrupted([](Buffer& buffer) { buffer.Read<EnvironmentCacheHeader>().Magic ^= 1; }));
+		FROST_CHECK(!deserializeCorrupted([](Buffer& buffer) { buffer.Read<EnvironmentCacheHeader>().Version += 1; }));
+
+		// The cubemap sizes have to add up to the data size, so the cubemaps can't read past each other
+		FROST_CHECK(!deserializeCorrupted([](Buffer& buffer) { buffer.Read<EnvironmentCacheHeader>().CubeMaps[0].DataSize += 4; }));
+		FROST_CHECK(!deserializeCorrupted([](Buffer& buffer)
+		{
+			EnvironmentCacheHeader& header = buffer.Read<EnvironmentCacheHeader>();
+			header.CubeMaps[0].DataSize += 4;
+			header.CubeMaps[2].DataSize -= 4;
+		}));
+		FROST_CHECK(!deserializeCorrupted([](Buffer& buffer) { buffer.Read<EnvironmentCacheHeader>().CubeMaps[1].MipCount += 1; }));
+
+		FROST_CHECK(!deserializeCorrupted([](Buffer& buffer) { buffer.As<Byte>()[buffer.Size - 1] ^= 0x80; }));
+		FROST_CHECK(!deserializeCorrupted([](Buffer& buffer) { buffer.Size -= 1; }));
+		FROST_CHECK(!deserializeCorrupted([](Buffer& buffer) { buffer.Size = sizeof(EnvironmentCacheHeader) - 1; }));
+
+		cacheBuffer.Release();
+	}
+}
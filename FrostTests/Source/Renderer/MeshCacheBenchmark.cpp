@@ -0,0 +1,84 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Renderer/MeshCache.h"
+
+#include <chrono>
+#include <filesystem>
+
+namespace Frost::Tests
+{
+	// Meshes of the editor's resources (the tests run from their project directory)
+	static constexpr const char* s_BenchmarkMeshPaths[] = {
+		"../FrostEditor/Resources/Meshes/.Default/Sphere.fbx",
+		"../FrostEditor/Resources/Meshes/MedievalBuilding.obj",
+		"../FrostEditor/Resources/Meshes/VulkanModel.obj",
+		"../FrostEditor/Resources/Meshes/Sponza/Sponza.gltf"
+	};
+
+	// Loading a mesh the first time (Assimp import, meshoptimizer passes and LODs, then cooking it)
+	// against every other time (reading the cooked mesh back)
+	FROST_BENCHMARK(MeshCacheImportVsCookedLoad)
+	{
+		static constexpr uint32_t s_CookedLoadCount = 10;
+
+		// A directory of its own, so the project's cache isn't needed (nor touched)
+		std::filesystem::path cacheDirectory = std::filesystem::temp_directory_path() / "FrostMeshCacheBenchmark";
+		std::filesystem::create_directories(cacheDirectory);
+
+		for (const char* meshPath : s_BenchmarkMeshPaths)
+		{
+			if (!std::filesystem::exists(meshPath))
+			{
+				FROST_CORE_WARN("    Skipped '{0}', it was not found", meshPath);
+				continue;
+			}
+
+			std::filesystem::path cacheFilepath = cacheDirectory / (std::filesystem::path(meshPath).stem().string() + ".fmesh");
+
+			auto start = std::chrono::high_resolution_clock::now();
+			Ref<MeshAsset> importedMesh = Ref<MeshAsset>::Create();
+			Vector<MeshAsset::MaterialSlot> importedMaterialSlots;
+			bool isImported = MeshCache::Import(meshPath, *importedMesh, importedMaterialSlots);
+			auto end = std::chrono::high_resolution_clock::now();
+			double importSeconds = std::chrono::duration<double>(end - start).count();
+
+			FROST_CHECK(isImported);
+			if (!isImported)
+				continue;
+
+			start = std::chrono::high_resolution_clock::now();
+			FROST_CHECK(MeshCache::StoreEntry(cacheFilepath, meshPath, *importedMesh, importedMaterialSlots));
+			end = std::chrono::high_resolution_clock::now();
+			double storeSeconds = std::chrono::duration<double>(end - start).count();
+
+			start = std::chrono::high_resolution_clock::now();
+			for (uint32_t i = 0; i < s_CookedLoadCount; i++)
+			{
+				Ref<MeshAsset> cookedMesh = Ref<MeshAsset>::Create();
+				Vector<MeshAsset::MaterialSlot> cookedMaterialSlots;
+				FROST_CHECK(MeshCache::LoadEntry(cacheFilepath, meshPath, *cookedMesh, cookedMaterialSlots));
+
+				// The cooked mesh has to be the same as the imported one
+				FROST_CHECK(cookedMesh->GetVertices().size() == importedMesh->GetVertices().size());
+				FROST_CHECK(cookedMesh->GetIndices().size() == importedMesh->GetIndices().size());
+				FROST_CHECK(cookedMesh->GetSubMeshes().size() == importedMesh->GetSubMeshes().size());
+				FROST_CHECK(cookedMesh->GetLODCount() == importedMesh->GetLODCount());
+				FROST_CHECK(cookedMaterialSlots.size() == importedMaterialSlots.size());
+			}
+			end = std::chrono::high_resolution_clock::now();
+			double cookedSeconds = std::chrono::duration<double>(end - start).count() / s_CookedLoadCount;
+
+			std::error_code errorCode;
+			uint64_t cookedSize = std::filesystem::file_size(cacheFilepath, errorCode);
+
+			FROST_CORE_INFO("    {0}: {1} vertices, {2} submeshes, {3} LODs, {4} KB cooked", std::filesystem::path(meshPath).filename().string(),
+				importedMesh->GetVertices().size(), importedMesh->GetSubMeshes().size(), importedMesh->GetLODCount(), cookedSize / 1024);
+			FROST_CORE_INFO("        Import:      {0:.3f} ms (+ {1:.3f} ms to cook it)", importSeconds * 1000.0, storeSeconds * 1000.0);
+			FROST_CORE_INFO("        Cooked load: {0:.3f} ms ({1:.1f}x faster)", cookedSeconds * 1000.0, importSeconds / cookedSeconds);
+		}
+
+		std::error_code errorCode;
+		std::filesystem::remove_all(cacheDirectory, errorCode);
+	}
+}
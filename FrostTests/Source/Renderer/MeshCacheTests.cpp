@@ -0,0 +1,143 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Renderer/MeshCacheFormat.h"
+
+namespace Frost::Tests
+{
+	static constexpr uint64_t s_TestSourceStamp = 0xFEDCBA9876543210ull;
+
+	struct MeshCacheTestVertex
+	{
+		float Position[3];
+		uint32_t BoneIndex;
+	};
+
+	static Vector<Byte> WriteTestEntry()
+	{
+		MeshCacheWriter writer;
+		writer.WriteArray(Vector<MeshCacheTestVertex>{ { { 1.0f, 2.0f, 3.0f }, 4 }, { { -1.0f, 0.5f, 0.0f }, 7 } });
+		writer.WriteArray(Vector<uint32_t>{ 0, 1, 2, 2, 1, 0 });
+		writer.WriteArray(Vector<uint32_t>{});
+		writer.WriteString("Submesh_0");
+		writer.Write(42.0f);
+		writer.FinishEntry(s_TestSourceStamp, true);
+		return writer.GetData();
+	}
+
+	static MeshCacheEntryStatus ValidateTestEntry(const Vector<Byte>& entry, uint64_t sourceStamp = s_TestSourceStamp)
+	{
+		MeshCacheHeader header;
+		return MeshCacheReader::ValidateEntry(entry.data(), entry.size(), sourceStamp, header);
+	}
+
+	static MeshCacheHeader& GetTestEntryHeader(Vector<Byte>& entry)
+	{
+		return *reinterpret_cast<MeshCacheHeader*>(entry.data());
+	}
+
+	FROST_TEST(MeshCacheRoundTrip)
+	{
+		Vector<Byte> entry = WriteTestEntry();
+
+		MeshCacheHeader header;
+		FROST_CHECK(MeshCacheReader::ValidateEntry(entry.data(), entry.size(), s_TestSourceStamp, header) == MeshCacheEntryStatus::Valid);
+		FROST_CHECK(header.IsAnimated == 1);
+		FROST_CHECK(header.DataSize == entry.size() - sizeof(MeshCacheHeader));
+
+		MeshCacheReader reader(entry.data() + sizeof(MeshCacheHeader), header.DataSize);
+
+		Vector<MeshCacheTestVertex> vertices;
+		FROST_CHECK(reader.ReadArray(vertices));
+		FROST_CHECK(vertices.size() == 2);
+		FROST_CHECK(vertices[1].Position[1] == 0.5f && vertices[1].BoneIndex == 7);
+
+		Vector<uint32_t> indices;
+		FROST_CHECK(reader.ReadArray(indices));
+		FROST_CHECK((indices == Vector<uint32_t>{ 0, 1, 2, 2, 1, 0 }));
+
+		Vector<uint32_t> emptyArray{ 5 };
+		FROST_CHECK(reader.ReadArray(emptyArray));
+		FROST_CHECK(emptyArray.empty());
+
+		std::string name;
+		FROST_CHECK(reader.ReadString(name));
+		FROST_CHECK(name == "Submesh_0");
+		FROST_CHECK(reader.Read<float>() == 42.0f);
+
+		FROST_CHECK(!reader.HasFailed());
+		FROST_CHECK(reader.IsAtEnd());
+	}
+
+	FROST_TEST(MeshCacheReaderFailsPastTheEnd)
+	{
+		Vector<Byte> entry = WriteTestEntry();
+		uint64_t dataSize = entry.size() - sizeof(MeshCacheHeader);
+
+		// Cut in the middle of the first array
+		MeshCacheReader truncatedReader(entry.data() + sizeof(MeshCacheHeader), 4 + sizeof(MeshCacheTestVertex));
+		Vector<MeshCacheTestVertex> vertices;
+		FROST_CHECK(!truncatedReader.ReadArray(vertices));
+		FROST_CHECK(truncatedReader.HasFailed());
+
+		// Once failed, every following read fails as well (and returns zeroed values)
+		FROST_CHECK(truncatedReader.Read<uint32_t>() == 0);
+		FROST_CHECK(truncatedReader.HasFailed());
+
+		// An element count that is bigger than the rest of the data isn't trusted
+		MeshCacheWriter writer;
+		writer.Write(UINT32_MAX);
+		writer.FinishEntry(s_TestSourceStamp, false);
+		Vector<Byte>& badCountEntry = writer.GetData();
+
+		MeshCacheReader badCountReader(badCountEntry.data() + sizeof(MeshCacheHeader), badCountEntry.size() - sizeof(MeshCacheHeader));
+		Vector<uint32_t> values;
+		FROST_CHECK(!badCountReader.ReadArray(values));
+		FROST_CHECK(values.empty());
+
+		std::string str;
+		MeshCacheReader badStringReader(badCountEntry.data() + sizeof(MeshCacheHeader), badCountEntry.size() - sizeof(MeshCacheHeader));
+		FROST_CHECK(!badStringReader.ReadString(str));
+
+		// Reading only a part of the data doesn't reach the end
+		MeshCacheReader reader(entry.data() + sizeof(MeshCacheHeader), dataSize);
+		reader.ReadArray(vertices);
+		FROST_CHECK(!reader.IsAtEnd());
+	}
+
+	FROST_TEST(MeshCacheRejectsBadHeader)
+	{
+		Vector<Byte> entry = WriteTestEntry();
+		GetTestEntryHeader(entry).Magic ^= 1;
+		FROST_CHECK(ValidateTestEntry(entry) == MeshCacheEntryStatus::Corrupted);
+
+		// An entry of another version is treated as corrupted even if its source stamp differs, so it gets deleted
+		entry = WriteTestEntry();
+		GetTestEntryHeader(entry).Version += 1;
+		FROST_CHECK(ValidateTestEntry(entry) == MeshCacheEntryStatus::Corrupted);
+		FROST_CHECK(ValidateTestEntry(entry, s_TestSourceStamp + 1) == MeshCacheEntryStatus::Corrupted);
+
+		entry = WriteTestEntry();
+		GetTestEntryHeader(entry).DataSize -= 1;
+		FROST_CHECK(ValidateTestEntry(entry) == MeshCacheEntryStatus::Corrupted);
+
+		entry.resize(sizeof(MeshCacheHeader) - 1);
+		FROST_CHECK(ValidateTestEntry(entry) == MeshCacheEntryStatus::Corrupted);
+
+		MeshCacheHeader header;
+		FROST_CHECK(MeshCacheReader::ValidateEntry(nullptr, 0, s_TestSourceStamp, header) == MeshCacheEntryStatus::Corrupted);
+	}
+
+	FROST_TEST(MeshCacheDetectsOutdatedAndCorruptedEntries)
+	{
+		Vector<Byte> entry = WriteTestEntry();
+		FROST_CHECK(ValidateTestEntry(entry, s_TestSourceStamp + 1) == MeshCacheEntryStatus::Outdated);
+
+		entry.back() ^= 0x10;
+		FROST_CHECK(ValidateTestEntry(entry) == MeshCacheEntryStatus::Corrupted);
+
+		entry = WriteTestEntry();
+		entry.pop_back();
+		FROST_CHECK(ValidateTestEntry(entry) == MeshCacheEntryStatus::Corrupted);
+	}
+}
@@ -0,0 +1,146 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Renderer/RenderCommandQueue.h"
+#include "Frost/Core/JobSystem.h"
+
+#include <random>
+
+namespace Frost::Tests
+{
+	struct RecordedCommand
+	{
+		uint32_t Lane;
+		uint32_t Sequence;
+		Vector<std::pair<uint32_t, uint32_t>>* Output;
+	};
+
+	static void RecordCommand(void* payload)
+	{
+		RecordedCommand* command = static_cast<RecordedCommand*>(payload);
+		command->Output->push_back({ command->Lane, command->Sequence });
+	}
+
+	// Records `commandCount` commands into every lane from its own thread, with the threads started in a random order
+	static Vector<std::pair<uint32_t, uint32_t>> RecordAndExecute(RenderCommandQueue& queue, uint32_t laneCount, uint32_t commandCount, uint32_t seed)
+	{
+		Vector<std::pair<uint32_t, uint32_t>> output;
+
+		Vector<uint32_t> laneOrder(laneCount);
+		for (uint32_t i = 0; i < laneCount; i++)
+			laneOrder[i] = i;
+		std::shuffle(laneOrder.begin(), laneOrder.end(), std::mt19937(seed));
+
+		Vector<std::thread> threads;
+		for (uint32_t lane : laneOrder)
+		{
+			threads.emplace_back([&queue, &output, lane, commandCount]()
+			{
+				for (uint32_t i = 0; i < commandCount; i++)
+				{
+					void* payload = queue.AllocateInLane(lane, RecordCommand, sizeof(RecordedCommand), alignof(RecordedCommand));
+					new (payload) RecordedCommand{ lane, i, &output };
+				}
+			});
+		}
+
+		// The owner thread records as well, its commands always come first
+		for (uint32_t i = 0; i < commandCount; i++)
+		{
+			void* payload = queue.Allocate(RecordCommand, sizeof(RecordedCommand), alignof(RecordedCommand));
+			new (payload) RecordedCommand{ UINT32_MAX, i, &output };
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		queue.MergeThreadLanes();
+		queue.Execute();
+		return output;
+	}
+
+	FROST_TEST(RenderCommandLanesMergeInLaneOrder)
+	{
+		static constexpr uint32_t s_LaneCount = 8;
+		static constexpr uint32_t s_CommandCount = 2000;
+
+		// Small chunks, so every lane spans over several chunks
+		RenderCommandQueue queue(4 * 1024);
+
+		Vector<std::pair<uint32_t, uint32_t>> firstOutput = RecordAndExecute(queue, s_LaneCount, s_CommandCount, 0);
+		FROST_CHECK(firstOutput.size() == (s_LaneCount + 1) * s_CommandCount);
+
+		// Owner commands first, then every lane in order, each one in recording order
+		bool ordered = true;
+		for (uint32_t i = 0; i < firstOutput.size(); i++)
+		{
+			uint32_t expectedLane = i < s_CommandCount ? UINT32_MAX : (i / s_CommandCount - 1);
+			ordered &= firstOutput[i].first == expectedLane && firstOutput[i].second == i % s_CommandCount;
+		}
+		FROST_CHECK(ordered);
+
+		// Whatever the thread scheduling is, the merged order stays the same
+		for (uint32_t round = 1; round < 20; round++)
+			FROST_CHECK(RecordAndExecute(queue, s_LaneCount, s_CommandCount, round) == firstOutput);
+	}
+
+	FROST_TEST(RenderCommandLanesKeepPayloadsAligned)
+	{
+		RenderCommandQueue queue(1024);
+
+		std::atomic<uint32_t> misalignedCount = 0;
+		std::atomic<uint32_t> executedCount = 0;
+		static std::atomic<uint32_t>* s_ExecutedCount = nullptr;
+		s_ExecutedCount = &executedCount;
+
+		Vector<std::thread> threads;
+		for (uint32_t lane = 0; lane < 4; lane++)
+		{
+			threads.emplace_back([&queue, &misalignedCount, lane]()
+			{
+				for (uint32_t i = 0; i < 1000; i++)
+				{
+					// Alignments from 4 to 64 bytes and sizes up to 2KB (bigger than a chunk)
+					uint32_t alignment = 4u << (i % 5);
+					uint32_t size = (i * 37) % 2048 + 1;
+					void* payload = queue.AllocateInLane(lane, [](void*) { s_ExecutedCount->fetch_add(1); }, size, alignment);
+					if (reinterpret_cast<uintptr_t>(payload) % alignment != 0)
+						misalignedCount++;
+					memset(payload, 0xCD, size);
+				}
+			});
+		}
+		for (auto& thread : threads)
+			thread.join();
+
+		queue.MergeThreadLanes();
+		FROST_CHECK(queue.GetCommandCount() == 4000);
+		queue.Execute();
+
+		FROST_CHECK(misalignedCount == 0);
+		FROST_CHECK(executedCount == 4000);
+		FROST_CHECK(queue.GetCommandCount() == 0);
+	}
+
+	FROST_TEST(RenderCommandWorkerLanesAreMerged)
+	{
+		JobSystem::Init(4);
+
+		RenderCommandQueue queue;
+		static std::atomic<uint32_t> s_ExecutedCount = 0;
+		s_ExecutedCount = 0;
+
+		// Job workers record implicitly into their own lane (the main thread helps while waiting, so it records into the queue itself)
+		JobSystem::ParallelFor(10'000, [&queue](uint32_t)
+		{
+			queue.Allocate([](void*) { s_ExecutedCount++; }, sizeof(uint32_t));
+		}, 64);
+
+		queue.MergeThreadLanes();
+		FROST_CHECK(queue.GetCommandCount() == 10'000);
+		queue.Execute();
+		FROST_CHECK(s_ExecutedCount == 10'000);
+
+		JobSystem::ShutDown();
+	}
+}
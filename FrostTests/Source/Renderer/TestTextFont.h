@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Frost/Renderer/UserInterface/TextLayout.h"
+
+namespace Frost::Tests
+{
+	// Monospace font without an atlas, for the text layout tests and benchmarks.
+	// The ascender and descender are 0.8 and -0.2 (so the font scale is 1), every glyph is 0.5 wide and advances by 0.6.
+	// Only ASCII characters have glyphs, and "AV" is kerned by -0.2
+	class TestTextFont : public TextLayoutFont
+	{
+	public:
+		virtual TextFontMetrics GetMetrics() const override
+		{
+			return { 0.8, -0.2, 1.2 };
+		}
+
+		virtual bool GetGlyph(char32_t character, TextGlyph& outGlyph) const override
+		{
+			if (character > 127)
+				return false;
+
+			outGlyph.PlaneBounds = character == ' ' ? glm::dvec4(0.0) : glm::dvec4(0.0, -0.2, 0.5, 0.8);
+			outGlyph.AtlasBounds = { character / 128.0, 0.0, (character + 1) / 128.0, 1.0 };
+			outGlyph.Advance = 0.6;
+			return true;
+		}
+
+		virtual double GetAdvance(char32_t character, char32_t nextCharacter, double glyphAdvance) const override
+		{
+			if (character == 'A' && nextCharacter == 'V')
+				return glyphAdvance - 0.2;
+			return glyphAdvance;
+		}
+	};
+}
@@ -0,0 +1,128 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Renderer/TestTextFont.h"
+
+namespace Frost::Tests
+{
+	static bool IsNear(float a, float b)
+	{
+		return std::abs(a - b) < 1e-5f;
+	}
+
+	FROST_TEST(TextLayoutAdvancesAndKerns)
+	{
+		TestTextFont font;
+		Vector<TextGlyphQuad> quads;
+
+		LayoutText(font, "AB", 100.0f, 0.0f, 0.0f, quads);
+		FROST_CHECK(quads.size() == 2);
+		FROST_CHECK(IsNear(quads[0].PlaneBounds.x, 0.0f) && IsNear(quads[0].PlaneBounds.z, 0.5f));
+		FROST_CHECK(IsNear(quads[0].PlaneBounds.y, -0.2f) && IsNear(quads[0].PlaneBounds.w, 0.8f));
+		FROST_CHECK(IsNear(quads[1].PlaneBounds.x, 0.6f));
+		FROST_CHECK(IsNear(quads[1].AtlasBounds.x, 'B' / 128.0f));
+
+		// The kerning offset is added to every advance
+		LayoutText(font, "AB", 100.0f, 0.0f, 0.1f, quads);
+		FROST_CHECK(IsNear(quads[1].PlaneBounds.x, 0.7f));
+
+		// The font's own kerning
+		LayoutText(font, "AV", 100.0f, 0.0f, 0.0f, quads);
+		FROST_CHECK(IsNear(quads[1].PlaneBounds.x, 0.4f));
+	}
+
+	FROST_TEST(TextLayoutBreaksLines)
+	{
+		TestTextFont font;
+		Vector<TextGlyphQuad> quads;
+
+		// Explicit new line (the offset is added to the font's line height)
+		LayoutText(font, "A\nB", 100.0f, 0.5f, 0.0f, quads);
+		FROST_CHECK(quads.size() == 2);
+		FROST_CHECK(IsNear(quads[1].PlaneBounds.x, 0.0f));
+		FROST_CHECK(IsNear(quads[1].PlaneBounds.y, -0.2f - 1.2f - 0.5f));
+
+		// Wrapped at the last space before the glyph which goes over the width (the space itself is dropped)
+		LayoutText(font, "AA AA", 2.0f, 0.0f, 0.0f, quads);
+		FROST_CHECK(quads.size() == 4);
+		FROST_CHECK(IsNear(quads[1].PlaneBounds.x, 0.6f) && IsNear(quads[1].PlaneBounds.y, -0.2f));
+		FROST_CHECK(IsNear(quads[2].PlaneBounds.x, 0.0f) && IsNear(quads[2].PlaneBounds.y, -0.2f - 1.2f));
+		FROST_CHECK(IsNear(quads[3].PlaneBounds.x, 0.6f));
+
+		// Without a space the line can't be wrapped
+		LayoutText(font, "AAAAA", 2.0f, 0.0f, 0.0f, quads);
+		FROST_CHECK(quads.size() == 5);
+		FROST_CHECK(IsNear(quads[4].PlaneBounds.y, -0.2f));
+	}
+
+	FROST_TEST(TextLayoutFallsBackToQuestionMark)
+	{
+		TestTextFont font;
+		Vector<TextGlyphQuad> quads;
+
+		LayoutText(font, "A\xC3\xA9", 100.0f, 0.0f, 0.0f, quads); // "Aé"
+		FROST_CHECK(quads.size() == 2);
+		FROST_CHECK(IsNear(quads[1].AtlasBounds.x, '?' / 128.0f));
+	}
+
+	FROST_TEST(TextLayoutCacheHitsAndMisses)
+	{
+		Ref<TestTextFont> font = Ref<TestTextFont>::Create();
+		Ref<TestTextFont> otherFont = Ref<TestTextFont>::Create();
+
+		TextLayoutCache cache;
+		cache.BeginFrame();
+		const TextLayout& layout = cache.GetTextLayout("Hello", font, 10.0f, 0.0f, 0.0f);
+		FROST_CHECK(layout.Quads.size() == 5);
+		FROST_CHECK(&cache.GetTextLayout("Hello", font, 10.0f, 0.0f, 0.0f) == &layout);
+		FROST_CHECK(cache.GetStats().CacheMisses == 1 && cache.GetStats().CacheHits == 1);
+
+		// Every setting, and the font, is part of the key
+		cache.GetTextLayout("Hello", otherFont, 10.0f, 0.0f, 0.0f);
+		cache.GetTextLayout("Hello", font, 5.0f, 0.0f, 0.0f);
+		cache.GetTextLayout("Hello", font, 10.0f, 1.0f, 0.0f);
+		cache.GetTextLayout("Hello", font, 10.0f, 0.0f, 1.0f);
+		cache.GetTextLayout("Hello!", font, 10.0f, 0.0f, 0.0f);
+		FROST_CHECK(cache.GetStats().CacheMisses == 6);
+		FROST_CHECK(cache.GetCachedLayoutCount() == 6);
+
+		// The cached layouts keep their font alive
+		FROST_CHECK(otherFont->GetRefCount() == 2);
+		cache.Clear();
+		FROST_CHECK(otherFont->GetRefCount() == 1);
+		FROST_CHECK(cache.GetCachedLayoutCount() == 0);
+
+		// The stats are per frame
+		cache.BeginFrame();
+		FROST_CHECK(cache.GetStats().CacheMisses == 0 && cache.GetStats().CacheHits == 0);
+	}
+
+	FROST_TEST(TextLayoutCacheEvictsLeastRecentlyUsed)
+	{
+		Ref<TestTextFont> font = Ref<TestTextFont>::Create();
+		TextLayoutCache cache;
+
+		for (uint32_t frame = 0; frame < 10; frame++)
+		{
+			cache.BeginFrame();
+			cache.GetTextLayout(std::to_string(frame), font, 10.0f, 0.0f, 0.0f);
+			cache.GetTextLayout("Always", font, 10.0f, 0.0f, 0.0f);
+			cache.EvictLayouts(4);
+		}
+
+		FROST_CHECK(cache.GetCachedLayoutCount() == 4);
+		FROST_CHECK(cache.GetStats().EvictedLayouts == 1);
+		FROST_CHECK(cache.GetStats().CachedLayouts == 4);
+
+		// The ones used in the last frames are still cached
+		cache.BeginFrame();
+		cache.GetTextLayout("Always", font, 10.0f, 0.0f, 0.0f);
+		cache.GetTextLayout("9", font, 10.0f, 0.0f, 0.0f);
+		cache.GetTextLayout("8", font, 10.0f, 0.0f, 0.0f);
+		cache.GetTextLayout("7", font, 10.0f, 0.0f, 0.0f);
+		FROST_CHECK(cache.GetStats().CacheHits == 4);
+
+		cache.GetTextLayout("0", font, 10.0f, 0.0f, 0.0f);
+		FROST_CHECK(cache.GetStats().CacheMisses == 1);
+	}
+}
@@ -0,0 +1,94 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Renderer/TextureCache.h"
+
+namespace Frost::Tests
+{
+	static constexpr uint64_t s_TestCacheKey = 0x1234567890ABCDEFull;
+
+	static CompressedTextureData CreateTestTextureData()
+	{
+		CompressedTextureData textureData;
+		textureData.Width = 64;
+		textureData.Height = 32;
+		textureData.MipCount = 3;
+		textureData.Format = ImageFormat::BC3;
+		textureData.Data.Allocate(256);
+		for (uint32_t i = 0; i < textureData.Data.Size; i++)
+			textureData.Data.As<Byte>()[i] = static_cast<Byte>(i * 7);
+		return textureData;
+	}
+
+	// Serializes the test texture, lets `corrupt` modify the entry and returns whether it was still accepted
+	template<typename Func>
+	static bool DeserializeCorrupted(Func corrupt)
+	{
+		CompressedTextureData textureData = CreateTestTextureData();
+		Buffer cacheBuffer = TextureCache::Serialize(s_TestCacheKey, textureData);
+		textureData.Data.Release();
+
+		corrupt(cacheBuffer);
+
+		CompressedTextureData loadedData;
+		bool isValid = TextureCache::Deserialize(s_TestCacheKey, cacheBuffer, loadedData);
+		cacheBuffer.Release();
+		free(loadedData.Data.Data);
+		return isValid;
+	}
+
+	FROST_TEST(TextureCacheRoundTrip)
+	{
+		CompressedTextureData textureData = CreateTestTextureData();
+		Buffer cacheBuffer = TextureCache::Serialize(s_TestCacheKey, textureData);
+		FROST_CHECK(cacheBuffer.Size == sizeof(TextureCacheHeader) + textureData.Data.Size);
+
+		CompressedTextureData loadedData;
+		FROST_CHECK(TextureCache::Deserialize(s_TestCacheKey, cacheBuffer, loadedData));
+		FROST_CHECK(loadedData.Width == textureData.Width);
+		FROST_CHECK(loadedData.Height == textureData.Height);
+		FROST_CHECK(loadedData.MipCount == textureData.MipCount);
+		FROST_CHECK(loadedData.Format == textureData.Format);
+		FROST_CHECK(loadedData.Data.Size == textureData.Data.Size);
+		FROST_CHECK(memcmp(loadedData.Data.Data, textureData.Data.Data, textureData.Data.Size) == 0);
+
+		free(loadedData.Data.Data);
+		cacheBuffer.Release();
+		textureData.Data.Release();
+	}
+
+	FROST_TEST(TextureCacheRejectsOtherKey)
+	{
+		CompressedTextureData textureData = CreateTestTextureData();
+		Buffer cacheBuffer = TextureCache::Serialize(s_TestCacheKey, textureData);
+
+		CompressedTextureData loadedData;
+		FROST_CHECK(!TextureCache::Deserialize(s_TestCacheKey + 1, cacheBuffer, loadedData));
+		FROST_CHECK(!loadedData.Data);
+
+		cacheBuffer.Release();
+		textureData.Data.Release();
+	}
+
+	FROST_TEST(TextureCacheRejectsBadHeader)
+	{
+		FROST_CHECK(!DeserializeCorrupted([](Buffer& buffer) { buffer.Read<TextureCacheHeader>().Magic ^= 1; }));
+		FROST_CHECK(!DeserializeCorrupted([](Buffer& buffer) { buffer.Read<TextureCacheHeader>().Version += 1; }));
+		FROST_CHECK(!DeserializeCorrupted([](Buffer& buffer) { buffer.Read<TextureCacheHeader>().DataSize += 1; }));
+
+		// The texture description is covered by the hash as well
+		FROST_CHECK(!DeserializeCorrupted([](Buffer& buffer) { buffer.Read<TextureCacheHeader>().Width *= 2; }));
+		FROST_CHECK(!DeserializeCorrupted([](Buffer& buffer) { buffer.Read<TextureCacheHeader>().MipCount += 1; }));
+		FROST_CHECK(!DeserializeCorrupted([](Buffer& buffer) { buffer.Read<TextureCacheHeader>().Format = static_cast<uint32_t>(ImageFormat::RGBA_BC1); }));
+	}
+
+	FROST_TEST(TextureCacheRejectsCorruptedData)
+	{
+		// A flipped bit in the compressed data doesn't match the stored hash anymore
+		FROST_CHECK(!DeserializeCorrupted([](Buffer& buffer) { buffer.As<Byte>()[sizeof(TextureCacheHeader) + 10] ^= 0x10; }));
+
+		// Truncated entries (a crash while writing) are rejected, down to a size smaller than the header
+		FROST_CHECK(!DeserializeCorrupted([](Buffer& buffer) { buffer.Size -= 1; }));
+		FROST_CHECK(!DeserializeCorrupted([](Buffer& buffer) { buffer.Size = sizeof(TextureCacheHeader) - 1; }));
+	}
+}
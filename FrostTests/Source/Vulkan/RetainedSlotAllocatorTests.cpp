@@ -0,0 +1,140 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Platform/Vulkan/Buffers/RetainedSlotAllocator.h"
+
+namespace Frost::Tests
+{
+	static bool HasFreeRanges(const RetainedSlotAllocator& allocator, const Vector<RetainedSlotRange>& expectedRanges)
+	{
+		const Vector<RetainedSlotRange>& freeRanges = allocator.GetFreeRanges();
+		if (freeRanges.size() != expectedRanges.size())
+			return false;
+
+		for (size_t i = 0; i < freeRanges.size(); i++)
+		{
+			if (freeRanges[i].Offset != expectedRanges[i].Offset || freeRanges[i].Size != expectedRanges[i].Size)
+				return false;
+		}
+		return true;
+	}
+
+	// Allocates `count` ranges of `size` slots next to each other, starting from 0
+	static void AllocateConsecutiveRanges(RetainedSlotAllocator& allocator, uint32_t count, uint32_t size)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t offset = UINT32_MAX;
+			FROST_CHECK(allocator.Allocate(size, UINT32_MAX, offset));
+			FROST_CHECK(offset == i * size);
+		}
+	}
+
+	FROST_TEST(RetainedSlotsAllocateFromTop)
+	{
+		RetainedSlotAllocator allocator;
+		allocator.Init(100);
+
+		AllocateConsecutiveRanges(allocator, 4, 25);
+		FROST_CHECK(allocator.GetTop() == 100);
+
+		uint32_t offset;
+		FROST_CHECK(!allocator.Allocate(1, UINT32_MAX, offset));
+		FROST_CHECK(allocator.GetFreeRanges().empty());
+	}
+
+	FROST_TEST(RetainedSlotsMergeFreedNeighbours)
+	{
+		RetainedSlotAllocator allocator;
+		allocator.Init(1000);
+		AllocateConsecutiveRanges(allocator, 6, 10); // [0, 60)
+
+		allocator.Free(10, 10);
+		allocator.Free(30, 10);
+		FROST_CHECK(HasFreeRanges(allocator, { { 10, 10 }, { 30, 10 } }));
+
+		// Merged with the next range
+		allocator.Free(0, 10);
+		FROST_CHECK(HasFreeRanges(allocator, { { 0, 20 }, { 30, 10 } }));
+
+		// Merged with the previous range
+		allocator.Free(40, 10);
+		FROST_CHECK(HasFreeRanges(allocator, { { 0, 20 }, { 30, 20 } }));
+
+		// Merged with both, which leaves a single range
+		allocator.Free(20, 10);
+		FROST_CHECK(HasFreeRanges(allocator, { { 0, 50 } }));
+		FROST_CHECK(allocator.GetTop() == 60);
+	}
+
+	FROST_TEST(RetainedSlotsGiveBackToTop)
+	{
+		RetainedSlotAllocator allocator;
+		allocator.Init(1000);
+		AllocateConsecutiveRanges(allocator, 4, 10); // [0, 40)
+
+		allocator.Free(20, 10);
+		FROST_CHECK(allocator.GetTop() == 40);
+
+		// Freeing the last range merges it with [20, 30) and the whole range goes back to the top
+		allocator.Free(30, 10);
+		FROST_CHECK(allocator.GetFreeRanges().empty());
+		FROST_CHECK(allocator.GetTop() == 20);
+
+		allocator.Free(0, 10);
+		allocator.Free(10, 10);
+		FROST_CHECK(allocator.GetFreeRanges().empty());
+		FROST_CHECK(allocator.GetTop() == 0);
+
+		// Empty ranges are ignored
+		allocator.Free(0, 0);
+		FROST_CHECK(allocator.GetFreeRanges().empty());
+	}
+
+	FROST_TEST(RetainedSlotsFirstFitAndSplit)
+	{
+		RetainedSlotAllocator allocator;
+		allocator.Init(1000);
+		AllocateConsecutiveRanges(allocator, 5, 10); // [0, 50)
+
+		allocator.Free(0, 10);
+		allocator.Free(20, 20);
+		FROST_CHECK(HasFreeRanges(allocator, { { 0, 10 }, { 20, 20 } }));
+
+		// Too big for the first free range, so it's taken from the start of the second one
+		uint32_t offset;
+		FROST_CHECK(allocator.Allocate(15, UINT32_MAX, offset));
+		FROST_CHECK(offset == 20);
+		FROST_CHECK(HasFreeRanges(allocator, { { 0, 10 }, { 35, 5 } }));
+
+		// Fits exactly, so the range is removed
+		FROST_CHECK(allocator.Allocate(10, UINT32_MAX, offset));
+		FROST_CHECK(offset == 0);
+		FROST_CHECK(HasFreeRanges(allocator, { { 35, 5 } }));
+
+		// Nothing free is big enough, so it comes from the top
+		FROST_CHECK(allocator.Allocate(6, UINT32_MAX, offset));
+		FROST_CHECK(offset == 50);
+		FROST_CHECK(allocator.GetTop() == 56);
+	}
+
+	FROST_TEST(RetainedSlotsRespectLimit)
+	{
+		RetainedSlotAllocator allocator;
+		allocator.Init(1000);
+		AllocateConsecutiveRanges(allocator, 5, 10); // [0, 50)
+
+		// Compaction of the last range [40, 50) only accepts a range that ends before its current offset
+		allocator.Free(25, 10);
+		uint32_t offset;
+		FROST_CHECK(!allocator.Allocate(10, 30, offset));
+		FROST_CHECK(HasFreeRanges(allocator, { { 25, 10 } }));
+		FROST_CHECK(allocator.GetTop() == 50);
+
+		FROST_CHECK(allocator.Allocate(10, 40, offset));
+		FROST_CHECK(offset == 25);
+		allocator.Free(40, 10);
+		FROST_CHECK(allocator.GetFreeRanges().empty());
+		FROST_CHECK(allocator.GetTop() == 40);
+	}
+}
@@ -0,0 +1,110 @@
+#include "frostpch.h"
+#include "FrostTest.h"
+
+#include "Frost/Platform/Vulkan/Buffers/UploadRingAllocator.h"
+
+namespace Frost::Tests
+{
+	FROST_TEST(UploadRingAllocatesAligned)
+	{
+		UploadRingAllocator ring;
+		ring.Init(1024);
+
+		uint64_t offset = UINT64_MAX;
+		FROST_CHECK(ring.Allocate(100, 256, offset));
+		FROST_CHECK(offset == 0);
+		FROST_CHECK(ring.Allocate(100, 256, offset));
+		FROST_CHECK(offset == 256);
+		FROST_CHECK(ring.GetUsedSize() == 356);
+	}
+
+	FROST_TEST(UploadRingWrapsAround)
+	{
+		UploadRingAllocator ring;
+		ring.Init(1024);
+
+		uint64_t offset;
+		FROST_CHECK(ring.Allocate(512, 256, offset) && offset == 0);
+		ring.CloseBatch(1);
+		FROST_CHECK(ring.Allocate(256, 256, offset) && offset == 512);
+		ring.CloseBatch(2);
+
+		ring.RetireBatches(1);
+		FROST_CHECK(ring.GetUsedSize() == 256);
+
+		// 400 bytes don't fit between 768 and the end of the ring, so the end is skipped and the allocation starts at 0
+		FROST_CHECK(ring.Allocate(400, 256, offset));
+		FROST_CHECK(offset == 0);
+		FROST_CHECK(ring.GetUsedSize() == 256 + 256 + 400);
+
+		// The space of batch 2 (512..768) is still in use
+		FROST_CHECK(!ring.Allocate(256, 256, offset));
+
+		ring.CloseBatch(3);
+		ring.RetireBatches(2);
+		FROST_CHECK(ring.Allocate(256, 256, offset) && offset == 512);
+	}
+
+	FROST_TEST(UploadRingRejectsWhenFull)
+	{
+		UploadRingAllocator ring;
+		ring.Init(1024);
+
+		uint64_t offset;
+		FROST_CHECK(ring.Allocate(1024, 256, offset) && offset == 0);
+		FROST_CHECK(!ring.Allocate(1, 1, offset));
+
+		// Closing the batch doesn't free anything, only retiring it does
+		ring.CloseBatch(1);
+		FROST_CHECK(!ring.Allocate(1, 1, offset));
+		FROST_CHECK(ring.GetUsedSize() == 1024);
+
+		ring.RetireBatches(1);
+		FROST_CHECK(ring.GetUsedSize() == 0);
+		FROST_CHECK(ring.Allocate(1024, 256, offset) && offset == 0);
+	}
+
+	FROST_TEST(UploadRingRetiresOutOfOrderBatchIDs)
+	{
+		UploadRingAllocator ring;
+		ring.Init(1024);
+
+		uint64_t offset;
+		FROST_CHECK(ring.Allocate(256, 256, offset));
+		ring.CloseBatch(2);
+		FROST_CHECK(ring.Allocate(256, 256, offset));
+		ring.CloseBatch(5);
+		FROST_CHECK(ring.Allocate(256, 256, offset));
+		ring.CloseBatch(9);
+
+		// A completed ID older than every batch frees nothing
+		ring.RetireBatches(1);
+		FROST_CHECK(ring.GetUsedSize() == 768);
+
+		// Batch IDs don't have to be contiguous, everything up to the completed ID is freed
+		ring.RetireBatches(7);
+		FROST_CHECK(ring.GetUsedSize() == 256);
+
+		// Retiring an older ID again (e.g. a stale completion) never moves the tail backwards
+		ring.RetireBatches(5);
+		FROST_CHECK(ring.GetUsedSize() == 256);
+
+		ring.RetireBatches(9);
+		FROST_CHECK(ring.GetUsedSize() == 0);
+	}
+
+	FROST_TEST(UploadRingRejectsOversizeRequests)
+	{
+		UploadRingAllocator ring;
+		ring.Init(1024);
+
+		uint64_t offset = UINT64_MAX;
+		FROST_CHECK(!ring.Allocate(1025, 256, offset));
+		FROST_CHECK(!ring.Allocate(0, 256, offset));
+		FROST_CHECK(offset == UINT64_MAX);
+		FROST_CHECK(ring.GetUsedSize() == 0);
+
+		// A failed request leaves the ring untouched
+		FROST_CHECK(ring.Allocate(1024, 256, offset) && offset == 0);
+	}
+}
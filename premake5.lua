@@ -217,6 +217,7 @@ project "Frost"
 		defines "FROST_RELEASE"
 		runtime "Release"
 		optimize "on"
+		vectorextensions "AVX2"
 
 		defines
 		{
@@ -228,6 +229,7 @@ project "Frost"
 		defines "FROST_DIST"
 		runtime "Release"
 		optimize "on"
+		vectorextensions "AVX2"
 
 		defines
 		{
@@ -327,6 +329,7 @@ project "FrostEditor"
 		defines "FROST_RELEASE"
 		runtime "Release"
 		optimize "on"
+		vectorextensions "AVX2"
 
 		defines
 		{
@@ -337,8 +340,94 @@ project "FrostEditor"
 		defines "FROST_DIST"
 		runtime "Release"
 		optimize "on"
+		vectorextensions "AVX2"
 
 		defines
 		{
 			"NDEBUG"
-		}
\ No newline at end of file
+		}
+
+project "FrostTests"
+	location "FrostTests"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "off"
+
+	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"%{prj.name}/Source/**.h",
+		"%{prj.name}/Source/**.cpp"
+	}
+
+	defines
+	{
+		"GLM_FORCE_DEPTH_ZERO_TO_ONE",
+		"PX_PHYSX_STATIC_LIB" -- The PhysX benchmark includes the PhysX headers
+	}
+
+	includedirs
+	{
+		"%{VULKAN_SDK}/Include",
+		"%{IncludeDir.GLFW}",
+		"%{IncludeDir.glm}",
+		"%{IncludeDir.vma}",
+		"%{IncludeDir.OZZ_Animation}",
+		"%{IncludeDir.ImGui}",
+		"%{IncludeDir.spdlog}",
+		"%{IncludeDir.assimp}",
+		"%{IncludeDir.entt}",
+		"%{IncludeDir.json}",
+		"%{IncludeDir.json}/json",
+		"%{IncludeDir.Compressonator}",
+		"%{IncludeDir.PhysX}",
+
+		"Frost/vendor",
+		"Frost/src/Frost",
+		"Frost/src",
+
+		"FrostTests/Source"
+	}
+
+	links 
+	{
+		"Frost"
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+
+	filter "configurations:Debug"
+		defines "FROST_DEBUG"
+		runtime "Debug"
+		symbols "on"
+
+		defines
+		{
+			"_DEBUG"
+		}
+
+	filter "configurations:Release"
+		defines "FROST_RELEASE"
+		runtime "Release"
+		optimize "on"
+		vectorextensions "AVX2"
+
+		defines
+		{
+			"NDEBUG"
+		}
+
+	filter "configurations:Dist"
+		defines "FROST_DIST"
+		runtime "Release"
+		optimize "on"
+		vectorextensions "AVX2"
+
+		defines
+		{
+			"NDEBUG"
+		}